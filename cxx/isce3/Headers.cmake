@@ -20,6 +20,7 @@ container/RSD.icc
 core/Attitude.h
 core/Baseline.h
 core/Basis.h
+core/BufferPool.h
 core/blockProcessing.h
 core/Common.h
 core/Constants.h
@@ -30,10 +31,12 @@ core/detail/InterpolateOrbit.h
 core/detail/InterpolateOrbit.icc
 core/detail/Interp1d.h
 core/detail/SSOBuffer.h
+core/detail/BlockPipeline.h
 core/Ellipsoid.h
 core/EMatrix.h
 core/EulerAngles.h
 core/forward.h
+core/Instrumentation.h
 core/Interp1d.h
 core/Interp1d.icc
 core/Interp2d.h
@@ -49,6 +52,7 @@ core/LUT1d.icc
 core/LUT2d.h
 core/Matrix.h
 core/Metadata.h
+core/Numa.h
 core/Orbit.h
 core/Peg.h
 core/Pegtrans.h
@@ -86,6 +90,7 @@ focus/GapMask.h
 focus/Presum.h
 focus/Presum.icc
 focus/RangeComp.h
+geocode/AreaProjOperator.h
 geocode/baseband.h
 geocode/geocodeSlc.h
 geometry/DEMInterpolator.h
@@ -98,6 +103,7 @@ geometry/Geo2rdr.icc
 geocode/GeocodeCov.h
 geocode/GeocodeCov.icc
 geocode/GeocodePolygon.h
+geocode/InterpOperator.h
 geometry/geo2rdr_roots.h
 geometry/geometry.h
 geometry/getGeolocationGrid.h
@@ -141,12 +147,15 @@ math/complexOperations.h
 math/Stats.h
 math/detail/RootFind1dBase.h
 math/polyfunc.h
+math/Phasor.h
 math/RootFind1dBracket.h
 math/RootFind1dBracket.icc
 math/RootFind1dNewton.h
 math/RootFind1dSecant.h
 math/Sinc.h
 math/Sinc.icc
+polsar/covariance.h
+polsar/detail/RasterBlocks.h
 polsar/symmetrize.h
 product/forward.h
 product/GeoGridParameters.h
@@ -196,6 +205,7 @@ unwrap/phass/PhaseStatistics.h
 unwrap/phass/Phass.h
 unwrap/phass/Phass.icc
 unwrap/phass/PhassUnwrapper.h
+unwrap/phass/PixelQueue.h
 unwrap/phass/Point.h
 unwrap/phass/RegionMap.h
 unwrap/phass/Seed.h
@@ -10,17 +10,20 @@ core/Baseline.cpp
 core/Basis.cpp
 core/BicubicInterpolator.cpp
 core/BilinearInterpolator.cpp
+core/BufferPool.cpp
 core/blockProcessing.cpp
 core/Constants.cpp
 core/DateTime.cpp
 core/detail/BuildOrbit.cpp
 core/Ellipsoid.cpp
 core/EulerAngles.cpp
+core/Instrumentation.cpp
 core/Interpolator.cpp
 core/LUT2d.cpp
 core/LookSide.cpp
 core/Metadata.cpp
 core/NearestNeighborInterpolator.cpp
+core/Numa.cpp
 core/Orbit.cpp
 core/Pegtrans.cpp
 core/Poly1d.cpp
@@ -42,6 +45,7 @@ focus/DryTroposphereModel.cpp
 focus/GapMask.cpp
 focus/Presum.cpp
 focus/RangeComp.cpp
+geocode/AreaProjOperator.cpp
 geocode/baseband.cpp
 geocode/geocodeSlc.cpp
 geometry/DEMInterpolator.cpp
@@ -49,6 +53,7 @@ geometry/loadDem.cpp
 geometry/Geo2rdr.cpp
 geocode/GeocodeCov.cpp
 geocode/GeocodePolygon.cpp
+geocode/InterpOperator.cpp
 geometry/geo2rdr_roots.cpp
 geometry/geometry.cpp
 geometry/getGeolocationGrid.cpp
@@ -87,9 +92,12 @@ matchtemplate/pycuampcor/cuOverSampler.cpp
 matchtemplate/pycuampcor/cuSincOverSampler.cpp
 math/Bessel.cpp
 math/Stats.cpp
+math/Phasor.cpp
 math/polyfunc.cpp
 math/RootFind1dNewton.cpp
 math/RootFind1dSecant.cpp
+polsar/covariance.cpp
+polsar/detail/RasterBlocks.cpp
 polsar/symmetrize.cpp
 product/RadarGridParameters.cpp
 product/GeoGridParameters.cpp
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
 #include <numeric>
 #include <utility>
 
@@ -10,6 +11,8 @@
 #include <isce3/except/Error.h>
 #include <isce3/focus/RangeComp.h>
 
+#include "detail/WinChirpRgCompPow.h"
+
 namespace isce3 { namespace antenna {
 
 Eigen::ArrayXcd linearInterpComplex1d(
@@ -149,11 +152,17 @@ tuple_echo formEchoNull(const std::vector<std::complex<float>>& chirp_ref,
         const Eigen::Ref<const Eigen::ArrayXcd>& coef_right,
         const Eigen::Ref<const Eigen::ArrayXd>& sr_coef)
 {
-    // form rangecomp obj used for all range comp in forming echo null pattern
-    auto rgc_obj = isce3::focus::RangeComp(chirp_ref, echo_left.cols(), 1,
-            isce3::focus::RangeComp::Mode::Valid);
+    // range lines are processed in parallel by blocks, with one rangecomp
+    // obj per thread
+    const Eigen::Index num_rgl = echo_left.rows();
+    const std::size_t num_blocks =
+            (num_rgl + detail::RGCOMP_PULSE_BATCH - 1) /
+            detail::RGCOMP_PULSE_BATCH;
+    auto rgc_objs = detail::makeRgCompPerThread(
+            chirp_ref, echo_left.cols(), num_blocks);
+    const auto num_threads = static_cast<int>(rgc_objs.size());
     // final number of range bins for the echo after range comp
-    const auto num_rgb_echo = rgc_obj.outputSize();
+    const auto num_rgb_echo = rgc_objs[0]->outputSize();
     // form uniform slant range (m) vector for only valid part of final
     // rangecomp echo
     const auto sr_stop = sr_start + (num_rgb_echo - 1) * sr_spacing;
@@ -185,33 +194,71 @@ tuple_echo formEchoNull(const std::vector<std::complex<float>>& chirp_ref,
         coef_right_limit(idx) = coef_right(idx_coef_vec(idx));
     }
 
-    // initialize the peak-normalized averaged echo null power
-    Eigen::ArrayXd pow_null_avg = Eigen::ArrayXd::Zero(num_rgb_null);
-    // allocate rangeline vector for range compression of left/right echoes
-    Eigen::ArrayXcf rgc_left(num_rgb_echo);
-    Eigen::ArrayXcf rgc_right(num_rgb_echo);
-    // allocate double precision lines for left and right weighted rangecomp
-    // echo within null formation part only
-    Eigen::ArrayXcd line_left(num_rgb_null);
-    Eigen::ArrayXcd line_right(num_rgb_null);
-    // loop over range lines /pulses
-    for (Eigen::Index pulse = 0; pulse < echo_left.rows(); ++pulse) {
-        // range compression of echoes left/right
-        rgc_obj.rangecompress(rgc_left.data(), echo_left.row(pulse).data());
-        rgc_obj.rangecompress(rgc_right.data(), echo_right.row(pulse).data());
-
-        // get the power and add up its double precision version
-        line_left = rgc_left.segment(idx_echo_first, num_rgb_null)
-                            .cast<std::complex<double>>() *
-                    coef_left_limit;
-        line_right = rgc_right.segment(idx_echo_first, num_rgb_null)
-                             .cast<std::complex<double>>() *
-                     coef_right_limit;
-
-        // form the null power to be averaged over range lines
-        pow_null_avg +=
-                (line_left - line_right).abs() / (line_left + line_right).abs();
+    // null power summed by each thread. Thread "ithread" processes blocks
+    // ithread, ithread + num_threads, ... so that the summation order does
+    // not depend on scheduling.
+    std::vector<Eigen::ArrayXd> pow_null_sums(
+            num_threads, Eigen::ArrayXd::Zero(num_rgb_null));
+    std::vector<std::exception_ptr> errors(num_threads);
+
+    _Pragma("omp parallel for schedule(static, 1) num_threads(num_threads)")
+    for (int ithread = 0; ithread < num_threads; ++ithread) {
+        try {
+            auto& rgc_obj = *rgc_objs[ithread];
+            // allocate blocks of range lines for range compression of
+            // left/right echoes
+            isce3::core::EArray2D<std::complex<float>> rgc_left(
+                    detail::RGCOMP_PULSE_BATCH, num_rgb_echo);
+            isce3::core::EArray2D<std::complex<float>> rgc_right(
+                    detail::RGCOMP_PULSE_BATCH, num_rgb_echo);
+            // allocate double precision lines for left and right weighted
+            // rangecomp echo within null formation part only
+            Eigen::ArrayXcd line_left(num_rgb_null);
+            Eigen::ArrayXcd line_right(num_rgb_null);
+            auto& pow_null_sum = pow_null_sums[ithread];
+            for (std::size_t iblock = ithread; iblock < num_blocks;
+                    iblock += num_threads) {
+                const Eigen::Index first_pulse =
+                        iblock * detail::RGCOMP_PULSE_BATCH;
+                const int num_pulses = static_cast<int>(
+                        std::min<Eigen::Index>(detail::RGCOMP_PULSE_BATCH,
+                                num_rgl - first_pulse));
+                // range compression of echoes left/right
+                detail::rangeCompressBlock(rgc_obj, echo_left, first_pulse,
+                        num_pulses, rgc_left.data());
+                detail::rangeCompressBlock(rgc_obj, echo_right, first_pulse,
+                        num_pulses, rgc_right.data());
+
+                // loop over range lines /pulses of the block
+                for (int line = 0; line < num_pulses; ++line) {
+                    line_left = rgc_left.row(line)
+                                        .segment(idx_echo_first, num_rgb_null)
+                                        .transpose()
+                                        .cast<std::complex<double>>() *
+                                coef_left_limit;
+                    line_right = rgc_right.row(line)
+                                         .segment(idx_echo_first, num_rgb_null)
+                                         .transpose()
+                                         .cast<std::complex<double>>() *
+                                 coef_right_limit;
+
+                    // form the null power to be averaged over range lines
+                    pow_null_sum += (line_left - line_right).abs() /
+                                    (line_left + line_right).abs();
+                }
+            }
+        } catch (...) {
+            errors[ithread] = std::current_exception();
+        }
     }
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+
+    // sum up the null power of all threads in order
+    Eigen::ArrayXd pow_null_avg = pow_null_sums[0];
+    for (int ithread = 1; ithread < num_threads; ++ithread)
+        pow_null_avg += pow_null_sums[ithread];
     auto max_pow_null = pow_null_avg.maxCoeff();
     if (!(max_pow_null > pow_null_avg.minCoeff()))
         throw isce3::except::RuntimeError(ISCE_SRCINFO(),
@@ -35,18 +35,10 @@ typename ElPatternEst::tuple5_t ElPatternEst::powerPattern2way(
         double chirp_rate, double chirp_dur, std::optional<double> az_time,
         int size_avg, bool inc_corr) const
 {
-    // get calibrated avreaged two-way power pattern
-    auto [cal_pow, slant_range, look_ang, inc_ang] =
-            _getCalibPowLinear(echo_mat, sr_spacing, chirp_rate, chirp_dur,
-                    az_time, size_avg, inc_corr);
-    // convert to dB
-    cal_pow = 10 * Eigen::log10(cal_pow);
-    // polyfit pow in dB as a function of look angles in rad with centering and
-    // scaling!
-    auto poly1d_obj = isce3::math::polyfitObj(
-            look_ang, cal_pow, _polyfit_deg, _center_scale_pf);
-    // return time-series power in dB scale
-    return {cal_pow, slant_range, look_ang, inc_ang, poly1d_obj};
+    return powerPattern2way(
+            std::vector<Eigen::Ref<const RowMatrixXcf>> {echo_mat},
+            sr_spacing, chirp_rate, chirp_dur, az_time, size_avg, inc_corr)
+            .front();
 }
 
 typename ElPatternEst::tuple5_t ElPatternEst::powerPattern1way(
@@ -54,24 +46,64 @@ typename ElPatternEst::tuple5_t ElPatternEst::powerPattern1way(
         double chirp_rate, double chirp_dur, std::optional<double> az_time,
         int size_avg, bool inc_corr) const
 {
-    // get calibrated avreaged one-way power pattern
-    auto [cal_pow, slant_range, look_ang, inc_ang] =
-            _getCalibPowLinear(echo_mat, sr_spacing, chirp_rate, chirp_dur,
-                    az_time, size_avg, inc_corr);
-    // convert sqrt value to dB
-    cal_pow = 5 * Eigen::log10(cal_pow);
-    // polyfit pow in dB as a function of look angles in rad with centering and
-    // scaling!
-    auto poly1d_obj = isce3::math::polyfitObj(
-            look_ang, cal_pow, _polyfit_deg, _center_scale_pf);
-    // return time-series power in dB scale
-    return {cal_pow, slant_range, look_ang, inc_ang, poly1d_obj};
+    return powerPattern1way(
+            std::vector<Eigen::Ref<const RowMatrixXcf>> {echo_mat},
+            sr_spacing, chirp_rate, chirp_dur, az_time, size_avg, inc_corr)
+            .front();
 }
 
-typename ElPatternEst::tuple4_t ElPatternEst::_getCalibPowLinear(
-        const Eigen::Ref<const RowMatrixXcf>& echo_mat, double sr_spacing,
-        double chirp_rate, double chirp_dur, std::optional<double> az_time,
-        int size_avg, bool inc_corr) const
+std::vector<typename ElPatternEst::tuple5_t> ElPatternEst::powerPattern2way(
+        const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
+        double sr_spacing, double chirp_rate, double chirp_dur,
+        std::optional<double> az_time, int size_avg, bool inc_corr) const
+{
+    // get calibrated avreaged two-way power pattern of all channels
+    auto calib_pows = _getCalibPowLinear(echo_mats, sr_spacing, chirp_rate,
+            chirp_dur, az_time, size_avg, inc_corr);
+    std::vector<tuple5_t> pow_patterns;
+    pow_patterns.reserve(calib_pows.size());
+    for (auto& [cal_pow, slant_range, look_ang, inc_ang] : calib_pows) {
+        // convert to dB
+        cal_pow = 10 * Eigen::log10(cal_pow);
+        // polyfit pow in dB as a function of look angles in rad with
+        // centering and scaling!
+        auto poly1d_obj = isce3::math::polyfitObj(
+                look_ang, cal_pow, _polyfit_deg, _center_scale_pf);
+        // time-series power in dB scale
+        pow_patterns.emplace_back(
+                cal_pow, slant_range, look_ang, inc_ang, poly1d_obj);
+    }
+    return pow_patterns;
+}
+
+std::vector<typename ElPatternEst::tuple5_t> ElPatternEst::powerPattern1way(
+        const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
+        double sr_spacing, double chirp_rate, double chirp_dur,
+        std::optional<double> az_time, int size_avg, bool inc_corr) const
+{
+    // get calibrated avreaged one-way power pattern of all channels
+    auto calib_pows = _getCalibPowLinear(echo_mats, sr_spacing, chirp_rate,
+            chirp_dur, az_time, size_avg, inc_corr);
+    std::vector<tuple5_t> pow_patterns;
+    pow_patterns.reserve(calib_pows.size());
+    for (auto& [cal_pow, slant_range, look_ang, inc_ang] : calib_pows) {
+        // convert sqrt value to dB
+        cal_pow = 5 * Eigen::log10(cal_pow);
+        // polyfit pow in dB as a function of look angles in rad with
+        // centering and scaling!
+        auto poly1d_obj = isce3::math::polyfitObj(
+                look_ang, cal_pow, _polyfit_deg, _center_scale_pf);
+        // time-series power in dB scale
+        pow_patterns.emplace_back(
+                cal_pow, slant_range, look_ang, inc_ang, poly1d_obj);
+    }
+    return pow_patterns;
+}
+
+std::vector<typename ElPatternEst::tuple4_t> ElPatternEst::_getCalibPowLinear(
+        const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
+        double sr_spacing, double chirp_rate, double chirp_dur,
+        std::optional<double> az_time, int size_avg, bool inc_corr) const
 
 {
     // get range sampling frequency
@@ -79,30 +111,37 @@ typename ElPatternEst::tuple4_t ElPatternEst::_getCalibPowLinear(
     // form the reference weighted unit-energy complex chirp
     auto chirp_ref = detail::genRcosWinChirp(
             sample_freq, chirp_rate, chirp_dur, _win_ped);
-    // calculate the mean echo power by averaging over multiple range compressed
-    // range lines
-    auto mean_echo_pow = detail::meanRgCompEchoPower(echo_mat, chirp_ref);
-    // perform averaging over multiple range bins and partially perform relative
-    // radiometric cal by compensating for 2-way range path loss
-    auto [cal_avg_pow, sr] = detail::rangeCalibAvgEchoPower(
-            mean_echo_pow, _sr_start, sr_spacing, size_avg);
-    // estimate look angle and incidence angles per geometry/orbit at az_time
-    auto [look_ang, inc_ang] = isce3::geometry::lookIncAngFromSlantRange(
-            sr, _orbit, az_time, _dem_interp, _ellips);
-    // as part of relative radiometric cal ,perform incidence angle correction
-    // if requested
-    if (inc_corr) {
-        cal_avg_pow *= Eigen::tan(inc_ang);
-        if (inc_ang(0) > 0.0)
-            cal_avg_pow /= std::tan(inc_ang(0));
+    // calculate the mean echo power of all channels by averaging over
+    // multiple range compressed range lines
+    auto mean_echo_pows = detail::meanRgCompEchoPower(echo_mats, chirp_ref);
+
+    std::vector<tuple4_t> calib_pows;
+    calib_pows.reserve(mean_echo_pows.size());
+    for (const auto& mean_echo_pow : mean_echo_pows) {
+        // perform averaging over multiple range bins and partially perform
+        // relative radiometric cal by compensating for 2-way range path loss
+        auto [cal_avg_pow, sr] = detail::rangeCalibAvgEchoPower(
+                mean_echo_pow, _sr_start, sr_spacing, size_avg);
+        // estimate look angle and incidence angles per geometry/orbit at
+        // az_time
+        auto [look_ang, inc_ang] = isce3::geometry::lookIncAngFromSlantRange(
+                sr, _orbit, az_time, _dem_interp, _ellips);
+        // as part of relative radiometric cal ,perform incidence angle
+        // correction if requested
+        if (inc_corr) {
+            cal_avg_pow *= Eigen::tan(inc_ang);
+            if (inc_ang(0) > 0.0)
+                cal_avg_pow /= std::tan(inc_ang(0));
+        }
+        // peak normalize to get relative variation
+        auto peak_pow {cal_avg_pow.maxCoeff()};
+        if (peak_pow > 0.0)
+            cal_avg_pow /= peak_pow;
+        auto slant_range = Linspace_t(
+                sr(0), sr_spacing * size_avg, static_cast<int>(sr.size()));
+        calib_pows.emplace_back(cal_avg_pow, slant_range, look_ang, inc_ang);
     }
-    // peak normalize to get relative variation
-    auto peak_pow {cal_avg_pow.maxCoeff()};
-    if (peak_pow > 0.0)
-        cal_avg_pow /= peak_pow;
-    auto slant_range = Linspace_t(
-            sr(0), sr_spacing * size_avg, static_cast<int>(sr.size()));
-    return {cal_avg_pow, slant_range, look_ang, inc_ang};
+    return calib_pows;
 }
 
 }} // namespace isce3::antenna
@@ -153,6 +153,66 @@ public:
             std::optional<double> az_time = {}, int size_avg = 8,
             bool inc_corr = true) const;
 
+    /**
+     * Estimated averaged two-way time-series power patterns in Elevation of
+     * several RX channels of a data-take at once. The mean echo power of all
+     * the channels is estimated in one multi-threaded pass sharing the
+     * reference chirp, and each channel is then processed as in the
+     * single-channel version.
+     * @param[in] echo_mats raw echo matrices, one per channel, each a
+     * row-major Eigen matrix of type complex float of shape pulses by range
+     * bins. All shall have the same number of range bins.
+     * @param[in] sr_spacing slant range spacing in (m).
+     * @param[in] chirp_rate transmit chirp rate in (Hz/sec).
+     * @param[in] chirp_dur transmit chirp duration in (sec).
+     * @param[in] az_time (optional) relative azimuth time in seconds w.r.t
+     * reference epoch time of orbit object. Default is the mid orbit time if
+     * not specified or if set to {} or std::nullopt.
+     * @param[in] size_avg (optional) the block size for averaging in slant
+     * range direction. Default is 8.
+     * @param[in] inc_corr (optional) whether or not apply correction for
+     * incidence angles. Default is true.
+     * @return vector of the outputs of the single-channel version, one per
+     * channel.
+     * @exception InvalidArgument, LengthError, RuntimeError
+     * @see powerPattern2way()
+     */
+    std::vector<tuple5_t> powerPattern2way(
+            const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
+            double sr_spacing, double chirp_rate, double chirp_dur,
+            std::optional<double> az_time = {}, int size_avg = 8,
+            bool inc_corr = true) const;
+
+    /**
+     * Estimated averaged one-way time-series power patterns in Elevation of
+     * several RX channels of a data-take at once. The mean echo power of all
+     * the channels is estimated in one multi-threaded pass sharing the
+     * reference chirp, and each channel is then processed as in the
+     * single-channel version.
+     * @param[in] echo_mats raw echo matrices, one per channel, each a
+     * row-major Eigen matrix of type complex float of shape pulses by range
+     * bins. All shall have the same number of range bins.
+     * @param[in] sr_spacing slant range spacing in (m).
+     * @param[in] chirp_rate transmit chirp rate in (Hz/sec).
+     * @param[in] chirp_dur transmit chirp duration in (sec).
+     * @param[in] az_time (optional) relative azimuth time in seconds w.r.t
+     * reference epoch time of orbit object. Default is the mid orbit time if
+     * not specified or if set to {} or std::nullopt.
+     * @param[in] size_avg (optional) the block size for averaging in slant
+     * range direction. Default is 8.
+     * @param[in] inc_corr (optional) whether or not apply correction for
+     * incidence angles. Default is true.
+     * @return vector of the outputs of the single-channel version, one per
+     * channel.
+     * @exception InvalidArgument, LengthError, RuntimeError
+     * @see powerPattern1way()
+     */
+    std::vector<tuple5_t> powerPattern1way(
+            const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
+            double sr_spacing, double chirp_rate, double chirp_dur,
+            std::optional<double> az_time = {}, int size_avg = 8,
+            bool inc_corr = true) const;
+
     /**
      * Get raised-cosine window pedestal set at the constructor.
      * @return window pedestal used for weighting ref chirp in
@@ -176,15 +236,16 @@ public:
 private:
     /**
      * Helper method for public methods "powPat1w" and "powPat2w"
-     * @return peak-normalized calibrated averaged 2-way power pattern vector
-     * in linear scale
-     * @return slant ranges in meters in the form of isce3 Linspace object
-     * @return look angles vector in radians.
-     * @return ellipsoidal incidence angles vector in radians.
-     * look angle in radians
+     * @return per echo matrix, a tuple of
+     * peak-normalized calibrated averaged 2-way power pattern vector
+     * in linear scale,
+     * slant ranges in meters in the form of isce3 Linspace object,
+     * look angles vector in radians, and
+     * ellipsoidal incidence angles vector in radians.
      * @see powerPattern2way(), powerPattern1way()
      */
-    tuple4_t _getCalibPowLinear(const Eigen::Ref<const RowMatrixXcf>& echo_mat,
+    std::vector<tuple4_t> _getCalibPowLinear(
+            const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
             double sr_spacing, double chirp_rate, double chirp_dur,
             std::optional<double> az_time, int size_avg, bool inc_corr) const;
 
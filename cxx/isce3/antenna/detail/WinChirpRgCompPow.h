@@ -4,16 +4,24 @@
 #pragma once
 
 #include <complex>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include <isce3/core/EMatrix.h>
+#include <isce3/focus/RangeComp.h>
 
 namespace isce3 { namespace antenna { namespace detail {
 
 // Aliases, typedef:
 using RowMatrixXcf = isce3::core::EMatrix2D<std::complex<float>>;
 
+// Constants:
+
+/** Number of range lines range compressed per FFT batch by the functions
+ * processing echoes block by block */
+constexpr int RGCOMP_PULSE_BATCH = 32;
+
 // Functions:
 
 /**
@@ -75,6 +83,59 @@ Eigen::ArrayXd meanRgCompEchoPower(
         const Eigen::Ref<const RowMatrixXcf>& echo_mat,
         const std::vector<std::complex<float>>& chirp_ref);
 
+/**
+ * Batched version of meanRgCompEchoPower over several echo matrices with
+ * the same number of range bins, e.g. all RX channels of a data-take or both
+ * beams of its null pairs.
+ * The pulses of all the echoes are range compressed in parallel by blocks of
+ * "RGCOMP_PULSE_BATCH" range lines with one range compression object, and
+ * thus one matched filter spectrum, per thread. The power of each block is
+ * accumulated as soon as it is compressed, so no range-compressed matrix is
+ * formed. Summation order only depends on the number of threads.
+ * @param[in] echo_mats raw echo matrices, row-major Eigen matrices of type
+ * complex float, each of shape pulses by range bins. The number of pulses
+ * may differ from one matrix to the next.
+ * @param[in] chirp_ref Basebanded Chirp reference complex float vector used in
+ * range compresssion. Its size shall not be larger than number of range bins.
+ * @return a vector of averaged power over range lines, one per echo matrix,
+ * as returned by meanRgCompEchoPower.
+ * @exception LengthError
+ */
+std::vector<Eigen::ArrayXd> meanRgCompEchoPower(
+        const std::vector<Eigen::Ref<const RowMatrixXcf>>& echo_mats,
+        const std::vector<std::complex<float>>& chirp_ref);
+
+/**
+ * Form the range compression objects of the threads processing echoes by
+ * blocks of "RGCOMP_PULSE_BATCH" range lines in valid mode.
+ * FFT plans are formed serially since the planner is not thread-safe, and
+ * are single-threaded since the threads already run in parallel. Plans
+ * after the first one reuse the FFTW wisdom gathered by the first.
+ * @param[in] chirp_ref Basebanded Chirp reference complex float vector.
+ * @param[in] num_rgb number of range bins of the raw echoes.
+ * @param[in] num_blocks number of blocks of range lines to process.
+ * @return range compression objects, one per thread up to the number
+ * of blocks.
+ */
+std::vector<std::unique_ptr<isce3::focus::RangeComp>> makeRgCompPerThread(
+        const std::vector<std::complex<float>>& chirp_ref, int num_rgb,
+        std::size_t num_blocks);
+
+/**
+ * Range compress a block of consecutive range lines of an echo matrix.
+ * @param[in,out] rgc_obj range compression object with a max batch size of
+ * at least "num_pulses".
+ * @param[in] echo_mat raw echo matrix (pulses by range bins).
+ * @param[in] first_pulse index of the first range line of the block.
+ * @param[in] num_pulses number of range lines of the block.
+ * @param[out] rgc_block range compressed block, a row-major buffer of
+ * at least "num_pulses * rgc_obj.outputSize()" samples.
+ */
+void rangeCompressBlock(isce3::focus::RangeComp& rgc_obj,
+        const Eigen::Ref<const RowMatrixXcf>& echo_mat,
+        Eigen::Index first_pulse, int num_pulses,
+        std::complex<float>* rgc_block);
+
 /**
  * Path-loss corrected/calibrated averaged/decimated uniformly-sampled echo
  * power as a function of slant ranges.
@@ -1,6 +1,9 @@
 // Definition of the antenna-related geometry functions
 #include "geometryfunc.h"
 
+#include <algorithm>
+#include <exception>
+
 #include <isce3/core/Projections.h>
 #include <isce3/core/Quaternion.h>
 #include <isce3/core/Vector.h>
@@ -66,6 +69,87 @@ static std::tuple<double, double, bool> _get_sr_dop_conv(double el_theta,
     return {sr, doppler, convergence};
 }
 
+/**
+ * @internal
+ * Helper function to walk a grid of antenna angles at several azimuth
+ * times, calling "store" with the slant range, ECEF pointing and LLH target
+ * of each angle.
+ * @param[in] el_theta : vector of either elevation or theta angles in
+ * radians depending on the "frame" object.
+ * @param[in] az_phi : vector of either azimuth or phi angles in radians
+ * depending on the "frame" object.
+ * @param[in] pos_ecef : antenna/spacecraft positions in ECEF (m,m,m)
+ * @param[in] quat : isce3 quaternion objects for transformation from antenna
+ * body-fixed to ECEF, one per position
+ * @param[in] dem_interp : isce3 DEMInterpolator object w.r.t ellipsoid.
+ * @param[in] abs_tol : Abs error/tolerance in height estimation (m)
+ * @param[in] max_iter : Max number of iterations in height estimation.
+ * @param[in] frame : isce3 Frame object to define antenna spherical
+ * coordinate system.
+ * @param[in] ellips : isce3 Ellipsoid object defining the ellipsoidal planet.
+ * @param[in] store : callable as store(row, col, time, sr, pnt_ecef, llh)
+ * where row = time * az_phi.size() + index of AZ and col is index of EL.
+ * @return a bool which is true if height tolerance is met for all angles.
+ * @exception InvalidArgument, LengthError, RuntimeError
+ */
+template<typename Store>
+static bool _walk_el_az_grid(const Eigen::Ref<const VecXd>& el_theta,
+        const Eigen::Ref<const VecXd>& az_phi,
+        const std::vector<Vec3>& pos_ecef, const std::vector<Quaternion>& quat,
+        const geom::DEMInterpolator& dem_interp, double abs_tol, int max_iter,
+        const ant::Frame& frame, const Ellipsoid& ellips, Store&& store)
+{
+    if (quat.size() != pos_ecef.size())
+        throw isce3::except::LengthError(ISCE_SRCINFO(),
+                "Number of quaternions must match number of positions!");
+
+    // start of the height iteration of the first angle of each row, once
+    // for the whole grid since it may require a pass over the DEM
+    const double mean_hgt = geom::compute_mean_dem(dem_interp);
+
+    const Eigen::Index el_size = el_theta.size();
+    const Eigen::Index az_size = az_phi.size();
+    const Eigen::Index nrows = az_size * pos_ecef.size();
+    std::vector<char> row_converge(nrows, 1);
+
+    // Exceptions cannot leave the parallel region, so keep the first one
+    // (in row order) and rethrow it afterwards.
+    std::vector<std::exception_ptr> errors(nrows);
+
+    _Pragma("omp parallel for schedule(dynamic)")
+    for (Eigen::Index row = 0; row < nrows; ++row) {
+        try {
+            const auto itime = row / az_size;
+            const auto iaz = row % az_size;
+            // the height of the previous EL angle is the first guess of
+            // the next one
+            double hgt = mean_hgt;
+            for (Eigen::Index iel = 0; iel < el_size; ++iel) {
+                const Vec3 pnt_ecef = quat[itime].rotate(
+                        frame.sphToCart(el_theta[iel], az_phi[iaz]));
+                Vec3 tg_ecef, tg_llh;
+                double sr;
+                auto iter_info = geom::srPosFromLookVecDem(sr, tg_ecef,
+                        tg_llh, pos_ecef[itime], pnt_ecef, dem_interp,
+                        abs_tol, max_iter, ellips, hgt);
+                if (iter_info.second > abs_tol)
+                    row_converge[row] = 0;
+                hgt = tg_llh[2];
+                store(row, iel, itime, sr, pnt_ecef, tg_llh);
+            }
+        } catch (...) {
+            errors[row] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+    return std::all_of(row_converge.begin(), row_converge.end(),
+            [](char flag) { return flag != 0; });
+}
+
 // Antenna to Radar functions
 std::tuple<double, double, bool> ant::ant2rgdop(double el_theta, double az_phi,
         const Vec3& pos_ecef, const Vec3& vel_ecef, const Quaternion& quat,
@@ -115,6 +199,40 @@ std::tuple<VecXd, VecXd, bool> ant::ant2rgdop(
     return {slantrange, doppler, converge};
 }
 
+std::tuple<EArray2D<double>, EArray2D<double>, bool> ant::ant2rgdop(
+        const Eigen::Ref<const VecXd>& el_theta,
+        const Eigen::Ref<const VecXd>& az_phi,
+        const std::vector<Vec3>& pos_ecef, const std::vector<Vec3>& vel_ecef,
+        const std::vector<Quaternion>& quat, double wavelength,
+        const geom::DEMInterpolator& dem_interp, double abs_tol, int max_iter,
+        const ant::Frame& frame, const Ellipsoid& ellips)
+{
+    if (!(wavelength > 0.0))
+        throw isce3::except::InvalidArgument(
+                ISCE_SRCINFO(), "Bad value for wavelength!");
+    if (vel_ecef.size() != pos_ecef.size())
+        throw isce3::except::LengthError(ISCE_SRCINFO(),
+                "Number of velocities must match number of positions!");
+
+    // velocities scaled by 2/wavelength
+    std::vector<Vec3> vel_ecef_cst(vel_ecef.size());
+    for (std::size_t itime = 0; itime < vel_ecef.size(); ++itime)
+        vel_ecef_cst[itime] = (2. / wavelength) * vel_ecef[itime];
+
+    const auto nrows = az_phi.size() * pos_ecef.size();
+    EArray2D<double> slantrange(nrows, el_theta.size());
+    EArray2D<double> doppler(nrows, el_theta.size());
+
+    const bool converge = _walk_el_az_grid(el_theta, az_phi, pos_ecef, quat,
+            dem_interp, abs_tol, max_iter, frame, ellips,
+            [&](Eigen::Index row, Eigen::Index col, std::size_t itime,
+                    double sr, const Vec3& pnt_ecef, const Vec3&) {
+                slantrange(row, col) = sr;
+                doppler(row, col) = vel_ecef_cst[itime].dot(pnt_ecef);
+            });
+    return {slantrange, doppler, converge};
+}
+
 // Antenna to Geometry
 std::tuple<Vec3, bool> ant::ant2geo(double el_theta, double az_phi,
         const Vec3& pos_ecef, const Quaternion& quat,
@@ -161,6 +279,29 @@ std::tuple<std::vector<Vec3>, bool> ant::ant2geo(
     return {tg_llh_vec, converge};
 }
 
+std::tuple<EArray2D<double>, EArray2D<double>, EArray2D<double>, bool>
+ant::ant2geo(const Eigen::Ref<const VecXd>& el_theta,
+        const Eigen::Ref<const VecXd>& az_phi,
+        const std::vector<Vec3>& pos_ecef, const std::vector<Quaternion>& quat,
+        const geom::DEMInterpolator& dem_interp, double abs_tol, int max_iter,
+        const ant::Frame& frame, const Ellipsoid& ellips)
+{
+    const auto nrows = az_phi.size() * pos_ecef.size();
+    EArray2D<double> lon(nrows, el_theta.size());
+    EArray2D<double> lat(nrows, el_theta.size());
+    EArray2D<double> hgt(nrows, el_theta.size());
+
+    const bool converge = _walk_el_az_grid(el_theta, az_phi, pos_ecef, quat,
+            dem_interp, abs_tol, max_iter, frame, ellips,
+            [&](Eigen::Index row, Eigen::Index col, std::size_t, double,
+                    const Vec3&, const Vec3& tg_llh) {
+                lon(row, col) = tg_llh[0];
+                lat(row, col) = tg_llh[1];
+                hgt(row, col) = tg_llh[2];
+            });
+    return {lon, lat, hgt, converge};
+}
+
 Vec3 ant::rangeAzToXyz(double slant_range, double az, const Vec3& pos_ecef,
         const Quaternion& quat, const geom::DEMInterpolator& dem_interp,
         double el_min, double el_max, double el_tol, const ant::Frame& frame)
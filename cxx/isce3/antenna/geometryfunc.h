@@ -11,6 +11,7 @@
 #include <Eigen/Dense>
 
 #include <isce3/antenna/Frame.h>
+#include <isce3/core/EMatrix.h>
 #include <isce3/core/Ellipsoid.h>
 #include <isce3/geometry/DEMInterpolator.h>
 
@@ -95,6 +96,59 @@ std::tuple<Eigen::VectorXd, Eigen::VectorXd, bool> ant2rgdop(
         const isce3::antenna::Frame& frame = {},
         const isce3::core::Ellipsoid& ellips = {});
 
+/**
+ * Batched function to estimate Radar products, Slant ranges and Doppler
+ * centroids, over a grid of spherical angles in antenna body-fixed domain
+ * for several spacecraft positions, velocities and attitudes, e.g. at
+ * several azimuth times, at a certain height w.r.t. an ellipsoid.
+ *
+ * Each (time, azimuth) pair is one row of the outputs, walked along
+ * elevation by one thread, and the rows are processed in parallel. The
+ * height iteration of each angle starts from the height found for the
+ * previous angle of its row rather than from the mean DEM height, so the
+ * results agree with those of the scalar function within "abs_tol" while
+ * taking fewer iterations when "el_theta" is ordered.
+ * @param[in] el_theta : a vector of either elevation or theta angles in
+ * radians depending on the "frame" object.
+ * @param[in] az_phi : a vector of either azimuth or phi angles in radians
+ * depending on the "frame" object.
+ * @param[in] pos_ecef : antenna/spacecraft positions in ECEF (m,m,m), one
+ * per azimuth time.
+ * @param[in] vel_ecef : spacecraft velocities in ECEF (m/s,m/s,m/s), one
+ * per azimuth time.
+ * @param[in] quat : isce3 quaternion objects for transformation from
+ * antenna body-fixed to ECEF, one per azimuth time.
+ * @param[in] wavelength : Radar wavelength in (m).
+ * @param[in] dem_interp (optional): isce3 DEMInterpolator object
+ * w.r.t ellipsoid. Default is zero height.
+ * @param[in] abs_tol (optional): Abs error/tolerance in height estimation (m)
+ * between desired input height and final output height. Default is 0.5.
+ * @param[in] max_iter (optional): Max number of iterations in height
+ * estimation. Default is 10.
+ * @param[in] frame (optional): isce3 Frame object to define antenna spherical
+ *  coordinate system. Default is based on "EL_AND_AZ" spherical grid.
+ * @param[in] ellips (optional): isce3 Ellipsoid object defining the
+ * ellipsoidal planet. Default is WGS84 ellipsoid.
+ * @return an array of slant ranges (m) of shape
+ * (times * az_phi.size(), el_theta.size()), whose row "t * az_phi.size() + j"
+ * holds the time "t" and the angle "az_phi[j]"
+ * @return an array of Doppler values (Hz) of the same shape
+ * @return a bool which is true if height tolerance is met for all the
+ * angles, false otherwise.
+ * @exception InvalidArgument, LengthError, RuntimeError
+ * @cite ReeTechDesDoc
+ */
+std::tuple<isce3::core::EArray2D<double>, isce3::core::EArray2D<double>, bool>
+ant2rgdop(const Eigen::Ref<const Eigen::VectorXd>& el_theta,
+        const Eigen::Ref<const Eigen::VectorXd>& az_phi,
+        const std::vector<isce3::core::Vec3>& pos_ecef,
+        const std::vector<isce3::core::Vec3>& vel_ecef,
+        const std::vector<isce3::core::Quaternion>& quat, double wavelength,
+        const isce3::geometry::DEMInterpolator& dem_interp = {},
+        double abs_tol = 0.5, int max_iter = 10,
+        const isce3::antenna::Frame& frame = {},
+        const isce3::core::Ellipsoid& ellips = {});
+
 // Antenna to Geometry
 
 /**
@@ -167,6 +221,54 @@ std::tuple<std::vector<isce3::core::Vec3>, bool> ant2geo(
         const isce3::antenna::Frame& frame = {},
         const isce3::core::Ellipsoid& ellips = {});
 
+/**
+ * Batched function to estimate geodetic geolocation
+ * (longitude, latitude, height) over a grid of spherical angles in antenna
+ * body-fixed domain for several spacecraft positions and attitudes, e.g. at
+ * several azimuth times, at a certain height w.r.t. an ellipsoid.
+ *
+ * The grid is processed as in the batched "ant2rgdop", in parallel over
+ * (time, azimuth) rows with the height iteration of each angle started from
+ * the previous angle of its row.
+ * @param[in] el_theta : a vector of either elevation or theta angles in
+ * radians depending on the "frame" object.
+ * @param[in] az_phi : a vector of either azimuth or phi angles in radians
+ * depending on the "frame" object.
+ * @param[in] pos_ecef : antenna/spacecraft positions in ECEF (m,m,m), one
+ * per azimuth time.
+ * @param[in] quat : isce3 quaternion objects for transformation from
+ * antenna body-fixed to ECEF, one per azimuth time.
+ * @param[in] dem_interp (optional): isce3 DEMInterpolator object
+ * w.r.t ellipsoid. Default is zero height.
+ * @param[in] abs_tol (optional): Abs error/tolerance in height estimation (m)
+ * between desired input height and final output height. Default is 0.5.
+ * @param[in] max_iter (optional): Max number of iterations in height
+ * estimation. Default is 10.
+ * @param[in] frame (optional): isce3 Frame object to define antenna spherical
+ *  coordinate system. Default is based on "EL_AND_AZ" spherical grid.
+ * @param[in] ellips (optional): isce3 Ellipsoid object defining the
+ * ellipsoidal planet. Default is WGS84 ellipsoid.
+ * @return an array of geodetic longitudes (rad) of shape
+ * (times * az_phi.size(), el_theta.size()), whose row "t * az_phi.size() + j"
+ * holds the time "t" and the angle "az_phi[j]"
+ * @return an array of geodetic latitudes (rad) of the same shape
+ * @return an array of heights (m) of the same shape
+ * @return a bool which is true if height tolerance is met for all the
+ * angles, false otherwise.
+ * @exception InvalidArgument, LengthError, RuntimeError
+ * @cite ReeTechDesDoc
+ */
+std::tuple<isce3::core::EArray2D<double>, isce3::core::EArray2D<double>,
+        isce3::core::EArray2D<double>, bool>
+ant2geo(const Eigen::Ref<const Eigen::VectorXd>& el_theta,
+        const Eigen::Ref<const Eigen::VectorXd>& az_phi,
+        const std::vector<isce3::core::Vec3>& pos_ecef,
+        const std::vector<isce3::core::Quaternion>& quat,
+        const isce3::geometry::DEMInterpolator& dem_interp = {},
+        double abs_tol = 0.5, int max_iter = 10,
+        const isce3::antenna::Frame& frame = {},
+        const isce3::core::Ellipsoid& ellips = {});
+
 /** Compute target position given range and AZ angle by varying EL until height
  *  matches DEM.
  *
@@ -0,0 +1,222 @@
+#include "BufferPool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <isce3/core/Instrumentation.h>
+
+namespace isce3 { namespace core {
+
+namespace {
+
+// Size classes per power of two
+constexpr int CLASSES_PER_OCTAVE = 4;
+
+// NUMA node of the CPU running the calling thread, 0 if unknown
+int currentNode()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+// Allocate a page-aligned buffer and touch each of its pages
+void* allocatePrefaulted(std::size_t size)
+{
+    void* data = std::aligned_alloc(BUFFER_POOL_ALIGNMENT, size);
+    if (data == nullptr) {
+        throw std::bad_alloc();
+    }
+    auto bytes = static_cast<volatile char*>(data);
+    for (std::size_t offset = 0; offset < size;
+            offset += BUFFER_POOL_ALIGNMENT) {
+        bytes[offset] = 0;
+    }
+    return data;
+}
+
+} // namespace
+
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        _pool = std::exchange(other._pool, nullptr);
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+        _node = other._node;
+    }
+    return *this;
+}
+
+void PooledBuffer::release()
+{
+    if (_pool != nullptr) {
+        _pool->_release(_data, _size, _node);
+        _pool = nullptr;
+        _data = nullptr;
+        _size = 0;
+    }
+}
+
+BufferPool::~BufferPool() { trim(); }
+
+BufferPool& BufferPool::instance()
+{
+    static BufferPool pool;
+    return pool;
+}
+
+std::size_t BufferPool::sizeClass(std::size_t bytes)
+{
+    if (bytes <= BUFFER_POOL_MIN_CLASS) {
+        return BUFFER_POOL_MIN_CLASS;
+    }
+    // smallest m * 2^k >= bytes with m in [CLASSES_PER_OCTAVE, 2 *
+    // CLASSES_PER_OCTAVE)
+    std::size_t step = BUFFER_POOL_MIN_CLASS / CLASSES_PER_OCTAVE;
+    while (bytes > 2 * CLASSES_PER_OCTAVE * step) {
+        step *= 2;
+    }
+    return (bytes + step - 1) / step * step;
+}
+
+PooledBuffer BufferPool::acquire(std::size_t bytes)
+{
+    PooledBuffer buffer;
+    if (bytes == 0) {
+        return buffer;
+    }
+    const std::size_t size = sizeClass(bytes);
+    const int node = currentNode();
+
+    void* data = nullptr;
+    int dataNode = node;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // idle buffer of the local node, otherwise of any node
+        auto it = _idle.find({node, size});
+        if (it == _idle.end() || it->second.empty()) {
+            it = std::find_if(_idle.begin(), _idle.end(), [size](auto& kv) {
+                return kv.first.second == size && !kv.second.empty();
+            });
+        }
+        if (it != _idle.end() && !it->second.empty()) {
+            data = it->second.back();
+            it->second.pop_back();
+            dataNode = it->first.first;
+            ++_stats.hits;
+        } else {
+            ++_stats.misses;
+            _stats.bytesReserved += size;
+        }
+        _stats.bytesInUse += size;
+        _stats.highWaterBytes =
+                std::max(_stats.highWaterBytes, _stats.bytesInUse);
+    }
+
+    if (data == nullptr) {
+        instrumentation::count("buffer_pool.bytes_allocated", size);
+        try {
+            data = allocatePrefaulted(size);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stats.bytesInUse -= size;
+            _stats.bytesReserved -= size;
+            throw;
+        }
+    }
+
+    buffer._pool = this;
+    buffer._data = data;
+    buffer._size = size;
+    buffer._node = dataNode;
+    return buffer;
+}
+
+void BufferPool::_release(void* data, std::size_t size, int node)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stats.bytesInUse -= size;
+        const std::size_t idleBytes = _stats.bytesReserved - _stats.bytesInUse;
+        if (idleBytes <= _maxIdleBytes) {
+            _idle[{node, size}].push_back(data);
+            return;
+        }
+        _stats.bytesReserved -= size;
+    }
+    // over the cap: return the buffer to the system
+    std::free(data);
+}
+
+void BufferPool::trim(std::size_t maxIdle)
+{
+    std::vector<void*> freed;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::size_t idleBytes = _stats.bytesReserved - _stats.bytesInUse;
+        // size classes are the second key, so visit the largest first
+        std::vector<std::pair<int, std::size_t>> keys;
+        for (const auto& kv : _idle) {
+            keys.push_back(kv.first);
+        }
+        std::stable_sort(keys.begin(), keys.end(), [](auto& a, auto& b) {
+            return a.second > b.second;
+        });
+        for (const auto& key : keys) {
+            auto& buffers = _idle[key];
+            while (idleBytes > maxIdle && !buffers.empty()) {
+                freed.push_back(buffers.back());
+                buffers.pop_back();
+                idleBytes -= key.second;
+                _stats.bytesReserved -= key.second;
+            }
+            if (buffers.empty()) {
+                _idle.erase(key);
+            }
+        }
+    }
+    for (void* data : freed) {
+        std::free(data);
+    }
+}
+
+std::size_t BufferPool::maxIdleBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxIdleBytes;
+}
+
+void BufferPool::maxIdleBytes(std::size_t bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _maxIdleBytes = bytes;
+    }
+    trim(bytes);
+}
+
+BufferPoolStats BufferPool::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+void BufferPool::resetHighWater()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats.highWaterBytes = _stats.bytesInUse;
+}
+
+}} // namespace isce3::core
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <isce3/core/EMatrix.h>
+
+namespace isce3 { namespace core {
+
+/** Smallest buffer size class (bytes) */
+constexpr static std::size_t BUFFER_POOL_MIN_CLASS = 1 << 16;
+
+/** Alignment of pooled buffers (bytes), one page */
+constexpr static std::size_t BUFFER_POOL_ALIGNMENT = 4096;
+
+/** Default cap (bytes) on the idle buffers kept by a BufferPool */
+constexpr static std::size_t BUFFER_POOL_DEFAULT_MAX_IDLE = std::size_t(1)
+                                                            << 30; // 1GB
+
+/** Usage statistics of a BufferPool */
+struct BufferPoolStats {
+    /** Bytes of the buffers currently borrowed */
+    std::size_t bytesInUse = 0;
+    /** Largest value of bytesInUse since the pool was created or the high
+     * water mark was reset */
+    std::size_t highWaterBytes = 0;
+    /** Bytes allocated from the system, borrowed or idle */
+    std::size_t bytesReserved = 0;
+    /** Number of requests served by an idle buffer */
+    std::uint64_t hits = 0;
+    /** Number of requests that allocated a new buffer */
+    std::uint64_t misses = 0;
+};
+
+class BufferPool;
+
+/** A buffer borrowed from a BufferPool, returned to it on destruction */
+class PooledBuffer {
+public:
+    PooledBuffer() = default;
+
+    PooledBuffer(PooledBuffer&& other) noexcept { *this = std::move(other); }
+
+    PooledBuffer& operator=(PooledBuffer&& other) noexcept;
+
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+    ~PooledBuffer() { release(); }
+
+    /** Start of the buffer, aligned to BUFFER_POOL_ALIGNMENT */
+    void* data() const { return _data; }
+
+    /** Size (bytes) of the buffer, i.e. of its size class */
+    std::size_t size() const { return _size; }
+
+    /** Return the buffer to its pool before the end of its scope */
+    void release();
+
+private:
+    friend class BufferPool;
+
+    BufferPool* _pool = nullptr;
+    void* _data = nullptr;
+    std::size_t _size = 0;
+    int _node = 0;
+};
+
+/**
+ * Pool of large, page-aligned buffers reused across processing blocks.
+ *
+ * Requests are rounded up to a size class, with four classes per power of
+ * two above BUFFER_POOL_MIN_CLASS so that at most 25% of a buffer is unused.
+ * New buffers are pre-faulted by the requesting thread, which places their
+ * pages on the NUMA node of that thread under the default first-touch policy.
+ * Returned buffers are kept per NUMA node and size class, and a request is
+ * served by an idle buffer of the node of the calling thread when there is
+ * one, then by an idle buffer of another node, and only then by a new
+ * allocation. For each size class the pool holds no more buffers than were
+ * ever borrowed at once. A returned buffer is freed instead of kept when the
+ * idle buffers would exceed maxIdleBytes(), and trim() frees idle buffers on
+ * demand.
+ */
+class BufferPool {
+public:
+    BufferPool() = default;
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /** Free all the idle buffers. The pool must outlive its borrowed
+     * buffers. */
+    ~BufferPool();
+
+    /** Pool shared by the processing loops */
+    static BufferPool& instance();
+
+    /** Borrow a buffer of at least the given size (bytes). The contents of
+     * the buffer are unspecified. */
+    PooledBuffer acquire(std::size_t bytes);
+
+    /** Free idle buffers, largest first, until at most maxIdle bytes of them
+     * remain */
+    void trim(std::size_t maxIdle = 0);
+
+    /** Get the cap (bytes) on the idle buffers kept by the pool */
+    std::size_t maxIdleBytes() const;
+
+    /** Set the cap (bytes) on the idle buffers kept by the pool, freeing
+     * idle buffers above it */
+    void maxIdleBytes(std::size_t bytes);
+
+    /** Current usage statistics */
+    BufferPoolStats stats() const;
+
+    /** Restart the high water mark from the bytes currently in use */
+    void resetHighWater();
+
+    /** Size class (bytes) of a request */
+    static std::size_t sizeClass(std::size_t bytes);
+
+private:
+    friend class PooledBuffer;
+
+    void _release(void* data, std::size_t size, int node);
+
+    mutable std::mutex _mutex;
+    // idle buffers keyed by NUMA node and size class
+    std::map<std::pair<int, std::size_t>, std::vector<void*>> _idle;
+    BufferPoolStats _stats;
+    std::size_t _maxIdleBytes = BUFFER_POOL_DEFAULT_MAX_IDLE;
+};
+
+namespace detail {
+// Holds the buffer of a PooledArray2D, as a base class so that it is
+// acquired before the Eigen::Map base is constructed
+struct PooledStorage {
+    PooledBuffer buffer;
+};
+} // namespace detail
+
+/**
+ * Row-major 2D array whose storage is borrowed from a BufferPool.
+ *
+ * Behaves as an Eigen::Map of an EArray2D, so it can be passed wherever an
+ * Eigen::Ref<EArray2D<T>> is expected. Elements are not initialized.
+ */
+template<typename T>
+class PooledArray2D : private detail::PooledStorage,
+                      public Eigen::Map<EArray2D<T>> {
+    static_assert(std::is_trivially_destructible_v<T>,
+            "pooled arrays only hold trivially destructible elements");
+
+public:
+    using Base = Eigen::Map<EArray2D<T>>;
+    using Base::operator=;
+
+    PooledArray2D(Eigen::Index rows, Eigen::Index cols,
+            BufferPool& pool = BufferPool::instance())
+        : detail::PooledStorage {pool.acquire(sizeof(T) * rows * cols)},
+          Base(static_cast<T*>(buffer.data()), rows, cols)
+    {}
+
+    PooledArray2D(const PooledArray2D&) = delete;
+    PooledArray2D& operator=(const PooledArray2D&) = delete;
+
+    /** Number of rows, as isce3::core::Matrix */
+    std::size_t length() const { return this->rows(); }
+
+    /** Number of columns, as isce3::core::Matrix */
+    std::size_t width() const { return this->cols(); }
+};
+
+}} // namespace isce3::core
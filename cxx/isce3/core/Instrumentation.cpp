@@ -0,0 +1,324 @@
+#include "Instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+
+#include <isce3/except/Error.h>
+
+namespace isce3 { namespace core { namespace instrumentation {
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+// Per-thread storage. Each thread only writes to its own record, so the
+// record mutex is uncontended except while a report is being merged.
+struct ThreadRecord {
+    std::mutex mutex;
+    int id = 0;
+    std::map<std::string, Histogram, std::less<>> timers;
+    std::map<std::string, std::int64_t, std::less<>> counters;
+    std::map<std::string, Histogram, std::less<>> histograms;
+    std::vector<TraceEvent> events;
+};
+
+// Records are shared with the registry so that the instrumentation of
+// threads that have exited is still reported.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadRecord>> threads;
+};
+
+bool enabledFromEnvironment()
+{
+    const char* value = std::getenv("ISCE3_INSTRUMENTATION");
+    return value != nullptr && *value != '\0' && std::string(value) != "0";
+}
+
+std::atomic<bool> g_enabled {enabledFromEnvironment()};
+std::atomic<bool> g_tracing {false};
+std::atomic<clock::rep> g_epoch {clock::now().time_since_epoch().count()};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+ThreadRecord& threadRecord()
+{
+    thread_local std::shared_ptr<ThreadRecord> record;
+    if (!record) {
+        record = std::make_shared<ThreadRecord>();
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        record->id = static_cast<int>(reg.threads.size());
+        reg.threads.push_back(record);
+    }
+    return *record;
+}
+
+// Get the entry of a map without constructing a key for existing names
+template<class Map>
+typename Map::mapped_type& entry(Map& map, const char* name)
+{
+    const std::string_view key(name);
+    auto it = map.find(key);
+    if (it == map.end()) {
+        it = map.emplace(std::string(key), typename Map::mapped_type {})
+                     .first;
+    }
+    return it->second;
+}
+
+double microseconds(clock::time_point t)
+{
+    const clock::duration since_epoch =
+            t.time_since_epoch() - clock::duration(g_epoch.load());
+    return std::chrono::duration<double, std::micro>(since_epoch).count();
+}
+
+void writeEscaped(std::ostream& os, const std::string& s)
+{
+    os << '"';
+    for (const char c : s) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+void writeHistogram(std::ostream& os, const Histogram& h)
+{
+    os << "{\"count\": " << h.count << ", \"sum\": " << h.sum
+       << ", \"mean\": " << h.sum / h.count << ", \"min\": " << h.min
+       << ", \"max\": " << h.max << ", \"bins\": [";
+    bool first = true;
+    for (int k = 0; k < HISTOGRAM_BINS; ++k) {
+        if (h.bins[k] == 0) {
+            continue;
+        }
+        os << (first ? "" : ", ") << "{\"lower\": "
+           << Histogram::binLowerEdge(k) << ", \"count\": " << h.bins[k]
+           << "}";
+        first = false;
+    }
+    os << "]}";
+}
+
+void writeHistograms(std::ostream& os,
+        const std::map<std::string, Histogram>& histograms)
+{
+    os << "{";
+    bool first = true;
+    for (const auto& [name, h] : histograms) {
+        os << (first ? "\n" : ",\n") << "    ";
+        writeEscaped(os, name);
+        os << ": ";
+        writeHistogram(os, h);
+        first = false;
+    }
+    os << (first ? "}" : "\n  }");
+}
+
+void writeFile(const std::string& filename, const std::string& contents)
+{
+    std::ofstream file(filename);
+    if (!file) {
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(),
+                "unable to open instrumentation output file " + filename);
+    }
+    file << contents;
+}
+
+} // namespace
+
+void Histogram::add(double value)
+{
+    ++count;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+
+    int k = 0;
+    if (value > 0.0) {
+        k = std::ilogb(value) - HISTOGRAM_MIN_EXPONENT;
+        k = std::clamp(k, 0, HISTOGRAM_BINS - 1);
+    }
+    ++bins[k];
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    for (int k = 0; k < HISTOGRAM_BINS; ++k) {
+        bins[k] += other.bins[k];
+    }
+}
+
+double Histogram::binLowerEdge(int k)
+{
+    return std::ldexp(1.0, k + HISTOGRAM_MIN_EXPONENT);
+}
+
+void enable(bool flag, bool trace)
+{
+    g_enabled = flag;
+    g_tracing = flag && trace;
+}
+
+bool enabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+bool tracing() { return g_tracing.load(std::memory_order_relaxed); }
+
+void reset()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& record : reg.threads) {
+        std::lock_guard<std::mutex> record_lock(record->mutex);
+        record->timers.clear();
+        record->counters.clear();
+        record->histograms.clear();
+        record->events.clear();
+    }
+    g_epoch = clock::now().time_since_epoch().count();
+}
+
+void count(const char* name, std::int64_t value)
+{
+    if (!enabled()) {
+        return;
+    }
+    auto& record = threadRecord();
+    std::lock_guard<std::mutex> lock(record.mutex);
+    entry(record.counters, name) += value;
+}
+
+void record(const char* name, double value)
+{
+    if (!enabled()) {
+        return;
+    }
+    auto& record = threadRecord();
+    std::lock_guard<std::mutex> lock(record.mutex);
+    entry(record.histograms, name).add(value);
+}
+
+Report report()
+{
+    Report merged;
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& record : reg.threads) {
+        std::lock_guard<std::mutex> record_lock(record->mutex);
+        for (const auto& [name, h] : record->timers) {
+            merged.timers[name].merge(h);
+        }
+        for (const auto& [name, value] : record->counters) {
+            merged.counters[name] += value;
+        }
+        for (const auto& [name, h] : record->histograms) {
+            merged.histograms[name].merge(h);
+        }
+        merged.events.insert(merged.events.end(), record->events.begin(),
+                record->events.end());
+    }
+    return merged;
+}
+
+std::string toJSON(const Report& report)
+{
+    std::ostringstream os;
+    os.precision(9);
+    os << "{\n  \"timers\": ";
+    writeHistograms(os, report.timers);
+    os << ",\n  \"counters\": {";
+    bool first = true;
+    for (const auto& [name, value] : report.counters) {
+        os << (first ? "\n" : ",\n") << "    ";
+        writeEscaped(os, name);
+        os << ": " << value;
+        first = false;
+    }
+    os << (first ? "}" : "\n  }");
+    os << ",\n  \"histograms\": ";
+    writeHistograms(os, report.histograms);
+    os << "\n}\n";
+    return os.str();
+}
+
+std::string toChromeTrace(const Report& report)
+{
+    std::ostringstream os;
+    os.precision(15);
+    os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    bool first = true;
+    for (const auto& event : report.events) {
+        os << (first ? "\n" : ",\n") << "{\"name\": ";
+        writeEscaped(os, event.name);
+        os << ", \"cat\": \"isce3\", \"ph\": \"X\", \"pid\": 0, \"tid\": "
+           << event.thread << ", \"ts\": " << event.start
+           << ", \"dur\": " << event.duration << "}";
+        first = false;
+    }
+    os << "\n]}\n";
+    return os.str();
+}
+
+void writeJSON(const std::string& filename)
+{
+    writeFile(filename, toJSON(report()));
+}
+
+void writeChromeTrace(const std::string& filename)
+{
+    writeFile(filename, toChromeTrace(report()));
+}
+
+ScopedTimer::ScopedTimer(const char* name)
+    : _name(name), _active(enabled()), _start(clock::now())
+{}
+
+ScopedTimer::~ScopedTimer() { stop(); }
+
+void ScopedTimer::stop()
+{
+    if (!_active) {
+        return;
+    }
+    _active = false;
+    const auto end = clock::now();
+    const double seconds = std::chrono::duration<double>(end - _start).count();
+
+    auto& record = threadRecord();
+    std::lock_guard<std::mutex> lock(record.mutex);
+    entry(record.timers, _name).add(seconds);
+    if (tracing() && record.events.size() < MAX_TRACE_EVENTS) {
+        const double start = microseconds(_start);
+        record.events.push_back({_name, start, microseconds(end) - start,
+                record.id});
+    }
+}
+
+double ScopedTimer::elapsed() const
+{
+    return std::chrono::duration<double>(clock::now() - _start).count();
+}
+
+}}} // namespace isce3::core::instrumentation
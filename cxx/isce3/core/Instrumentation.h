@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace isce3 { namespace core { namespace instrumentation {
+
+/** Number of power-of-two bins in a Histogram */
+constexpr static int HISTOGRAM_BINS = 64;
+
+/** Exponent of the lower edge of the first Histogram bin (2^-32) */
+constexpr static int HISTOGRAM_MIN_EXPONENT = -32;
+
+/** Maximum number of trace events kept per thread */
+constexpr static std::size_t MAX_TRACE_EVENTS = 1 << 20;
+
+/** Summary statistics of a recorded quantity, with a histogram using
+ * power-of-two bins. Bin k holds the values in
+ * [2^(k + HISTOGRAM_MIN_EXPONENT), 2^(k + 1 + HISTOGRAM_MIN_EXPONENT)), with
+ * values below (above) that range going to the first (last) bin.
+ */
+struct Histogram {
+    std::uint64_t count = 0;
+    double sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    std::array<std::uint64_t, HISTOGRAM_BINS> bins {};
+
+    /** Add a value */
+    void add(double value);
+
+    /** Add all the values recorded by another histogram */
+    void merge(const Histogram& other);
+
+    /** Lower edge of bin k */
+    static double binLowerEdge(int k);
+};
+
+/** A completed timed scope, in microseconds since the start of the trace */
+struct TraceEvent {
+    std::string name;
+    double start;
+    double duration;
+    int thread;
+};
+
+/** Merged view of all the instrumentation recorded by every thread */
+struct Report {
+    /** Durations (s) of each named timer */
+    std::map<std::string, Histogram> timers;
+    /** Totals of each named counter */
+    std::map<std::string, std::int64_t> counters;
+    /** Values of each named histogram */
+    std::map<std::string, Histogram> histograms;
+    /** Timed scopes in order of completion per thread (only when tracing) */
+    std::vector<TraceEvent> events;
+};
+
+/** Enable or disable recording. Recording is disabled by default unless the
+ * ISCE3_INSTRUMENTATION environment variable is set to a non-zero value.
+ *
+ * @param[in] flag      Whether to record timers, counters and histograms
+ * @param[in] trace     Whether to also keep every timed scope so that a
+ *                      Chrome trace can be written
+ */
+void enable(bool flag = true, bool trace = false);
+
+/** Whether recording is enabled */
+bool enabled();
+
+/** Whether timed scopes are kept for tracing */
+bool tracing();
+
+/** Discard everything recorded so far and restart the trace clock */
+void reset();
+
+/** Add value to the named counter of the calling thread */
+void count(const char* name, std::int64_t value = 1);
+
+/** Add value to the named histogram of the calling thread */
+void record(const char* name, double value);
+
+/** Merge the instrumentation of all threads */
+Report report();
+
+/** Format a report as JSON, with one object per timer, counter and
+ * histogram */
+std::string toJSON(const Report& report);
+
+/** Format the timed scopes of a report in the Chrome trace event format,
+ * readable by chrome://tracing or Perfetto */
+std::string toChromeTrace(const Report& report);
+
+/** Write the merged report of all threads as JSON */
+void writeJSON(const std::string& filename);
+
+/** Write the timed scopes of all threads as a Chrome trace */
+void writeChromeTrace(const std::string& filename);
+
+/** Record the time spent in a scope under the given name.
+ *
+ * When recording is disabled only the clock is read, so timers can be left
+ * in block loops. The name must outlive the timer, e.g. a string literal.
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* name);
+
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    /** Record the time spent so far instead of waiting for the end of the
+     * scope. Later calls and the destructor do nothing. */
+    void stop();
+
+    /** Seconds elapsed since construction */
+    double elapsed() const;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    const char* _name;
+    bool _active;
+    clock::time_point _start;
+};
+
+}}} // namespace isce3::core::instrumentation
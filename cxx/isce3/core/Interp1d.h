@@ -40,6 +40,50 @@ template<typename KernelType, typename DataType>
 DataType interp1d(const Kernel<KernelType>& kernel,
         const std::valarray<DataType>& x, double t, bool periodic = false);
 
+/** Interpolate sequence x at point t with a fixed-width kernel
+ *
+ * Same as the Kernel overload, but the number of taps is known at compile
+ * time so the tap loop is unrolled and the kernel is evaluated without
+ * virtual calls.
+ *
+ * @tparam KernelType kernel element type
+ * @tparam N number of kernel taps
+ * @tparam DataType data element type
+ */
+template<typename KernelType, int N, typename DataType>
+DataType interp1d(const TabulatedKernelN<KernelType, N>& kernel,
+        const DataType* x, size_t length, size_t stride, double t,
+        bool periodic = false);
+
+/** Interpolate sequence x at point t with a fixed-width kernel */
+template<typename KernelType, int N, typename DataType>
+DataType interp1d(const TabulatedKernelN<KernelType, N>& kernel,
+        const std::valarray<DataType>& x, double t, bool periodic = false);
+
+/** Interpolate sequence x at several points with a fixed-width kernel
+ *
+ * The coefficients of a block of output samples are computed together
+ * before the inner products, so that the compiler can vectorize across
+ * output samples.
+ *
+ * @tparam KernelType kernel element type
+ * @tparam N number of kernel taps
+ * @tparam DataType data element type
+ *
+ * @param[in]  kernel    Kernel function to use for interpolation.
+ * @param[in]  x         Sequence to interpolate.
+ * @param[in]  length    Length of sequence.
+ * @param[in]  stride    Stride between elements of sequence.
+ * @param[in]  t         Desired time samples, size nt.
+ * @param[out] out       Interpolated values, size nt.
+ * @param[in]  nt        Number of time samples.
+ * @param[in]  periodic  Use periodic boundary condition.  Default = false.
+ */
+template<typename KernelType, int N, typename DataType>
+void interp1d(const TabulatedKernelN<KernelType, N>& kernel,
+        const DataType* x, size_t length, size_t stride, const double* t,
+        DataType* out, size_t nt, bool periodic = false);
+
 }} // namespace isce3::core
 
 #include "Interp1d.icc"
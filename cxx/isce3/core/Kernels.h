@@ -144,12 +144,61 @@ public:
 
     const std::vector<T>& table() const { return _table; }
 
-private:
+protected:
+    /** Non-virtual table lookup */
+    inline T _lookup(double x) const;
+
     std::vector<T> _table;
     int _imax;
     T _1_dx;
 };
 
+/** Tabulated Kernel with a number of taps fixed at compile time.
+ *
+ * The interp1d overloads for this type unroll the loop over the N taps and
+ * evaluate the table without virtual calls.
+ *
+ * @tparam T Kernel element type
+ * @tparam N Number of taps, must equal ceil(width)
+ */
+template<typename T, int N>
+class TabulatedKernelN final : public TabulatedKernel<T> {
+public:
+    static_assert(N > 0, "number of taps must be positive");
+
+    /** Number of taps */
+    static constexpr int taps = N;
+
+    /** Constructor of tabulated kernel.
+     *
+     * @param[in] kernel    Kernel to sample, ceil(kernel.width()) == N
+     * @param[in] n         Table size.
+     */
+    template<typename Tin>
+    TabulatedKernelN(const Kernel<Tin>& kernel, int n);
+
+    /** Constructor reusing the table of an existing tabulated kernel.
+     *
+     * @param[in] kernel    Tabulated kernel, ceil(kernel.width()) == N
+     */
+    explicit TabulatedKernelN(const TabulatedKernel<T>& kernel);
+
+    T operator()(double x) const override { return this->_lookup(x); }
+
+    /** Get interpolator coefficients for a given offset.
+     *
+     * Same placement as isce3::core::detail::interp1d_coeffs
+     *
+     * @param[in]  t      Desired time sample.
+     * @param[out] low    Offset in input array where to apply coeffs.
+     * @param[out] coeffs Interpolator coeffs.
+     */
+    inline void coeffs(double t, long* low, T coeffs[N]) const;
+
+private:
+    void _checkWidth() const;
+};
+
 /** Polynomial Kernel */
 template<typename T>
 class ChebyKernel : public Kernel<T> {
@@ -110,6 +110,20 @@ class LUT1d {
         /** Evaluate the LUT */
         inline T eval(double x) const;
         inline ArrayXt eval(const Eigen::Ref<const Eigen::ArrayXd>& x) const;
+
+        /** Evaluate the LUT with a search cursor
+          *
+          * The cursor holds the index of the coordinate bracket found by the
+          * previous call and is updated in place. When successive points are
+          * monotonic (e.g. along a range line) the bracket is found in O(1)
+          * instead of with a binary search. Any cursor value is valid, so a
+          * new cursor may simply be initialized to zero.
+          *
+          * @param[in] x Point to evaluate the LUT
+          * @param[in,out] cursor Search cursor
+          * @returns Interpolated value */
+        inline T eval(double x, size_t & cursor) const;
+
     // Data members
     private:
         bool _haveData;
@@ -117,6 +131,11 @@ class LUT1d {
         std::valarray<double> _coords;
         std::valarray<T> _values;
         bool _extrapolate;
+
+        // Evaluate outside of the coordinate bounds
+        inline T _evalOutOfBounds(double x) const;
+        // Interpolate between coordinates (high - 1) and high
+        inline T _interpolate(double x, size_t high) const;
 };
 
 /** Convert LUT2d to LUT1d by averaging along rows or columns
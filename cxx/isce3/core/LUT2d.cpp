@@ -6,6 +6,8 @@
 
 #include "LUT2d.h"
 
+#include <algorithm>
+#include <cmath>
 #include <complex>
 #include <pyre/journal.h>
 
@@ -141,14 +143,7 @@ eval(const double y, const double x) const {
 
     // Check bounds or clamp indices to valid values
     if (_boundsError && not contains(y, x)) {
-        pyre::journal::error_t errorChannel("isce.core.LUT2d");
-        errorChannel
-            << "Out of bounds LUT2d evaluation at " << y << " " << x
-            << pyre::journal::newline
-            << " - bounds are " << _ystart << " "
-            << _ystart + _dy * (_data.length() - 1.0) << " "
-            << _xstart << " " << _xstart + _dx * (_data.width() - 1.0)
-            << pyre::journal::endl;
+        _reportOutOfBounds(y, x);
     }
     x_idx = isce3::core::clamp(x_idx, 0.0, _data.width() - 1.0);
     y_idx = isce3::core::clamp(y_idx, 0.0, _data.length() - 1.0);
@@ -162,15 +157,80 @@ template<typename T>
 Eigen::Matrix<T, Eigen::Dynamic, 1> isce3::core::LUT2d<T>::
 eval(double y, const Eigen::Ref<const Eigen::VectorXd>& x) const
 {
-    const auto n = x.size();
+    const long n = x.size();
     Eigen::Matrix<T, Eigen::Dynamic, 1> out(n);
+
+    // Evaluate in chunks of the row so that each thread can reuse the
+    // row weights
+    const long chunk = 1024;
     _Pragma("omp parallel for")
-    for (long i = 0; i < n; ++i) {
-        out(i) = eval(y, x(i));
+    for (long i = 0; i < n; i += chunk) {
+        eval(y, x.data() + i, out.data() + i, std::min(chunk, n - i));
     }
     return out;
 }
 
+template<typename T>
+void isce3::core::LUT2d<T>::
+eval(double y, const double* x, T* out, size_t n) const
+{
+    // Check if data are available; if not, return ref value
+    if (!_haveData) {
+        std::fill(out, out + n, _refValue);
+        return;
+    }
+
+    // Only the bilinear interpolator is separable into a row blend
+    if (_interp->method() != isce3::core::BILINEAR_METHOD) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = eval(y, x[i]);
+        }
+        return;
+    }
+
+    // Row indices and weights shared by all points
+    const double y_idx = isce3::core::clamp((y - _ystart) / _dy, 0.0,
+                                            _data.length() - 1.0);
+    const int y1 = std::floor(y_idx);
+    const int y2 = std::ceil(y_idx);
+    const T wy2 = static_cast<T>((y1 == y2) ? 0.0 : y_idx - y1);
+    const T wy1 = static_cast<T>((y1 == y2) ? 1.0 : y2 - y_idx);
+    const T* row1 = &_data(y1, 0);
+    const T* row2 = &_data(y2, 0);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (_boundsError && not contains(y, x[i])) {
+            _reportOutOfBounds(y, x[i]);
+        }
+        const double x_idx = isce3::core::clamp((x[i] - _xstart) / _dx, 0.0,
+                                                _data.width() - 1.0);
+        const int x1 = std::floor(x_idx);
+        const int x2 = std::ceil(x_idx);
+        const T q1 = wy1 * row1[x1] + wy2 * row2[x1];
+        if (x1 == x2) {
+            out[i] = q1;
+        } else {
+            const T q2 = wy1 * row1[x2] + wy2 * row2[x2];
+            out[i] = static_cast<T>(x2 - x_idx) * q1 +
+                     static_cast<T>(x_idx - x1) * q2;
+        }
+    }
+}
+
+template<typename T>
+void isce3::core::LUT2d<T>::
+_reportOutOfBounds(double y, double x) const
+{
+    pyre::journal::error_t errorChannel("isce.core.LUT2d");
+    errorChannel
+        << "Out of bounds LUT2d evaluation at " << y << " " << x
+        << pyre::journal::newline
+        << " - bounds are " << _ystart << " "
+        << _ystart + _dy * (_data.length() - 1.0) << " "
+        << _xstart << " " << _xstart + _dx * (_data.width() - 1.0)
+        << pyre::journal::endl;
+}
+
 template <typename T>
 void
 isce3::core::LUT2d<T>::
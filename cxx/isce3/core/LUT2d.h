@@ -80,6 +80,20 @@ class isce3::core::LUT2d {
         Eigen::Matrix<T, Eigen::Dynamic, 1>
         eval(double y, const Eigen::Ref<const Eigen::VectorXd>& x) const;
 
+        /** Evaluate LUT along a row
+         *
+         * For bilinear interpolation the row weights and data rows are
+         * computed once for all points, and only the blend along X is done
+         * per point. Other interpolation methods evaluate each point
+         * independently.
+         *
+         * @param[in]  y   Y-coordinate shared by all points
+         * @param[in]  x   X-coordinates of the points
+         * @param[out] out Interpolated values
+         * @param[in]  n   Number of points
+         */
+        void eval(double y, const double* x, T* out, size_t n) const;
+
         /** Check if point resides in domain of LUT */
         inline bool contains(double y, double x) const
         {
@@ -111,6 +125,11 @@ class isce3::core::LUT2d {
          */
         void _setInterpolator(dataInterpMethod method);
 
+        /** @internal
+         * Report an out of bounds evaluation
+         */
+        void _reportOutOfBounds(double y, double x) const;
+
     // BVR: I'm placing the comparison operator implementations inline here because
     // it wasn't clear to me how to handle the template arguments out-of-line
     public:
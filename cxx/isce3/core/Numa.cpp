@@ -0,0 +1,288 @@
+#include "Numa.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace isce3 { namespace core {
+
+namespace {
+
+ThreadPlacement placementFromEnvironment()
+{
+    const char* value = std::getenv("ISCE3_THREAD_PLACEMENT");
+    if (value == nullptr) {
+        return ThreadPlacement::Default;
+    }
+    const std::string name(value);
+    if (name == "pinned") {
+        return ThreadPlacement::Pinned;
+    }
+    if (name == "per_node") {
+        return ThreadPlacement::PerNode;
+    }
+    return ThreadPlacement::Default;
+}
+
+std::atomic<ThreadPlacement> g_placement {placementFromEnvironment()};
+
+// Parse a sysfs CPU list such as "0-3,8,10-11"
+std::vector<int> parseCpuList(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const auto dash = range.find('-');
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = dash == std::string::npos
+                ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// CPUs the process may run on, as set before any thread is pinned
+std::vector<int> usableCpus()
+{
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &mask)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+std::vector<std::vector<int>> readNumaNodeCpus()
+{
+    const auto usable = usableCpus();
+    std::vector<std::vector<int>> nodes;
+    for (int node = 0;; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" +
+                           std::to_string(node) + "/cpulist");
+        if (!file) {
+            break;
+        }
+        std::string list;
+        std::getline(file, list);
+        std::vector<int> cpus;
+        for (int cpu : parseCpuList(list)) {
+            if (std::find(usable.begin(), usable.end(), cpu) != usable.end()) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            nodes.push_back(std::move(cpus));
+        }
+    }
+    if (nodes.empty() && !usable.empty()) {
+        nodes.push_back(usable);
+    }
+    return nodes;
+}
+
+// Restores the CPU affinity of the calling thread on destruction. Each
+// thread of a pinned team holds one, so that the OpenMP threads reused by
+// later parallel regions are not confined to the CPU they were pinned to.
+class AffinityGuard {
+public:
+    AffinityGuard()
+    {
+#if defined(__linux__)
+        CPU_ZERO(&_mask);
+        _valid = sched_getaffinity(0, sizeof(_mask), &_mask) == 0;
+#endif
+    }
+
+    ~AffinityGuard()
+    {
+#if defined(__linux__)
+        if (_valid) {
+            sched_setaffinity(0, sizeof(_mask), &_mask);
+        }
+#endif
+    }
+
+private:
+#if defined(__linux__)
+    cpu_set_t _mask;
+    bool _valid = false;
+#endif
+};
+
+// Raises the number of nested active parallel levels for its lifetime
+class MaxActiveLevelsGuard {
+public:
+    explicit MaxActiveLevelsGuard(int levels)
+    {
+#ifdef _OPENMP
+        _saved = omp_get_max_active_levels();
+        omp_set_max_active_levels(std::max(_saved, levels));
+#else
+        (void) levels;
+#endif
+    }
+
+    ~MaxActiveLevelsGuard()
+    {
+#ifdef _OPENMP
+        omp_set_max_active_levels(_saved);
+#endif
+    }
+
+    MaxActiveLevelsGuard(const MaxActiveLevelsGuard&) = delete;
+    MaxActiveLevelsGuard& operator=(const MaxActiveLevelsGuard&) = delete;
+
+private:
+    int _saved = 1;
+};
+
+int maxThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+int threadNum()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+// Process the blocks [first, last) with the threads of the current team,
+// catching the exceptions of each block
+void runBlocks(std::size_t first, std::size_t last,
+        const std::function<void(std::size_t)>& f,
+        std::vector<std::exception_ptr>& errors)
+{
+#pragma omp for schedule(dynamic)
+    for (std::size_t block = first; block < last; ++block) {
+        try {
+            f(block);
+        } catch (...) {
+            errors[block] = std::current_exception();
+        }
+    }
+}
+
+} // namespace
+
+void setThreadPlacement(ThreadPlacement placement) { g_placement = placement; }
+
+ThreadPlacement threadPlacement() { return g_placement; }
+
+std::vector<std::vector<int>> numaNodeCpus()
+{
+    static const auto nodes = readNumaNodeCpus();
+    return nodes;
+}
+
+bool pinThread(int cpu)
+{
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+    return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+    (void) cpu;
+    return false;
+#endif
+}
+
+void forEachBlock(std::size_t nBlocks,
+        const std::function<void(std::size_t)>& f)
+{
+    const auto placement = threadPlacement();
+    detail::forEachBlock(nBlocks, f, placement,
+            placement == ThreadPlacement::Default
+                    ? std::vector<std::vector<int>>() : numaNodeCpus());
+}
+
+namespace detail {
+
+void forEachBlock(std::size_t nBlocks,
+        const std::function<void(std::size_t)>& f,
+        ThreadPlacement placement, const std::vector<std::vector<int>>& nodes)
+{
+    std::vector<std::exception_ptr> errors(nBlocks);
+    const int nNodes = placement == ThreadPlacement::Default
+            ? 0 : static_cast<int>(nodes.size());
+
+    if (placement == ThreadPlacement::PerNode && nNodes > 1 &&
+            nBlocks > 1) {
+        MaxActiveLevelsGuard levels(2);
+        const int threadsPerNode = std::max(1, maxThreads() / nNodes);
+#pragma omp parallel num_threads(nNodes)
+        {
+            const int node = threadNum();
+            const auto& cpus = nodes[node];
+            const int nThreads = std::min<int>(threadsPerNode, cpus.size());
+            const std::size_t first = nBlocks * node / nNodes;
+            const std::size_t last = nBlocks * (node + 1) / nNodes;
+#pragma omp parallel num_threads(nThreads)
+            {
+                AffinityGuard guard;
+                pinThread(cpus[threadNum() % cpus.size()]);
+                runBlocks(first, last, f, errors);
+            }
+        }
+    } else {
+        // all the CPUs in node order
+        std::vector<int> cpus;
+        for (int node = 0; node < nNodes; ++node) {
+            cpus.insert(cpus.end(), nodes[node].begin(), nodes[node].end());
+        }
+#pragma omp parallel
+        {
+            AffinityGuard guard;
+            if (!cpus.empty()) {
+                pinThread(cpus[threadNum() % cpus.size()]);
+            }
+            runBlocks(0, nBlocks, f, errors);
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace detail
+
+}} // namespace isce3::core
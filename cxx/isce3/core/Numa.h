@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace isce3 { namespace core {
+
+/** Placement of the OpenMP threads of the block processing loops */
+enum class ThreadPlacement {
+    Default, /**< leave the placement to the OS and OpenMP runtime */
+    Pinned,  /**< pin each thread to one CPU, filling the NUMA nodes in
+                  order */
+    PerNode, /**< pin the threads and split the blocks into one contiguous
+                  range per NUMA node, processed by the threads of that
+                  node only */
+};
+
+/** Set the placement used by forEachBlock. The default is read from the
+ * ISCE3_THREAD_PLACEMENT environment variable ("pinned" or "per_node"),
+ * Default otherwise. */
+void setThreadPlacement(ThreadPlacement placement);
+
+/** Placement used by forEachBlock */
+ThreadPlacement threadPlacement();
+
+/** CPUs usable by the process on each NUMA node, read from
+ * /sys/devices/system/node. Nodes without usable CPUs are left out, and a
+ * single node holding all the usable CPUs is returned if the topology is not
+ * available. */
+std::vector<std::vector<int>> numaNodeCpus();
+
+/** Pin the calling thread to a CPU. Returns false if the CPU could not be
+ * set, e.g. on platforms without thread affinity. */
+bool pinThread(int cpu);
+
+/**
+ * Call f(block) for each block in [0, nBlocks) in parallel, according to
+ * the thread placement.
+ *
+ * Blocks are scheduled dynamically among the threads. With
+ * ThreadPlacement::PerNode, each NUMA node processes a contiguous range of
+ * blocks with a nested team of the threads pinned to it, so that the memory
+ * each block allocates and first touches stays on the node that processes
+ * it. The threads pinned by the loop get their previous CPU affinity back
+ * when it ends. Exceptions thrown by f are caught, and the one of the first
+ * failing block is rethrown once all the blocks are done.
+ *
+ * @param[in] nBlocks   Number of blocks
+ * @param[in] f         Function processing one block
+ */
+void forEachBlock(std::size_t nBlocks,
+        const std::function<void(std::size_t)>& f);
+
+namespace detail {
+/** \internal forEachBlock with the given placement and CPUs of each NUMA
+ * node, e.g. to run the PerNode path on a single node machine */
+void forEachBlock(std::size_t nBlocks,
+        const std::function<void(std::size_t)>& f,
+        ThreadPlacement placement, const std::vector<std::vector<int>>& nodes);
+} // namespace detail
+
+/**
+ * Fill a row-major array in parallel, with the static schedule over rows
+ * used by the processing loops, so that each page is first touched, and
+ * thus placed, by the thread that later processes its rows.
+ *
+ * @param[out] data     Array to fill
+ * @param[in]  rows     Number of rows
+ * @param[in]  cols     Number of columns
+ * @param[in]  value    Fill value
+ */
+template<typename T>
+void firstTouchFill(T* data, std::size_t rows, std::size_t cols,
+        const T& value)
+{
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < rows; ++i) {
+        T* row = data + i * cols;
+        for (std::size_t j = 0; j < cols; ++j) {
+            row[j] = value;
+        }
+    }
+}
+
+}} // namespace isce3::core
@@ -2,11 +2,111 @@
 
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
 namespace isce3 { namespace core {
 
+static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+int ProjectionBase::forward_batch(std::size_t n, const double* lon,
+                                  const double* lat, const double* hgt,
+                                  double* x, double* y, double* z) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Vec3 llh {lon[i], lat[i], hgt ? hgt[i] : 0.};
+        Vec3 xyz;
+        if (forward(llh, xyz) != 0) {
+            xyz = {NaN, NaN, NaN};
+            ++nfailed;
+        }
+        x[i] = xyz[0];
+        y[i] = xyz[1];
+        if (z)
+            z[i] = xyz[2];
+    }
+    return nfailed;
+}
+
+int ProjectionBase::inverse_batch(std::size_t n, const double* x,
+                                  const double* y, const double* z,
+                                  double* lon, double* lat, double* hgt) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Vec3 xyz {x[i], y[i], z ? z[i] : 0.};
+        Vec3 llh;
+        if (inverse(xyz, llh) != 0) {
+            llh = {NaN, NaN, NaN};
+            ++nfailed;
+        }
+        lon[i] = llh[0];
+        lat[i] = llh[1];
+        if (hgt)
+            hgt[i] = llh[2];
+    }
+    return nfailed;
+}
+
+int ProjectionBase::inverse_row(std::size_t n, const double* x, double y,
+                                double* lon, double* lat) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        Vec3 llh;
+        if (inverse(Vec3 {x[i], y, 0.}, llh) != 0) {
+            llh = {NaN, NaN, NaN};
+            ++nfailed;
+        }
+        lon[i] = llh[0];
+        lat[i] = llh[1];
+    }
+    return nfailed;
+}
+
+int LonLat::forward_batch(std::size_t n, const double* lon, const double* lat,
+                          const double* hgt, double* x, double* y,
+                          double* z) const
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = lon[i] * 180.0 / M_PI;
+        y[i] = lat[i] * 180.0 / M_PI;
+    }
+    if (z) {
+        for (std::size_t i = 0; i < n; ++i)
+            z[i] = hgt ? hgt[i] : 0.;
+    }
+    return 0;
+}
+
+int LonLat::inverse_batch(std::size_t n, const double* x, const double* y,
+                          const double* z, double* lon, double* lat,
+                          double* hgt) const
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        lon[i] = x[i] * M_PI / 180.0;
+        lat[i] = y[i] * M_PI / 180.0;
+    }
+    if (hgt) {
+        for (std::size_t i = 0; i < n; ++i)
+            hgt[i] = z ? z[i] : 0.;
+    }
+    return 0;
+}
+
+int LonLat::inverse_row(std::size_t n, const double* x, double y, double* lon,
+                        double* lat) const
+{
+    const double lat_row = y * M_PI / 180.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        lon[i] = x[i] * M_PI / 180.0;
+        lat[i] = lat_row;
+    }
+    return 0;
+}
+
 int Geocent::forward(const Vec3& llh, Vec3& xyz) const
 {
     // This is to transform LLH to Geocent, which is just a pass-through to
@@ -25,56 +125,49 @@ int Geocent::inverse(const Vec3& xyz, Vec3& llh) const
 
 /**
  * @internal
- * Local function - Compute the real clenshaw summation. Also computes
- * Gaussian latitude for some B as clens(a, len(a), 2*B) + B.
+ * Local function - Compute the real clenshaw summation of sin(k * real)
+ * terms, given sin(real) and cos(real). Also computes Gaussian latitude for
+ * some B as clens(a, len(a), sin(2*B), cos(2*B)) + B.
  *
- * NOTE: The implementation here has been modified to allow for
- * encapsulating the gatg() implementation, as well as to make the
- * implementation details much clearer/cleaner.
+ * NOTE: The trigonometric terms are loop invariant and are passed in so that
+ * batch transforms can compute them once per point (or once per row).
  */
-static double clens(const double* a, int size, double real)
+static inline double clens(const double* a, int size, double sin_real,
+                           double cos_real)
 {
-    const double* p;
-    double hr, hr1, hr2;
-    for (p = a + size, hr2 = 0., hr1 = *(--p), hr = 0.; a - p;
-         hr2 = hr1, hr1 = hr) {
-        hr = -hr2 + (2. * hr1 * std::cos(real)) + *(--p);
+    const double r = 2. * cos_real;
+    double hr2 = 0., hr1 = a[size - 1], hr = 0.;
+    for (int k = size - 2; k >= 0; --k) {
+        hr = -hr2 + r * hr1 + a[k];
+        hr2 = hr1;
+        hr1 = hr;
     }
-    return std::sin(real) * hr;
+    return sin_real * hr;
 }
 
 /**
  * @internal
- * Local function - Compute the complex clenshaw summation.
- *
- * NOTE: The implementation here has been modified to match the modified
- * implementation of the real clenshaw summation above. As expected with
- * complex->real behavior, if imag == 0, then I == 0 on return regardless of
- * other inputs (so maybe we just implement clenS(a,len(a),real,0,_,_) for
- * clens(a,len(a),real) to simplify the code space?)
+ * Local function - Compute the complex clenshaw summation, given the sine and
+ * cosine of the real part and the hyperbolic sine and cosine of the imaginary
+ * part of the argument. Returns the real and imaginary parts in R and I.
  */
-static double clenS(const double* a, int size, double real, double imag,
-                    double& R, double& I)
-{
-    const double* p;
-    double hr, hr1, hr2, hi, hi1, hi2;
-    for (p = a + size, hr2 = 0., hi2 = 0., hi1 = 0., hr1 = *(--p), hi1 = 0.,
-        hr = 0., hi = 0.;
-         a - p; hr2 = hr1, hi2 = hi1, hr1 = hr, hi1 = hi) {
-        hr = -hr2 + (2. * hr1 * std::cos(real) * std::cosh(imag)) -
-             (-2. * hi1 * std::sin(real) * std::sinh(imag)) + *(--p);
-        hi = -hi2 + (-2. * hr1 * std::sin(real) * std::sinh(imag)) +
-             (2. * hi1 * std::cos(real) * std::cosh(imag));
+static inline void clenS(const double* a, int size, double sin_real,
+                         double cos_real, double sinh_imag, double cosh_imag,
+                         double& R, double& I)
+{
+    const double r = 2. * cos_real * cosh_imag;
+    const double i = -2. * sin_real * sinh_imag;
+    double hr2 = 0., hi2 = 0., hr1 = a[size - 1], hi1 = 0., hr = 0., hi = 0.;
+    for (int k = size - 2; k >= 0; --k) {
+        hr = -hr2 + r * hr1 - i * hi1 + a[k];
+        hi = -hi2 + i * hr1 + r * hi1;
+        hr2 = hr1;
+        hi2 = hi1;
+        hr1 = hr;
+        hi1 = hi;
     }
-
-    // Bad practice - Should *either* modify R in-place *or* return R, not both.
-    // I is modified, but not returned. Since R and I are tied, we should either
-    // return a pair<,>(,) or modify in-place, not mix the strategies
-    R = (std::sin(real) * std::cosh(imag) * hr) -
-        (std::cos(real) * std::sinh(imag) * hi);
-    I = (std::sin(real) * std::cosh(imag) * hi) +
-        (std::cos(real) * std::sinh(imag) * hr);
-    return R;
+    R = (sin_real * cosh_imag * hr) - (cos_real * sinh_imag * hi);
+    I = (sin_real * cosh_imag * hi) + (cos_real * sinh_imag * hr);
 }
 
 UTM::UTM(int code) : ProjectionBase(code)
@@ -164,72 +257,156 @@ UTM::UTM(int code) : ProjectionBase(code)
 
     // Gaussian latitude of origin latitude
     // JC - clens(_,_,0.) is always 0, should we hardcode/eliminate this?
-    double Z = clens(cbg, 6, 0.);
-    Zb = -Qn * (Z + clens(gtu, 6, 2 * Z));
+    double Z = clens(cbg, 6, 0., 1.);
+    Zb = -Qn * (Z + clens(gtu, 6, std::sin(2 * Z), std::cos(2 * Z)));
 }
 
-int UTM::forward(const Vec3& llh, Vec3& utm) const
+// Limit of the normalized easting of the UTM domain
+static constexpr double utm_max_easting = 2.623395162778;
+
+bool UTM::_forward(double lon, double lat, double& x, double& y) const
 {
     // Elliptical Lat, Lon -> Gaussian Lat, Lon
-    double gauss = clens(cbg, 6, 2. * llh[1]) + llh[1];
+    double gauss = clens(cbg, 6, std::sin(2. * lat), std::cos(2. * lat)) + lat;
     // Adjust longitude for zone offset
-    double lam = llh[0] - lon0;
+    double lam = lon - lon0;
 
     // Account for longitude and get Spherical N,E
-    double Cn = std::atan2(std::sin(gauss), std::cos(lam) * std::cos(gauss));
-    double Ce = std::atan2(
-            std::sin(lam) * std::cos(gauss),
-            std::hypot(std::sin(gauss), std::cos(gauss) * std::cos(lam)));
+    const double sin_gauss = std::sin(gauss);
+    const double cos_gauss = std::cos(gauss);
+    const double cos_lam = std::cos(lam);
+    double Cn = std::atan2(sin_gauss, cos_lam * cos_gauss);
+    double Ce = std::atan2(std::sin(lam) * cos_gauss,
+                           std::hypot(sin_gauss, cos_gauss * cos_lam));
 
     // Spherical N,E to Elliptical N,E
     Ce = asinh(tan(Ce));
     double dCn, dCe;
-    Cn += clenS(gtu, 6, 2 * Cn, 2 * Ce, dCn, dCe);
+    clenS(gtu, 6, std::sin(2 * Cn), std::cos(2 * Cn), std::sinh(2 * Ce),
+          std::cosh(2 * Ce), dCn, dCe);
+    Cn += dCn;
     Ce += dCe;
 
-    if (std::fabs(Ce) <= 2.623395162778) {
-        utm[0] = (Qn * Ce * ellipsoid().a()) + 500000.;
-        utm[1] = (((Qn * Cn) + Zb) * ellipsoid().a()) +
-                 (isnorth ? 0. : 10000000.);
-        // UTM is lateral projection only, height is pass through.
-        utm[2] = llh[2];
-        return 0;
-    } else {
-        return 1;
+    if (std::fabs(Ce) <= utm_max_easting) {
+        x = (Qn * Ce * ellipsoid().a()) + 500000.;
+        y = (((Qn * Cn) + Zb) * ellipsoid().a()) + (isnorth ? 0. : 10000000.);
+        return true;
     }
+    return false;
+}
+
+double UTM::_normalizedNorthing(double y) const
+{
+    // Normalize N to Spherical N
+    const double Cn = (y - (isnorth ? 0. : 10000000.)) / ellipsoid().a();
+    return (Cn - Zb) / Qn;
+}
+
+double UTM::_normalizedEasting(double x) const
+{
+    // Normalize E to Spherical E
+    return ((x - 500000.) / ellipsoid().a()) / Qn;
+}
+
+bool UTM::_inverse(double Cn, double sin2Cn, double cos2Cn, double Ce,
+                   double& lon, double& lat) const
+{
+    if (std::fabs(Ce) > utm_max_easting)
+        return false;
+
+    // N,E to Spherical Lat, Lon
+    double dCn, dCe;
+    clenS(utg, 6, sin2Cn, cos2Cn, std::sinh(2 * Ce), std::cosh(2 * Ce), dCn,
+          dCe);
+    Cn += dCn;
+    Ce = std::atan(std::sinh(Ce + dCe));
+
+    // Spherical Lat, Lon to Gaussian Lat, Lon
+    const double sinCe = std::sin(Ce);
+    const double cosCe = std::cos(Ce);
+    const double cosCn = std::cos(Cn);
+    Ce = std::atan2(sinCe, cosCe * cosCn);
+    Cn = std::atan2(std::sin(Cn) * cosCe, std::hypot(sinCe, cosCe * cosCn));
+
+    // Gaussian Lat, Lon to Elliptical Lat, Lon
+    lon = Ce + lon0;
+    lat = clens(cgb, 6, std::sin(2 * Cn), std::cos(2 * Cn)) + Cn;
+    return true;
+}
+
+int UTM::forward(const Vec3& llh, Vec3& utm) const
+{
+    if (not _forward(llh[0], llh[1], utm[0], utm[1]))
+        return 1;
+    // UTM is lateral projection only, height is pass through.
+    utm[2] = llh[2];
+    return 0;
 }
 
 int UTM::inverse(const Vec3& utm, Vec3& llh) const
 {
-    double Cn = (utm[1] - (isnorth ? 0. : 10000000.)) / ellipsoid().a();
-    double Ce = (utm[0] - 500000.) / ellipsoid().a();
-
-    // Normalize N,E to Spherical N,E
-    Cn = (Cn - Zb) / Qn;
-    Ce /= Qn;
-
-    if (std::fabs(Ce) <= 2.623395162778) {
-        // N,E to Spherical Lat, Lon
-        double dCn, dCe;
-        Cn += clenS(utg, 6, 2 * Cn, 2 * Ce, dCn, dCe);
-        Ce = std::atan(std::sinh(Ce + dCe));
-
-        // Spherical Lat, Lon to Gaussian Lat, Lon
-        double sinCe = std::sin(Ce);
-        double cosCe = std::cos(Ce);
-        Ce = std::atan2(sinCe, cosCe * std::cos(Cn));
-        Cn = std::atan2(std::sin(Cn) * cosCe,
-                        std::hypot(sinCe, cosCe * std::cos(Cn)));
-
-        // Gaussian Lat, Lon to Elliptical Lat, Lon
-        llh[0] = Ce + lon0;
-        llh[1] = clens(cgb, 6, 2 * Cn) + Cn;
-        // UTM is a lateral projection only. Height is pass through.
-        llh[2] = utm[2];
-        return 0;
-    } else {
+    const double Cn = _normalizedNorthing(utm[1]);
+    const double Ce = _normalizedEasting(utm[0]);
+    if (not _inverse(Cn, std::sin(2 * Cn), std::cos(2 * Cn), Ce, llh[0],
+                     llh[1]))
         return 1;
+    // UTM is a lateral projection only. Height is pass through.
+    llh[2] = utm[2];
+    return 0;
+}
+
+int UTM::forward_batch(std::size_t n, const double* lon, const double* lat,
+                       const double* hgt, double* x, double* y,
+                       double* z) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (not _forward(lon[i], lat[i], x[i], y[i])) {
+            x[i] = y[i] = NaN;
+            ++nfailed;
+        }
+        if (z)
+            z[i] = std::isnan(x[i]) ? NaN : (hgt ? hgt[i] : 0.);
     }
+    return nfailed;
+}
+
+int UTM::inverse_batch(std::size_t n, const double* x, const double* y,
+                       const double* z, double* lon, double* lat,
+                       double* hgt) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double Cn = _normalizedNorthing(y[i]);
+        if (not _inverse(Cn, std::sin(2 * Cn), std::cos(2 * Cn),
+                         _normalizedEasting(x[i]), lon[i], lat[i])) {
+            lon[i] = lat[i] = NaN;
+            ++nfailed;
+        }
+        if (hgt)
+            hgt[i] = std::isnan(lon[i]) ? NaN : (z ? z[i] : 0.);
+    }
+    return nfailed;
+}
+
+int UTM::inverse_row(std::size_t n, const double* x, double y, double* lon,
+                     double* lat) const
+{
+    // The normalized northing and its Clenshaw trigonometric terms are
+    // shared by the whole row
+    const double Cn = _normalizedNorthing(y);
+    const double sin2Cn = std::sin(2 * Cn);
+    const double cos2Cn = std::cos(2 * Cn);
+
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (not _inverse(Cn, sin2Cn, cos2Cn, _normalizedEasting(x[i]), lon[i],
+                         lat[i])) {
+            lon[i] = lat[i] = NaN;
+            ++nfailed;
+        }
+    }
+    return nfailed;
 }
 
 /**
@@ -275,23 +452,20 @@ PolarStereo::PolarStereo(int code) : ProjectionBase(code)
             std::sqrt(1. - (std::pow(e, 2) * std::pow(std::sin(lat_ts), 2)));
 }
 
-int PolarStereo::forward(const Vec3& llh, Vec3& out) const
+void PolarStereo::_forward(double lon, double lat, double& x,
+                           double& y) const
 {
-    double lam = llh[0] - lon0;
-    double phi = llh[1] * (isnorth ? 1. : -1.);
+    double lam = lon - lon0;
+    double phi = lat * (isnorth ? 1. : -1.);
     double temp = akm1 * pj_tsfn(phi, std::sin(phi), e);
 
-    out[0] = temp * std::sin(lam);
-    out[1] = -temp * std::cos(lam) * (isnorth ? 1. : -1.);
-    // Height is just pass through
-    out[2] = llh[2];
-
-    return 0;
+    x = temp * std::sin(lam);
+    y = -temp * std::cos(lam) * (isnorth ? 1. : -1.);
 }
 
-int PolarStereo::inverse(const Vec3& ups, Vec3& llh) const
+bool PolarStereo::_inverse(double x, double y, double& lon, double& lat) const
 {
-    double tp = -std::hypot(ups[0], ups[1]) / akm1;
+    double tp = -std::hypot(x, y) / akm1;
     double fact = (isnorth) ? 1 : -1;
     double phi_l = (.5 * M_PI) - (2. * std::atan(tp));
 
@@ -303,15 +477,73 @@ int PolarStereo::inverse(const Vec3& ups, Vec3& llh) const
               2. * std::atan(tp *
                              std::pow((1. + sinphi) / (1. - sinphi), -0.5 * e));
         if (std::fabs(phi_l - phi) < 1.e-10) {
-            llh[0] = ((ups[0] == 0.) && (ups[1] == 0.))
-                             ? 0.
-                             : std::atan2(ups[0], -fact * ups[1]) + lon0;
-            llh[1] = phi * fact;
-            llh[2] = ups[2];
-            return 0;
+            lon = ((x == 0.) && (y == 0.))
+                          ? 0.
+                          : std::atan2(x, -fact * y) + lon0;
+            lat = phi * fact;
+            return true;
         }
     }
-    return 1;
+    return false;
+}
+
+int PolarStereo::forward(const Vec3& llh, Vec3& out) const
+{
+    _forward(llh[0], llh[1], out[0], out[1]);
+    // Height is just pass through
+    out[2] = llh[2];
+
+    return 0;
+}
+
+int PolarStereo::inverse(const Vec3& ups, Vec3& llh) const
+{
+    if (not _inverse(ups[0], ups[1], llh[0], llh[1]))
+        return 1;
+    llh[2] = ups[2];
+    return 0;
+}
+
+int PolarStereo::forward_batch(std::size_t n, const double* lon,
+                               const double* lat, const double* hgt,
+                               double* x, double* y, double* z) const
+{
+    for (std::size_t i = 0; i < n; ++i)
+        _forward(lon[i], lat[i], x[i], y[i]);
+    if (z) {
+        for (std::size_t i = 0; i < n; ++i)
+            z[i] = hgt ? hgt[i] : 0.;
+    }
+    return 0;
+}
+
+int PolarStereo::inverse_batch(std::size_t n, const double* x,
+                               const double* y, const double* z, double* lon,
+                               double* lat, double* hgt) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (not _inverse(x[i], y[i], lon[i], lat[i])) {
+            lon[i] = lat[i] = NaN;
+            ++nfailed;
+        }
+        if (hgt)
+            hgt[i] = std::isnan(lon[i]) ? NaN : (z ? z[i] : 0.);
+    }
+    return nfailed;
+}
+
+int PolarStereo::inverse_row(std::size_t n, const double* x, double y,
+                             double* lon, double* lat) const
+{
+    int nfailed = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (not _inverse(x[i], y, lon[i], lat[i])) {
+            lon[i] = lat[i] = NaN;
+            ++nfailed;
+        }
+    }
+    return nfailed;
 }
 
 /**
@@ -346,6 +578,13 @@ CEA::CEA() : ProjectionBase(6933)
     // clang-format on
 }
 
+double CEA::_latitude(double y) const
+{
+    double beta = std::asin((2. * y * k0) / (ellipsoid().a() * qp));
+    return beta + (apa[0] * std::sin(2. * beta)) +
+           (apa[1] * std::sin(4. * beta)) + (apa[2] * std::sin(6. * beta));
+}
+
 int CEA::forward(const Vec3& llh, Vec3& enu) const
 {
     enu[0] = k0 * llh[0] * ellipsoid().a();
@@ -357,13 +596,54 @@ int CEA::forward(const Vec3& llh, Vec3& enu) const
 int CEA::inverse(const Vec3& enu, Vec3& llh) const
 {
     llh[0] = enu[0] / (k0 * ellipsoid().a());
-    double beta = std::asin((2. * enu[1] * k0) / (ellipsoid().a() * qp));
-    llh[1] = beta + (apa[0] * std::sin(2. * beta)) +
-             (apa[1] * std::sin(4. * beta)) + (apa[2] * std::sin(6. * beta));
+    llh[1] = _latitude(enu[1]);
     llh[2] = enu[2];
     return 0;
 }
 
+int CEA::forward_batch(std::size_t n, const double* lon, const double* lat,
+                       const double* hgt, double* x, double* y,
+                       double* z) const
+{
+    const double a = ellipsoid().a();
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = k0 * lon[i] * a;
+        y[i] = (.5 * a * pj_qsfn(std::sin(lat[i]), e, one_es)) / k0;
+    }
+    if (z) {
+        for (std::size_t i = 0; i < n; ++i)
+            z[i] = hgt ? hgt[i] : 0.;
+    }
+    return 0;
+}
+
+int CEA::inverse_batch(std::size_t n, const double* x, const double* y,
+                       const double* z, double* lon, double* lat,
+                       double* hgt) const
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        lon[i] = x[i] / (k0 * ellipsoid().a());
+        lat[i] = _latitude(y[i]);
+    }
+    if (hgt) {
+        for (std::size_t i = 0; i < n; ++i)
+            hgt[i] = z ? z[i] : 0.;
+    }
+    return 0;
+}
+
+int CEA::inverse_row(std::size_t n, const double* x, double y, double* lon,
+                     double* lat) const
+{
+    // Latitude only depends on the northing
+    const double lat_row = _latitude(y);
+    for (std::size_t i = 0; i < n; ++i) {
+        lon[i] = x[i] / (k0 * ellipsoid().a());
+        lat[i] = lat_row;
+    }
+    return 0;
+}
+
 ProjectionBase* createProj(int epsgcode)
 {
     // Check for Lat/Lon
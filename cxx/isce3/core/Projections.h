@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 
@@ -102,6 +103,60 @@ public:
         return llh;
     }
 
+    /**
+     * Transform a batch of points from LLH. Coordinates are passed as
+     * separate arrays (structure of arrays).
+     *
+     * @param[in]  n   Number of points
+     * @param[in]  lon Longitudes in radians
+     * @param[in]  lat Latitudes in radians
+     * @param[in]  hgt Heights, or nullptr for zero heights
+     * @param[out] x   X coordinates in specified projection system
+     * @param[out] y   Y coordinates in specified projection system
+     * @param[out] z   Z coordinates in specified projection system, or
+     *                 nullptr if not needed
+     * @returns Number of points that failed to transform. The outputs of
+     * these points are set to NaN.
+     */
+    virtual int forward_batch(std::size_t n, const double* lon,
+                              const double* lat, const double* hgt,
+                              double* x, double* y, double* z) const;
+
+    /**
+     * Transform a batch of points to LLH. Coordinates are passed as
+     * separate arrays (structure of arrays).
+     *
+     * @param[in]  n   Number of points
+     * @param[in]  x   X coordinates in specified projection system
+     * @param[in]  y   Y coordinates in specified projection system
+     * @param[in]  z   Z coordinates in specified projection system, or
+     *                 nullptr for zero heights
+     * @param[out] lon Longitudes in radians
+     * @param[out] lat Latitudes in radians
+     * @param[out] hgt Heights, or nullptr if not needed
+     * @returns Number of points that failed to transform. The outputs of
+     * these points are set to NaN.
+     */
+    virtual int inverse_batch(std::size_t n, const double* x, const double* y,
+                              const double* z, double* lon, double* lat,
+                              double* hgt) const;
+
+    /**
+     * Transform to LLH a row of zero-height points sharing the same Y
+     * coordinate, e.g. a line of a geocoded grid.  Projections override
+     * this to compute the terms that only depend on Y once per row.
+     *
+     * @param[in]  n   Number of points
+     * @param[in]  x   X coordinates in specified projection system
+     * @param[in]  y   Y coordinate shared by all points
+     * @param[out] lon Longitudes in radians
+     * @param[out] lat Latitudes in radians
+     * @returns Number of points that failed to transform. The outputs of
+     * these points are set to NaN.
+     */
+    virtual int inverse_row(std::size_t n, const double* x, double y,
+                            double* lon, double* lat) const;
+
     virtual ~ProjectionBase() = default;
 };
 
@@ -116,6 +171,17 @@ public:
     int forward(const Vec3&, Vec3&) const override;
 
     int inverse(const Vec3&, Vec3&) const override;
+
+    int forward_batch(std::size_t n, const double* lon, const double* lat,
+                      const double* hgt, double* x, double* y,
+                      double* z) const override;
+
+    int inverse_batch(std::size_t n, const double* x, const double* y,
+                      const double* z, double* lon, double* lat,
+                      double* hgt) const override;
+
+    int inverse_row(std::size_t n, const double* x, double y, double* lon,
+                    double* lat) const override;
 };
 
 inline void LonLat::print() const
@@ -177,6 +243,18 @@ class UTM : public ProjectionBase {
     double cgb[6], cbg[6], utg[6], gtu[6];
     double Qn, Zb;
 
+    // Lateral transforms shared by the single point and batch interfaces.
+    // Return false if the point is out of the projection domain.
+    bool _forward(double lon, double lat, double& x, double& y) const;
+
+    // Inverse transform from the normalized northing Cn (with the sine and
+    // cosine of 2 * Cn precomputed) and normalized easting Ce.
+    bool _inverse(double Cn, double sin2Cn, double cos2Cn, double Ce,
+                  double& lon, double& lat) const;
+
+    double _normalizedNorthing(double y) const;
+    double _normalizedEasting(double x) const;
+
 public:
     UTM(int);
 
@@ -188,6 +266,17 @@ public:
 
     /** Transform from UTM(m) to llh (rad) */
     int inverse(const Vec3& xyz, Vec3& llh) const override;
+
+    int forward_batch(std::size_t n, const double* lon, const double* lat,
+                      const double* hgt, double* x, double* y,
+                      double* z) const override;
+
+    int inverse_batch(std::size_t n, const double* x, const double* y,
+                      const double* z, double* lon, double* lat,
+                      double* hgt) const override;
+
+    int inverse_row(std::size_t n, const double* x, double y, double* lon,
+                    double* lat) const override;
 };
 
 inline void UTM::print() const
@@ -208,6 +297,10 @@ class PolarStereo : public ProjectionBase {
     double lat0, lon0, lat_ts, akm1, e;
     bool isnorth;
 
+    // Lateral transforms shared by the single point and batch interfaces.
+    void _forward(double lon, double lat, double& x, double& y) const;
+    bool _inverse(double x, double y, double& lon, double& lat) const;
+
 public:
     PolarStereo(int);
 
@@ -219,6 +312,17 @@ public:
 
     /** Transform from Polar Stereo (m) to llh (rad) */
     int inverse(const Vec3&, Vec3&) const override;
+
+    int forward_batch(std::size_t n, const double* lon, const double* lat,
+                      const double* hgt, double* x, double* y,
+                      double* z) const override;
+
+    int inverse_batch(std::size_t n, const double* x, const double* y,
+                      const double* z, double* lon, double* lat,
+                      double* hgt) const override;
+
+    int inverse_row(std::size_t n, const double* x, double y, double* lon,
+                    double* lat) const override;
 };
 
 inline void PolarStereo::print() const
@@ -238,6 +342,9 @@ class CEA : public ProjectionBase {
     double apa[3];
     double lat_ts, k0, e, one_es, qp;
 
+    // Latitude (rad) from northing (m)
+    double _latitude(double y) const;
+
 public:
     CEA();
 
@@ -248,6 +355,17 @@ public:
 
     /** Transform from CEA (m) to LLH (rad) */
     int inverse(const Vec3& xyz, Vec3& llh) const override;
+
+    int forward_batch(std::size_t n, const double* lon, const double* lat,
+                      const double* hgt, double* x, double* y,
+                      double* z) const override;
+
+    int inverse_batch(std::size_t n, const double* x, const double* y,
+                      const double* z, double* lon, double* lat,
+                      double* hgt) const override;
+
+    int inverse_row(std::size_t n, const double* x, double y, double* lon,
+                    double* lat) const override;
 };
 
 inline void CEA::print() const
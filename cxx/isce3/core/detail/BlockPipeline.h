@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+namespace isce3 { namespace core { namespace detail {
+
+/** Number of buffer slots used by runBlockPipeline */
+inline int pipelineSlots(int nblocks, bool overlap_io)
+{
+    return (overlap_io && nblocks > 1) ? 3 : 1;
+}
+
+/**
+ * Process the blocks of lines of a raster in three stages: read, compute and
+ * write.
+ *
+ * With overlap, the read of block b + 1 and the write of block b - 1 run as
+ * OpenMP tasks while the lines of block b are computed as a taskloop by the
+ * rest of the team, each block using buffer slot b % 3. Otherwise the blocks
+ * are read, computed over a parallel loop and written one after the other
+ * in slot 0. Exceptions are caught in each stage, the pipeline stops after
+ * the step that raised them, and the one of the first failing block is
+ * rethrown.
+ *
+ * @param[in] nblocks       Number of blocks
+ * @param[in] block_length  Number of lines of each block but the last one
+ * @param[in] length        Total number of lines
+ * @param[in] overlap_io    Whether to overlap I/O and computation
+ * @param[in] read          Callable read(block, slot, y0, block_length)
+ * @param[in] compute       Callable compute(slot, line) processing one line
+ * of the block held in slot
+ * @param[in] write         Callable write(block, slot, y0, block_length)
+ */
+template<class Read, class Compute, class Write>
+void runBlockPipeline(int nblocks, long block_length, long length,
+        bool overlap_io, Read&& read, Compute&& compute, Write&& write)
+{
+    const int nslots = pipelineSlots(nblocks, overlap_io);
+    std::vector<std::exception_ptr> errors(nblocks);
+
+    auto first_line = [&](int block) { return block * block_length; };
+    auto lines = [&](int block) {
+        return std::min(block_length, length - first_line(block));
+    };
+    auto failed = [&]() {
+        return std::any_of(errors.begin(), errors.end(),
+                [](const std::exception_ptr& e) { return bool(e); });
+    };
+
+    if (nslots == 1) {
+        for (int block = 0; block < nblocks && !failed(); ++block) {
+            const long n = lines(block);
+            try {
+                read(block, 0, first_line(block), n);
+            } catch (...) {
+                errors[block] = std::current_exception();
+                break;
+            }
+            _Pragma("omp parallel for schedule(static)")
+            for (long i = 0; i < n; ++i) {
+                try {
+                    compute(0, i);
+                } catch (...) {
+                    _Pragma("omp critical")
+                    errors[block] = std::current_exception();
+                }
+            }
+            if (errors[block]) {
+                break;
+            }
+            try {
+                write(block, 0, first_line(block), n);
+            } catch (...) {
+                errors[block] = std::current_exception();
+            }
+        }
+    } else {
+        _Pragma("omp parallel")
+        _Pragma("omp single")
+        for (int step = 0; step < nblocks + 2; ++step) {
+            const int read_block = step;
+            const int compute_block = step - 1;
+            const int write_block = step - 2;
+
+            if (read_block < nblocks) {
+                _Pragma("omp task")
+                {
+                    try {
+                        read(read_block, read_block % nslots,
+                                first_line(read_block), lines(read_block));
+                    } catch (...) {
+                        errors[read_block] = std::current_exception();
+                    }
+                }
+            }
+            if (write_block >= 0) {
+                _Pragma("omp task")
+                {
+                    try {
+                        write(write_block, write_block % nslots,
+                                first_line(write_block), lines(write_block));
+                    } catch (...) {
+                        errors[write_block] = std::current_exception();
+                    }
+                }
+            }
+            if (compute_block >= 0 && compute_block < nblocks) {
+                const int slot = compute_block % nslots;
+                const long n = lines(compute_block);
+                _Pragma("omp taskloop")
+                for (long i = 0; i < n; ++i) {
+                    try {
+                        compute(slot, i);
+                    } catch (...) {
+                        _Pragma("omp critical")
+                        errors[compute_block] = std::current_exception();
+                    }
+                }
+            }
+            _Pragma("omp taskwait")
+
+            if (failed()) {
+                break;
+            }
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}}} // namespace isce3::core::detail
@@ -42,6 +42,7 @@ namespace isce3 {
         template<class> class LinearKernel;
         template<class> class NFFTKernel;
         template<class> class TabulatedKernel;
+        template<class, int> class TabulatedKernelN;
         template<class> class ChebyKernel;
 
         // using-declarations
@@ -1,5 +1,6 @@
 #include "Backproject.h"
 
+#include <algorithm>
 #include <cmath>
 #include <isce3/container/RadarGeometry.h>
 #include <isce3/core/Constants.h>
@@ -12,7 +13,9 @@
 #include <isce3/geometry/geometry.h>
 #include <isce3/geometry/rdr2geo_roots.h>
 #include <isce3/geometry/geo2rdr_roots.h>
+#include <isce3/math/Phasor.h>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -27,6 +30,7 @@ using isce3::container::RadarGeometry;
 namespace isce3 {
 namespace focus {
 
+template<class KernelType>
 inline std::complex<float> sumCoherent(const std::complex<float>* data,
                                        const Linspace<double>& sampling_window,
                                        const std::vector<Vec3>& pos,
@@ -34,34 +38,93 @@ inline std::complex<float> sumCoherent(const std::complex<float>* data,
                                        const Vec3& x,
                                        double fc,
                                        double tau_atm,
-                                       const Kernel<float>& kernel,
+                                       const KernelType& kernel,
                                        int kstart, int kstop)
 {
-    // loop over pulses within integration window
-    std::complex<double> sum(0., 0.);
-    for (int k = kstart; k < kstop; ++k) {
-
-        // compute round-trip delay to target
-        double tau = tau_atm + bistaticDelay(pos[k], vel[k], x);
-
-        // interpolate range-compressed data
-        auto data_line = &data[size_t(k) * sampling_window.size()];
-        double u = (tau - sampling_window.first()) / sampling_window.spacing();
-        std::complex<double> s =
-                interp1d(kernel, data_line, sampling_window.size(), 1, u);
+    // loop over pulses within integration window, in chunks so that the
+    // phase migration compensation is applied with one vectorized rotation
+    constexpr int chunk = 64;
+    std::complex<double> samples[chunk];
+    double phases[chunk];
 
-        // apply phase migration compensation
-        double phi = 2. * M_PI * fc * tau;
-        s *= std::complex<double>(std::cos(phi), std::sin(phi));
+    std::complex<double> sum(0., 0.);
+    for (int kchunk = kstart; kchunk < kstop; kchunk += chunk) {
+        const int n = std::min(chunk, kstop - kchunk);
+        for (int i = 0; i < n; ++i) {
+            const int k = kchunk + i;
+
+            // compute round-trip delay to target
+            double tau = tau_atm + bistaticDelay(pos[k], vel[k], x);
+
+            // interpolate range-compressed data
+            auto data_line = &data[size_t(k) * sampling_window.size()];
+            double u = (tau - sampling_window.first()) /
+                       sampling_window.spacing();
+            samples[i] = interp1d(kernel, data_line, sampling_window.size(), 1,
+                                  u);
+
+            // phase migration compensation
+            phases[i] = 2. * M_PI * fc * tau;
+        }
+        isce3::math::rotate(samples, phases, n);
 
         // worst-case numerical error increases linearly, accumulate using
         // double precision to mitigate errors
-        sum += s;
+        for (int i = 0; i < n; ++i) {
+            sum += samples[i];
+        }
     }
 
     return std::complex<float>(sum);
 }
 
+/** Fixed-width copies of a tabulated kernel with one of the common widths,
+ * so that the tap loop of interp1d() can be unrolled.
+ */
+struct FixedWidthKernels {
+    const Kernel<float>& kernel;
+    std::unique_ptr<TabulatedKernelN<float, 8>> kernel8;
+    std::unique_ptr<TabulatedKernelN<float, 9>> kernel9;
+
+    explicit FixedWidthKernels(const Kernel<float>& kernel) : kernel(kernel)
+    {
+        auto table = dynamic_cast<const TabulatedKernel<float>*>(&kernel);
+        if (table == nullptr) {
+            return;
+        }
+        switch (static_cast<int>(std::ceil(kernel.width()))) {
+        case 8:
+            kernel8 = std::make_unique<TabulatedKernelN<float, 8>>(*table);
+            break;
+        case 9:
+            kernel9 = std::make_unique<TabulatedKernelN<float, 9>>(*table);
+            break;
+        }
+    }
+};
+
+inline std::complex<float> sumCoherent(const std::complex<float>* data,
+                                       const Linspace<double>& sampling_window,
+                                       const std::vector<Vec3>& pos,
+                                       const std::vector<Vec3>& vel,
+                                       const Vec3& x,
+                                       double fc,
+                                       double tau_atm,
+                                       const FixedWidthKernels& kernels,
+                                       int kstart, int kstop)
+{
+    if (kernels.kernel8) {
+        return sumCoherent(data, sampling_window, pos, vel, x, fc, tau_atm,
+                           *kernels.kernel8, kstart, kstop);
+    }
+    if (kernels.kernel9) {
+        return sumCoherent(data, sampling_window, pos, vel, x, fc, tau_atm,
+                           *kernels.kernel9, kstart, kstop);
+    }
+    return sumCoherent(data, sampling_window, pos, vel, x, fc, tau_atm,
+                       kernels.kernel, kstart, kstop);
+}
+
 ErrorCode
 backproject(std::complex<float>* out, const RadarGeometry& out_geometry,
         const std::complex<float>* in, const RadarGeometry& in_geometry,
@@ -118,6 +181,9 @@ backproject(std::complex<float>* out, const RadarGeometry& out_geometry,
     // carrier wavelength
     double wvl = c / fc;
 
+    // fixed-width copy of the interpolation kernel, if available
+    const FixedWidthKernels fixed_kernels(kernel);
+
     // loop over targets in output grid
     bool all_converged = true;
 #pragma omp parallel for collapse(2)
@@ -201,7 +267,7 @@ backproject(std::complex<float>* out, const RadarGeometry& out_geometry,
             // integrate pulses
             out[j * out_geometry.gridWidth() + i] =
                     sumCoherent(in, sampling_window, pos, vel, x, fc, tau_atm,
-                                kernel, kstart, kstop);
+                                fixed_kernels, kstart, kstop);
         }
     }
 
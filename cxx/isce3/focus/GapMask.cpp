@@ -43,15 +43,22 @@ GapMask::GapMask(const std::vector<double> & azimuth_time, int samples,
     if (guard < 0.) {
         throw DomainError(ISCE_SRCINFO(), "require guard band >= 0");
     }
+    // Count pulses transmitted before the end of each RX window.  This is
+    // the same stopping criterion used by forEachGap, so it's an upper bound
+    // on the number of gaps in any pulse.
+    const double rxlen = dwp + n / fs;
+    for (int pulse = 0; pulse < t.size(); ++pulse) {
+        const auto end = std::upper_bound(t.begin() + pulse, t.end(),
+                                          t[pulse] + rxlen + guard);
+        const int ngaps = std::distance(t.begin() + pulse, end);
+        maxgaps = std::max(maxgaps, ngaps);
+    }
 }
 
-std::vector<std::pair<int, int>>
-GapMask::gaps(int pulse) const
+template<typename F>
+void
+GapMask::forEachGap(int pulse, F&& f) const
 {
-    if ((pulse < 0) || (pulse >= t.size())) {
-        throw isce3::except::DomainError(ISCE_SRCINFO(), "pulse out of bounds");
-    }
-    std::vector<std::pair<int, int>> g;
     const double t0 = t[pulse] + dwp;
     const double t1 = t0 + n / fs;
     // Loop over pulses in the air.
@@ -68,9 +75,27 @@ GapMask::gaps(int pulse) const
         if ((j0 <= n) && (j1 >= 0)) {
             j0 = std::max(0, j0);
             j1 = std::min(n, j1);
-            g.push_back(std::make_pair(j0, j1));
+            f(j0, j1);
         }
     }
+}
+
+void
+GapMask::checkPulses(int pulse, int npulses) const
+{
+    if ((pulse < 0) || (npulses < 0) || (pulse + npulses > t.size())) {
+        throw isce3::except::DomainError(ISCE_SRCINFO(), "pulse out of bounds");
+    }
+}
+
+std::vector<std::pair<int, int>>
+GapMask::gaps(int pulse) const
+{
+    checkPulses(pulse, 1);
+    std::vector<std::pair<int, int>> g;
+    forEachGap(pulse, [&](int j0, int j1) {
+        g.push_back(std::make_pair(j0, j1));
+    });
     return g;
 }
 
@@ -78,13 +103,58 @@ std::vector<bool>
 GapMask::mask(int pulse) const
 {
     // convert pairs of [start, stop) intervals to boolean mask.
+    checkPulses(pulse, 1);
     std::vector<bool> mask(n, false);
-    for (const auto & gap : gaps(pulse)) {
-        for (auto i = gap.first; i < gap.second; ++i) {
+    forEachGap(pulse, [&](int j0, int j1) {
+        for (auto i = j0; i < j1; ++i) {
             mask[i] = true;
         }
-    }
+    });
     return mask;
 }
 
+void
+GapMask::mask(bool* mask, int pulse, int npulses) const
+{
+    checkPulses(pulse, npulses);
+    #pragma omp parallel for
+    for (int ip = 0; ip < npulses; ++ip) {
+        bool* row = mask + static_cast<long>(ip) * n;
+        std::fill(row, row + n, false);
+        forEachGap(pulse + ip, [&](int j0, int j1) {
+            std::fill(row + j0, row + j1, true);
+        });
+    }
+}
+
+void
+GapMask::gaps(std::pair<int, int>* intervals, int* count, int pulse,
+              int npulses, int max_gaps) const
+{
+    checkPulses(pulse, npulses);
+    if (max_gaps < 0) {
+        throw isce3::except::DomainError(ISCE_SRCINFO(),
+            "require max_gaps >= 0");
+    }
+    bool overflow = false;
+    #pragma omp parallel for reduction(||:overflow)
+    for (int ip = 0; ip < npulses; ++ip) {
+        auto row = intervals + static_cast<long>(ip) * max_gaps;
+        int ngaps = 0;
+        forEachGap(pulse + ip, [&](int j0, int j1) {
+            if (ngaps < max_gaps) {
+                row[ngaps] = std::make_pair(j0, j1);
+            } else {
+                overflow = true;
+            }
+            ++ngaps;
+        });
+        count[ip] = std::min(ngaps, max_gaps);
+    }
+    if (overflow) {
+        throw isce3::except::LengthError(ISCE_SRCINFO(),
+            "interval table too small, see maxGapsPerPulse()");
+    }
+}
+
 }} // namespace isce3::focus
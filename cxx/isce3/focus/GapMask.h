@@ -39,13 +39,59 @@ public:
     std::vector<bool>
     mask(int pulse) const;
 
+    /** Compute gap masks for a block of pulses.
+     *
+     * No memory is allocated, and pulses are processed in parallel.
+     *
+     * @param[out] mask     Row-major buffer of shape (npulses, samples())
+     *                      set to true for samples blocked by transmit events.
+     * @param[in]  pulse    Index of first range line
+     * @param[in]  npulses  Number of range lines
+     */
+    void
+    mask(bool* mask, int pulse, int npulses) const;
+
+    /** Upper bound on the number of gaps in any pulse. */
+    int maxGapsPerPulse() const { return maxgaps; }
+
+    /** Compute gap locations for a block of pulses.
+     *
+     * No memory is allocated, and pulses are processed in parallel.
+     * Intervals are stored in a row-major table with `max_gaps` entries per
+     * pulse, of which the first `count[i]` entries are valid for pulse i.
+     * A table wide enough for any pulse can be sized with maxGapsPerPulse().
+     *
+     * @param[out] intervals List of [start, stop) range indices blocked by
+     *                       transmit events, shape (npulses, max_gaps)
+     * @param[out] count     Number of gaps in each pulse, length npulses
+     * @param[in]  pulse     Index of first range line
+     * @param[in]  npulses   Number of range lines
+     * @param[in]  max_gaps  Capacity of interval table for each pulse
+     */
+    void
+    gaps(std::pair<int, int>* intervals, int* count, int pulse, int npulses,
+         int max_gaps) const;
+
+    /** Number of pulses */
+    int pulses() const { return static_cast<int>(t.size()); }
+
+    /** Number of range samples per pulse */
+    int samples() const { return n; }
+
 private:
+    // Call f(start, stop) for each gap in the given pulse.
+    template<typename F>
+    void forEachGap(int pulse, F&& f) const;
+
+    void checkPulses(int pulse, int npulses) const;
+
     std::vector<double> t;
     int n;
     double dwp;
     double fs;
     double chirplen;
     double guard;
+    int maxgaps = 0;
 };
 
 }} // namespace isce3::focus
@@ -1,6 +1,8 @@
 
 #include "Presum.h"
 
+#include <isce3/except/Error.h>
+
 namespace isce3 { namespace focus {
 
 Eigen::MatrixXd fillWeights(
@@ -30,4 +32,35 @@ Eigen::MatrixXd fillWeights(
     return out;
 }
 
+std::vector<std::uint64_t>
+getGapPatternIds(const GapMask& gaps, long offset, int npulses)
+{
+    if ((npulses < 0) or (npulses > 64)) {
+        throw isce3::except::LengthError(ISCE_SRCINFO(),
+                "gap pattern hash requires 0 <= npulses <= 64");
+    }
+    if ((offset < 0) or (offset + npulses > gaps.pulses())) {
+        throw isce3::except::OutOfRange(ISCE_SRCINFO(),
+                "requested pulses are out of bounds");
+    }
+    // Start with all pulses valid and clear bits that fall in a gap.
+    const std::uint64_t all_valid = (npulses == 64) ?
+            ~std::uint64_t(0) : (std::uint64_t(1) << npulses) - 1;
+    std::vector<std::uint64_t> ids(gaps.samples(), all_valid);
+    const int maxgaps = gaps.maxGapsPerPulse();
+    std::vector<std::pair<int, int>> intervals(npulses * maxgaps);
+    std::vector<int> count(npulses);
+    gaps.gaps(intervals.data(), count.data(), offset, npulses, maxgaps);
+    for (int j = 0; j < npulses; ++j) {
+        const std::uint64_t bit = std::uint64_t(1) << j;
+        for (int i = 0; i < count[j]; ++i) {
+            const auto& gap = intervals[j * maxgaps + i];
+            for (int k = gap.first; k < gap.second; ++k) {
+                ids[k] &= ~bit;
+            }
+        }
+    }
+    return ids;
+}
+
 }} // namespace isce3::focus
@@ -3,9 +3,13 @@
 
 #include <isce3/core/forward.h>
 #include <Eigen/Dense>
+#include <complex>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
+#include "GapMask.h"
+
 namespace isce3 { namespace focus {
 
 /** Get weight vector needed to reconstruct a sample at the given time.
@@ -65,6 +69,123 @@ Eigen::MatrixXd fillWeights(
         const std::unordered_map<long, const Eigen::Ref<const Eigen::VectorXd>>&
                 lut);
 
+
+/** Get the sorted unique values of a list of identifiers.
+ *
+ * Equivalent to numpy.unique, but faster when the input contains long runs of
+ * repeated values (as gap pattern identifiers do) since consecutive
+ * duplicates are dropped before sorting.
+ *
+ * @param[in] ids Vector of identifiers
+ * @returns Sorted unique identifiers
+ */
+template<typename T>
+std::vector<T>
+getUniqueIds(std::vector<T> ids);
+
+
+/** Compute an identifier for the pattern of gaps seen by each range bin.
+ *
+ * Bit j of the identifier is set when pulse `offset + j` is free of transmit
+ * gaps at that range bin.  Range bins sharing an identifier share presum
+ * weights, so the number of weight solutions needed is the number of unique
+ * identifiers (typically a handful) rather than the number of range bins.
+ *
+ * @param[in] gaps    Gap mask for the raw data.
+ * @param[in] offset  Index of first pulse.
+ * @param[in] npulses Number of pulses (at most 64).
+ * @returns Identifier for each range bin, length gaps.samples()
+ */
+std::vector<std::uint64_t>
+getGapPatternIds(const GapMask& gaps, long offset, int npulses);
+
+
+/** Solve for the presum weights of each unique gap pattern.
+ *
+ * Weight vectors are computed (in parallel) once per unique identifier using
+ * only the valid pulses of the pattern, then zero-filled at the invalid
+ * pulses so that all vectors have length `npulses`.
+ *
+ * @tparam KernelType One of the kernels available in isce3/core/Kernels.h
+ *
+ * @param[in]  acorr   Autocorrelation function (same time units as xin).
+ * @param[in]  xin     Available sample times, monotonically increasing.
+ * @param[in]  xout    Desired output sample time.
+ * @param[in]  offset  Index of first pulse in the pattern.
+ * @param[in]  npulses Number of pulses in the pattern.
+ * @param[in]  ids     Gap pattern identifiers, see getGapPatternIds
+ * @returns Weight vector (length npulses) for each unique identifier.
+ */
+template<typename KernelType>
+std::unordered_map<std::uint64_t, Eigen::VectorXd>
+getPresumWeightsLUT(const KernelType& acorr,
+                    const Eigen::Ref<const Eigen::VectorXd>& xin, double xout,
+                    long offset, int npulses,
+                    const std::vector<std::uint64_t>& ids);
+
+
+/** Reconstruct a uniformly sampled pulse from raw data with gaps.
+ *
+ * Computes the output sample at each range bin k as
+ *
+ * \f$ y_k = \sum_j w_{ids[k]}[j] \; e^{-i 2 \pi (x_{in}[o+j] - x_{out})
+ *     f_{d,k}} \; z(o+j, k) \f$
+ *
+ * where `o` is the offset returned by getPresumWeights and the weight vectors
+ * are shared between all range bins with the same gap pattern (see
+ * getGapPatternIds and getPresumWeightsLUT).  Since the Doppler phase is zero
+ * at the output time, no reramp is needed afterwards.
+ *
+ * @tparam KernelType One of the kernels available in isce3/core/Kernels.h
+ *
+ * @param[out] out     Output pulse, length gaps.samples()
+ * @param[in]  acorr   Autocorrelation function (same time units as xin).
+ * @param[in]  xin     Pulse times, length gaps.pulses()
+ * @param[in]  xout    Desired output pulse time.
+ * @param[in]  gaps    Gap mask describing blind ranges of the raw data.
+ * @param[in]  raw     Raw data, row-major, shape (gaps.pulses(),
+ *                     gaps.samples())
+ * @param[in]  doppler Doppler (Hz, reciprocal time units of xin) at each
+ *                     range bin, length gaps.samples()
+ */
+template<typename KernelType>
+void
+presumPulse(std::complex<float>* out, const KernelType& acorr,
+            const Eigen::Ref<const Eigen::VectorXd>& xin, double xout,
+            const GapMask& gaps, const std::complex<float>* raw,
+            const Eigen::Ref<const Eigen::VectorXd>& doppler);
+
+
+/** Reconstruct a uniformly sampled pulse from a block of pulses given the
+ * gap pattern of each range bin.
+ *
+ * Same as the GapMask overload, except that the valid pulses of each range
+ * bin are given by their identifiers (bit j set when pulse `offset + j` is
+ * valid) and that only the pulses in play are supplied.
+ *
+ * @tparam KernelType One of the kernels available in isce3/core/Kernels.h
+ *
+ * @param[out] out     Output pulse, length ids.size()
+ * @param[in]  acorr   Autocorrelation function (same time units as xin).
+ * @param[in]  xin     Pulse times of all the raw data
+ * @param[in]  xout    Desired output pulse time.
+ * @param[in]  offset  Index of first pulse, as returned by getPresumWeights
+ * @param[in]  npulses Number of pulses, length of the weights returned by
+ *                     getPresumWeights (at most 64)
+ * @param[in]  ids     Gap pattern identifier of each range bin
+ * @param[in]  raw     Pulses offset to offset + npulses, row-major, shape
+ *                     (npulses, ids.size())
+ * @param[in]  doppler Doppler (Hz, reciprocal time units of xin) at each
+ *                     range bin, length ids.size()
+ */
+template<typename KernelType>
+void
+presumPulse(std::complex<float>* out, const KernelType& acorr,
+            const Eigen::Ref<const Eigen::VectorXd>& xin, double xout,
+            long offset, int npulses, const std::vector<std::uint64_t>& ids,
+            const std::complex<float>* raw,
+            const Eigen::Ref<const Eigen::VectorXd>& doppler);
+
 }} // namespace isce3::focus
 
 #include "Presum.icc"
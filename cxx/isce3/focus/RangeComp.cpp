@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <limits>
 
+#include <isce3/core/Instrumentation.h>
 #include <isce3/except/Error.h>
+#include <isce3/fft/detail/Threads.h>
 
 namespace isce3 { namespace focus {
 
@@ -36,10 +38,22 @@ formRangeReference(const std::vector<std::complex<float>> & chirp, int fftsize)
     return reffn;
 }
 
+// number of threads of the FFT plans, by default one per batch item up to
+// the max number of threads
+static
+int fftThreads(int maxbatch, int threads)
+{
+    if (threads > 0) {
+        return threads;
+    }
+    return std::max(1, std::min(maxbatch, fft::detail::getMaxThreads()));
+}
+
 RangeComp::RangeComp(const std::vector<std::complex<float>> & chirp,
                      int inputsize,
                      int maxbatch,
-                     Mode mode)
+                     Mode mode,
+                     int threads)
 :
     _chirpsize([=]()
         {
@@ -68,8 +82,10 @@ RangeComp::RangeComp(const std::vector<std::complex<float>> & chirp,
     _mode(mode),
     _reffn(formRangeReference(chirp, _fftsize)),
     _wkspc(std::size_t(maxbatch) * _fftsize),
-    _fftplan(fft::planfft1d(_wkspc.data(), _wkspc.data(), {maxbatch, _fftsize}, 1)),
-    _ifftplan(fft::planifft1d(_wkspc.data(), _wkspc.data(), {maxbatch, _fftsize}, 1))
+    _fftplan(_wkspc.data(), _wkspc.data(), _fftsize, _fftsize, 1, _fftsize,
+             maxbatch, FFTW_MEASURE, fftThreads(maxbatch, threads)),
+    _ifftplan(_wkspc.data(), _wkspc.data(), _fftsize, _fftsize, 1, _fftsize,
+              maxbatch, FFTW_MEASURE, fftThreads(maxbatch, threads))
 {}
 
 int RangeComp::outputSize() const
@@ -96,6 +112,9 @@ void RangeComp::rangecompress(std::complex<float> * out,
         throw isce3::except::LengthError(ISCE_SRCINFO(), "batch size exceeds max batch");
     }
 
+    isce3::core::instrumentation::ScopedTimer timer("rangecomp.batch");
+    isce3::core::instrumentation::count("rangecomp.pulses", batch);
+
     // copy input data to internal workspace buffer & zero pad to FFT length
     int padding = fftSize() - inputSize();
     #pragma omp parallel for
@@ -48,11 +48,15 @@ public:
      * \param[in] inputsize Number of range samples in the signal to be compressed
      * \param[in] maxbatch  Max batch size
      * \param[in] mode      Convolution output mode
+     * \param[in] threads   Thread count of the FFT plans. If less than 1,
+     *                      use one thread per batch item, up to the max
+     *                      number of threads.
      */
     RangeComp(const std::vector<std::complex<float>> & chirp,
               int inputsize,
               int maxbatch = 1,
-              Mode mode = Mode::Full);
+              Mode mode = Mode::Full,
+              int threads = 0);
 
     /** Number of samples in chirp */
     int chirpSize() const { return _chirpsize; }
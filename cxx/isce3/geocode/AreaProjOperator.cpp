@@ -0,0 +1,266 @@
+#include "AreaProjOperator.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include <isce3/except/Error.h>
+#include <isce3/io/IH5.h>
+#include <isce3/io/Serialization.h>
+
+namespace isce3 { namespace geocode {
+
+std::size_t AreaProjOperator::nnz() const
+{
+    std::size_t n = 0;
+    for (const auto& block : _blocks)
+        n += block.index.size();
+    return n;
+}
+
+std::size_t AreaProjOperator::memorySize() const
+{
+    std::size_t n = 0;
+    for (const auto& block : _blocks) {
+        n += block.row_offset.size() * sizeof(std::uint64_t) +
+             block.index.size() * sizeof(std::uint32_t) +
+             block.weight.size() * sizeof(float);
+    }
+    return n;
+}
+
+void AreaProjOperator::compress(
+        Block& block, std::vector<Entry>& entries, int npixels)
+{
+    block.row_offset.clear();
+    block.index.clear();
+    block.weight.clear();
+
+    if (entries.empty())
+        return;
+
+    // counting sort of the entries by pixel, keeping the order of the
+    // samples within each pixel
+    block.row_offset.assign(npixels + 1, 0);
+    for (const auto& entry : entries)
+        block.row_offset[entry.pixel + 1]++;
+    for (int pixel = 0; pixel < npixels; ++pixel)
+        block.row_offset[pixel + 1] += block.row_offset[pixel];
+
+    block.index.resize(entries.size());
+    block.weight.resize(entries.size());
+    std::vector<std::uint64_t> next(
+            block.row_offset.begin(), block.row_offset.end() - 1);
+    for (const auto& entry : entries) {
+        const std::uint64_t k = next[entry.pixel]++;
+        block.index[k] = entry.index;
+        block.weight[k] = entry.weight;
+    }
+
+    entries.clear();
+    entries.shrink_to_fit();
+}
+
+void AreaProjOperator::saveToH5(isce3::io::IGroup& group) const
+{
+    using isce3::io::saveToH5;
+
+    saveToH5(group, "geogridStartX", _geogrid_start_x);
+    saveToH5(group, "geogridStartY", _geogrid_start_y);
+    saveToH5(group, "geogridSpacingX", _geogrid_spacing_x);
+    saveToH5(group, "geogridSpacingY", _geogrid_spacing_y);
+    saveToH5(group, "geogridLength", _geogrid_length);
+    saveToH5(group, "geogridWidth", _geogrid_width);
+    saveToH5(group, "epsg", _epsg);
+
+    saveToH5(group, "inputLength", _input_length);
+    saveToH5(group, "inputWidth", _input_width);
+    saveToH5(group, "radarOffsetY", _radar_offset_y);
+    saveToH5(group, "radarOffsetX", _radar_offset_x);
+    saveToH5(group, "radarLength", _radar_length);
+    saveToH5(group, "radarWidth", _radar_width);
+    saveToH5(group, "upsampleRadarGrid", int(_upsample_radar_grid));
+    saveToH5(group, "radarGridSingleBlock", int(_radar_grid_single_block));
+    saveToH5(group, "complexOutput", int(_complex_output));
+
+    saveToH5(group, "memoryMode", int(_memory_mode));
+    saveToH5(group, "minBlockSize", _min_block_size);
+    saveToH5(group, "maxBlockSize", _max_block_size);
+
+    // geometry of the blocks and offsets of their CSR arrays in the
+    // concatenated datasets
+    const std::size_t nblocks = _blocks.size();
+    std::vector<int> geometry(nblocks * 8);
+    std::vector<std::uint64_t> row_offset_start(nblocks + 1, 0);
+    std::vector<std::uint64_t> entry_start(nblocks + 1, 0);
+    for (std::size_t i = 0; i < nblocks; ++i) {
+        const Block& block = _blocks[i];
+        const int values[8] = {block.y0, block.x0, block.length, block.width,
+                block.radar_y0, block.radar_x0, block.radar_length,
+                block.radar_width};
+        std::copy(values, values + 8, geometry.begin() + 8 * i);
+        row_offset_start[i + 1] =
+                row_offset_start[i] + block.row_offset.size();
+        entry_start[i + 1] = entry_start[i] + block.index.size();
+    }
+
+    std::vector<std::uint64_t> row_offset;
+    std::vector<std::uint32_t> index;
+    std::vector<float> weight;
+    row_offset.reserve(row_offset_start[nblocks]);
+    index.reserve(entry_start[nblocks]);
+    weight.reserve(entry_start[nblocks]);
+    for (const Block& block : _blocks) {
+        row_offset.insert(row_offset.end(), block.row_offset.begin(),
+                block.row_offset.end());
+        index.insert(index.end(), block.index.begin(), block.index.end());
+        weight.insert(weight.end(), block.weight.begin(), block.weight.end());
+    }
+
+    saveToH5(group, "numBlocks", int(nblocks));
+    if (nblocks == 0)
+        return;
+    std::array<std::size_t, 2> geometry_dims {nblocks, 8};
+    saveToH5(group, "blockGeometry", geometry, geometry_dims);
+    saveToH5(group, "blockRowOffsetStart", row_offset_start);
+    saveToH5(group, "blockEntryStart", entry_start);
+
+    // empty datasets are not written
+    if (entry_start[nblocks] == 0)
+        return;
+    saveToH5(group, "rowOffset", row_offset);
+    saveToH5(group, "index", index);
+    saveToH5(group, "weight", weight);
+}
+
+void AreaProjOperator::loadFromH5(isce3::io::IGroup& group)
+{
+    using isce3::io::loadFromH5;
+
+    loadFromH5(group, "geogridStartX", _geogrid_start_x);
+    loadFromH5(group, "geogridStartY", _geogrid_start_y);
+    loadFromH5(group, "geogridSpacingX", _geogrid_spacing_x);
+    loadFromH5(group, "geogridSpacingY", _geogrid_spacing_y);
+    loadFromH5(group, "geogridLength", _geogrid_length);
+    loadFromH5(group, "geogridWidth", _geogrid_width);
+    loadFromH5(group, "epsg", _epsg);
+
+    loadFromH5(group, "inputLength", _input_length);
+    loadFromH5(group, "inputWidth", _input_width);
+    loadFromH5(group, "radarOffsetY", _radar_offset_y);
+    loadFromH5(group, "radarOffsetX", _radar_offset_x);
+    loadFromH5(group, "radarLength", _radar_length);
+    loadFromH5(group, "radarWidth", _radar_width);
+
+    int flag;
+    loadFromH5(group, "upsampleRadarGrid", flag);
+    _upsample_radar_grid = flag;
+    loadFromH5(group, "radarGridSingleBlock", flag);
+    _radar_grid_single_block = flag;
+    loadFromH5(group, "complexOutput", flag);
+    _complex_output = flag;
+
+    int memory_mode;
+    loadFromH5(group, "memoryMode", memory_mode);
+    _memory_mode = static_cast<isce3::core::GeocodeMemoryMode>(memory_mode);
+    loadFromH5(group, "minBlockSize", _min_block_size);
+    loadFromH5(group, "maxBlockSize", _max_block_size);
+
+    int nblocks;
+    loadFromH5(group, "numBlocks", nblocks);
+    _blocks.clear();
+    if (nblocks <= 0)
+        return;
+
+    std::vector<int> geometry;
+    std::vector<std::uint64_t> row_offset_start, entry_start;
+    loadFromH5(group, "blockGeometry", geometry);
+    loadFromH5(group, "blockRowOffsetStart", row_offset_start);
+    loadFromH5(group, "blockEntryStart", entry_start);
+    if (geometry.size() != std::size_t(nblocks) * 8 ||
+            row_offset_start.size() != std::size_t(nblocks) + 1 ||
+            entry_start.size() != std::size_t(nblocks) + 1) {
+        std::string error_msg = "ERROR inconsistent block datasets in the"
+                                " area-projection operator";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    std::vector<std::uint64_t> row_offset;
+    std::vector<std::uint32_t> index;
+    std::vector<float> weight;
+    if (entry_start[nblocks] > 0) {
+        loadFromH5(group, "rowOffset", row_offset);
+        loadFromH5(group, "index", index);
+        loadFromH5(group, "weight", weight);
+    }
+    if (row_offset.size() != row_offset_start[nblocks] ||
+            index.size() != entry_start[nblocks] ||
+            weight.size() != entry_start[nblocks]) {
+        std::string error_msg = "ERROR inconsistent CSR datasets in the"
+                                " area-projection operator";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    _blocks.resize(nblocks);
+    for (int i = 0; i < nblocks; ++i) {
+        Block& block = _blocks[i];
+        const int* values = geometry.data() + 8 * i;
+        block.y0 = values[0];
+        block.x0 = values[1];
+        block.length = values[2];
+        block.width = values[3];
+        block.radar_y0 = values[4];
+        block.radar_x0 = values[5];
+        block.radar_length = values[6];
+        block.radar_width = values[7];
+
+        if (block.y0 < 0 || block.x0 < 0 || block.length < 0 ||
+                block.width < 0 ||
+                block.y0 + block.length > _geogrid_length ||
+                block.x0 + block.width > _geogrid_width ||
+                block.radar_y0 < 0 || block.radar_x0 < 0 ||
+                block.radar_length < 0 || block.radar_width < 0) {
+            std::string error_msg = "ERROR invalid geometry of block " +
+                                    std::to_string(i) +
+                                    " of the area-projection operator";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+
+        block.row_offset.assign(row_offset.begin() + row_offset_start[i],
+                row_offset.begin() + row_offset_start[i + 1]);
+        block.index.assign(index.begin() + entry_start[i],
+                index.begin() + entry_start[i + 1]);
+        block.weight.assign(weight.begin() + entry_start[i],
+                weight.begin() + entry_start[i + 1]);
+        const std::size_t npixels = std::size_t(block.length) * block.width;
+        const bool valid_row_offset =
+                block.row_offset.empty()
+                        ? block.index.empty()
+                        : block.row_offset.size() == npixels + 1 &&
+                                  block.row_offset.front() == 0 &&
+                                  block.row_offset.back() ==
+                                          block.index.size() &&
+                                  std::is_sorted(block.row_offset.begin(),
+                                          block.row_offset.end());
+        if (!valid_row_offset) {
+            std::string error_msg = "ERROR invalid row offsets of block " +
+                                    std::to_string(i) +
+                                    " of the area-projection operator";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+
+        // the samples should lie within the radar window of the block
+        const std::uint64_t radar_size =
+                std::uint64_t(block.radar_length) * block.radar_width;
+        if (std::any_of(block.index.begin(), block.index.end(),
+                    [&](std::uint32_t k) { return k >= radar_size; })) {
+            std::string error_msg = "ERROR sample indices of block " +
+                                    std::to_string(i) +
+                                    " of the area-projection operator are"
+                                    " outside of its radar window";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+    }
+}
+
+}} // namespace isce3::geocode
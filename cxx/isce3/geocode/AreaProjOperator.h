@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <isce3/core/blockProcessing.h>
+#include <isce3/io/forward.h>
+
+namespace isce3 { namespace geocode {
+
+template<class T>
+class Geocode;
+
+/**
+ * Sparse radar-to-geo operator of the area-projection geocoding.
+ *
+ * The operator holds, for each geogrid pixel, the radar samples that
+ * contribute to it and their weights, including the polygon-intersection
+ * footprint, the RTC normalization, the absolute calibration factor, the
+ * geogrid upsampling and the sample masking (layover/shadow, sub-swaths,
+ * minimum number of looks). It is filled by Geocode::geocodeAreaProj()
+ * and can then be applied by Geocode::applyAreaProjOperator() to any number
+ * of bands sharing the same radar grid, skipping the geometry entirely.
+ *
+ * The contributions are kept per geogrid block in compressed sparse row
+ * (CSR) format: the row of each pixel lists the linear indices of its radar
+ * samples within the radar window read for the block, and the pixels
+ * without contributions are set to NaN.
+ */
+class AreaProjOperator {
+public:
+    /** Contributions to the pixels of one geogrid block */
+    struct Block {
+        /** First line of the block in the geogrid */
+        int y0 = 0;
+        /** First column of the block in the geogrid */
+        int x0 = 0;
+        /** Number of lines of the block */
+        int length = 0;
+        /** Number of columns of the block */
+        int width = 0;
+
+        /** First line of the radar window relative to the radar grid of
+         * the operator (blocks of the radar grid only) */
+        int radar_y0 = 0;
+        /** First column of the radar window (blocks of the radar grid
+         * only) */
+        int radar_x0 = 0;
+        /** Number of lines of the radar window */
+        int radar_length = 0;
+        /** Number of columns of the radar window */
+        int radar_width = 0;
+
+        /** Offsets of the rows of the pixels in `index` and `weight`,
+         * length * width + 1 elements, or empty if no pixel is valid */
+        std::vector<std::uint64_t> row_offset;
+        /** Linear index of each contributing sample in the radar window */
+        std::vector<std::uint32_t> index;
+        /** Weight of each contributing sample */
+        std::vector<float> weight;
+    };
+
+    /** A contribution of a radar sample to a pixel of a block */
+    struct Entry {
+        std::uint32_t pixel;
+        std::uint32_t index;
+        float weight;
+    };
+
+    /** Whether the operator has been filled */
+    bool empty() const { return _blocks.empty(); }
+
+    /** Total number of contributions */
+    std::size_t nnz() const;
+
+    /** Memory held by the contributions (bytes) */
+    std::size_t memorySize() const;
+
+    /** Free the contributions */
+    void clear() { _blocks.clear(); }
+
+    /** Number of geogrid blocks */
+    std::size_t numBlocks() const { return _blocks.size(); }
+
+    /** Contributions of a geogrid block */
+    const Block& block(std::size_t i) const { return _blocks[i]; }
+
+    /** Geogrid length (lines) */
+    int geogridLength() const { return _geogrid_length; }
+
+    /** Geogrid width (columns) */
+    int geogridWidth() const { return _geogrid_width; }
+
+    /** Length of the input rasters the operator applies to */
+    int inputLength() const { return _input_length; }
+
+    /** Width of the input rasters the operator applies to */
+    int inputWidth() const { return _input_width; }
+
+    /** Whether the operator applies to complex values (amplitude
+     * geocoding) instead of powers */
+    bool complexOutput() const { return _complex_output; }
+
+    /** Sort the entries of a block by pixel and store them in CSR format.
+     * The entries are consumed. */
+    static void compress(
+            Block& block, std::vector<Entry>& entries, int npixels);
+
+    /** Save the operator to an HDF5 group */
+    void saveToH5(isce3::io::IGroup& group) const;
+
+    /** Load the operator from an HDF5 group written by saveToH5() */
+    void loadFromH5(isce3::io::IGroup& group);
+
+private:
+    template<class T>
+    friend class Geocode;
+
+    std::vector<Block> _blocks;
+
+    // output geogrid
+    double _geogrid_start_x = 0;
+    double _geogrid_start_y = 0;
+    double _geogrid_spacing_x = 0;
+    double _geogrid_spacing_y = 0;
+    int _geogrid_length = 0;
+    int _geogrid_width = 0;
+    int _epsg = 0;
+
+    // input rasters and radar grid of the operator within them
+    int _input_length = 0;
+    int _input_width = 0;
+    int _radar_offset_y = 0;
+    int _radar_offset_x = 0;
+    int _radar_length = 0;
+    int _radar_width = 0;
+    bool _upsample_radar_grid = false;
+    bool _radar_grid_single_block = true;
+    bool _complex_output = false;
+
+    // memory settings used to read the radar grid
+    isce3::core::GeocodeMemoryMode _memory_mode =
+            isce3::core::GeocodeMemoryMode::Auto;
+    long long _min_block_size = isce3::core::DEFAULT_MIN_BLOCK_SIZE;
+    long long _max_block_size = isce3::core::DEFAULT_MAX_BLOCK_SIZE;
+};
+
+}} // namespace isce3::geocode
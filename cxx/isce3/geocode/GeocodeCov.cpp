@@ -5,9 +5,12 @@
 #include <cmath>
 #include <cpl_virtualmem.h>
 #include <limits>
+#include <vector>
 
 #include <isce3/core/Basis.h>
 #include <isce3/core/DenseMatrix.h>
+#include <isce3/core/Instrumentation.h>
+#include <isce3/core/Numa.h>
 #include <isce3/core/Projections.h>
 #include <isce3/core/TypeTraits.h>
 #include <isce3/core/Constants.h>
@@ -17,6 +20,7 @@
 #include <isce3/geometry/RTC.h>
 #include <isce3/geometry/boundingbox.h>
 #include <isce3/geometry/geometry.h>
+#include <isce3/math/Phasor.h>
 #include <isce3/product/GeoGridParameters.h>
 #include <isce3/signal/Looks.h>
 #include <isce3/signal/signalUtils.h>
@@ -26,9 +30,41 @@
 using isce3::core::OrbitInterpBorderMode;
 using isce3::core::Vec3;
 using isce3::core::GeocodeMemoryMode;
+using isce3::core::instrumentation::ScopedTimer;
+namespace instrumentation = isce3::core::instrumentation;
 
 namespace isce3 { namespace geocode {
 
+// Clip the magnitude of a geocoded value to [clip_min, clip_max], keeping
+// the phase of complex values. NaN values and limits are left untouched.
+template<class T_out>
+static void _clipGeoValue(T_out& geo_value, float clip_min, float clip_max)
+{
+    using isce3::math::complex_operations::operator*;
+
+    // no data
+    if (std::isnan(std::abs(geo_value)))
+        return;
+
+    // clip min (complex)
+    else if (!std::isnan(clip_min) && std::abs(geo_value) < clip_min &&
+             isce3::is_complex<T_out>())
+        geo_value = (geo_value * clip_min / std::abs(geo_value));
+
+    // clip min (real)
+    else if (!std::isnan(clip_min) && std::abs(geo_value) < clip_min)
+        geo_value = clip_min;
+
+    // clip max (complex)
+    else if (!std::isnan(clip_max) && std::abs(geo_value) > clip_max &&
+             isce3::is_complex<T_out>())
+        geo_value = (geo_value * clip_max / std::abs(geo_value));
+
+    // clip max (real)
+    else if (!std::isnan(clip_max) && std::abs(geo_value) > clip_max)
+        geo_value = clip_max;
+}
+
 template<class T>
 void Geocode<T>::updateGeoGrid(
         const isce3::product::RadarGridParameters& radar_grid,
@@ -149,7 +185,9 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
         isce3::io::Raster* out_mask,
         GeocodeMemoryMode geocode_memory_mode,
         const long long min_block_size, const long long max_block_size,
-        isce3::core::dataInterpMethod dem_interp_method)
+        isce3::core::dataInterpMethod dem_interp_method,
+        AreaProjOperator* out_area_proj_operator,
+        InterpOperator* out_interp_operator)
 {
     bool flag_complex_to_real = isce3::signal::verifyComplexToRealCasting(
             input_raster, output_raster, exponent);
@@ -168,7 +206,7 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
                 input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask,
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_interp_operator);
     else if (flag_run_geocode_interp &&
              (std::is_same<T, double>::value ||
                      std::is_same<T, std::complex<double>>::value))
@@ -184,7 +222,7 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
                 input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask, 
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_interp_operator);
     else if (flag_run_geocode_interp)
         geocodeInterp<float>(radar_grid, input_raster, output_raster,
                 dem_raster, flag_apply_rtc, flag_az_baseband_doppler, flatten,
@@ -198,7 +236,7 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
                 input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask,
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_interp_operator);
     else if (!flag_complex_to_real)
         geocodeAreaProj<T>(radar_grid, input_raster, output_raster, dem_raster,
                 geogrid_upsampling, flag_upsample_radar_grid, flag_apply_rtc,
@@ -213,7 +251,7 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
                 input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask,
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_area_proj_operator);
     else if (std::is_same<T, double>::value ||
              std::is_same<T, std::complex<double>>::value)
         geocodeAreaProj<double>(radar_grid, input_raster, output_raster,
@@ -229,7 +267,7 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
                 output_rtc, input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask,
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_area_proj_operator);
     else
         geocodeAreaProj<float>(radar_grid, input_raster, output_raster,
                 dem_raster, geogrid_upsampling, flag_upsample_radar_grid,
@@ -244,7 +282,7 @@ void Geocode<T>::geocode(const isce3::product::RadarGridParameters& radar_grid,
                 output_rtc, input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask,
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_area_proj_operator);
 }
 
 template<class T>
@@ -274,7 +312,8 @@ void Geocode<T>::geocodeInterp(
         isce3::io::Raster* out_mask,
         isce3::core::GeocodeMemoryMode geocode_memory_mode, const long long min_block_size,
         const long long max_block_size,
-        isce3::core::dataInterpMethod dem_interp_method)
+        isce3::core::dataInterpMethod dem_interp_method,
+        InterpOperator* out_interp_operator)
 {
     pyre::journal::info_t info("isce.geocode.GeocodeCov.geocodeInterp");
     pyre::journal::warning_t warning("isce.geocode.GeocodeCov.geocodeInterp");
@@ -514,6 +553,19 @@ void Geocode<T>::geocodeInterp(
     info << "block length: " << block_length << pyre::journal::newline;
     info << pyre::journal::newline;
 
+    if (out_interp_operator != nullptr) {
+        out_interp_operator->_blocks.assign(nBlocks, {});
+        out_interp_operator->_geogrid_start_x = geogrid.startX();
+        out_interp_operator->_geogrid_start_y = geogrid.startY();
+        out_interp_operator->_geogrid_spacing_x = geogrid.spacingX();
+        out_interp_operator->_geogrid_spacing_y = geogrid.spacingY();
+        out_interp_operator->_geogrid_length = geogrid.length();
+        out_interp_operator->_geogrid_width = geogrid.width();
+        out_interp_operator->_epsg = geogrid.epsg();
+        out_interp_operator->_radar_grid_length = radar_grid.length();
+        out_interp_operator->_radar_grid_width = radar_grid.width();
+    }
+
     info << "starting geocoding" << pyre::journal::endl;
     // loop over the blocks of the geocoded Grid
     for (int block = 0; block < nBlocks; ++block) {
@@ -542,13 +594,15 @@ void Geocode<T>::geocodeInterp(
             out_geo_dem_array.fill(std::numeric_limits<float>::quiet_NaN());
         }
 
-       // load a block of DEM for the current geocoded grid with a margin of
+        // load a block of DEM for the current geocoded grid with a margin of
         // 50 DEM pixels
+        ScopedTimer demTimer("geocode_cov.interp.load_dem");
         int dem_margin_in_pixels = 50;
         isce3::geometry::DEMInterpolator demInterp =
             isce3::geometry::DEMRasterToInterpolator(
                 demRaster, geogrid, lineStart, geoBlockLength, geogrid.width(),
                 dem_margin_in_pixels, dem_interp_method);
+        demTimer.stop();
 
         // X and Y indices (in the radar coordinates) for the
         // geocoded pixels (after geo2rdr computation)
@@ -560,6 +614,32 @@ void Geocode<T>::geocodeInterp(
         int rangeFirstPixel = radar_grid.width() - 1;
         int rangeLastPixel = 0;
 
+        ScopedTimer geo2rdrTimer("geocode_cov.interp.geo2rdr");
+
+        // Transform the geogrid block to lon/lat one line at a time. The x
+        // coordinates are shared by all lines of the block
+        std::valarray<double> geoX(geogrid.width());
+        for (int pixel = 0; pixel < geogrid.width(); ++pixel)
+            geoX[pixel] = geogrid.startX() + geogrid.spacingX() * (0.5 + pixel);
+        std::valarray<double> geoLon(blockSize);
+        std::valarray<double> geoLat(blockSize);
+
+        int nfailed = 0;
+#pragma omp parallel for reduction(+ : nfailed)
+        for (size_t blockLine = 0; blockLine < geoBlockLength; ++blockLine) {
+            // y coordinate in the out put grid
+            const int line = lineStart + blockLine;
+            const double y =
+                    geogrid.startY() + geogrid.spacingY() * (0.5 + line);
+            const size_t offset = blockLine * geogrid.width();
+            nfailed += proj->inverse_row(geogrid.width(), &geoX[0], y,
+                                         &geoLon[offset], &geoLat[offset]);
+        }
+        if (nfailed != 0) {
+            throw isce3::except::RuntimeError(ISCE_SRCINFO(),
+                    "Inverse projection transformation failed");
+        }
+
         // Loop over lines, samples of the output grid
 #pragma omp parallel for reduction(                                            \
         min                                                                    \
@@ -572,23 +652,14 @@ void Geocode<T>::geocodeInterp(
             size_t blockLine = kk / geogrid.width();
             size_t pixel = kk % geogrid.width();
 
-            // Global line index
-            const int line = lineStart + blockLine;
-
-            // y coordinate in the out put grid
-            double y = geogrid.startY() + geogrid.spacingY() * (0.5 + line);
-
-            // x in the output geocoded Grid
-            double x = geogrid.startX() + geogrid.spacingX() * (0.5 + pixel);
-
             // compute the azimuth time and slant range for the
             // x,y coordinates in the output grid
             double aztime, srange;
             float dem_value;
 
             aztime = radar_grid.sensingMid();
-            int converged = _geo2rdr(radar_grid, x, y, aztime, srange,
-                    demInterp, proj.get(), dem_value);
+            int converged = _geo2rdr(radar_grid, geoLon[kk], geoLat[kk],
+                    aztime, srange, demInterp, dem_value);
 
             // (optional arg) save interpolated DEM element
             if (out_geo_dem != nullptr) {
@@ -650,6 +721,8 @@ void Geocode<T>::geocodeInterp(
             radarY[blockLine * geogrid.width() + pixel] = rdrY;
 
         } // end loops over lines and pixel of output grid
+        geo2rdrTimer.stop();
+        instrumentation::count("geocode_cov.interp.pixels", blockSize);
 
         // (optional arg) flush rdr position values
         if (out_geo_rdr != nullptr)
@@ -680,6 +753,41 @@ void Geocode<T>::geocodeInterp(
         rangeLastPixel = std::min(rangeLastPixel + interp_margin,
                                   static_cast<int>(radar_grid.width() - 1));
 
+        // (optional arg) save the radar positions of the pixels relative
+        // to the radar window, as they are checked by _interpolate()
+        if (out_interp_operator != nullptr) {
+            InterpOperator::Block& op_block =
+                    out_interp_operator->_blocks[block];
+            op_block.y0 = lineStart;
+            op_block.length = geoBlockLength;
+            if (azimuthFirstLine <= azimuthLastLine &&
+                    rangeFirstPixel <= rangeLastPixel) {
+                op_block.radar_y0 = azimuthFirstLine;
+                op_block.radar_x0 = rangeFirstPixel;
+                op_block.radar_length = azimuthLastLine - azimuthFirstLine + 1;
+                op_block.radar_width = rangeLastPixel - rangeFirstPixel + 1;
+                op_block.radar_y.resize(blockSize);
+                op_block.radar_x.resize(blockSize);
+
+#pragma omp parallel for
+                for (int kk = 0; kk < blockSize; ++kk) {
+                    const double rdrY = radarY[kk] - azimuthFirstLine;
+                    const double rdrX = radarX[kk] - rangeFirstPixel;
+                    if (rdrX < interp_margin || rdrY < interp_margin ||
+                            rdrX >= (op_block.radar_width - interp_margin) ||
+                            rdrY >= (op_block.radar_length - interp_margin)) {
+                        op_block.radar_y[kk] =
+                                std::numeric_limits<double>::quiet_NaN();
+                        op_block.radar_x[kk] =
+                                std::numeric_limits<double>::quiet_NaN();
+                        continue;
+                    }
+                    op_block.radar_y[kk] = rdrY;
+                    op_block.radar_x[kk] = rdrX;
+                }
+            }
+        }
+
         // set NaN values according to T_out, i.e. real (NaN) or complex (NaN,
         // NaN)
         using T_out_real = typename isce3::real<T_out>::type;
@@ -712,58 +820,15 @@ void Geocode<T>::geocodeInterp(
         // for each band in the input:
         for (int band = 0; band < nbands; ++band) {
 
-            // if complex to real
-            if ((std::is_same<T, std::complex<float>>::value ||
-                        std::is_same<T, std::complex<double>>::value) &&
-                    (std::is_same<T_out, float>::value ||
-                            std::is_same<T_out, double>::value)) {
-                isce3::core::Matrix<T> rdrDataBlockTemp(
-                        rdrBlockLength, rdrBlockWidth);
-                inputRaster.getBlock(rdrDataBlockTemp.data(), rangeFirstPixel,
-                        azimuthFirstLine, rdrBlockWidth, rdrBlockLength,
-                        band + 1);
-                if (flag_az_baseband_doppler) {
-
-                    // baseband the SLC in the radar grid
-                    const double blockStartingRange =
-                            radar_grid.startingRange() +
-                            rangeFirstPixel * radar_grid.rangePixelSpacing();
-                    const double blockSensingStart =
-                            radar_grid.sensingStart() +
-                            azimuthFirstLine / radar_grid.prf();
-
-                    _baseband(rdrDataBlockTemp, blockStartingRange,
-                            blockSensingStart, radar_grid.rangePixelSpacing(),
-                            radar_grid.prf(), _nativeDoppler);
-                }
-                for (int i = 0; i < rdrBlockLength; ++i)
-                    for (int j = 0; j < rdrBlockWidth; ++j) {
-                        T_out output_value;
-                        _convertToOutputType(
-                                rdrDataBlockTemp(i, j), output_value);
-                        rdrDataBlock(i, j) = output_value;
-                    }
-            }
-            // otherwise
-            else {
-                inputRaster.getBlock(rdrDataBlock.data(), rangeFirstPixel,
-                        azimuthFirstLine, rdrBlockWidth, rdrBlockLength,
-                        band + 1);
-                if (flag_az_baseband_doppler) {
-
-                    // baseband the SLC in the radar grid
-                    const double blockStartingRange =
-                            radar_grid.startingRange() +
-                            rangeFirstPixel * radar_grid.rangePixelSpacing();
-                    const double blockSensingStart =
-                            radar_grid.sensingStart() +
-                            azimuthFirstLine / radar_grid.prf();
-
-                    _baseband(rdrDataBlock, blockStartingRange,
-                            blockSensingStart, radar_grid.rangePixelSpacing(),
-                            radar_grid.prf(), _nativeDoppler);
-                }
-            }
+            ScopedTimer readTimer("geocode_cov.interp.read");
+            instrumentation::count("geocode_cov.interp.bytes_read",
+                    rdrBlockLength * rdrBlockWidth * sizeof(T));
+
+            _readRadarBlock(inputRaster, band, rangeFirstPixel,
+                    azimuthFirstLine, radar_grid, flag_az_baseband_doppler,
+                    rdrDataBlock);
+
+            readTimer.stop();
 
             // (optional arg) if band == 0, populate RTC array
             isce3::io::Raster* out_geo_rtc_band = nullptr;
@@ -788,7 +853,8 @@ void Geocode<T>::geocodeInterp(
                 out_mask_array.resize(geoBlockLength, geogrid.width());
                 out_mask_array.fill(255);
             }
- 
+
+            ScopedTimer interpTimer("geocode_cov.interp.interpolate");
             _interpolate(rdrDataBlock, geoDataBlock, radarX, radarY,
                     rdrBlockWidth, rdrBlockLength, azimuthFirstLine,
                     rangeFirstPixel, interp.get(), radar_grid,
@@ -801,8 +867,10 @@ void Geocode<T>::geocodeInterp(
                     input_layover_shadow_mask, sub_swaths,
                     effective_apply_valid_samples_sub_swath_masking,
                     out_mask, out_mask_array);
+            interpTimer.stop();
 
             // flush optional layers
+            ScopedTimer writeTimer("geocode_cov.interp.write");
             if (out_geo_rtc_band != nullptr && band == 0) {
                 out_geo_rtc->setBlock(out_geo_rtc_array.data(), 0, lineStart,
                         geogrid.width(), geoBlockLength, 1);
@@ -819,7 +887,8 @@ void Geocode<T>::geocodeInterp(
 
             outputRaster.setBlock(geoDataBlock.data(), 0, lineStart,
                     geogrid.width(), geoBlockLength, band + 1);
-
+            instrumentation::count("geocode_cov.interp.bytes_written",
+                    blockSize * sizeof(T_out));
         }
     } // end loop over block of output grid
 
@@ -865,6 +934,58 @@ void Geocode<T>::geocodeInterp(
     info << "elapsed time (GEO-IN) [s]: " << elapsed_time << pyre::journal::endl;
 }
 
+template<class T>
+template<class T_out>
+void Geocode<T>::_readRadarBlock(isce3::io::Raster& input_raster, int band,
+        int x0, int y0, const isce3::product::RadarGridParameters& radar_grid,
+        bool flag_az_baseband_doppler,
+        isce3::core::Matrix<T_out>& rdrDataBlock)
+{
+    const int length = rdrDataBlock.length();
+    const int width = rdrDataBlock.width();
+
+    // radar coordinates of the first sample of the window
+    const double blockStartingRange =
+            radar_grid.startingRange() + x0 * radar_grid.rangePixelSpacing();
+    const double blockSensingStart =
+            radar_grid.sensingStart() + y0 / radar_grid.prf();
+
+    // if complex to real
+    if ((std::is_same<T, std::complex<float>>::value ||
+                std::is_same<T, std::complex<double>>::value) &&
+            (std::is_same<T_out, float>::value ||
+                    std::is_same<T_out, double>::value)) {
+        isce3::core::Matrix<T> rdrDataBlockTemp(length, width);
+        input_raster.getBlock(
+                rdrDataBlockTemp.data(), x0, y0, width, length, band + 1);
+        if (flag_az_baseband_doppler) {
+
+            // baseband the SLC in the radar grid
+            _baseband(rdrDataBlockTemp, blockStartingRange, blockSensingStart,
+                    radar_grid.rangePixelSpacing(), radar_grid.prf(),
+                    _nativeDoppler);
+        }
+        for (int i = 0; i < length; ++i)
+            for (int j = 0; j < width; ++j) {
+                T_out output_value;
+                _convertToOutputType(rdrDataBlockTemp(i, j), output_value);
+                rdrDataBlock(i, j) = output_value;
+            }
+    }
+    // otherwise
+    else {
+        input_raster.getBlock(
+                rdrDataBlock.data(), x0, y0, width, length, band + 1);
+        if (flag_az_baseband_doppler) {
+
+            // baseband the SLC in the radar grid
+            _baseband(rdrDataBlock, blockStartingRange, blockSensingStart,
+                    radar_grid.rangePixelSpacing(), radar_grid.prf(),
+                    _nativeDoppler);
+        }
+    }
+}
+
 template<class T>
 template<class T_out>
 inline void Geocode<T>::_interpolate(
@@ -1043,23 +1164,7 @@ inline void Geocode<T>::_interpolate(
             }
         }
 
-        // clip min (complex)
-        if (!std::isnan(clip_min) && std::abs(val) < clip_min &&
-                isce3::is_complex<T_out>())
-            val = val * clip_min / std::abs(val);
-
-        // clip min (real)
-        else if (!std::isnan(clip_min) && std::abs(val) < clip_min)
-            val = clip_min;
-
-        // clip max (complex)
-        if (!std::isnan(clip_max) && std::abs(val) > clip_max &&
-                isce3::is_complex<T_out>())
-            val = val * clip_max / std::abs(val);
-
-        // clip max (real)
-        else if (!std::isnan(clip_max) && std::abs(val) > clip_max)
-            val = clip_max;
+        _clipGeoValue(val, clip_min, clip_max);
 
         if (std::is_same<T_out, float>::value ||
                 std::is_same<T_out, double>::value ||
@@ -1130,30 +1235,33 @@ void Geocode<T>::_baseband(isce3::core::Matrix<std::complex<T2>>& data,
     size_t length = data.length();
     size_t width = data.width();
 
-#pragma omp parallel for
-    for (size_t kk = 0; kk < length * width; ++kk) {
-        size_t line = kk / width;
-        size_t col = kk % width;
-        const double azimuth_time = sensing_start + line / prf;
-        const double slant_range = starting_range + col * range_pixel_spacing;
-        const double phase = doppler_lut.eval(azimuth_time, slant_range) * 2 *
-                             M_PI * azimuth_time;
-        const std::complex<T2> cpx_phase(std::cos(phase), -std::sin(phase));
-        data(line, col) *= cpx_phase;
+    // Slant range is the same for all lines
+    std::vector<double> slant_range(width);
+    for (size_t col = 0; col < width; ++col)
+        slant_range[col] = starting_range + col * range_pixel_spacing;
+
+#pragma omp parallel
+    {
+        std::vector<double> doppler(width);
+#pragma omp for
+        for (size_t line = 0; line < length; ++line) {
+            const double azimuth_time = sensing_start + line / prf;
+            doppler_lut.eval(azimuth_time, slant_range.data(), doppler.data(),
+                             width);
+            // remove the doppler phase, doppler * 2 pi * azimuth_time
+            for (size_t col = 0; col < width; ++col)
+                doppler[col] *= -2 * M_PI * azimuth_time;
+            isce3::math::rotate(&data(line, 0), doppler.data(), width);
+        }
     }
 }
 
 template<class T>
 int Geocode<T>::_geo2rdr(const isce3::product::RadarGridParameters& radar_grid,
-        double x, double y, double& azimuthTime, double& slantRange,
-        isce3::geometry::DEMInterpolator& demInterp,
-        isce3::core::ProjectionBase* proj, float& dem_value)
+        double lon, double lat, double& azimuthTime, double& slantRange,
+        isce3::geometry::DEMInterpolator& demInterp, float& dem_value)
 {
-    // coordinate in the output projection system
-    const Vec3 xyz {x, y, 0.0};
-
-    // transform the xyz in the output projection system to llh
-    Vec3 llh = proj->inverse(xyz);
+    Vec3 llh {lon, lat, 0.0};
 
     // interpolate the height from the DEM for this pixel
     llh[2] = demInterp.interpolateLonLat(llh[0], llh[1]);
@@ -1380,6 +1488,31 @@ void _getUpsampledBlock(
     }
 }
 
+/* Transform a line of DEM coordinates to LLH with a single call to
+ * ProjectionBase::inverse_batch(); as ProjectionBase::inverse(), a
+ * RuntimeError is thrown if any point fails to transform. */
+static void _getDemLineLlh(const isce3::geometry::DEMInterpolator& dem_interp,
+        const std::vector<Vec3>& dem_xyz, std::vector<Vec3>& llh)
+{
+    const std::size_t n = dem_xyz.size();
+    std::vector<double> dem_x(n), dem_y(n), dem_z(n), lon(n), lat(n), hgt(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        dem_x[k] = dem_xyz[k][0];
+        dem_y[k] = dem_xyz[k][1];
+        dem_z[k] = dem_xyz[k][2];
+    }
+
+    if (dem_interp.proj()->inverse_batch(n, dem_x.data(), dem_y.data(),
+                dem_z.data(), lon.data(), lat.data(), hgt.data()) != 0) {
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(),
+                "Inverse projection transformation failed");
+    }
+
+    llh.resize(n);
+    for (std::size_t k = 0; k < n; ++k)
+        llh[k] = {lon[k], lat[k], hgt[k]};
+}
+
 static int _geo2rdrWrapper(const Vec3& inputLLH, const Ellipsoid& ellipsoid,
         const Orbit& orbit, const LUT2d<double>& doppler, double& aztime,
         double& slantRange, double wavelength, LookSide side,
@@ -1813,7 +1946,8 @@ void Geocode<T>::geocodeAreaProj(
         isce3::io::Raster* out_mask,
         GeocodeMemoryMode geocode_memory_mode, const long long min_block_size,
         const long long max_block_size,
-        isce3::core::dataInterpMethod dem_interp_method)
+        isce3::core::dataInterpMethod dem_interp_method,
+        AreaProjOperator* out_area_proj_operator)
 {
 
     pyre::journal::info_t info("isce.geocode.GeocodeCov.geocodeAreaProj");
@@ -1848,7 +1982,7 @@ void Geocode<T>::geocodeAreaProj(
                 output_rtc, input_layover_shadow_mask_raster, sub_swaths,
                 apply_valid_samples_sub_swath_masking, out_mask,
                 geocode_memory_mode, min_block_size, max_block_size,
-                dem_interp_method);
+                dem_interp_method, out_area_proj_operator);
         return;
     }
 
@@ -2168,11 +2302,53 @@ void Geocode<T>::geocodeAreaProj(
     info << "block size Y (with upsampling): " << block_size_with_upsampling_y
          << pyre::journal::newline;
 
+    if (out_area_proj_operator != nullptr) {
+        if (static_cast<long long>(radar_grid_cropped.length()) *
+                        radar_grid_cropped.width() >
+                std::numeric_limits<std::uint32_t>::max()) {
+            std::string error_msg = "ERROR the radar grid is too large to be"
+                                    " indexed by the area-projection"
+                                    " operator";
+            throw isce3::except::LengthError(ISCE_SRCINFO(), error_msg);
+        }
+        info << "saving area-projection operator: true"
+             << pyre::journal::newline;
+
+        AreaProjOperator& area_proj_operator = *out_area_proj_operator;
+        area_proj_operator._blocks.clear();
+        area_proj_operator._blocks.resize(
+                static_cast<std::size_t>(nblocks_y) * nblocks_x);
+        area_proj_operator._geogrid_start_x = _geoGridStartX;
+        area_proj_operator._geogrid_start_y = _geoGridStartY;
+        area_proj_operator._geogrid_spacing_x = _geoGridSpacingX;
+        area_proj_operator._geogrid_spacing_y = _geoGridSpacingY;
+        area_proj_operator._geogrid_length = _geoGridLength;
+        area_proj_operator._geogrid_width = _geoGridWidth;
+        area_proj_operator._epsg = _epsgOut;
+        area_proj_operator._input_length = input_raster.length();
+        area_proj_operator._input_width = input_raster.width();
+        area_proj_operator._radar_offset_y = offset_y;
+        area_proj_operator._radar_offset_x = offset_x;
+        area_proj_operator._radar_length = radar_grid_cropped.length();
+        area_proj_operator._radar_width = radar_grid_cropped.width();
+        area_proj_operator._upsample_radar_grid = flag_upsample_radar_grid;
+        area_proj_operator._radar_grid_single_block =
+                is_radar_grid_single_block;
+        area_proj_operator._complex_output = isce3::is_complex<T_out>();
+        area_proj_operator._memory_mode = geocode_memory_mode;
+        area_proj_operator._min_block_size = min_block_size;
+        area_proj_operator._max_block_size = max_block_size;
+    }
+
     info << "starting geocoding" << pyre::journal::endl;
     if (!std::is_same<T, T_out>::value && nbands_off_diag_terms == 0) {
-        _Pragma("omp parallel for schedule(dynamic)")
-        for (int block_y = 0; block_y < nblocks_y; ++block_y) {
+        isce3::core::forEachBlock(nblocks_y, [&](std::size_t block_y) {
             for (int block_x = 0; block_x < nblocks_x; ++block_x) {
+                AreaProjOperator::Block* area_proj_block = nullptr;
+                if (out_area_proj_operator != nullptr) {
+                    area_proj_block = &out_area_proj_operator->_blocks[
+                            block_y * nblocks_x + block_x];
+                }
                 _runBlock<T_out, T_out>(radar_grid_cropped,
                         is_radar_grid_single_block, rdrData, block_size_y,
                         block_size_with_upsampling_y, block_y, block_size_x,
@@ -2193,13 +2369,18 @@ void Geocode<T>::geocodeAreaProj(
                         input_layover_shadow_mask, sub_swaths,
                         effective_apply_valid_samples_sub_swath_masking,
                         out_mask, geocode_memory_mode,
-                        min_block_size, max_block_size, info);
+                        min_block_size, max_block_size, area_proj_block,
+                        info);
             }
-        }
+        });
     } else {
-        _Pragma("omp parallel for schedule(dynamic)")
-        for (int block_y = 0; block_y < nblocks_y; ++block_y) {
+        isce3::core::forEachBlock(nblocks_y, [&](std::size_t block_y) {
             for (int block_x = 0; block_x < nblocks_x; ++block_x) {
+                AreaProjOperator::Block* area_proj_block = nullptr;
+                if (out_area_proj_operator != nullptr) {
+                    area_proj_block = &out_area_proj_operator->_blocks[
+                            block_y * nblocks_x + block_x];
+                }
                 _runBlock<T, T_out>(radar_grid_cropped,
                         is_radar_grid_single_block, rdrDataT, block_size_y,
                         block_size_with_upsampling_y, block_y, block_size_x,
@@ -2220,9 +2401,9 @@ void Geocode<T>::geocodeAreaProj(
                         input_layover_shadow_mask, sub_swaths,
                         effective_apply_valid_samples_sub_swath_masking, out_mask,
                         geocode_memory_mode, min_block_size, max_block_size,
-                        info);
+                        area_proj_block, info);
             }
-        }
+        });
     }
     printf("\rgeocode progress: 100%%\n");
 
@@ -2289,6 +2470,507 @@ void Geocode<T>::geocodeAreaProj(
     info << "elapsed time (GEO-AP) [s]: " << elapsed_time << pyre::journal::endl;
 }
 
+template<class T>
+void Geocode<T>::applyAreaProjOperator(
+        const AreaProjOperator& area_proj_operator,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        isce3::io::Raster* out_off_diag_terms, float clip_min, float clip_max)
+{
+    if (area_proj_operator.empty()) {
+        std::string error_msg = "ERROR the area-projection operator is empty";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (input_raster.length() != area_proj_operator.inputLength() ||
+            input_raster.width() != area_proj_operator.inputWidth()) {
+        std::string error_msg =
+                "ERROR the dimensions of the input raster (" +
+                std::to_string(input_raster.length()) + " x " +
+                std::to_string(input_raster.width()) +
+                ") do not match the ones of the area-projection operator (" +
+                std::to_string(area_proj_operator.inputLength()) + " x " +
+                std::to_string(area_proj_operator.inputWidth()) + ")";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (output_raster.length() != area_proj_operator.geogridLength() ||
+            output_raster.width() != area_proj_operator.geogridWidth()) {
+        std::string error_msg =
+                "ERROR the dimensions of the output raster do not match the"
+                " geogrid of the area-projection operator";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    const int nbands = input_raster.numBands();
+    if (output_raster.numBands() != nbands) {
+        std::string error_msg = "ERROR the number of bands of the input and"
+                                " output rasters do not match";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (out_off_diag_terms != nullptr) {
+        if (out_off_diag_terms->numBands() != nbands * (nbands - 1) / 2) {
+            std::string error_msg = "ERROR invalid number of bands of the"
+                                    " off-diagonal raster";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        if (!GDALDataTypeIsComplex(input_raster.dtype())) {
+            std::string error_msg = "Input raster must be complex to"
+                                    " generate full-covariance matrix";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        if (!GDALDataTypeIsComplex(out_off_diag_terms->dtype())) {
+            std::string error_msg = "Off-diagonal raster must be complex";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+    }
+
+    bool flag_complex_output = GDALDataTypeIsComplex(output_raster.dtype());
+    if (flag_complex_output != area_proj_operator.complexOutput()) {
+        std::string error_msg = "ERROR the area-projection operator was built"
+                                " for ";
+        error_msg += (area_proj_operator.complexOutput() ? "complex" : "real");
+        error_msg += " outputs";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    int exponent = 0;
+    bool flag_complex_to_real = isce3::signal::verifyComplexToRealCasting(
+            input_raster, output_raster, exponent);
+
+    /*
+    Same types as geocodeAreaProj(): T2 is the type of the radar data
+    (T if the off-diagonal terms are computed) and T_out the type of the
+    diagonal terms
+    */
+    if (!flag_complex_to_real)
+        _applyAreaProjOperator<T, T>(area_proj_operator, input_raster,
+                output_raster, out_off_diag_terms, clip_min, clip_max);
+    else if ((std::is_same<T, double>::value ||
+                     std::is_same<T, std::complex<double>>::value) &&
+             out_off_diag_terms == nullptr)
+        _applyAreaProjOperator<double, double>(area_proj_operator,
+                input_raster, output_raster, out_off_diag_terms, clip_min,
+                clip_max);
+    else if (std::is_same<T, double>::value ||
+             std::is_same<T, std::complex<double>>::value)
+        _applyAreaProjOperator<T, double>(area_proj_operator, input_raster,
+                output_raster, out_off_diag_terms, clip_min, clip_max);
+    else if (out_off_diag_terms == nullptr)
+        _applyAreaProjOperator<float, float>(area_proj_operator,
+                input_raster, output_raster, out_off_diag_terms, clip_min,
+                clip_max);
+    else
+        _applyAreaProjOperator<T, float>(area_proj_operator, input_raster,
+                output_raster, out_off_diag_terms, clip_min, clip_max);
+}
+
+template<class T>
+template<class T2, class T_out>
+void Geocode<T>::_applyAreaProjOperator(
+        const AreaProjOperator& area_proj_operator,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        isce3::io::Raster* out_off_diag_terms, float clip_min, float clip_max)
+{
+    using isce3::math::complex_operations::operator*;
+
+    pyre::journal::info_t info(
+            "isce.geocode.GeocodeCov.applyAreaProjOperator");
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const int nbands = input_raster.numBands();
+    const int nbands_off_diag_terms =
+            out_off_diag_terms != nullptr ? nbands * (nbands - 1) / 2 : 0;
+
+    info << "nbands (diagonal terms): " << nbands << pyre::journal::newline;
+    info << "nbands (off-diagonal terms): " << nbands_off_diag_terms
+         << pyre::journal::newline;
+    info << "area-projection operator blocks: "
+         << area_proj_operator.numBlocks() << pyre::journal::newline;
+    info << "area-projection operator non-zero weights: "
+         << area_proj_operator.nnz() << " ("
+         << isce3::core::getNbytesStr(area_proj_operator.memorySize()) << ")"
+         << pyre::journal::endl;
+
+    // set NaN values according to T_out, i.e. real (NaN) or complex (NaN, NaN)
+    using T_out_real = typename isce3::real<T_out>::type;
+    T_out nan_t_out = 0;
+    nan_t_out *= std::numeric_limits<T_out_real>::quiet_NaN();
+
+    using T_real = typename isce3::real<T>::type;
+    T nan_t = 0;
+    nan_t *= std::numeric_limits<T_real>::quiet_NaN();
+
+    const auto& op = area_proj_operator;
+
+    // read the radar grid of the operator at once, if it was built in
+    // radar-grid single block mode
+    std::vector<std::unique_ptr<isce3::core::Matrix<T2>>> rdrData;
+    if (op._radar_grid_single_block) {
+        _getUpsampledBlock<T, T2>(rdrData, input_raster, op._radar_offset_x,
+                op._radar_offset_y, op._radar_width, op._radar_length,
+                op._upsample_radar_grid, op._memory_mode, op._min_block_size,
+                op._max_block_size, info);
+    }
+
+    isce3::core::forEachBlock(op.numBlocks(), [&](std::size_t block_index) {
+        const AreaProjOperator::Block& block = op.block(block_index);
+        const int npixels = block.length * block.width;
+
+        // otherwise, read the radar window of each geogrid block
+        std::vector<std::unique_ptr<isce3::core::Matrix<T2>>> rdrDataBlock;
+        if (!op._radar_grid_single_block && !block.index.empty()) {
+            _getUpsampledBlock<T, T2>(rdrDataBlock, input_raster,
+                    block.radar_x0 + op._radar_offset_x,
+                    block.radar_y0 + op._radar_offset_y, block.radar_width,
+                    block.radar_length, op._upsample_radar_grid,
+                    op._memory_mode, op._min_block_size, op._max_block_size,
+                    info);
+        }
+        const auto& radar_data =
+                op._radar_grid_single_block ? rdrData : rdrDataBlock;
+
+        std::vector<isce3::core::Matrix<T_out>> geoDataBlock(nbands);
+        for (int band = 0; band < nbands; ++band) {
+            geoDataBlock[band].resize(block.length, block.width);
+            geoDataBlock[band].fill(nan_t_out);
+        }
+        std::vector<isce3::core::Matrix<T>> geoDataBlockOffDiag(
+                nbands_off_diag_terms);
+        for (int band = 0; band < nbands_off_diag_terms; ++band) {
+            geoDataBlockOffDiag[band].resize(block.length, block.width);
+            geoDataBlockOffDiag[band].fill(nan_t);
+        }
+
+        // sparse matrix-multi-vector product over the rows (pixels) of the
+        // block
+        std::vector<T_out> cumulative_sum(nbands);
+        std::vector<T> cumulative_sum_off_diag_terms(nbands_off_diag_terms);
+        for (int pixel = 0; pixel < npixels && !block.index.empty();
+                ++pixel) {
+            const std::uint64_t k_start = block.row_offset[pixel];
+            const std::uint64_t k_end = block.row_offset[pixel + 1];
+            if (k_start == k_end)
+                continue;
+
+            std::fill(cumulative_sum.begin(), cumulative_sum.end(), 0);
+            std::fill(cumulative_sum_off_diag_terms.begin(),
+                    cumulative_sum_off_diag_terms.end(), 0);
+
+            for (std::uint64_t k = k_start; k < k_end; ++k) {
+                const std::uint32_t index = block.index[k];
+                const double w = block.weight[k];
+                int band_index = 0;
+                for (int band_1 = 0; band_1 < nbands; ++band_1) {
+                    const T2 v1 = radar_data[band_1]->data()[index];
+                    _accumulate(cumulative_sum[band_1], v1, w);
+
+                    // cov = v1 * conj(v2)
+                    for (int band_2 = band_1 + 1;
+                            band_2 < nbands && nbands_off_diag_terms > 0;
+                            ++band_2) {
+                        const T2 v2 = radar_data[band_2]->data()[index];
+                        _accumulate(cumulative_sum_off_diag_terms[band_index],
+                                v1 * std::conj(v2), w);
+                        band_index++;
+                    }
+                }
+            }
+
+            const int i = pixel / block.width;
+            const int j = pixel % block.width;
+            for (int band = 0; band < nbands; ++band)
+                geoDataBlock[band](i, j) = cumulative_sum[band];
+            for (int band = 0; band < nbands_off_diag_terms; ++band)
+                geoDataBlockOffDiag[band](i, j) =
+                        cumulative_sum_off_diag_terms[band];
+        }
+
+        for (int band = 0; band < nbands; ++band) {
+            T_out* ptr = geoDataBlock[band].data();
+            for (int k = 0; k < npixels; ++k)
+                _clipGeoValue(ptr[k], clip_min, clip_max);
+
+            _Pragma("omp critical")
+            {
+                output_raster.setBlock(geoDataBlock[band].data(), block.x0,
+                        block.y0, block.width, block.length, band + 1);
+            }
+        }
+
+        for (int band = 0; band < nbands_off_diag_terms; ++band) {
+            T* ptr = geoDataBlockOffDiag[band].data();
+            for (int k = 0; k < npixels; ++k)
+                _clipGeoValue(ptr[k], clip_min, clip_max);
+
+            _Pragma("omp critical")
+            {
+                out_off_diag_terms->setBlock(geoDataBlockOffDiag[band].data(),
+                        block.x0, block.y0, block.width, block.length,
+                        band + 1);
+            }
+        }
+    });
+
+    double geotransform[] = {op._geogrid_start_x, op._geogrid_spacing_x, 0,
+            op._geogrid_start_y, 0, op._geogrid_spacing_y};
+    if (op._geogrid_spacing_y > 0) {
+        geotransform[3] = op._geogrid_start_y +
+                          op._geogrid_length * op._geogrid_spacing_y;
+        geotransform[5] = -op._geogrid_spacing_y;
+    }
+
+    output_raster.setGeoTransform(geotransform);
+    output_raster.setEPSG(op._epsg);
+
+    if (out_off_diag_terms != nullptr) {
+        out_off_diag_terms->setGeoTransform(geotransform);
+        out_off_diag_terms->setEPSG(op._epsg);
+    }
+
+    auto elapsed_time_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start_time);
+    float elapsed_time = ((float) elapsed_time_milliseconds.count()) / 1e3;
+    info << "elapsed time (GEO-AP operator) [s]: " << elapsed_time
+         << pyre::journal::endl;
+}
+
+template<class T>
+void Geocode<T>::applyInterpOperator(const InterpOperator& interp_operator,
+        const isce3::product::RadarGridParameters& radar_grid,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        bool flag_az_baseband_doppler, bool flatten, double abs_cal_factor,
+        float clip_min, float clip_max,
+        isce3::io::Raster* phase_screen_raster, isce3::io::Raster* input_rtc,
+        isce3::io::Raster* input_layover_shadow_mask_raster,
+        isce3::product::SubSwaths* sub_swaths,
+        std::optional<bool> apply_valid_samples_sub_swath_masking)
+{
+    if (interp_operator.empty()) {
+        std::string error_msg = "ERROR the interpolation operator is empty";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (radar_grid.length() != interp_operator.radarGridLength() ||
+            radar_grid.width() != interp_operator.radarGridWidth() ||
+            input_raster.length() != radar_grid.length() ||
+            input_raster.width() != radar_grid.width()) {
+        std::string error_msg =
+                "ERROR the dimensions of the radar grid (" +
+                std::to_string(radar_grid.length()) + " x " +
+                std::to_string(radar_grid.width()) +
+                ") and input raster (" +
+                std::to_string(input_raster.length()) + " x " +
+                std::to_string(input_raster.width()) +
+                ") must match the ones of the interpolation operator (" +
+                std::to_string(interp_operator.radarGridLength()) + " x " +
+                std::to_string(interp_operator.radarGridWidth()) + ")";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (output_raster.length() != interp_operator.geogridLength() ||
+            output_raster.width() != interp_operator.geogridWidth()) {
+        std::string error_msg =
+                "ERROR the dimensions of the output raster do not match the"
+                " geogrid of the interpolation operator";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (output_raster.numBands() != input_raster.numBands()) {
+        std::string error_msg = "ERROR the number of bands of the input and"
+                                " output rasters do not match";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (apply_valid_samples_sub_swath_masking &&
+            *apply_valid_samples_sub_swath_masking && sub_swaths == nullptr) {
+        std::string error_message =
+            ("ERROR cannot apply valid-samples sub-swath"
+             "masking without a sub_swaths object");
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_message);
+    }
+    bool effective_apply_valid_samples_sub_swath_masking =
+        apply_valid_samples_sub_swath_masking?
+        *apply_valid_samples_sub_swath_masking: sub_swaths != nullptr;
+
+    int exponent = 0;
+    bool flag_complex_to_real = isce3::signal::verifyComplexToRealCasting(
+            input_raster, output_raster, exponent);
+
+    // same output types as geocode()
+    if (!flag_complex_to_real)
+        _applyInterpOperator<T>(interp_operator, radar_grid, input_raster,
+                output_raster, flag_az_baseband_doppler, flatten,
+                abs_cal_factor, clip_min, clip_max, phase_screen_raster,
+                input_rtc, input_layover_shadow_mask_raster, sub_swaths,
+                effective_apply_valid_samples_sub_swath_masking);
+    else if (std::is_same<T, double>::value ||
+             std::is_same<T, std::complex<double>>::value)
+        _applyInterpOperator<double>(interp_operator, radar_grid,
+                input_raster, output_raster, flag_az_baseband_doppler,
+                flatten, abs_cal_factor, clip_min, clip_max,
+                phase_screen_raster, input_rtc,
+                input_layover_shadow_mask_raster, sub_swaths,
+                effective_apply_valid_samples_sub_swath_masking);
+    else
+        _applyInterpOperator<float>(interp_operator, radar_grid,
+                input_raster, output_raster, flag_az_baseband_doppler,
+                flatten, abs_cal_factor, clip_min, clip_max,
+                phase_screen_raster, input_rtc,
+                input_layover_shadow_mask_raster, sub_swaths,
+                effective_apply_valid_samples_sub_swath_masking);
+}
+
+template<class T>
+template<class T_out>
+void Geocode<T>::_applyInterpOperator(const InterpOperator& interp_operator,
+        const isce3::product::RadarGridParameters& radar_grid,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        bool flag_az_baseband_doppler, bool flatten, double abs_cal_factor,
+        float clip_min, float clip_max,
+        isce3::io::Raster* phase_screen_raster, isce3::io::Raster* input_rtc,
+        isce3::io::Raster* input_layover_shadow_mask_raster,
+        isce3::product::SubSwaths* sub_swaths,
+        bool apply_valid_samples_sub_swath_masking)
+{
+    pyre::journal::info_t info("isce.geocode.GeocodeCov.applyInterpOperator");
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const auto& op = interp_operator;
+    const int nbands = input_raster.numBands();
+    const int width = op.geogridWidth();
+
+    info << "nbands: " << nbands << pyre::journal::newline;
+    info << "interpolation operator blocks: " << op.numBlocks()
+         << pyre::journal::newline;
+    info << "interpolation operator valid pixels: " << op.numValidPixels()
+         << " (" << isce3::core::getNbytesStr(op.memorySize()) << ")"
+         << pyre::journal::endl;
+
+    for (int band = 0; band < nbands; ++band) {
+        const auto dtype = input_raster.dtype(band + 1);
+        if ((dtype == GDT_Byte || dtype == GDT_UInt32) &&
+                _data_interp_method != isce3::core::NEAREST_METHOD) {
+            std::string err_str {
+                "int type of raster can only use nearest neighbor interp"};
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), err_str);
+        }
+    }
+
+    // radar-geometry layers
+    isce3::core::Matrix<uint8_t> input_layover_shadow_mask;
+    if (input_layover_shadow_mask_raster != nullptr) {
+        _validateInputLayoverShadowMaskRaster(
+            input_layover_shadow_mask_raster, radar_grid);
+        input_layover_shadow_mask.resize(
+                radar_grid.length(), radar_grid.width());
+        input_layover_shadow_mask_raster->getBlock(
+            input_layover_shadow_mask.data(), 0, 0,
+            radar_grid.width(), radar_grid.length(), 1);
+    }
+
+    isce3::core::Matrix<float> phase_screen_array;
+    if (phase_screen_raster != nullptr) {
+        phase_screen_array.resize(radar_grid.length(), radar_grid.width());
+        phase_screen_raster->getBlock(phase_screen_array.data(), 0, 0,
+                radar_grid.width(), radar_grid.length(), 1);
+    }
+
+    const bool flag_apply_rtc = input_rtc != nullptr;
+    isce3::core::Matrix<float> rtc_area_array, rtc_area_sigma0_array;
+    if (flag_apply_rtc) {
+        rtc_area_array.resize(radar_grid.length(), radar_grid.width());
+        input_rtc->getBlock(rtc_area_array.data(), 0, 0, radar_grid.width(),
+                radar_grid.length(), 1);
+    }
+
+    std::unique_ptr<isce3::core::Interpolator<T_out>> interp {
+            isce3::core::createInterpolator<T_out>(_data_interp_method)};
+
+    // set NaN values according to T_out, i.e. real (NaN) or complex (NaN,
+    // NaN)
+    using T_out_real = typename isce3::real<T_out>::type;
+    T_out nan_t_out = 0;
+    nan_t_out *= std::numeric_limits<T_out_real>::quiet_NaN();
+
+    // unused optional outputs of _interpolate()
+    isce3::core::Matrix<float> out_geo_rtc_array;
+    isce3::core::Matrix<float> out_geo_rtc_gamma0_to_sigma0_array;
+    isce3::core::Matrix<uint8_t> out_mask_array;
+
+    for (std::size_t block_index = 0; block_index < op.numBlocks();
+            ++block_index) {
+        const InterpOperator::Block& block = op.block(block_index);
+        const int blockSize = block.length * width;
+
+        isce3::core::Matrix<T_out> geoDataBlock(block.length, width);
+        geoDataBlock.fill(nan_t_out);
+
+        if (block.radar_y.empty()) {
+            for (int band = 0; band < nbands; ++band) {
+                output_raster.setBlock(geoDataBlock.data(), 0, block.y0,
+                        width, block.length, band + 1);
+            }
+            continue;
+        }
+
+        // absolute radar positions. Invalid pixels are moved to the origin
+        // of the radar grid, outside of the interpolation window
+        std::valarray<double> radarX(0.0, blockSize);
+        std::valarray<double> radarY(0.0, blockSize);
+        for (int kk = 0; kk < blockSize; ++kk) {
+            if (std::isnan(block.radar_y[kk]) || std::isnan(block.radar_x[kk]))
+                continue;
+            radarY[kk] = block.radar_y[kk] + block.radar_y0;
+            radarX[kk] = block.radar_x[kk] + block.radar_x0;
+        }
+
+        isce3::core::Matrix<T_out> rdrDataBlock(
+                block.radar_length, block.radar_width);
+
+        for (int band = 0; band < nbands; ++band) {
+            _readRadarBlock(input_raster, band, block.radar_x0,
+                    block.radar_y0, radar_grid, flag_az_baseband_doppler,
+                    rdrDataBlock);
+
+            _interpolate(rdrDataBlock, geoDataBlock, radarX, radarY,
+                    block.radar_width, block.radar_length, block.radar_y0,
+                    block.radar_x0, interp.get(), radar_grid,
+                    flag_az_baseband_doppler, flatten, phase_screen_raster,
+                    phase_screen_array, abs_cal_factor, clip_min, clip_max,
+                    flag_apply_rtc, rtc_area_array, rtc_area_sigma0_array,
+                    nullptr, out_geo_rtc_array, nullptr,
+                    out_geo_rtc_gamma0_to_sigma0_array,
+                    input_layover_shadow_mask_raster,
+                    input_layover_shadow_mask, sub_swaths,
+                    apply_valid_samples_sub_swath_masking, nullptr,
+                    out_mask_array);
+
+            output_raster.setBlock(geoDataBlock.data(), 0, block.y0, width,
+                    block.length, band + 1);
+        }
+    }
+
+    double geotransform[] = {op._geogrid_start_x, op._geogrid_spacing_x, 0,
+            op._geogrid_start_y, 0, op._geogrid_spacing_y};
+    if (op._geogrid_spacing_y > 0) {
+        geotransform[3] = op._geogrid_start_y +
+                          op._geogrid_length * op._geogrid_spacing_y;
+        geotransform[5] = -op._geogrid_spacing_y;
+    }
+
+    output_raster.setGeoTransform(geotransform);
+    output_raster.setEPSG(op._epsg);
+
+    auto elapsed_time_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start_time);
+    float elapsed_time = ((float) elapsed_time_milliseconds.count()) / 1e3;
+    info << "elapsed time (GEO-IN operator) [s]: " << elapsed_time
+         << pyre::journal::endl;
+}
+
 template<class T>
 void Geocode<T>::_getRadarPositionVect(double dem_pos_1, const int k_start,
         const int k_end, double geogrid_upsampling, double* az_time,
@@ -2322,30 +3004,35 @@ void Geocode<T>::_getRadarPositionVect(double dem_pos_1, const int k_start,
         r0 = radar_grid.startingRange() - 0.5 * dr;
     }
 
+    // Convert DEM coordinates (`dem_x` and `dem_y`) from _epsgOut to DEM
+    // EPSG coordinates x and y, interpolate height (z), and transform the
+    // whole vector to LLH at once
+    std::vector<Vec3> dem_pos_line(std::max(k_end - k_start + 1, 0));
     for (int kk = k_start; kk <= k_end; ++kk) {
-        const int k = kk - k_start;
-
-        Vec3 dem_pos_vect;
-        // Convert DEM coordinates (`dem_x` and `dem_y`) from _epsgOut to DEM
-        // EPSG coordinates x and y, interpolate height (z), and return:
-        // dem_pos_vect = {x, y, z}
         if (flag_direction_line) {
             // flag_direction_line == true: y fixed, varies x
             const double dem_pos_2 =
                     _geoGridStartX + _geoGridSpacingX * kk / geogrid_upsampling;
-            dem_pos_vect =
+            dem_pos_line[kk - k_start] =
                     getDemCoords(dem_pos_2, dem_pos_1, dem_interp_block, proj);
         } else {
             // flag_direction_line == false: x fixed, varies y
             const double dem_pos_2 =
                     _geoGridStartY + _geoGridSpacingY * kk / geogrid_upsampling;
-            dem_pos_vect =
+            dem_pos_line[kk - k_start] =
                     getDemCoords(dem_pos_1, dem_pos_2, dem_interp_block, proj);
         }
+    }
+    std::vector<Vec3> llh_line;
+    _getDemLineLlh(dem_interp_block, dem_pos_line, llh_line);
+
+    for (int kk = k_start; kk <= k_end; ++kk) {
+        const int k = kk - k_start;
+        const Vec3& dem_pos_vect = dem_pos_line[k];
 
         // coarse geo2rdr
         int converged =
-                _geo2rdrWrapper(dem_interp_block.proj()->inverse(dem_pos_vect),
+                _geo2rdrWrapper(llh_line[k],
                         _ellipsoid, _orbit, _doppler, *az_time, *range_distance,
                         radar_grid.wavelength(), radar_grid.lookSide(),
                         az_time_correction, slant_range_correction,
@@ -2417,11 +3104,14 @@ void Geocode<T>::_runBlock(
         isce3::io::Raster* out_mask,
         GeocodeMemoryMode geocode_memory_mode,
         const long long min_block_size, const long long max_block_size,
+        AreaProjOperator::Block* area_proj_block,
         pyre::journal::info_t& info)
 {
 
     using isce3::math::complex_operations::operator*;
 
+    ScopedTimer blockTimer("geocode_cov.area_proj.block");
+
     // start (az) and r0 at the outer edge of the first pixel
     const double pixazm = radar_grid.azimuthTimeInterval();
     const double start = radar_grid.sensingStart() - 0.5 * pixazm;
@@ -2453,6 +3143,20 @@ void Geocode<T>::_runBlock(
     const int this_block_size_with_upsampling_x =
             this_block_size_x * geogrid_upsampling;
 
+    /*
+    Blocks of the area-projection operator start empty (all pixels set to
+    NaN) and their radar window defaults to the entire radar grid. It is
+    updated below if the radar grid is read in blocks
+    */
+    if (area_proj_block != nullptr) {
+        area_proj_block->y0 = block_y * block_size_y;
+        area_proj_block->x0 = block_x * block_size_x;
+        area_proj_block->length = this_block_size_y;
+        area_proj_block->width = this_block_size_x;
+        area_proj_block->radar_length = radar_grid.length();
+        area_proj_block->radar_width = radar_grid.width();
+    }
+
     isce3::core::Matrix<float> out_geo_rdr_a;
     isce3::core::Matrix<float> out_geo_rdr_r;
     if (out_geo_rdr != nullptr) {
@@ -2599,6 +3303,7 @@ void Geocode<T>::_runBlock(
     Vec3 dem11;
 
     // pre-compute radar positions on the top of the geogrid
+    ScopedTimer edgesTimer("geocode_cov.area_proj.geo2rdr_edges");
     bool flag_direction_line = true, flag_save_vectors = true;
     bool flag_compute_min_max = !is_radar_grid_single_block;
 
@@ -2686,6 +3391,7 @@ void Geocode<T>::_runBlock(
             proj, dem_interp_block, getDemCoords, flag_direction_line,
             flag_save_vectors, flag_compute_min_max, az_time_correction,
             slant_range_correction, &a_right, &r_right, &dem_right);
+    edgesTimer.stop();
 
     // load radar grid data
     int offset_x = 0, offset_y = 0;
@@ -2754,6 +3460,14 @@ void Geocode<T>::_runBlock(
                 radar_grid.offsetAndResize(offset_y, offset_x, grid_size_y,
                                            grid_size_x);
 
+        if (area_proj_block != nullptr) {
+            area_proj_block->radar_y0 = offset_y;
+            area_proj_block->radar_x0 = offset_x;
+            area_proj_block->radar_length = radar_grid_block.length();
+            area_proj_block->radar_width = radar_grid_block.width();
+        }
+
+        ScopedTimer readTimer("geocode_cov.area_proj.read");
         if (flag_apply_rtc) {
             rtc_area_block.resize(
                     radar_grid_block.length(), radar_grid_block.width());
@@ -2784,6 +3498,9 @@ void Geocode<T>::_runBlock(
                 radar_grid_block.width(), radar_grid_block.length(),
                 flag_upsample_radar_grid, geocode_memory_mode,
                 min_block_size, max_block_size, info);
+        instrumentation::count("geocode_cov.area_proj.bytes_read",
+                static_cast<long long>(grid_size_y) * grid_size_x *
+                        nbands * sizeof(T));
     }
 
     std::vector<std::unique_ptr<isce3::core::Matrix<T_out>>> geoDataBlock;
@@ -2815,6 +3532,15 @@ void Geocode<T>::_runBlock(
         for (int band = 0; band < nbands_off_diag_terms; ++band)
             geoDataBlockOffDiag[band]->fill(nan_t);
     }
+
+    /*
+    If the area-projection operator is requested, the radar samples
+    accumulated for each geogrid pixel (index within the radar window and
+    weight) are kept in `area_proj_samples` and moved to `area_proj_entries`
+    once the pixel is considered valid
+    */
+    std::vector<std::pair<std::uint32_t, double>> area_proj_samples;
+    std::vector<AreaProjOperator::Entry> area_proj_entries;
     /*
 
          r_last[j], a_last[j]                   r_last[j+1], a_last[j+1]
@@ -2840,6 +3566,10 @@ void Geocode<T>::_runBlock(
 
     */
 
+    // DEM coordinates and LLH of the bottom right vertices of a line
+    std::vector<Vec3> dem11_line, llh11_line;
+
+    ScopedTimer projTimer("geocode_cov.area_proj.accumulate");
     for (int i = 0; i < this_block_size_with_upsampling_y; ++i) {
 
         // initiating lower right vertex
@@ -2859,9 +3589,24 @@ void Geocode<T>::_runBlock(
         dem_y1 = _geoGridStartY +
                  _geoGridSpacingY * (1.0 + ii) / geogrid_upsampling;
 
-        for (int j = 0; j < this_block_size_with_upsampling_x; ++j) {
+        // Convert the DEM coordinates of the new bottom right vertices of
+        // the line from _epsgOut to DEM EPSG coordinates x and y,
+        // interpolate height (z), and transform them to LLH at once
+        if (i < this_block_size_with_upsampling_y - 1) {
+            dem11_line.resize(
+                    std::max(this_block_size_with_upsampling_x - 1, 0));
+            for (int j = 0; j < this_block_size_with_upsampling_x - 1; ++j) {
+                const int jj = block_x * block_size_with_upsampling_x + j;
+                const double dem_x1 =
+                        _geoGridStartX +
+                        _geoGridSpacingX * (1.0 + jj) / geogrid_upsampling;
+                dem11_line[j] =
+                        getDemCoords(dem_x1, dem_y1, dem_interp_block, proj);
+            }
+            _getDemLineLlh(dem_interp_block, dem11_line, llh11_line);
+        }
 
-            const int jj = block_x * block_size_with_upsampling_x + j;
+        for (int j = 0; j < this_block_size_with_upsampling_x; ++j) {
 
             _Pragma("omp atomic") numdone++;
             if (numdone % progress_block == 0)
@@ -2906,17 +3651,10 @@ void Geocode<T>::_runBlock(
                     r11 = r00;
                 }
 
-                const double dem_x1 =
-                        _geoGridStartX +
-                        _geoGridSpacingX * (1.0 + jj) / geogrid_upsampling;
-
-                // Convert DEM coordinates (`dem_x` and `dem_y`) from _epsgOut
-                // to DEM EPSG coordinates x and y, interpolate height (z), and
-                // return: dem11 = {x, y, z}
-                dem11 = getDemCoords(dem_x1, dem_y1, dem_interp_block, proj);
+                // dem11 = {x, y, z} in DEM EPSG coordinates
+                dem11 = dem11_line[j];
 
-                int converged = _geo2rdrWrapper(
-                        dem_interp_block.proj()->inverse(dem11), _ellipsoid,
+                int converged = _geo2rdrWrapper(llh11_line[j], _ellipsoid,
                         _orbit, _doppler, a11, r11, radar_grid.wavelength(),
                         radar_grid.lookSide(), az_time_correction,
                         slant_range_correction, _threshold, _numiter, 1.0e-8);
@@ -3094,6 +3832,7 @@ void Geocode<T>::_runBlock(
 
             double nlooks = 0;
             float area_total = 0, area_sigma_total = 0;
+            area_proj_samples.clear();
             std::vector<T_out> cumulative_sum(nbands, 0);
             std::vector<T> cumulative_sum_off_diag_terms(nbands_off_diag_terms,
                                                          0);
@@ -3229,6 +3968,13 @@ void Geocode<T>::_runBlock(
                         samples_sub_swath_counts[sample_sub_swath - 1]++;
                     }
 
+                    if (area_proj_block != nullptr) {
+                        area_proj_samples.emplace_back(
+                                (y - offset_y) * area_proj_block->radar_width +
+                                        (x - offset_x),
+                                w);
+                    }
+
                     int band_index = 0;
                     for (int band_1 = 0; band_1 < nbands; ++band_1) {
                         T2 v1;
@@ -3386,6 +4132,16 @@ void Geocode<T>::_runBlock(
 
             // compute backscatter contribution v and update output arrays
 
+            if (area_proj_block != nullptr) {
+                const double scale = abs_cal_factor_effective /
+                        (nlooks * geogrid_upsampling * geogrid_upsampling);
+                const std::uint32_t pixel = y * this_block_size_x + x;
+                for (const auto& sample : area_proj_samples) {
+                    area_proj_entries.push_back({pixel, sample.first,
+                            static_cast<float>(sample.second * scale)});
+                }
+            }
+
             for (int band = 0; band < nbands; ++band) {
                 T_out v = (static_cast<T_out>(
                         (cumulative_sum[band]) * abs_cal_factor_effective /
@@ -3414,38 +4170,20 @@ void Geocode<T>::_runBlock(
             }
         }
     }
+    projTimer.stop();
+    instrumentation::count("geocode_cov.area_proj.pixels",
+            static_cast<long long>(this_block_size_y) * this_block_size_x);
+
+    if (area_proj_block != nullptr) {
+        AreaProjOperator::compress(*area_proj_block, area_proj_entries,
+                this_block_size_y * this_block_size_x);
+    }
+
     for (int band = 0; band < nbands; ++band) {
         for (int i = 0; i < this_block_size_y; ++i) {
             for (int j = 0; j < this_block_size_x; ++j) {
-                T_out geo_value = geoDataBlock[band]->operator()(i, j);
-
-                // no data
-                if (std::isnan(std::abs(geo_value)))
-                    continue;
-
-                // clip min (complex)
-                else if (!std::isnan(clip_min) &&
-                         std::abs(geo_value) < clip_min &&
-                         isce3::is_complex<T_out>())
-                    geoDataBlock[band]->operator()(i, j) =
-                            (geo_value * clip_min / std::abs(geo_value));
-
-                // clip min (real)
-                else if (!std::isnan(clip_min) &&
-                         std::abs(geo_value) < clip_min)
-                    geoDataBlock[band]->operator()(i, j) = clip_min;
-
-                // clip max (complex)
-                else if (!std::isnan(clip_max) &&
-                         std::abs(geo_value) > clip_max &&
-                         isce3::is_complex<T_out>())
-                    geoDataBlock[band]->operator()(i, j) =
-                            (geo_value * clip_max / std::abs(geo_value));
-
-                // clip max (real)
-                else if (!std::isnan(clip_max) &&
-                         std::abs(geo_value) > clip_max)
-                    geoDataBlock[band]->operator()(i, j) = clip_max;
+                _clipGeoValue(geoDataBlock[band]->operator()(i, j),
+                        clip_min, clip_max);
             }
         }
         _Pragma("omp critical")
@@ -3463,27 +4201,8 @@ void Geocode<T>::_runBlock(
         for (int band = 0; band < nbands_off_diag_terms; ++band) {
             for (int i = 0; i < this_block_size_y; ++i) {
                 for (int j = 0; j < this_block_size_x; ++j) {
-
-                    T geo_value_off_diag =
-                            geoDataBlockOffDiag[band]->operator()(i, j);
-
-                    // no data (complex)
-                    if (std::isnan(std::abs(geo_value_off_diag)))
-                        continue;
-
-                    // clip min (complex)
-                    else if (!std::isnan(clip_min) &&
-                             std::abs(geo_value_off_diag) < clip_min)
-                        geoDataBlockOffDiag[band]->operator()(i, j) =
-                                (geo_value_off_diag * clip_min /
-                                 std::abs(geo_value_off_diag));
-
-                    // clip max (complex)
-                    else if (!std::isnan(clip_max) &&
-                             std::abs(geo_value_off_diag) > clip_max)
-                        geoDataBlockOffDiag[band]->operator()(i, j) =
-                                (geo_value_off_diag * clip_max /
-                                 std::abs(geo_value_off_diag));
+                    _clipGeoValue(geoDataBlockOffDiag[band]->operator()(i, j),
+                            clip_min, clip_max);
                 }
             }
 
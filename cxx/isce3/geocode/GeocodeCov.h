@@ -24,6 +24,9 @@
 // isce3::geometry
 #include <isce3/geometry/RTC.h>
 
+#include "AreaProjOperator.h"
+#include "InterpOperator.h"
+
 namespace isce3 { namespace geocode {
 
 /** Enumeration type to indicate the algorithm used for geocoding */
@@ -105,6 +108,12 @@ public:
      * @param[in]  min_block_size      Minimum block size (per thread)
      * @param[in]  max_block_size      Maximum block size (per thread)
      * @param[in]  dem_interp_method   DEM interpolation method
+     * @param[out] out_area_proj_operator Output sparse area-projection
+     * operator (area-projection only), to be applied to other rasters with
+     * applyAreaProjOperator()
+     * @param[out] out_interp_operator Output interpolation operator
+     * (interpolation only), to be applied to other rasters with
+     * applyInterpOperator()
      */
     void geocode(const isce3::product::RadarGridParameters& radar_grid,
             isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
@@ -154,7 +163,9 @@ public:
             const long long max_block_size =
                     isce3::core::DEFAULT_MAX_BLOCK_SIZE,
             isce3::core::dataInterpMethod dem_interp_method =
-                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD);
+                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD,
+            AreaProjOperator* out_area_proj_operator = nullptr,
+            InterpOperator* out_interp_operator = nullptr);
 
     /** Geocode using the interpolation algorithm.
      *
@@ -206,6 +217,8 @@ public:
      * @param[in]  min_block_size      Minimum block size (per thread)
      * @param[in]  max_block_size      Maximum block size (per thread)
      * @param[in]  dem_interp_method   DEM interpolation method
+     * @param[out] out_interp_operator Output interpolation operator, to be
+     * applied to other rasters with applyInterpOperator()
      */
     template<class T_out>
     void geocodeInterp(const isce3::product::RadarGridParameters& radar_grid,
@@ -248,7 +261,8 @@ public:
             const long long max_block_size =
                     isce3::core::DEFAULT_MAX_BLOCK_SIZE,
             isce3::core::dataInterpMethod dem_interp_method =
-                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD);
+                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD,
+            InterpOperator* out_interp_operator = nullptr);
 
     /** Geocode using the area projection algorithm (adaptive multilooking)
      *
@@ -309,6 +323,9 @@ public:
      * @param[in]  min_block_size      Minimum block size (per thread)
      * @param[in]  max_block_size      Maximum block size (per thread)
      * @param[in]  dem_interp_method   DEM interpolation method
+     * @param[out] out_area_proj_operator Output sparse area-projection
+     * operator holding the contributions of the radar samples to each
+     * geogrid pixel
      */
     template<class T_out>
     void geocodeAreaProj(
@@ -356,7 +373,82 @@ public:
             const long long max_block_size =
                     isce3::core::DEFAULT_MAX_BLOCK_SIZE,
             isce3::core::dataInterpMethod dem_interp_method =
-                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD);
+                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD,
+            AreaProjOperator* out_area_proj_operator = nullptr);
+
+    /** Geocode a raster with a precomputed area-projection operator.
+     *
+     * The contributions of the radar samples to each geogrid pixel are read
+     * from the operator, so that the geometry (DEM loading, geo2rdr, polygon
+     * integration, RTC) is not recomputed. All the bands of the input raster
+     * (and their cross-products, if out_off_diag_terms is provided) are
+     * geocoded as a sparse matrix-multi-vector product over each geogrid
+     * block. The input raster must share the radar grid and dimensions of
+     * the raster used to build the operator, and the output is written over
+     * the geogrid of the operator.
+     *
+     * @param[in]  area_proj_operator  Area-projection operator obtained from
+     * geocode() or geocodeAreaProj()
+     * @param[in]  input_raster        Input raster
+     * @param[out] output_raster       Output raster
+     * @param[out] out_off_diag_terms  Output raster containing the
+     * off-diagonal terms of the covariance matrix.
+     * @param[in]  clip_min            Clip (limit) minimum output values
+     * @param[in]  clip_max            Clip (limit) maximum output values
+     */
+    void applyAreaProjOperator(const AreaProjOperator& area_proj_operator,
+            isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+            isce3::io::Raster* out_off_diag_terms = nullptr,
+            float clip_min = std::numeric_limits<float>::quiet_NaN(),
+            float clip_max = std::numeric_limits<float>::quiet_NaN());
+
+    /** Geocode a raster with a precomputed interpolation operator.
+     *
+     * The radar-grid positions of the geogrid pixels are read from the
+     * operator, so that the geometry (DEM loading, geo2rdr, RTC) is not
+     * recomputed, and the bands of the input raster are interpolated with
+     * the current data interpolator. The radar-grid masking and the RTC
+     * area normalization only depend on the radar-geometry layers given
+     * below. The input raster must share the radar grid of the raster used
+     * to build the operator, and the output is written over the geogrid of
+     * the operator.
+     *
+     * @param[in]  interp_operator     Interpolation operator obtained from
+     * geocode() or geocodeInterp()
+     * @param[in]  radar_grid          Radar grid
+     * @param[in]  input_raster        Input raster
+     * @param[out] output_raster       Output raster
+     * @param[in]  flag_az_baseband_doppler Shift SLC azimuth spectrum to
+     * baseband (using Doppler centroid) before interpolation
+     * @param[in]  flatten             Flatten the geocoded SLC
+     * @param[in]  abs_cal_factor      Absolute calibration factor.
+     * @param[in]  clip_min            Clip (limit) minimum output values
+     * @param[in]  clip_max            Clip (limit) maximum output values
+     * @param[in]  phase_screen_raster Phase screen to be removed before
+     * geocoding
+     * @param[in]  input_rtc           Input RTC area factor (in slant-range
+     * geometry). If provided, the RTC area normalization is applied.
+     * @param[in]  input_layover_shadow_mask_raster Input layover/shadow mask
+     * raster (in radar geometry). Samples identified as SHADOW or
+     * LAYOVER_AND_SHADOW are considered invalid.
+     * @param[in]  sub_swaths          Sub-swaths metadata
+     * @param[in]  apply_valid_samples_sub_swath_masking Flag indicating
+     * whether the valid-samples sub-swath masking should be applied. If not
+     * given, then sub-swath masking will be applied if the sub_swaths
+     * parameter is provided.
+     */
+    void applyInterpOperator(const InterpOperator& interp_operator,
+            const isce3::product::RadarGridParameters& radar_grid,
+            isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+            bool flag_az_baseband_doppler = false, bool flatten = false,
+            double abs_cal_factor = 1,
+            float clip_min = std::numeric_limits<float>::quiet_NaN(),
+            float clip_max = std::numeric_limits<float>::quiet_NaN(),
+            isce3::io::Raster* phase_screen_raster = nullptr,
+            isce3::io::Raster* input_rtc = nullptr,
+            isce3::io::Raster* input_layover_shadow_mask_raster = nullptr,
+            isce3::product::SubSwaths* sub_swaths = nullptr,
+            std::optional<bool> apply_valid_samples_sub_swath_masking = {});
 
     /** Set the output geogrid
      * @param[in]  geoGridStartY       Starting Lat/Northing position
@@ -532,14 +624,43 @@ private:
             isce3::io::Raster* out_mask,
             isce3::core::GeocodeMemoryMode geocode_memory_mode,
             const long long min_block_size, const long long max_block_size,
+            AreaProjOperator::Block* area_proj_block,
             pyre::journal::info_t& info);
 
+    template<class T2, class T_out>
+    void _applyAreaProjOperator(const AreaProjOperator& area_proj_operator,
+            isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+            isce3::io::Raster* out_off_diag_terms, float clip_min,
+            float clip_max);
+
+    template<class T_out>
+    void _applyInterpOperator(const InterpOperator& interp_operator,
+            const isce3::product::RadarGridParameters& radar_grid,
+            isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+            bool flag_az_baseband_doppler, bool flatten,
+            double abs_cal_factor, float clip_min, float clip_max,
+            isce3::io::Raster* phase_screen_raster,
+            isce3::io::Raster* input_rtc,
+            isce3::io::Raster* input_layover_shadow_mask_raster,
+            isce3::product::SubSwaths* sub_swaths,
+            bool apply_valid_samples_sub_swath_masking);
+
+    /* Read a radar window of a band of the input raster, converting it
+     * to T_out and, if requested, moving its azimuth spectrum to baseband */
+    template<class T_out>
+    void _readRadarBlock(isce3::io::Raster& input_raster, int band,
+            int x0, int y0, const isce3::product::RadarGridParameters&
+                    radar_grid,
+            bool flag_az_baseband_doppler,
+            isce3::core::Matrix<T_out>& rdrDataBlock);
+
     std::string _get_nbytes_str(long nbytes);
 
+    /* Run geo2rdr on a geogrid pixel given by its longitude and latitude
+     * (already transformed from the geogrid projection). */
     int _geo2rdr(const isce3::product::RadarGridParameters& radar_grid,
-            double x, double y, double& azimuthTime, double& slantRange,
-            isce3::geometry::DEMInterpolator& demInterp,
-            isce3::core::ProjectionBase* proj, float& dem_value);
+            double lon, double lat, double& azimuthTime, double& slantRange,
+            isce3::geometry::DEMInterpolator& demInterp, float& dem_value);
 
     /**
      * @param[in] rdrDataBlock a basebanded block of data in radar coordinate
@@ -2,7 +2,10 @@
 #include "GeocodePolygon.h"
 #include "GeocodeHelpers.h"
 
+#include <algorithm>
 #include <limits>
+#include <map>
+#include <numeric>
 
 #include <isce3/core/DenseMatrix.h>
 #include <isce3/core/Projections.h>
@@ -16,18 +19,11 @@
 
 namespace isce3 { namespace geocode {
 
-template <class T>
-GeocodePolygon<T>::GeocodePolygon(
-        const std::vector<double>& x_vect, const std::vector<double>& y_vect,
-        const isce3::product::RadarGridParameters& radar_grid,
-        const isce3::core::Orbit& orbit,
-        const isce3::core::Ellipsoid& ellipsoid,
-        const isce3::core::LUT2d<double>& input_dop,
-        isce3::io::Raster& dem_raster,
-        double threshold, int num_iter, double delta_range) {
-
-    pyre::journal::info_t _info("isce.geometry.GeocodePolygon");
+namespace {
 
+void checkPolygonVertices(const std::vector<double>& x_vect,
+                          const std::vector<double>& y_vect)
+{
     if (x_vect.size() != y_vect.size()) {
         std::string error_msg = "ERROR number of X- and Y-coordinates"
                                 " do not match: " +
@@ -39,29 +35,145 @@ GeocodePolygon<T>::GeocodePolygon(
         std::string error_msg = "ERROR the polygon must have at least 3 vertices";
         throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
     }
-    
-    const auto minmax_x = \
-        std::minmax_element(x_vect.begin(), x_vect.end());
-    const double x0 = *minmax_x.first;
-    const double xf = *minmax_x.second;
+}
+
+/* Axis-aligned bounding box [x0, xf] x [y0, yf] */
+struct BoundingBox {
+    double x0, y0, xf, yf;
+
+    double area() const { return (xf - x0) * (yf - y0); }
+
+    BoundingBox merge(const BoundingBox& other) const
+    {
+        return {std::min(x0, other.x0), std::min(y0, other.y0),
+                std::max(xf, other.xf), std::max(yf, other.yf)};
+    }
+};
+
+BoundingBox polygonBoundingBox(const std::vector<double>& x_vect,
+                               const std::vector<double>& y_vect,
+                               double margin_x, double margin_y)
+{
+    const auto minmax_x = std::minmax_element(x_vect.begin(), x_vect.end());
+    const auto minmax_y = std::minmax_element(y_vect.begin(), y_vect.end());
+    return {*minmax_x.first - margin_x, *minmax_y.first - margin_y,
+            *minmax_x.second + margin_x, *minmax_y.second + margin_y};
+}
+
+/* Group bounding boxes into clusters that can be served by a single read.
+ * A box joins a cluster when the union of their boxes is not larger than
+ * the sum of their areas (i.e., merging does not increase the number of
+ * samples to be read) and the union does not exceed max_area. Boxes are
+ * swept in Y; since the union of two boxes separated in X or Y is always
+ * larger than the sum of their areas, only clusters that still overlap
+ * the sweep line and the box extent in X are candidates. Returns the
+ * indices of the boxes in each cluster. */
+std::vector<std::vector<int>> clusterBoundingBoxes(
+        const std::vector<BoundingBox>& boxes, double max_area)
+{
+    std::vector<int> order(boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return boxes[a].y0 < boxes[b].y0 ||
+               (boxes[a].y0 == boxes[b].y0 && boxes[a].x0 < boxes[b].x0);
+    });
+
+    std::vector<BoundingBox> cluster_boxes;
+    std::vector<std::vector<int>> clusters;
+
+    // clusters still overlapping the sweep line, keyed by their start X
+    std::multimap<double, int> active;
+    double max_width = 0;
+
+    for (int i : order) {
+        const BoundingBox& box = boxes[i];
+
+        int cluster = -1;
+        auto it = active.upper_bound(box.xf);
+        while (it != active.begin()) {
+            --it;
+            if (it->first < box.x0 - max_width)
+                break;
+            const BoundingBox& cluster_box = cluster_boxes[it->second];
+            if (cluster_box.yf < box.y0) {
+                // the sweep line has moved past this cluster
+                it = active.erase(it);
+                continue;
+            }
+            if (cluster_box.xf < box.x0)
+                continue;
+            const BoundingBox merged = cluster_box.merge(box);
+            if (merged.area() > max_area ||
+                merged.area() > cluster_box.area() + box.area())
+                continue;
+            cluster = it->second;
+            active.erase(it);
+            break;
+        }
+
+        if (cluster < 0) {
+            cluster = clusters.size();
+            clusters.emplace_back();
+            cluster_boxes.push_back(box);
+        } else {
+            cluster_boxes[cluster] = cluster_boxes[cluster].merge(box);
+        }
+        clusters[cluster].push_back(i);
+
+        const BoundingBox& cluster_box = cluster_boxes[cluster];
+        active.emplace(cluster_box.x0, cluster);
+        max_width = std::max(max_width, cluster_box.xf - cluster_box.x0);
+    }
+    return clusters;
+}
 
-    const auto minmax_y = \
-        std::minmax_element(y_vect.begin(), y_vect.end());
-    const double y0 = *minmax_y.first;
-    const double yf = *minmax_y.second;
+isce3::geometry::DEMInterpolator loadPolygonDEM(
+        const std::vector<double>& x_vect, const std::vector<double>& y_vect,
+        isce3::io::Raster& dem_raster)
+{
+    checkPolygonVertices(x_vect, y_vect);
 
-    const double dx = dem_raster.dx();
-    const double dy = dem_raster.dy();
+    const double margin_x = std::abs(dem_raster.dx()) * 10;
+    const double margin_y = std::abs(dem_raster.dy()) * 10;
+    const BoundingBox box =
+            polygonBoundingBox(x_vect, y_vect, margin_x, margin_y);
 
-    const double margin_x = std::abs(dx) * 10;
-    const double margin_y = std::abs(dy) * 10;
     isce3::geometry::DEMInterpolator dem_interp;
+    dem_interp.loadDEM(dem_raster, box.x0, box.xf, box.y0, box.yf);
+    return dem_interp;
+}
+
+} // namespace
+
+template <class T>
+GeocodePolygon<T>::GeocodePolygon(
+        const std::vector<double>& x_vect, const std::vector<double>& y_vect,
+        const isce3::product::RadarGridParameters& radar_grid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::Ellipsoid& ellipsoid,
+        const isce3::core::LUT2d<double>& input_dop,
+        isce3::io::Raster& dem_raster,
+        double threshold, int num_iter, double delta_range)
+    : GeocodePolygon(x_vect, y_vect, radar_grid, orbit, ellipsoid, input_dop,
+                     loadPolygonDEM(x_vect, y_vect, dem_raster), threshold,
+                     num_iter, delta_range)
+{}
 
-    dem_interp.loadDEM(dem_raster, x0 - margin_x, xf + margin_x,
-                       std::min(y0, yf) - margin_y,
-                       std::max(y0, yf) + margin_y);
+template <class T>
+GeocodePolygon<T>::GeocodePolygon(
+        const std::vector<double>& x_vect, const std::vector<double>& y_vect,
+        const isce3::product::RadarGridParameters& radar_grid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::Ellipsoid& ellipsoid,
+        const isce3::core::LUT2d<double>& input_dop,
+        const isce3::geometry::DEMInterpolator& dem_interp,
+        double threshold, int num_iter, double delta_range) {
+
+    pyre::journal::info_t _info("isce.geometry.GeocodePolygon");
 
-    int epsg = dem_raster.getEPSG();
+    checkPolygonVertices(x_vect, y_vect);
+
+    int epsg = dem_interp.epsgCode();
     std::unique_ptr<isce3::core::ProjectionBase> proj(
             isce3::core::createProj(epsg));
 
@@ -190,53 +302,12 @@ void GeocodePolygon<T>::getPolygonMean(
     }
 
     isce3::core::Matrix<float> rtc_area;
-    std::unique_ptr<isce3::io::Raster> rtc_raster_unique_ptr;
     if (flag_apply_rtc) {
-
-        isce3::io::Raster* rtc_raster;
-        // if RTC (area factor) raster does not needed to be saved,
-        // initialize it as a GDAL memory virtual file
-        if (output_rtc == nullptr) {
-            std::string vsimem_ref = (
-                "/vsimem/" + getTempString("geocode_polygon_rtc"));
-            rtc_raster_unique_ptr = std::make_unique<isce3::io::Raster>(
-                    vsimem_ref, radar_grid_cropped.width(),
-                    radar_grid_cropped.length(), 1, GDT_Float32, "ENVI");
-            rtc_raster = rtc_raster_unique_ptr.get();
-        }
-
-        // Otherwise, copies the pointer to the output RTC file
-        else
-            rtc_raster = output_rtc;
-
         _info << "computing RTC area factor..." << pyre::journal::endl;
-
-        isce3::geometry::rtcAreaMode rtc_area_mode =
-                isce3::geometry::rtcAreaMode::AREA_FACTOR;
-        isce3::geometry::rtcAlgorithm rtc_algorithm =
-                isce3::geometry::rtcAlgorithm::RTC_AREA_PROJECTION;
-        isce3::geometry::rtcAreaBetaMode rtc_area_beta_mode =
-                isce3::geometry::rtcAreaBetaMode::AUTO;
-
-        isce3::core::MemoryModeBlocksY rtc_memory_mode =
-                isce3::core::MemoryModeBlocksY::SingleBlockY;
-
-        isce3::io::Raster* out_sigma = nullptr;
-
-        computeRtc(radar_grid_cropped, _orbit, input_dop, dem_raster,
-                   *rtc_raster, input_terrain_radiometry,
-                   output_terrain_radiometry, rtc_area_mode,
-                   rtc_algorithm, rtc_area_beta_mode,
-                   geogrid_upsampling * 2, rtc_min_value_db,
-                   out_sigma, rtc_memory_mode, interp_method, _threshold,
-                   _num_iter, _delta_range);
-
-        rtc_area.resize(radar_grid_cropped.length(),
-                        radar_grid_cropped.width());
-
-        rtc_raster->getBlock(rtc_area.data(), 0, 0, radar_grid_cropped.width(),
-                             radar_grid_cropped.length(), 1);
-
+        _computeRtcArea(radar_grid_cropped, input_dop, dem_raster,
+                        input_terrain_radiometry, output_terrain_radiometry,
+                        geogrid_upsampling, rtc_min_value_db, interp_method,
+                        rtc_area, output_rtc);
         _info << "... done (RTC) " << pyre::journal::endl;
     }
 
@@ -341,10 +412,135 @@ void GeocodePolygon<T>::_getPolygonMean(
     }
 
     isce3::core::Matrix<double> w_arr(_ysize, _xsize);
+    std::vector<T_out> cumulative_sum(nbands);
+    std::vector<T> cumulative_sum_off_diag_terms(nbands_off_diag_terms, 0);
+
+    isce3::core::Matrix<T_out> output_radargrid_data_array;
+    if (output_radargrid_data != nullptr) {
+        output_radargrid_data_array.resize(_ysize, _xsize);
+        output_radargrid_data_array.fill(std::numeric_limits<T_out>::quiet_NaN());
+    }
+
+    const double nlooks = _integrate(
+            rdrDataBlock, _xoff, _yoff, rtc_area, flag_apply_rtc,
+            rtc_min_value, radar_grid.lookSide(), w_arr, cumulative_sum,
+            cumulative_sum_off_diag_terms,
+            (output_radargrid_data != nullptr ? &output_radargrid_data_array
+                                              : nullptr));
+
+    if (output_radargrid_data != nullptr)
+        output_radargrid_data->setBlock(output_radargrid_data_array.data(), 0,
+                                        0, _xsize, _ysize, 1);
+
+    if (output_weights != nullptr)
+        output_weights->setBlock(w_arr.data(), 0, 0, _xsize, _ysize, 1);
+
+    _info << "nlooks: " << radar_grid_nlooks * std::abs(nlooks)
+         << pyre::journal::endl;
+
+    for (int band = 0; band < nbands; ++band) {
+        cumulative_sum[band] *= abs_cal_factor / nlooks;
+        _info << "mean value (band = " << band + 1 << "): " << cumulative_sum[band]
+             << pyre::journal::endl;
+    }
+    output_raster.setBlock(cumulative_sum, 0, 0, nbands, 1);
+    if (nbands_off_diag_terms > 0) {
+        for (int band = 0; band < nbands_off_diag_terms; ++band) {
+            cumulative_sum_off_diag_terms[band] *= abs_cal_factor / nlooks;
+            _info << "mean value (off diag band = " << band + 1
+                  << "): " << cumulative_sum_off_diag_terms[band]
+                  << pyre::journal::endl;
+        }
+        output_off_diag_terms->setBlock(cumulative_sum_off_diag_terms, 0, 0,
+                                        nbands_off_diag_terms, 1);
+    }
+
+    _out_nlooks = radar_grid_nlooks * std::abs(nlooks);
+
+}
+
+template<class T>
+void GeocodePolygon<T>::_computeRtcArea(
+        const isce3::product::RadarGridParameters& radar_grid_cropped,
+        const isce3::core::LUT2d<double>& input_dop,
+        isce3::io::Raster& dem_raster,
+        isce3::geometry::rtcInputTerrainRadiometry input_terrain_radiometry,
+        isce3::geometry::rtcOutputTerrainRadiometry output_terrain_radiometry,
+        double geogrid_upsampling, float rtc_min_value_db,
+        isce3::core::dataInterpMethod interp_method,
+        isce3::core::Matrix<float>& rtc_area,
+        isce3::io::Raster* output_rtc) const {
+
+    isce3::io::Raster* rtc_raster;
+    std::unique_ptr<isce3::io::Raster> rtc_raster_unique_ptr;
+
+    // if RTC (area factor) raster does not needed to be saved,
+    // initialize it as a GDAL memory virtual file
+    if (output_rtc == nullptr) {
+        std::string vsimem_ref = (
+            "/vsimem/" + getTempString("geocode_polygon_rtc"));
+        rtc_raster_unique_ptr = std::make_unique<isce3::io::Raster>(
+                vsimem_ref, radar_grid_cropped.width(),
+                radar_grid_cropped.length(), 1, GDT_Float32, "ENVI");
+        rtc_raster = rtc_raster_unique_ptr.get();
+    }
+
+    // Otherwise, copies the pointer to the output RTC file
+    else
+        rtc_raster = output_rtc;
+
+    isce3::geometry::rtcAreaMode rtc_area_mode =
+            isce3::geometry::rtcAreaMode::AREA_FACTOR;
+    isce3::geometry::rtcAlgorithm rtc_algorithm =
+            isce3::geometry::rtcAlgorithm::RTC_AREA_PROJECTION;
+    isce3::geometry::rtcAreaBetaMode rtc_area_beta_mode =
+            isce3::geometry::rtcAreaBetaMode::AUTO;
+
+    isce3::core::MemoryModeBlocksY rtc_memory_mode =
+            isce3::core::MemoryModeBlocksY::SingleBlockY;
+
+    isce3::io::Raster* out_sigma = nullptr;
+
+    computeRtc(radar_grid_cropped, _orbit, input_dop, dem_raster,
+               *rtc_raster, input_terrain_radiometry,
+               output_terrain_radiometry, rtc_area_mode,
+               rtc_algorithm, rtc_area_beta_mode,
+               geogrid_upsampling * 2, rtc_min_value_db,
+               out_sigma, rtc_memory_mode, interp_method, _threshold,
+               _num_iter, _delta_range);
+
+    rtc_area.resize(radar_grid_cropped.length(),
+                    radar_grid_cropped.width());
+
+    rtc_raster->getBlock(rtc_area.data(), 0, 0, radar_grid_cropped.width(),
+                         radar_grid_cropped.length(), 1);
+}
+
+template<class T>
+template<class T_out>
+double GeocodePolygon<T>::_integrate(
+        const std::vector<std::unique_ptr<isce3::core::Matrix<T>>>&
+                rdrDataBlock,
+        int block_xoff, int block_yoff,
+        const isce3::core::Matrix<float>& rtc_area,
+        bool flag_apply_rtc, float rtc_min_value,
+        isce3::core::LookSide look_side,
+        isce3::core::Matrix<double>& w_arr,
+        std::vector<T_out>& cumulative_sum,
+        std::vector<T>& cumulative_sum_off_diag_terms,
+        isce3::core::Matrix<T_out>* output_radargrid_data_array) const {
+
+    using isce3::math::complex_operations::operator*;
+
+    const int nbands = rdrDataBlock.size();
+    const int nbands_off_diag_terms = cumulative_sum_off_diag_terms.size();
+    const int block_length = rdrDataBlock[0]->length();
+    const int block_width = rdrDataBlock[0]->width();
+
     w_arr.fill(0);
 
     int plane_orientation;
-    if (radar_grid.lookSide() == isce3::core::LookSide::Left)
+    if (look_side == isce3::core::LookSide::Left)
         plane_orientation = -1;
     else
         plane_orientation = 1;
@@ -367,19 +563,16 @@ void GeocodePolygon<T>::_getPolygonMean(
                                  x01 - _xoff, _ysize, _xsize, w_arr, w_total,
                                  plane_orientation);
     }
-    std::vector<T_out> cumulative_sum(nbands);
-    std::vector<T> cumulative_sum_off_diag_terms(nbands_off_diag_terms, 0);
     double nlooks = 0;
 
-    isce3::core::Matrix<T_out> output_radargrid_data_array;
-    if (output_radargrid_data != nullptr) {
-        output_radargrid_data_array.resize(_ysize, _xsize);
-        output_radargrid_data_array.fill(std::numeric_limits<T_out>::quiet_NaN());
-    }
-
-    Geocode<T> geo_obj;
-    for (int y = 0; y < _ysize; ++y)
+    for (int y = 0; y < _ysize; ++y) {
+        const int block_y = y + _yoff - block_yoff;
+        if (block_y < 0 || block_y >= block_length)
+            continue;
         for (int x = 0; x < _xsize; ++x) {
+            const int block_x = x + _xoff - block_xoff;
+            if (block_x < 0 || block_x >= block_width)
+                continue;
             double w = w_arr(y, x);
             if (w == 0)
                 continue;
@@ -403,12 +596,13 @@ void GeocodePolygon<T>::_getPolygonMean(
         
             int band_index = 0;
             for (int band_1 = 0; band_1 < nbands; ++band_1) {
-                T v1 = rdrDataBlock[band_1].get()->operator()(y, x);
+                T v1 = rdrDataBlock[band_1]->operator()(block_y, block_x);
                 _accumulate(cumulative_sum[band_1], v1, w);
-                if (output_radargrid_data != nullptr) {
+                if (output_radargrid_data_array != nullptr) {
                     T_out out_radar;
                     _convertToOutputType(v1, out_radar);
-                    output_radargrid_data_array(y, x) = out_radar * std::abs(w);
+                    (*output_radargrid_data_array)(y, x) =
+                            out_radar * std::abs(w);
                 }
 
                 if (nbands_off_diag_terms > 0) {
@@ -416,43 +610,274 @@ void GeocodePolygon<T>::_getPolygonMean(
                         if (band_2 <= band_1)
                             continue;
                         _accumulate(cumulative_sum_off_diag_terms[band_index],
-                            v1 * std::conj(rdrDataBlock[band_2].get()->operator()(y, x)), 
+                            v1 * std::conj(rdrDataBlock[band_2]->operator()(
+                                    block_y, block_x)),
                             w);
                         band_index++;
                     }
                 }
             }
         }
+    }
+    return nlooks;
+}
 
-    if (output_radargrid_data != nullptr)
-        output_radargrid_data->setBlock(output_radargrid_data_array.data(), 0,
-                                        0, _xsize, _ysize, 1);
+template<class T>
+std::vector<float> GeocodePolygon<T>::getPolygonMeans(
+        const std::vector<std::vector<double>>& x_vects,
+        const std::vector<std::vector<double>>& y_vects,
+        const isce3::product::RadarGridParameters& radar_grid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::Ellipsoid& ellipsoid,
+        const isce3::core::LUT2d<double>& input_dop,
+        isce3::io::Raster& input_raster,
+        isce3::io::Raster& output_raster,
+        isce3::io::Raster& dem_raster,
+        bool flag_apply_rtc,
+        isce3::geometry::rtcInputTerrainRadiometry input_terrain_radiometry,
+        isce3::geometry::rtcOutputTerrainRadiometry output_terrain_radiometry,
+        int exponent, double geogrid_upsampling,
+        float rtc_min_value_db, double abs_cal_factor, float radar_grid_nlooks,
+        isce3::io::Raster* output_off_diag_terms,
+        isce3::core::dataInterpMethod interp_method,
+        double threshold, int num_iter, double delta_range,
+        long long max_block_size) {
 
-    if (output_weights != nullptr)
-        output_weights->setBlock(w_arr.data(), 0, 0, _xsize, _ysize, 1);
+    pyre::journal::info_t _info("isce.geometry.getPolygonMeans");
 
-    _info << "nlooks: " << radar_grid_nlooks * std::abs(nlooks)
-         << pyre::journal::endl;
+    if (x_vects.size() != y_vects.size()) {
+        std::string error_msg = "ERROR number of X- and Y-coordinate vectors"
+                                " do not match: " +
+                                std::to_string(x_vects.size()) +
+                                " != " + std::to_string(y_vects.size());
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    if (max_block_size <= 0) {
+        std::string error_msg = "ERROR invalid maximum block size: " +
+                                std::to_string(max_block_size);
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    const int npolygons = x_vects.size();
+    if (npolygons == 0)
+        return {};
 
-    for (int band = 0; band < nbands; ++band) {
-        cumulative_sum[band] *= abs_cal_factor / nlooks;
-        _info << "mean value (band = " << band + 1 << "): " << cumulative_sum[band]
-             << pyre::journal::endl;
+    if (std::isnan(geogrid_upsampling))
+        geogrid_upsampling = 2;
+    assert(geogrid_upsampling > 0);
+
+    // group polygons that can share the same DEM subset (in DEM pixels)
+    const double dem_dx = std::abs(dem_raster.dx());
+    const double dem_dy = std::abs(dem_raster.dy());
+    std::vector<BoundingBox> geo_boxes;
+    geo_boxes.reserve(npolygons);
+    for (int i = 0; i < npolygons; ++i) {
+        checkPolygonVertices(x_vects[i], y_vects[i]);
+        const BoundingBox box = polygonBoundingBox(
+                x_vects[i], y_vects[i], dem_dx * 10, dem_dy * 10);
+        geo_boxes.push_back({box.x0 / dem_dx, box.y0 / dem_dy,
+                             box.xf / dem_dx, box.yf / dem_dy});
     }
-    output_raster.setBlock(cumulative_sum, 0, 0, nbands, 1);
-    if (nbands_off_diag_terms > 0) {
-        for (int band = 0; band < nbands_off_diag_terms; ++band) {
-            cumulative_sum_off_diag_terms[band] *= abs_cal_factor / nlooks;
-            _info << "mean value (off diag band = " << band + 1
-                  << "): " << cumulative_sum_off_diag_terms[band]
-                  << pyre::journal::endl;
+    const std::vector<std::vector<int>> dem_blocks =
+            clusterBoundingBoxes(geo_boxes, max_block_size);
+
+    _info << "number of polygons: " << npolygons << pyre::journal::newline
+          << "number of DEM blocks: " << dem_blocks.size()
+          << pyre::journal::endl;
+
+    std::vector<std::unique_ptr<GeocodePolygon<T>>> polygons(npolygons);
+    for (const auto& dem_block : dem_blocks) {
+        BoundingBox box = geo_boxes[dem_block[0]];
+        for (int i : dem_block)
+            box = box.merge(geo_boxes[i]);
+
+        isce3::geometry::DEMInterpolator dem_interp;
+        dem_interp.loadDEM(dem_raster, box.x0 * dem_dx, box.xf * dem_dx,
+                           box.y0 * dem_dy, box.yf * dem_dy);
+
+        for (int i : dem_block)
+            polygons[i] = std::make_unique<GeocodePolygon<T>>(
+                    x_vects[i], y_vects[i], radar_grid, orbit, ellipsoid,
+                    input_dop, dem_interp, threshold, num_iter, delta_range);
+    }
+
+    // group polygons that can share the same radar-grid block
+    std::vector<BoundingBox> radar_boxes;
+    radar_boxes.reserve(npolygons);
+    for (const auto& polygon : polygons) {
+        radar_boxes.push_back(
+                {(double) polygon->_xoff, (double) polygon->_yoff,
+                 (double) polygon->_xoff + polygon->_xsize,
+                 (double) polygon->_yoff + polygon->_ysize});
+    }
+    const std::vector<std::vector<int>> radar_blocks =
+            clusterBoundingBoxes(radar_boxes, max_block_size);
+
+    _info << "number of radar-grid blocks: " << radar_blocks.size()
+          << pyre::journal::endl;
+
+    GDALDataType input_dtype = input_raster.dtype();
+    if (exponent == 0 && GDALDataTypeIsComplex(input_dtype))
+        exponent = 2;
+
+    if (input_dtype == GDT_Float32 ||
+        (input_dtype == GDT_CFloat32 && exponent == 2)) {
+        _getPolygonMeans<float>(
+                polygons, radar_blocks, radar_grid, input_dop, input_raster,
+                output_raster, dem_raster, flag_apply_rtc,
+                input_terrain_radiometry, output_terrain_radiometry,
+                geogrid_upsampling, rtc_min_value_db, abs_cal_factor,
+                radar_grid_nlooks, output_off_diag_terms, interp_method);
+    } else if (input_dtype == GDT_CFloat32 && exponent == 1) {
+        _getPolygonMeans<std::complex<float>>(
+                polygons, radar_blocks, radar_grid, input_dop, input_raster,
+                output_raster, dem_raster, flag_apply_rtc,
+                input_terrain_radiometry, output_terrain_radiometry,
+                geogrid_upsampling, rtc_min_value_db, abs_cal_factor,
+                radar_grid_nlooks, output_off_diag_terms, interp_method);
+    } else
+        _info << "ERROR not implemented for datatype: " << input_dtype
+              << pyre::journal::endl;
+
+    std::vector<float> out_nlooks(npolygons);
+    for (int i = 0; i < npolygons; ++i)
+        out_nlooks[i] = polygons[i]->_out_nlooks;
+    return out_nlooks;
+}
+
+template<class T>
+template<class T_out>
+void GeocodePolygon<T>::_getPolygonMeans(
+        std::vector<std::unique_ptr<GeocodePolygon<T>>>& polygons,
+        const std::vector<std::vector<int>>& blocks,
+        const isce3::product::RadarGridParameters& radar_grid,
+        const isce3::core::LUT2d<double>& input_dop,
+        isce3::io::Raster& input_raster,
+        isce3::io::Raster& output_raster,
+        isce3::io::Raster& dem_raster,
+        bool flag_apply_rtc,
+        isce3::geometry::rtcInputTerrainRadiometry input_terrain_radiometry,
+        isce3::geometry::rtcOutputTerrainRadiometry output_terrain_radiometry,
+        double geogrid_upsampling, float rtc_min_value_db,
+        double abs_cal_factor, float radar_grid_nlooks,
+        isce3::io::Raster* output_off_diag_terms,
+        isce3::core::dataInterpMethod interp_method) {
+
+    pyre::journal::info_t _info("isce.geometry._getPolygonMeans");
+
+    const int npolygons = polygons.size();
+    const int nbands = input_raster.numBands();
+
+    int nbands_off_diag_terms = 0;
+    if (output_off_diag_terms != nullptr) {
+        nbands_off_diag_terms = nbands * (nbands - 1) / 2;
+        assert(output_off_diag_terms->numBands() == nbands_off_diag_terms);
+        if (!GDALDataTypeIsComplex(input_raster.dtype())) {
+            std::string error_msg = "Input raster must be complex to"
+                                    " generate full-covariance matrix";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        if (!GDALDataTypeIsComplex(output_off_diag_terms->dtype())) {
+            std::string error_msg = "Off-diagonal raster must be complex";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
         }
-        output_off_diag_terms->setBlock(cumulative_sum_off_diag_terms, 0, 0,
-                                        nbands_off_diag_terms, 1);
     }
 
-    _out_nlooks = radar_grid_nlooks * std::abs(nlooks);
+    double rtc_min_value = 0;
+    if (!std::isnan(rtc_min_value_db) && flag_apply_rtc)
+        rtc_min_value = std::pow(10., (rtc_min_value_db / 10.));
+
+    // one line per polygon, one column per band
+    isce3::core::Matrix<T_out> mean_values(npolygons, nbands);
+    isce3::core::Matrix<T> mean_values_off_diag_terms;
+    if (nbands_off_diag_terms > 0)
+        mean_values_off_diag_terms.resize(npolygons, nbands_off_diag_terms);
+
+    for (const auto& block : blocks) {
+
+        int block_xoff = radar_grid.width(), block_yoff = radar_grid.length();
+        int block_xend = 0, block_yend = 0;
+        for (int i : block) {
+            const auto& polygon = *polygons[i];
+            block_xoff = std::min(block_xoff, polygon._xoff);
+            block_yoff = std::min(block_yoff, polygon._yoff);
+            block_xend = std::max(block_xend, polygon._xoff + polygon._xsize);
+            block_yend = std::max(block_yend, polygon._yoff + polygon._ysize);
+        }
+        block_xend = std::min(block_xend, (int) radar_grid.width());
+        block_yend = std::min(block_yend, (int) radar_grid.length());
+        const int block_width = block_xend - block_xoff;
+        const int block_length = block_yend - block_yoff;
+
+        _info << "radar-grid block (a0: " << block_yoff << ", r0: "
+              << block_xoff << ", length: " << block_length
+              << ", width: " << block_width << "), number of polygons: "
+              << block.size() << pyre::journal::endl;
+
+        std::vector<std::unique_ptr<isce3::core::Matrix<T>>> rdrDataBlock;
+        rdrDataBlock.reserve(nbands);
+        for (int band = 0; band < nbands; ++band) {
+            rdrDataBlock.emplace_back(
+                    std::make_unique<isce3::core::Matrix<T>>(
+                            block_length, block_width));
+            input_raster.getBlock(rdrDataBlock[band]->data(), block_xoff,
+                                  block_yoff, block_width, block_length,
+                                  band + 1);
+        }
+
+        // RTC area factors are computed over each polygon's own radar-grid
+        // footprint (as in getPolygonMean()) so that the results do not
+        // depend on how polygons are grouped into blocks
+        const int block_size = block.size();
+        std::vector<isce3::core::Matrix<float>> rtc_areas(block_size);
+        if (flag_apply_rtc) {
+            for (int k = 0; k < block_size; ++k) {
+                const auto& polygon = *polygons[block[k]];
+                polygon._computeRtcArea(
+                        radar_grid.offsetAndResize(polygon._yoff,
+                                                   polygon._xoff,
+                                                   polygon._ysize,
+                                                   polygon._xsize),
+                        input_dop, dem_raster, input_terrain_radiometry,
+                        output_terrain_radiometry, geogrid_upsampling,
+                        rtc_min_value_db, interp_method, rtc_areas[k]);
+            }
+        }
+
+        _Pragma("omp parallel for schedule(dynamic)")
+        for (int k = 0; k < block_size; ++k) {
+            const int i = block[k];
+            auto& polygon = *polygons[i];
+
+            isce3::core::Matrix<double> w_arr(polygon._ysize, polygon._xsize);
+            std::vector<T_out> cumulative_sum(nbands);
+            std::vector<T> cumulative_sum_off_diag_terms(
+                    nbands_off_diag_terms, 0);
+
+            const double nlooks = polygon.template _integrate<T_out>(
+                    rdrDataBlock, block_xoff, block_yoff, rtc_areas[k],
+                    flag_apply_rtc, rtc_min_value, radar_grid.lookSide(),
+                    w_arr, cumulative_sum, cumulative_sum_off_diag_terms,
+                    nullptr);
+
+            for (int band = 0; band < nbands; ++band) {
+                cumulative_sum[band] *= abs_cal_factor / nlooks;
+                mean_values(i, band) = cumulative_sum[band];
+            }
+            for (int band = 0; band < nbands_off_diag_terms; ++band) {
+                cumulative_sum_off_diag_terms[band] *= abs_cal_factor / nlooks;
+                mean_values_off_diag_terms(i, band) =
+                        cumulative_sum_off_diag_terms[band];
+            }
+
+            polygon._out_nlooks = radar_grid_nlooks * std::abs(nlooks);
+        }
+    }
 
+    output_raster.setBlock(mean_values.data(), 0, 0, nbands, npolygons, 1);
+    if (nbands_off_diag_terms > 0)
+        output_off_diag_terms->setBlock(mean_values_off_diag_terms.data(), 0,
+                                        0, nbands_off_diag_terms, npolygons,
+                                        1);
 }
 
 template<class T>
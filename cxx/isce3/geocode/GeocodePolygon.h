@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 // pyre
 #include <pyre/journal.h>
 
@@ -15,6 +18,7 @@
 #include <isce3/product/RadarGridParameters.h>
 
 // isce3::geometry
+#include <isce3/geometry/DEMInterpolator.h>
 #include <isce3/geometry/RTC.h>
 
 
@@ -46,6 +50,30 @@ public:
                    isce3::io::Raster& dem_raster, double threshold = 1e-8,
                    int num_iter = 100, double delta_range = 1e-8);
 
+    /** Calculate the mean value of radar-grid samples using a polygon defined
+     * over geographical coordinates and a DEM interpolator that has already
+     * been loaded over the polygon extent.
+     *
+     * @param[in]  x_vect              Polygon vertices Lon/Easting positions
+     * @param[in]  y_vect              Polygon vertices Lon/Easting positions
+     * @param[in]  radar_grid          Radar grid
+     * @param[in]  orbit               Orbit
+     * @param[in]  input_dop           Doppler LUT associated with the radar grid
+     * @param[in]  dem_interp          DEM interpolator covering the polygon
+     * @param[in]  threshold           Azimuth time threshold for convergence (s)
+     * @param[in]  num_iter            Maximum number of Newton-Raphson iterations
+     * @param[in]  delta_range         Step size used for computing Doppler derivative
+     */
+    GeocodePolygon(const std::vector<double>& x_vect,
+                   const std::vector<double>& y_vect,
+                   const isce3::product::RadarGridParameters& radar_grid,
+                   const isce3::core::Orbit& orbit,
+                   const isce3::core::Ellipsoid& ellipsoid,
+                   const isce3::core::LUT2d<double>& input_dop,
+                   const isce3::geometry::DEMInterpolator& dem_interp,
+                   double threshold = 1e-8, int num_iter = 100,
+                   double delta_range = 1e-8);
+
     /** Calculate the mean value of radar-grid samples using a polygon defined
      * over geographical coordinates.
      *
@@ -99,6 +127,75 @@ public:
             isce3::core::dataInterpMethod interp_method =
                     isce3::core::dataInterpMethod::BIQUINTIC_METHOD);
 
+    /** Calculate the mean value of radar-grid samples for many polygons
+     * defined over geographical coordinates.
+     *
+     * Polygons that are close to each other share DEM reads. Their radar-grid
+     * bounding boxes are merged into blocks, and each block is read only
+     * once. The polygons within a block are then integrated in parallel.
+     * The RTC area factor, if requested, is computed over each polygon's
+     * own radar-grid footprint, so that each output line is equal to the
+     * output of getPolygonMean() for the same polygon.
+     *
+     * @param[in]  x_vects             Vertices Lon/Easting positions of each polygon
+     * @param[in]  y_vects             Vertices Lat/Northing positions of each polygon
+     * @param[in]  radar_grid          Radar grid
+     * @param[in]  orbit               Orbit
+     * @param[in]  ellipsoid           Ellipsoid
+     * @param[in]  input_dop           Doppler LUT associated with the radar grid
+     * @param[in]  input_raster        Input raster
+     * @param[out] output_raster       Output raster with one line per polygon
+     * and one column per input band
+     * @param[in]  dem_raster          Input DEM raster
+     * @param[in]  flag_apply_rtc      Apply radiometric terrain correction (RTC)
+     * @param[in]  input_terrain_radiometry    Terrain radiometry of the input raster
+     * @param[in]  output_terrain_radiometry Output terrain radiometry
+     * @param[in]  exponent            Exponent to be applied to the input data.
+     * The value 0 indicates that the the exponent is based on the data type of
+     * the input raster (1 for real and 2 for complex rasters).
+     * @param[in]  geogrid_upsampling  Geogrid upsampling (in each direction)
+     * @param[in]  rtc_min_value_db    Minimum value for the RTC area factor.
+     * Radar data with RTC area factor below this limit are ignored.
+     * @param[in]  abs_cal_factor      Absolute calibration factor.
+     * @param[in]  radar_grid_nlooks   Radar grid number of looks. This
+     * parameters determines the multilooking factor used to compute out_nlooks.
+     * @param[out] output_off_diag_terms Output raster containing the
+     * off-diagonal terms of the covariance matrix with one line per polygon.
+     * @param[in]  interp_method       Data interpolation method
+     * @param[in]  threshold           Azimuth time threshold for convergence (s)
+     * @param[in]  num_iter            Maximum number of Newton-Raphson iterations
+     * @param[in]  delta_range         Step size used for computing Doppler derivative
+     * @param[in]  max_block_size      Maximum number of pixels of a merged
+     * DEM or radar-grid block
+     * @returns                        Number of looks of each polygon
+     */
+    static std::vector<float> getPolygonMeans(
+            const std::vector<std::vector<double>>& x_vects,
+            const std::vector<std::vector<double>>& y_vects,
+            const isce3::product::RadarGridParameters& radar_grid,
+            const isce3::core::Orbit& orbit,
+            const isce3::core::Ellipsoid& ellipsoid,
+            const isce3::core::LUT2d<double>& input_dop,
+            isce3::io::Raster& input_raster,
+            isce3::io::Raster& output_raster,
+            isce3::io::Raster& dem_raster,
+            bool flag_apply_rtc = false,
+            isce3::geometry::rtcInputTerrainRadiometry input_terrain_radiometry =
+                    isce3::geometry::rtcInputTerrainRadiometry::BETA_NAUGHT,
+            isce3::geometry::rtcOutputTerrainRadiometry
+                    output_terrain_radiometry = isce3::geometry::
+                            rtcOutputTerrainRadiometry::GAMMA_NAUGHT,
+            int exponent = 0,
+            double geogrid_upsampling =
+                    std::numeric_limits<double>::quiet_NaN(),
+            float rtc_min_value_db = std::numeric_limits<float>::quiet_NaN(),
+            double abs_cal_factor = 1, float radar_grid_nlooks = 1,
+            isce3::io::Raster* output_off_diag_terms = nullptr,
+            isce3::core::dataInterpMethod interp_method =
+                    isce3::core::dataInterpMethod::BIQUINTIC_METHOD,
+            double threshold = 1e-8, int num_iter = 100,
+            double delta_range = 1e-8, long long max_block_size = 1 << 24);
+
     // Radar grid X offset
     int xoff() const { return _xoff; }
 
@@ -143,6 +240,55 @@ private:
             isce3::io::Raster* output_radargrid_data = nullptr,
             isce3::io::Raster* output_weights = nullptr);
 
+    template<class T_out>
+    static void _getPolygonMeans(
+            std::vector<std::unique_ptr<GeocodePolygon<T>>>& polygons,
+            const std::vector<std::vector<int>>& blocks,
+            const isce3::product::RadarGridParameters& radar_grid,
+            const isce3::core::LUT2d<double>& input_dop,
+            isce3::io::Raster& input_raster,
+            isce3::io::Raster& output_raster,
+            isce3::io::Raster& dem_raster,
+            bool flag_apply_rtc,
+            isce3::geometry::rtcInputTerrainRadiometry input_terrain_radiometry,
+            isce3::geometry::rtcOutputTerrainRadiometry output_terrain_radiometry,
+            double geogrid_upsampling, float rtc_min_value_db,
+            double abs_cal_factor, float radar_grid_nlooks,
+            isce3::io::Raster* output_off_diag_terms,
+            isce3::core::dataInterpMethod interp_method);
+
+    /* Compute the RTC area factor over the cropped radar grid. If
+     * output_rtc is null, the area factor is computed over a GDAL memory
+     * virtual file. */
+    void _computeRtcArea(
+            const isce3::product::RadarGridParameters& radar_grid_cropped,
+            const isce3::core::LUT2d<double>& input_dop,
+            isce3::io::Raster& dem_raster,
+            isce3::geometry::rtcInputTerrainRadiometry input_terrain_radiometry,
+            isce3::geometry::rtcOutputTerrainRadiometry output_terrain_radiometry,
+            double geogrid_upsampling, float rtc_min_value_db,
+            isce3::core::dataInterpMethod interp_method,
+            isce3::core::Matrix<float>& rtc_area,
+            isce3::io::Raster* output_rtc = nullptr) const;
+
+    /* Integrate the polygon over a radar-grid block whose first sample
+     * is located at (block_yoff, block_xoff). The RTC area factor rtc_area
+     * covers the polygon's cropped radar grid (_yoff, _xoff, _ysize,
+     * _xsize). Returns the sum of weights (number of looks before
+     * multilooking). */
+    template<class T_out>
+    double _integrate(
+            const std::vector<std::unique_ptr<isce3::core::Matrix<T>>>&
+                    rdrDataBlock,
+            int block_xoff, int block_yoff,
+            const isce3::core::Matrix<float>& rtc_area,
+            bool flag_apply_rtc, float rtc_min_value,
+            isce3::core::LookSide look_side,
+            isce3::core::Matrix<double>& w_arr,
+            std::vector<T_out>& cumulative_sum,
+            std::vector<T>& cumulative_sum_off_diag_terms,
+            isce3::core::Matrix<T_out>* output_radargrid_data_array) const;
+
     void _ValidatePolygon(
             const isce3::product::RadarGridParameters& radar_grid);
 
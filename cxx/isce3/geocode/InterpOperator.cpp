@@ -0,0 +1,152 @@
+#include "InterpOperator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <isce3/except/Error.h>
+#include <isce3/io/IH5.h>
+#include <isce3/io/Serialization.h>
+
+namespace isce3 { namespace geocode {
+
+std::size_t InterpOperator::numValidPixels() const
+{
+    std::size_t n = 0;
+    for (const auto& block : _blocks) {
+        n += std::count_if(block.radar_y.begin(), block.radar_y.end(),
+                [](double v) { return !std::isnan(v); });
+    }
+    return n;
+}
+
+std::size_t InterpOperator::memorySize() const
+{
+    std::size_t n = 0;
+    for (const auto& block : _blocks)
+        n += (block.radar_y.size() + block.radar_x.size()) * sizeof(double);
+    return n;
+}
+
+void InterpOperator::saveToH5(isce3::io::IGroup& group) const
+{
+    using isce3::io::saveToH5;
+
+    saveToH5(group, "geogridStartX", _geogrid_start_x);
+    saveToH5(group, "geogridStartY", _geogrid_start_y);
+    saveToH5(group, "geogridSpacingX", _geogrid_spacing_x);
+    saveToH5(group, "geogridSpacingY", _geogrid_spacing_y);
+    saveToH5(group, "geogridLength", _geogrid_length);
+    saveToH5(group, "geogridWidth", _geogrid_width);
+    saveToH5(group, "epsg", _epsg);
+    saveToH5(group, "radarGridLength", _radar_grid_length);
+    saveToH5(group, "radarGridWidth", _radar_grid_width);
+
+    // geometry of the blocks and the radar positions of all the geogrid
+    // pixels (NaN for the pixels of blocks without valid pixels)
+    const std::size_t nblocks = _blocks.size();
+    std::vector<int> geometry(nblocks * 6);
+    for (std::size_t i = 0; i < nblocks; ++i) {
+        const Block& block = _blocks[i];
+        const int values[6] = {block.y0, block.length, block.radar_y0,
+                block.radar_x0, block.radar_length, block.radar_width};
+        std::copy(values, values + 6, geometry.begin() + 6 * i);
+    }
+
+    saveToH5(group, "numBlocks", int(nblocks));
+    if (nblocks == 0)
+        return;
+    std::array<std::size_t, 2> geometry_dims {nblocks, 6};
+    saveToH5(group, "blockGeometry", geometry, geometry_dims);
+
+    const std::size_t width = _geogrid_width;
+    std::vector<double> radar_y, radar_x;
+    radar_y.reserve(std::size_t(_geogrid_length) * width);
+    radar_x.reserve(std::size_t(_geogrid_length) * width);
+    for (const Block& block : _blocks) {
+        if (block.radar_y.empty()) {
+            radar_y.insert(radar_y.end(), block.length * width,
+                    std::numeric_limits<double>::quiet_NaN());
+            radar_x.insert(radar_x.end(), block.length * width,
+                    std::numeric_limits<double>::quiet_NaN());
+            continue;
+        }
+        radar_y.insert(radar_y.end(), block.radar_y.begin(),
+                block.radar_y.end());
+        radar_x.insert(radar_x.end(), block.radar_x.begin(),
+                block.radar_x.end());
+    }
+
+    std::array<std::size_t, 2> dims {radar_y.size() / width, width};
+    saveToH5(group, "radarY", radar_y, dims, "pixels");
+    saveToH5(group, "radarX", radar_x, dims, "pixels");
+}
+
+void InterpOperator::loadFromH5(isce3::io::IGroup& group)
+{
+    using isce3::io::loadFromH5;
+
+    loadFromH5(group, "geogridStartX", _geogrid_start_x);
+    loadFromH5(group, "geogridStartY", _geogrid_start_y);
+    loadFromH5(group, "geogridSpacingX", _geogrid_spacing_x);
+    loadFromH5(group, "geogridSpacingY", _geogrid_spacing_y);
+    loadFromH5(group, "geogridLength", _geogrid_length);
+    loadFromH5(group, "geogridWidth", _geogrid_width);
+    loadFromH5(group, "epsg", _epsg);
+    loadFromH5(group, "radarGridLength", _radar_grid_length);
+    loadFromH5(group, "radarGridWidth", _radar_grid_width);
+
+    int nblocks;
+    loadFromH5(group, "numBlocks", nblocks);
+    _blocks.clear();
+    if (nblocks <= 0)
+        return;
+
+    std::vector<int> geometry;
+    std::vector<double> radar_y, radar_x;
+    loadFromH5(group, "blockGeometry", geometry);
+    loadFromH5(group, "radarY", radar_y);
+    loadFromH5(group, "radarX", radar_x);
+
+    const std::size_t width = _geogrid_width;
+    const std::size_t npixels = std::size_t(_geogrid_length) * width;
+    if (geometry.size() != std::size_t(nblocks) * 6 ||
+            radar_y.size() != npixels || radar_x.size() != npixels) {
+        std::string error_msg = "ERROR inconsistent datasets in the"
+                                " interpolation operator";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    _blocks.resize(nblocks);
+    for (int i = 0; i < nblocks; ++i) {
+        Block& block = _blocks[i];
+        const int* values = geometry.data() + 6 * i;
+        block.y0 = values[0];
+        block.length = values[1];
+        block.radar_y0 = values[2];
+        block.radar_x0 = values[3];
+        block.radar_length = values[4];
+        block.radar_width = values[5];
+
+        if (block.y0 < 0 || block.length < 0 ||
+                block.y0 + block.length > _geogrid_length) {
+            std::string error_msg = "ERROR invalid geometry of block " +
+                                    std::to_string(i) +
+                                    " of the interpolation operator";
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+
+        if (block.radar_length <= 0 || block.radar_width <= 0)
+            continue;
+
+        const std::size_t start = std::size_t(block.y0) * width;
+        const std::size_t end = start + std::size_t(block.length) * width;
+        block.radar_y.assign(radar_y.begin() + start, radar_y.begin() + end);
+        block.radar_x.assign(radar_x.begin() + start, radar_x.begin() + end);
+    }
+}
+
+}} // namespace isce3::geocode
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <isce3/io/forward.h>
+
+namespace isce3 { namespace geocode {
+
+template<class T>
+class Geocode;
+
+/**
+ * Radar-to-geo operator of the geocoding with interpolation.
+ *
+ * The operator holds the radar-grid position (after geo2rdr and the
+ * azimuth-time and slant-range corrections) of the center of each geogrid
+ * pixel. It is filled by Geocode::geocodeInterp() and can then be applied
+ * by Geocode::applyInterpOperator() to any raster sharing the same radar
+ * grid, so that only the data interpolation is performed.
+ *
+ * The positions are kept per block of geogrid lines, relative to the radar
+ * window read for the block. They are stored in double precision so that
+ * the applied operator reproduces the positions, and therefore the window
+ * checks and the flattening and Doppler phases, of geocodeInterp() exactly.
+ * Pixels that fall outside the window (minus the interpolation margin) are
+ * set to NaN.
+ */
+class InterpOperator {
+public:
+    /** Radar positions of the pixels of a block of geogrid lines */
+    struct Block {
+        /** First line of the block in the geogrid */
+        int y0 = 0;
+        /** Number of lines of the block */
+        int length = 0;
+
+        /** First line of the radar window in the radar grid */
+        int radar_y0 = 0;
+        /** First column of the radar window in the radar grid */
+        int radar_x0 = 0;
+        /** Number of lines of the radar window, 0 if no pixel is valid */
+        int radar_length = 0;
+        /** Number of columns of the radar window, 0 if no pixel is valid */
+        int radar_width = 0;
+
+        /** Radar line of each pixel relative to radar_y0, length * width
+         * elements, or empty if no pixel is valid */
+        std::vector<double> radar_y;
+        /** Radar column of each pixel relative to radar_x0, length * width
+         * elements, or empty if no pixel is valid */
+        std::vector<double> radar_x;
+    };
+
+    /** Whether the operator has been filled */
+    bool empty() const { return _blocks.empty(); }
+
+    /** Number of valid pixels */
+    std::size_t numValidPixels() const;
+
+    /** Memory held by the radar positions (bytes) */
+    std::size_t memorySize() const;
+
+    /** Free the radar positions */
+    void clear() { _blocks.clear(); }
+
+    /** Number of blocks of geogrid lines */
+    std::size_t numBlocks() const { return _blocks.size(); }
+
+    /** Radar positions of a block of geogrid lines */
+    const Block& block(std::size_t i) const { return _blocks[i]; }
+
+    /** Geogrid length (lines) */
+    int geogridLength() const { return _geogrid_length; }
+
+    /** Geogrid width (columns) */
+    int geogridWidth() const { return _geogrid_width; }
+
+    /** Radar grid length (lines) */
+    int radarGridLength() const { return _radar_grid_length; }
+
+    /** Radar grid width (columns) */
+    int radarGridWidth() const { return _radar_grid_width; }
+
+    /** Save the operator to an HDF5 group */
+    void saveToH5(isce3::io::IGroup& group) const;
+
+    /** Load the operator from an HDF5 group written by saveToH5() */
+    void loadFromH5(isce3::io::IGroup& group);
+
+private:
+    template<class T>
+    friend class Geocode;
+
+    std::vector<Block> _blocks;
+
+    // output geogrid
+    double _geogrid_start_x = 0;
+    double _geogrid_start_y = 0;
+    double _geogrid_spacing_x = 0;
+    double _geogrid_spacing_y = 0;
+    int _geogrid_length = 0;
+    int _geogrid_width = 0;
+    int _epsg = 0;
+
+    // radar grid of the operator
+    int _radar_grid_length = 0;
+    int _radar_grid_width = 0;
+};
+
+}} // namespace isce3::geocode
@@ -2,6 +2,9 @@
 
 #include <isce3/core/LUT2d.h>
 #include <isce3/core/Matrix.h>
+#include <isce3/math/Phasor.h>
+
+#include <vector>
 
 void isce3::geocode::baseband(isce3::core::Matrix<std::complex<float>>& data,
                              const double starting_range,
@@ -12,16 +15,23 @@ void isce3::geocode::baseband(isce3::core::Matrix<std::complex<float>>& data,
 
     size_t length = data.length();
     size_t width = data.width();
-#pragma omp parallel for
-    for (size_t kk = 0; kk < length * width; ++kk) {
+    // Slant range is the same for all lines
+    std::vector<double> slant_range(width);
+    for (size_t col = 0; col < width; ++col)
+        slant_range[col] = starting_range + col * range_pixel_spacing;
 
-        size_t line = kk / width;
-        size_t col = kk % width;
-        const double azimuth_time = sensing_start + line / prf;
-        const double slant_range = starting_range + col * range_pixel_spacing;
-        const double phase = doppler_lut.eval(azimuth_time, slant_range) * 2 *
-                             M_PI * azimuth_time;
-        const std::complex<float> cpx_phase(std::cos(phase), -std::sin(phase));
-        data(line, col) *= cpx_phase;
+#pragma omp parallel
+    {
+        std::vector<double> doppler(width);
+#pragma omp for
+        for (size_t line = 0; line < length; ++line) {
+            const double azimuth_time = sensing_start + line / prf;
+            doppler_lut.eval(azimuth_time, slant_range.data(), doppler.data(),
+                             width);
+            // remove the doppler phase, doppler * 2 pi * azimuth_time
+            for (size_t col = 0; col < width; ++col)
+                doppler[col] *= -2 * M_PI * azimuth_time;
+            isce3::math::rotate(&data(line, 0), doppler.data(), width);
+        }
     }
 }
@@ -2,20 +2,31 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
+#include <utility>
+#include <vector>
 
+#include <isce3/core/BufferPool.h>
+#include <isce3/core/blockProcessing.h>
 #include <isce3/core/Constants.h>
 #include <isce3/core/Ellipsoid.h>
+#include <isce3/core/Instrumentation.h>
 #include <isce3/core/LUT2d.h>
+#include <isce3/core/Numa.h>
 #include <isce3/core/Orbit.h>
 #include <isce3/core/Poly2d.h>
 #include <isce3/core/Projections.h>
 #include <isce3/geocode/baseband.h>
 #include <isce3/geometry/DEMInterpolator.h>
+#include <isce3/geometry/boundingbox.h>
 #include <isce3/geometry/loadDem.h>
 #include <isce3/geometry/geometry.h>
 #include <isce3/io/Raster.h>
+#include <isce3/math/Phasor.h>
 #include <isce3/product/GeoGridParameters.h>
 #include <isce3/product/RadarGridProduct.h>
 #include <isce3/product/RadarGridParameters.h>
@@ -23,6 +34,7 @@
 
 namespace isce3::geocode {
 
+using isce3::core::PooledArray2D;
 
 /**
  * Compute radar grid indices for a given geo grid and determine corresponding mask value.
@@ -53,9 +65,9 @@ namespace isce3::geocode {
  * \return  tuple consisting of first azimuth line, last azimuth line, first range pixel, and last range pixel
  */
 std::tuple<int, int, int, int> computeGeogridRadarIndicesAndMask(
-        isce3::core::Matrix<double>& rangeIndices,
-        isce3::core::Matrix<double>& azimuthIndices,
-        isce3::core::Matrix<double>& uncorrectedSRange,
+        Eigen::Ref<isce3::core::EArray2D<double>> rangeIndices,
+        Eigen::Ref<isce3::core::EArray2D<double>> azimuthIndices,
+        Eigen::Ref<isce3::core::EArray2D<double>> uncorrectedSRange,
         std::optional<isce3::geocode::EArray2duc8> mask,
         const isce3::geometry::DEMInterpolator& demInterp,
         const isce3::product::GeoGridParameters& geoGrid,
@@ -76,6 +88,10 @@ std::tuple<int, int, int, int> computeGeogridRadarIndicesAndMask(
         const size_t lineStart = 0,
         const isce3::product::SubSwaths* subswaths = nullptr)
 {
+    isce3::core::instrumentation::ScopedTimer timer("geocode_slc.geo2rdr");
+    isce3::core::instrumentation::count("geocode_slc.pixels",
+            geoBlockLength * geoBlockWidth);
+
     // Init first and last line of the data block in radar coordinates
     int azimuthFirstLine = radarGrid.length() - 1;
     int azimuthLastLine = 0;
@@ -92,26 +108,32 @@ std::tuple<int, int, int, int> computeGeogridRadarIndicesAndMask(
         // Global line index
         const size_t line = lineStart + blockLine;
 
-        for (size_t pixel = 0; pixel < geoBlockWidth; ++pixel) {
-            // y coordinate in the out put grid
-            // Assuming geoGrid.startY() and geoGrid.startX() represent the top-left
-            // corner of the first pixel, then 0.5 pixel shift is needed to get
-            // to the center of each pixel
-            double y = geoGrid.startY() + geoGrid.spacingY() * (line + 0.5);
-
-            // x in the output geocoded Grid
-            double x = geoGrid.startX() + geoGrid.spacingX() * (pixel + 0.5);
+        // y coordinate in the out put grid
+        // Assuming geoGrid.startY() and geoGrid.startX() represent the top-left
+        // corner of the first pixel, then 0.5 pixel shift is needed to get
+        // to the center of each pixel
+        const double y = geoGrid.startY() + geoGrid.spacingY() * (line + 0.5);
+
+        // transform the x coordinates of the whole line in the output
+        // projection system to lon/lat at once
+        std::vector<double> xRow(geoBlockWidth), lonRow(geoBlockWidth),
+                latRow(geoBlockWidth);
+        for (size_t pixel = 0; pixel < geoBlockWidth; ++pixel)
+            xRow[pixel] = geoGrid.startX() + geoGrid.spacingX() * (pixel + 0.5);
+        if (proj->inverse_row(geoBlockWidth, xRow.data(), y, lonRow.data(),
+                              latRow.data()) != 0) {
+            throw isce3::except::RuntimeError(ISCE_SRCINFO(),
+                    "Inverse projection transformation failed");
+        }
 
+        for (size_t pixel = 0; pixel < geoBlockWidth; ++pixel) {
             // compute the azimuth time and slant range for the
             // x,y coordinates in the output grid
             double aztime, srange;
             aztime = radarGrid.sensingMid();
 
-            // coordinate in the output projection system
-            const isce3::core::Vec3 xyz {x, y, 0.0};
-
-            // transform the xyz in the output projection system to llh
-            isce3::core::Vec3 llh = proj->inverse(xyz);
+            // llh of the x,y coordinates in the output grid
+            isce3::core::Vec3 llh {lonRow[pixel], latRow[pixel], 0.0};
 
             // interpolate the height from the DEM for this pixel
             llh[2] = demInterp.interpolateLonLat(llh[0], llh[1]);
@@ -244,48 +266,61 @@ void carrierPhaseDeramp(
         const size_t azimuthFirstLine, const size_t rangeFirstPixel,
         const isce3::product::RadarGridParameters& radarGrid)
 {
+    isce3::core::instrumentation::ScopedTimer timer("geocode_slc.deramp");
+
     const size_t rdrBlockLength = rdrDataBlock.rows();
     const size_t rdrBlockWidth = rdrDataBlock.cols();
 
-    // remove carrier from radar data
-#pragma omp parallel for
-    for (size_t ii = 0; ii < rdrBlockLength * rdrBlockWidth; ++ii) {
-        auto i = ii / rdrBlockWidth;
-        auto j = ii % rdrBlockWidth;
+    // remove carrier from radar data, one line at a time so that the
+    // phasors of the whole line are computed at once
+#pragma omp parallel
+    {
+    std::vector<double> phase(rdrBlockWidth);
 
+#pragma omp for
+    for (size_t i = 0; i < rdrBlockLength; ++i) {
         // Offset for block starting line
         const auto i_az = i + azimuthFirstLine;
         const double az = radarGrid.sensingStart() + i_az / radarGrid.prf();
 
-        // Offset for block starting pixel
-        const auto j_rg = j + rangeFirstPixel;
-        const double rg = radarGrid.startingRange() +
-                j_rg * radarGrid.rangePixelSpacing();
+        for (size_t j = 0; j < rdrBlockWidth; ++j) {
+            // Offset for block starting pixel
+            const auto j_rg = j + rangeFirstPixel;
+            const double rg = radarGrid.startingRange() +
+                    j_rg * radarGrid.rangePixelSpacing();
 
-        // Evaluate the pixel's carrier phase
-        const float carrierPhase = rgCarrierPhase.eval(az, rg)
-                + azCarrierPhase.eval(az, rg);
+            // Evaluate the pixel's carrier phase, to be removed
+            const float carrierPhase = rgCarrierPhase.eval(az, rg)
+                    + azCarrierPhase.eval(az, rg);
+            phase[j] = -carrierPhase;
+        }
 
         // Remove carrier at current radar grid indices
-        const std::complex<float> cpxVal(std::cos(carrierPhase),
-                                         -std::sin(carrierPhase));
-        rdrDataBlock(i, j) *= cpxVal;
+        isce3::math::rotate(&rdrDataBlock(i, 0), phase.data(), rdrBlockWidth);
     }
+    } // end omp parallel
 }
 
 
 /**
- * Add back range and azimuth phase carrier and simultaneously flatten the block of geocoded SLC
+ * Interpolate a block of deramped radar data to the geo grid, then add back
+ * the range and azimuth phase carrier and flatten the geocoded SLC.
+ *
+ * The interpolation and the phase corrections of each output pixel are done
+ * in a single pass over the geo grid so that the radar indices, slant range
+ * and azimuth time of the pixel are only looked up once.
  *
- * @param[out] geoDataBlock     geocoded SLC data whose phase will be added by carrier phase and flatten by geometrical phase
+ * @param[in] rdrDataBlock      block of deramped SLC data in radar coordinates
+ * @param[out] geoDataBlock     block of geocoded SLC data. Pixels without a
+ *                              valid interpolation chip are left unchanged
  * @param[out] carrierPhaseBlock     geocoded carrier phase data that could have been added to SLC data
  * @param[out] flattenPhaseBlock     geocoded flattening phase data that could have been flatten to SLC data
- * @param[in] rdrDataBlock      radar grid SLC data
  * @tparam[in] azCarrierPhase   azimuth carrier phase of the SLC data, in radian, as a function of azimuth and range
  * @tparam[in] rgCarrierPhase   range carrier phase of the SLC data, in radian, as a function of azimuth and range
  * @param[in] nativeDopplerLUT  native doppler of SLC image
  * @param[in] rangeIndices      range (radar-coordinates x) index of the pixels in geo-grid
  * @param[in] azimuthIndices    azimuth (radar-coordinates y) index of the pixels in geo-grid
+ * @param[in] sincInterp        sinc interpolator object
  * @param[in] radarGrid         radar grid parameters
  * @param[in] flatten           flag to flatten the geocoded SLC
  * @param[in] reramp            flag to reramp the geocoded SLC
@@ -296,218 +331,169 @@ void carrierPhaseDeramp(
  *                              by geo-grid indices
  */
 template <typename AzRgFunc>
-void carrierPhaseRerampAndFlatten(
+void interpolateRerampAndFlatten(
+        const EArray2dc64 rdrDataBlock,
         EArray2dc64 geoDataBlock,
         EArray2df64 carrierPhaseBlock,
         EArray2df64 flattenPhaseBlock,
-        const EArray2dc64 rdrDataBlock,
         const AzRgFunc& azCarrierPhase, const AzRgFunc& rgCarrierPhase,
         const isce3::core::LUT2d<double>& nativeDopplerLUT,
-        isce3::core::Matrix<double>& rangeIndices,
-        isce3::core::Matrix<double>& azimuthIndices,
+        const Eigen::Ref<const isce3::core::EArray2D<double>>& rangeIndices,
+        const Eigen::Ref<const isce3::core::EArray2D<double>>& azimuthIndices,
+        const isce3::core::Interpolator<std::complex<float>>* sincInterp,
         const isce3::product::RadarGridParameters& radarGrid,
         const bool flatten, const bool reramp,
         const size_t azimuthFirstLine, const size_t rangeFirstPixel,
         const bool flattenWithCorrectedSRng,
-        isce3::core::Matrix<double>& uncorrectedSRngs)
+        const Eigen::Ref<const isce3::core::EArray2D<double>>& uncorrectedSRngs)
 {
-    const size_t outWidth = geoDataBlock.cols();
-    const size_t outLength = geoDataBlock.rows();
-    const int inWidth = rdrDataBlock.cols();
-    const int inLength = rdrDataBlock.rows();
-    const int chipHalf = isce3::core::SINC_ONE / 2;
+    isce3::core::instrumentation::ScopedTimer timer("geocode_slc.interpolate");
 
-#pragma omp parallel for
-    for (size_t ii = 0; ii < outLength * outWidth; ++ii) {
-        auto i = ii / outWidth;
-        auto j = ii % outWidth;
-
-        // Cache range and azimuth index for later use
-        const auto unadjustedRgIndex = rangeIndices(i, j);
-        const auto unadjustedAzIndex = azimuthIndices(i, j);
-
-        // Skip further processing if range and azimuth indices are Nan i.e.
-        // invalid
-        if (std::isnan(unadjustedRgIndex) or std::isnan(unadjustedAzIndex))
-            continue;
-
-        // Get double and int rg/az coordinates (accounting for block offsets)
-        const double RgIndex = unadjustedRgIndex - rangeFirstPixel;
-        const double AzIndex = unadjustedAzIndex - azimuthFirstLine;
-
-        // Truncate rg/az indices to int
-        const int intRgIndex = static_cast<int>(RgIndex);
-        const int intAzIndex = static_cast<int>(AzIndex);
-
-        // Check if chip indices could be outside radar grid (plus interp chip)
-        // i.e. Check if current pixel was interpolated
-        // Skip if chip indices outside int value of radar grid
-        if ((intRgIndex < chipHalf) || (intRgIndex >= (inWidth - chipHalf)))
-            continue;
-        if ((intAzIndex < chipHalf) || (intAzIndex >= (inLength - chipHalf)))
-            continue;
-
-        // Slant Range at the current output pixel
-        const double rng = radarGrid.startingRange() +
-                unadjustedRgIndex * radarGrid.rangePixelSpacing();
-
-        // Azimuth time at the current output pixel
-        const double az = radarGrid.sensingStart() +
-                          unadjustedAzIndex / radarGrid.prf();
-
-        // Skip pixel if doppler could not be evaluated
-        if (not nativeDopplerLUT.contains(az, rng))
-            continue;
-
-        // Evaluate range and azimuth carriers
-        const double carrierPhase =
-            rgCarrierPhase.eval(az, rng) + azCarrierPhase.eval(az, rng);
-
-        // Compute flatten phase based on corrected or uncorrected slant range
-        const double sRngFlatten = flattenWithCorrectedSRng ?
-            rng : uncorrectedSRngs(i, j);
-        const double flattenPhase =
-            4.0 * (M_PI / radarGrid.wavelength()) * sRngFlatten;
-
-        // Add all the phases together as needed
-        double totalPhase = 0.0;
-        if (reramp)
-            totalPhase += carrierPhase;
-        if (flatten)
-            totalPhase += flattenPhase;
-
-        // assign values to carrier and flattening phase arrays if shape
-        // matches geoDataBlock shape
-        if (carrierPhaseBlock.rows() == geoDataBlock.rows() and
-                carrierPhaseBlock.cols() == geoDataBlock.cols())
-            carrierPhaseBlock(i, j) = carrierPhase;
-
-        if (flattenPhaseBlock.rows() == geoDataBlock.rows() and
-                flattenPhaseBlock.cols() == geoDataBlock.cols())
-            flattenPhaseBlock(i, j) = flattenPhase;
-
-        // Update geoDataBlock column and row from index
-        const std::complex<float> cpxVal(std::cos(totalPhase),
-                                         std::sin(totalPhase));
-        geoDataBlock(i, j) *= cpxVal;
-    }
-}
-
-
-/** Interpolate radar data block to geo data block
- *
- * @param[in] rdrDataBlock      block of SLC data in radar coordinates basebanded in range direction
- * @param[out] geoDataBlock     block of data in geo coordinates
- * @param[in] rangeIndices      range (radar-coordinates x) index of the pixels in geo-grid
- * @param[in] azimuthIndices    azimuth (radar-coordinates y) index of the pixels in geo-grid
- * @param[in] azimuthFirstLine  line index of the first sample of the block
- * @param[in] rangeFirstPixel   pixel index of the first sample of the block
- * @param[in] sincInterp        sinc interpolator object
- * @param[in] radarGrid         RadarGridParameters of radar data
- * @param[in] nativeDopplerLUT  native doppler of SLC image
- */
-void interpolate(
-        const Eigen::Ref<isce3::core::EArray2D<std::complex<float>>> rdrDataBlock,
-        Eigen::Ref<isce3::core::EArray2D<std::complex<float>>> geoDataBlock,
-        isce3::core::Matrix<double>& rangeIndices,
-        isce3::core::Matrix<double>& azimuthIndices,
-        const int azimuthFirstLine, const int rangeFirstPixel,
-        const isce3::core::Interpolator<std::complex<float>>* sincInterp,
-        const isce3::product::RadarGridParameters& radarGrid,
-        const isce3::core::LUT2d<double>& nativeDopplerLUT)
-{
     const int chipSize = isce3::core::SINC_ONE;
-    const int outWidth = geoDataBlock.cols();
-    const int outLength = geoDataBlock.rows();
+    const size_t outWidth = geoDataBlock.cols();
+    const size_t outLength = geoDataBlock.rows();
     const int inWidth = rdrDataBlock.cols();
     const int inLength = rdrDataBlock.rows();
     const int chipHalf = isce3::core::SINC_HALF;
 
-#pragma omp parallel for
-    for (size_t ii = 0; ii < outLength * outWidth; ++ii) {
-        auto i = ii / outWidth;
-        auto j = ii % outWidth;
+    // Only save the phases if their arrays match the output block
+    const bool saveCarrierPhase =
+            carrierPhaseBlock.rows() == geoDataBlock.rows() and
+            carrierPhaseBlock.cols() == geoDataBlock.cols();
+    const bool saveFlattenPhase =
+            flattenPhaseBlock.rows() == geoDataBlock.rows() and
+            flattenPhaseBlock.cols() == geoDataBlock.cols();
+
+#pragma omp parallel
+    {
+    // Interpolation chip reused by all the pixels of a thread
+    isce3::core::Matrix<std::complex<float>> chip(chipSize, chipSize);
+
+    // Doppler phasors of the rows of the chip
+    std::vector<std::complex<float>> doppVals(chipSize);
+
+    // Interpolated values of the valid pixels of a line and the phase to add
+    // back to each of them, rotated all at once at the end of the line
+    std::vector<size_t> validCols(outWidth);
+    std::vector<std::complex<float>> values(outWidth);
+    std::vector<double> phases(outWidth);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < outLength; ++i) {
+        size_t nValid = 0;
+        for (size_t j = 0; j < outWidth; ++j) {
+            // Cache range and azimuth index for later use
+            const auto unadjustedRgIndex = rangeIndices(i, j);
+            const auto unadjustedAzIndex = azimuthIndices(i, j);
+
+            // Skip further processing if range and azimuth indices are Nan i.e.
+            // invalid
+            if (std::isnan(unadjustedRgIndex) or std::isnan(unadjustedAzIndex))
+                continue;
 
-        // Cache range and azimuth index for later use
-        const auto unadjustedRgIndex = rangeIndices(i, j);
-        const auto unadjustedAzIndex = azimuthIndices(i, j);
+            // adjust the row and column indicies for the current block,
+            // i.e., moving the origin to the top-left of this radar block.
+            const double RgIndex = unadjustedRgIndex - rangeFirstPixel;
+            const double AzIndex = unadjustedAzIndex - azimuthFirstLine;
 
-        // Skip further processing if range and azimuth indices are Nan i.e.
-        // invalid
-        if (isnan(unadjustedRgIndex) or isnan(unadjustedAzIndex))
-            continue;
+            // Truncate rg/az coordinates to int
+            const int intRgIndex = static_cast<int>(RgIndex);
+            const int intAzIndex = static_cast<int>(AzIndex);
 
-        // adjust the row and column indicies for the current block,
-        // i.e., moving the origin to the top-left of this radar block.
-        double RgIndex = unadjustedRgIndex - rangeFirstPixel;
-        double AzIndex = unadjustedAzIndex - azimuthFirstLine;
+            // Save the fractional parts of rg/az coordinates
+            const double fracRgIndex = RgIndex - intRgIndex;
+            const double fracAzIndex = AzIndex - intAzIndex;
 
-        // Truncate rg/az coordinates to int
-        const int intRgIndex = static_cast<int>(RgIndex);
-        const int intAzIndex = static_cast<int>(AzIndex);
-
-        // Save the fractional parts of rg/az coordinates
-        const double fracRgIndex = RgIndex - intRgIndex;
-        const double fracAzIndex = AzIndex - intAzIndex;
+            // Check if chip indices could be outside radar grid
+            // Skip if chip indices out of bounds
+            if ((intRgIndex < chipHalf) || (intRgIndex >= (inWidth - chipHalf)))
+                continue;
+            if ((intAzIndex < chipHalf) || (intAzIndex >= (inLength - chipHalf)))
+                continue;
 
-        // Check if chip indices could be outside radar grid
-        // Skip if chip indices out of bounds
-        if ((intRgIndex < chipHalf) || (intRgIndex >= (inWidth - chipHalf)))
-            continue;
-        if ((intAzIndex < chipHalf) || (intAzIndex >= (inLength - chipHalf)))
-            continue;
+            // Slant Range at the current output pixel
+            const double rng =
+                    radarGrid.startingRange() +
+                    unadjustedRgIndex * radarGrid.rangePixelSpacing();
 
-        // Slant Range at the current output pixel
-        const double rng =
-                radarGrid.startingRange() +
-                unadjustedRgIndex * radarGrid.rangePixelSpacing();
+            // Azimuth time at the current output pixel
+            const double az = radarGrid.sensingStart() +
+                              unadjustedAzIndex / radarGrid.prf();
 
-        // Azimuth time at the current output pixel
-        const double az = radarGrid.sensingStart() +
-                          unadjustedAzIndex / radarGrid.prf();
+            if (not nativeDopplerLUT.contains(az, rng))
+                continue;
 
-        if (not nativeDopplerLUT.contains(az, rng))
-            continue;
+            // Evaluate doppler at current range and azimuth time
+            const double doppFreq =
+                    nativeDopplerLUT.eval(az, rng) * 2 * M_PI / radarGrid.prf();
 
-        // Evaluate doppler at current range and azimuth time
-        const double doppFreq =
-                nativeDopplerLUT.eval(az, rng) * 2 * M_PI / radarGrid.prf();
+            // Doppler phase of each chip row, -doppFreq * (ii - chipHalf), which
+            // is linear in the row
+            isce3::math::linearPhasors(doppFreq * chipHalf, -doppFreq,
+                    doppVals.data(), chipSize);
 
-        isce3::core::Matrix<std::complex<float>> chip(chipSize, chipSize);
-        // Read data chip
-        for (int ii = 0; ii < chipSize; ++ii) {
-            // Row to read from
-            const int chipRow = intAzIndex + ii - chipHalf;
+            // Read data chip
+            for (int ii = 0; ii < chipSize; ++ii) {
+                // Row to read from
+                const int chipRow = intAzIndex + ii - chipHalf;
 
-            // Compute doppler frequency at current row
-            const double doppPhase = doppFreq * (ii - chipHalf);
-            const std::complex<float> doppVal(std::cos(doppPhase),
-                                              -std::sin(doppPhase));
+                // Doppler phasor at current row
+                const std::complex<float> doppVal = doppVals[ii];
 
-            for (int jj = 0; jj < chipSize; ++jj) {
-                // Column to read from
-                const int chipCol = intRgIndex + jj - chipHalf;
+                for (int jj = 0; jj < chipSize; ++jj) {
+                    // Column to read from
+                    const int chipCol = intRgIndex + jj - chipHalf;
 
-                // Set the data values after doppler demodulation
-                chip(ii, jj) = rdrDataBlock(chipRow, chipCol) * doppVal;
+                    // Set the data values after doppler demodulation
+                    chip(ii, jj) = rdrDataBlock(chipRow, chipCol) * doppVal;
+                }
             }
-        }
 
-        // Interpolate chip
-        const std::complex<float> cval =
-                sincInterp->interpolate(chipHalf + fracRgIndex,
-                        chipHalf + fracAzIndex, chip);
-
-        // Compute doppler that was demodulated from chip in interpolation to
-        // be added back
-        const auto azLocation = fracAzIndex;
-        const auto doppFreqToAddBack = doppFreq * azLocation;
-        const std::complex<float> doppValAddBack(std::cos(doppFreqToAddBack),
-                std::sin(doppFreqToAddBack));
+            // Interpolate chip
+            const std::complex<float> cval =
+                    sincInterp->interpolate(chipHalf + fracRgIndex,
+                            chipHalf + fracAzIndex, chip);
+
+            // Compute doppler that was demodulated from chip in interpolation to
+            // be added back
+            const auto azLocation = fracAzIndex;
+            const auto doppFreqToAddBack = doppFreq * azLocation;
+
+            // Evaluate range and azimuth carriers
+            const double carrierPhase =
+                rgCarrierPhase.eval(az, rng) + azCarrierPhase.eval(az, rng);
+
+            // Compute flatten phase based on corrected or uncorrected slant range
+            const double sRngFlatten = flattenWithCorrectedSRng ?
+                rng : uncorrectedSRngs(i, j);
+            const double flattenPhase =
+                4.0 * (M_PI / radarGrid.wavelength()) * sRngFlatten;
+
+            // Add all the phases together as needed
+            double totalPhase = doppFreqToAddBack;
+            if (reramp)
+                totalPhase += carrierPhase;
+            if (flatten)
+                totalPhase += flattenPhase;
+
+            if (saveCarrierPhase)
+                carrierPhaseBlock(i, j) = carrierPhase;
+            if (saveFlattenPhase)
+                flattenPhaseBlock(i, j) = flattenPhase;
+
+            validCols[nValid] = j;
+            values[nValid] = cval;
+            phases[nValid] = totalPhase;
+            ++nValid;
+        }
 
-        // Set geoDataBlock column and row from index with doppler added back
-        geoDataBlock(i, j) = cval * doppValAddBack;
+        // Add back the doppler, carrier and flattening phases of the valid
+        // pixels of the line and save them to geoDataBlock
+        isce3::math::rotate(values.data(), phases.data(), nValid);
+        for (size_t k = 0; k < nValid; ++k)
+            geoDataBlock(i, validCols[k]) = values[k];
     }
+    } // end omp parallel
 }
 
 
@@ -602,6 +588,89 @@ array_sizes_consistent(const std::vector<EArray2dc64>& arrays) {
 }
 
 
+/**
+ * DEM shared by consecutive blocks of the geocoded grid.
+ *
+ * The DEM is loaded once per tile of blocksPerTile blocks, when the first
+ * block of the tile is acquired, and is freed when every block of the tile has
+ * been released. This way blocks processed concurrently share a single DEM
+ * read instead of each loading an overlapping region.
+ */
+class DEMTileCache {
+public:
+    /**
+     * @param[in] demRaster     DEM raster
+     * @param[in] geoGrid       geocoded grid
+     * @param[in] linesPerBlock number of lines of each block of the geocoded grid
+     * @param[in] blocksPerTile number of consecutive blocks sharing a DEM
+     */
+    DEMTileCache(isce3::io::Raster& demRaster,
+            const isce3::product::GeoGridParameters& geoGrid,
+            size_t linesPerBlock, size_t blocksPerTile) :
+        _demRaster(demRaster), _geoGrid(geoGrid),
+        _linesPerBlock(linesPerBlock), _blocksPerTile(blocksPerTile),
+        _nBlocks((geoGrid.length() + linesPerBlock - 1) / linesPerBlock)
+    {}
+
+    /** Get the DEM covering a block, loading it if needed */
+    std::shared_ptr<const isce3::geometry::DEMInterpolator>
+    acquire(size_t block)
+    {
+        const size_t tileIndex = block / _blocksPerTile;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _tiles.find(tileIndex);
+        if (it != _tiles.end()) {
+            return it->second.dem;
+        }
+
+        const size_t firstBlock = tileIndex * _blocksPerTile;
+        const size_t nTileBlocks = std::min(_blocksPerTile,
+                                            _nBlocks - firstBlock);
+        const size_t lineStart = firstBlock * _linesPerBlock;
+        const size_t tileLength = std::min(nTileBlocks * _linesPerBlock,
+                static_cast<size_t>(_geoGrid.length()) - lineStart);
+
+        isce3::core::instrumentation::ScopedTimer demTimer(
+                "geocode_slc.load_dem");
+        std::shared_ptr<const isce3::geometry::DEMInterpolator> dem;
+#pragma omp critical
+        {
+            dem = std::make_shared<const isce3::geometry::DEMInterpolator>(
+                    isce3::geometry::DEMRasterToInterpolator(_demRaster,
+                            _geoGrid, lineStart, tileLength,
+                            _geoGrid.width()));
+        }
+        _tiles[tileIndex] = Tile {dem, nTileBlocks};
+        return dem;
+    }
+
+    /** Signal that a block no longer needs its DEM */
+    void release(size_t block)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _tiles.find(block / _blocksPerTile);
+        if (it != _tiles.end() && --it->second.remainingBlocks == 0) {
+            _tiles.erase(it);
+        }
+    }
+
+private:
+    struct Tile {
+        std::shared_ptr<const isce3::geometry::DEMInterpolator> dem;
+        size_t remainingBlocks;
+    };
+
+    isce3::io::Raster& _demRaster;
+    const isce3::product::GeoGridParameters& _geoGrid;
+    size_t _linesPerBlock;
+    size_t _blocksPerTile;
+    size_t _nBlocks;
+    std::mutex _mutex;
+    std::map<size_t, Tile> _tiles;
+};
+
+
 template<typename AzRgFunc>
 void geocodeSlc(
         isce3::io::Raster& outputRaster, isce3::io::Raster& inputRaster,
@@ -642,10 +711,20 @@ void geocodeSlc(
     // Compute number of blocks in the output geocoded grid
     size_t nBlocks = (geoGrid.length() + linesPerBlock - 1) / linesPerBlock;
 
-    debug << "nBlocks: " << nBlocks << pyre::journal::endl;
-    // loop over the blocks of the geocoded Grid
-    for (size_t block = 0; block < nBlocks; ++block) {
-        debug << "block: " << block << pyre::journal::endl;
+    // Independent geogrid blocks are processed concurrently, one block per
+    // thread. The DEM is loaded once per tile of consecutive blocks, with as
+    // many blocks per tile as fit the maximum block size. The tiles (and so
+    // the output) do not depend on the number of threads.
+    const size_t blockSize = linesPerBlock * geoGrid.width() * sizeof(float);
+    const size_t blocksPerTile = std::clamp<size_t>(
+            isce3::core::DEFAULT_MAX_BLOCK_SIZE / std::max(blockSize, size_t(1)),
+            1, std::max(nBlocks, size_t(1)));
+    DEMTileCache demCache(demRaster, geoGrid, linesPerBlock, blocksPerTile);
+
+    debug << "nBlocks: " << nBlocks << pyre::journal::newline
+          << "blocks per DEM tile: " << blocksPerTile << pyre::journal::endl;
+
+    auto processBlock = [&](const size_t block) {
         // Get block extents (of the geocoded grid)
         size_t lineStart, geoBlockLength;
         lineStart = block * linesPerBlock;
@@ -655,35 +734,32 @@ void geocodeSlc(
             geoBlockLength = linesPerBlock;
         }
 
-        // get a DEM interpolator for a block of DEM for the current geocoded
-        // grid
-        isce3::geometry::DEMInterpolator demInterp =
-            isce3::geometry::DEMRasterToInterpolator(demRaster, geoGrid,
-                    lineStart, geoBlockLength, geoGrid.width());
+        // get the DEM interpolator covering the current geocoded block
+        auto demInterp = demCache.acquire(block);
 
         // X and Y indices (in the radar coordinates) for the geocoded pixels
         // (after geo2rdr computation) - initialized to invalid values
-        isce3::core::Matrix<double> rangeIndices(geoBlockLength, geoGrid.width());
+        // The block buffers are borrowed from the buffer pool, so that they
+        // are reused by the following blocks instead of being reallocated.
+        PooledArray2D<double> rangeIndices(geoBlockLength, geoGrid.width());
         rangeIndices.fill(std::numeric_limits<double>::quiet_NaN());
 
-        isce3::core::Matrix<double> azimuthIndices(geoBlockLength, geoGrid.width());
+        PooledArray2D<double> azimuthIndices(geoBlockLength, geoGrid.width());
         azimuthIndices.fill(std::numeric_limits<double>::quiet_NaN());
 
         // Array containing masking labels applied to pixels. Inconsequentially
         // filled with dummy values as raster mode is not used in production.
-        auto maskArr2d = isce3::core::EArray2D<unsigned char>(geoBlockLength,
-                                                              geoGrid.width());
+        PooledArray2D<unsigned char> maskArr2d(geoBlockLength, geoGrid.width());
         maskArr2d.fill(0);
         auto maskArr2dRef = isce3::geocode::EArray2duc8(maskArr2d);
         auto maskArr2RefOpt = std::make_optional(maskArr2dRef);
 
         // selectively use uncorrected slant range - initialized to invalid
         // values
-        isce3::core::Matrix<double> uncorrectedSRange;
-        if (!flattenWithCorrectedSRng) {
-            uncorrectedSRange.resize(geoBlockLength, geoGrid.width());
-            uncorrectedSRange.fill(std::real(invalidValue));
-        }
+        PooledArray2D<double> uncorrectedSRange(
+                flattenWithCorrectedSRng ? 0 : geoBlockLength,
+                geoGrid.width());
+        uncorrectedSRange.fill(std::real(invalidValue));
 
         // Compute radar coordinates of each geocoded pixel
         // Determine boundary of corresponding radar raster
@@ -697,7 +773,7 @@ void geocodeSlc(
                 azimuthIndices,
                 uncorrectedSRange,
                 maskArr2RefOpt,
-                demInterp,
+                *demInterp,
                 geoGrid,
                 geoBlockLength,
                 geoGridWidth,
@@ -715,27 +791,27 @@ void geocodeSlc(
                 flattenWithCorrectedSRng,
                 lineStart);
 
+        // The DEM is not needed past geo2rdr
+        demInterp.reset();
+        demCache.release(block);
+
         // Fill the output block with the default value before checking validity
-        isce3::core::EArray2D<std::complex<float>> geoDataBlock(geoBlockLength,
-                                                                geoGrid.width());
+        PooledArray2D<std::complex<float>> geoDataBlock(geoBlockLength,
+                                                        geoGrid.width());
 
         // assume all values invalid by default
-        // interpolate and carrierPhaseRerampAndFlatten will only modify valid pixels
+        // interpolateRerampAndFlatten will only modify valid pixels
         geoDataBlock.fill(invalidValue);
 
         // init phase and range offset blocks, but only resize and fill if
         // their respective raster pointers are not nullptr
-        isce3::core::EArray2D<double> carrierPhaseBlock;
-        if (carrierPhaseRaster) {
-            carrierPhaseBlock.resize(geoBlockLength, geoGrid.width());
-            carrierPhaseBlock.fill(invalidValue.real());
-        }
+        PooledArray2D<double> carrierPhaseBlock(
+                carrierPhaseRaster ? geoBlockLength : 0, geoGrid.width());
+        carrierPhaseBlock.fill(invalidValue.real());
 
-        isce3::core::EArray2D<double> flattenPhaseBlock;
-        if (flattenPhaseRaster) {
-            flattenPhaseBlock.resize(geoBlockLength, geoGrid.width());
-            flattenPhaseBlock.fill(invalidValue.real());
-        }
+        PooledArray2D<double> flattenPhaseBlock(
+                flattenPhaseRaster ? geoBlockLength : 0, geoGrid.width());
+        flattenPhaseBlock.fill(invalidValue.real());
 
         // Extra margin for interpolation to avoid gaps between blocks in output
         int interp_margin = 5;
@@ -749,24 +825,42 @@ void geocodeSlc(
         rangeLastPixel = std::min(rangeLastPixel + interp_margin,
                                   static_cast<int>(radarGrid.width() - 1));
 
-        if (azimuthFirstLine > azimuthLastLine ||
-            rangeFirstPixel > rangeLastPixel) {
-            // No valid pixels in this block, so set to invalid and continue
-            for (size_t band = 0; band < nbands; ++band) {
+        // Write the geocoded block and, if requested, its phases
+        auto writeBlock = [&](size_t band) {
+            isce3::core::instrumentation::ScopedTimer writeTimer(
+                    "geocode_slc.write");
+#pragma omp critical
+            {
                 outputRaster.setBlock(geoDataBlock.data(), 0, lineStart,
-                                    geoGrid.width(), geoBlockLength, band + 1);
+                        geoGrid.width(), geoBlockLength, band + 1);
             }
-            // set output if phase and range offset rasters not nullptr
-            if (carrierPhaseRaster) {
-                carrierPhaseRaster->setBlock(carrierPhaseBlock.data(), 0, lineStart,
-                        geoGrid.width(), geoBlockLength, 1);
+            isce3::core::instrumentation::count("geocode_slc.bytes_written",
+                    geoDataBlock.size() * sizeof(std::complex<float>));
+        };
+        auto writePhases = [&]() {
+#pragma omp critical
+            {
+                // set output if phase and range offset rasters not nullptr
+                if (carrierPhaseRaster) {
+                    carrierPhaseRaster->setBlock(carrierPhaseBlock.data(), 0,
+                            lineStart, geoGrid.width(), geoBlockLength, 1);
+                }
+
+                if (flattenPhaseRaster) {
+                    flattenPhaseRaster->setBlock(flattenPhaseBlock.data(), 0,
+                            lineStart, geoGrid.width(), geoBlockLength, 1);
+                }
             }
+        };
 
-            if (flattenPhaseRaster) {
-                flattenPhaseRaster->setBlock(flattenPhaseBlock.data(), 0, lineStart,
-                        geoGrid.width(), geoBlockLength, 1);
+        if (azimuthFirstLine > azimuthLastLine ||
+            rangeFirstPixel > rangeLastPixel) {
+            // No valid pixels in this block, so set to invalid and continue
+            for (size_t band = 0; band < nbands; ++band) {
+                writeBlock(band);
             }
-            continue;
+            writePhases();
+            return;
         }
 
         // shape of the required block of data in the radar coordinates
@@ -774,8 +868,8 @@ void geocodeSlc(
         size_t rdrBlockWidth = rangeLastPixel - rangeFirstPixel + 1;
 
         // define the matrix based on the rasterbands data type
-        isce3::core::EArray2D<std::complex<float>> rdrDataBlock(rdrBlockLength,
-                                                                rdrBlockWidth);
+        PooledArray2D<std::complex<float>> rdrDataBlock(rdrBlockLength,
+                                                        rdrBlockWidth);
 
         // fill both radar data block with zero
         rdrDataBlock.fill(0);
@@ -783,58 +877,69 @@ void geocodeSlc(
         // for each band in the input:
         for (size_t band = 0; band < nbands; ++band) {
 
-            debug << "band: " << band << pyre::journal::newline;
             // get a block of data
-            debug << "get data block " << pyre::journal::endl;
-            inputRaster.getBlock(rdrDataBlock.data(), rangeFirstPixel,
-                                 azimuthFirstLine, rdrBlockWidth,
-                                 rdrBlockLength, band + 1);
+            isce3::core::instrumentation::ScopedTimer readTimer(
+                    "geocode_slc.read");
+#pragma omp critical
+            {
+                inputRaster.getBlock(rdrDataBlock.data(), rangeFirstPixel,
+                                     azimuthFirstLine, rdrBlockWidth,
+                                     rdrBlockLength, band + 1);
+            }
+            readTimer.stop();
+            isce3::core::instrumentation::count("geocode_slc.bytes_read",
+                    rdrDataBlock.size() * sizeof(std::complex<float>));
 
             // Remove doppler and carriers as needed
             carrierPhaseDeramp(rdrDataBlock, azCarrierPhase, rgCarrierPhase,
                    azimuthFirstLine, rangeFirstPixel, radarGrid);
 
-            // interpolate the data in radar grid to the geocoded grid.
-            interpolate(rdrDataBlock, geoDataBlock, rangeIndices, azimuthIndices,
-                    azimuthFirstLine, rangeFirstPixel, sincInterp.get(),
-                    radarGrid, nativeDoppler);
-
-            // Add back doppler and carriers as needed
-            carrierPhaseRerampAndFlatten(geoDataBlock, carrierPhaseBlock,
-                    flattenPhaseBlock, rdrDataBlock, azCarrierPhase,
+            // interpolate the data in radar grid to the geocoded grid and
+            // add back doppler and carriers as needed
+            interpolateRerampAndFlatten(rdrDataBlock, geoDataBlock,
+                    carrierPhaseBlock, flattenPhaseBlock, azCarrierPhase,
                     rgCarrierPhase, nativeDoppler, rangeIndices,
-                    azimuthIndices, radarGrid, flatten, reramp,
-                    azimuthFirstLine, rangeFirstPixel, flattenWithCorrectedSRng,
-                    uncorrectedSRange);
+                    azimuthIndices, sincInterp.get(), radarGrid, flatten,
+                    reramp, azimuthFirstLine, rangeFirstPixel,
+                    flattenWithCorrectedSRng, uncorrectedSRange);
 
             // set output
-            debug << "set output " << pyre::journal::endl;
-            outputRaster.setBlock(geoDataBlock.data(), 0, lineStart,
-                                  geoGrid.width(), geoBlockLength, band + 1);
-
-        }
-        // set output if phase and range offset rasters not nullptr
-        if (carrierPhaseRaster) {
-            carrierPhaseRaster->setBlock(carrierPhaseBlock.data(), 0,
-                    lineStart, geoGrid.width(), geoBlockLength, 1);
+            writeBlock(band);
         }
+        writePhases();
+    };
 
-        if (flattenPhaseRaster) {
-            flattenPhaseRaster->setBlock(flattenPhaseBlock.data(), 0,
-                    lineStart, geoGrid.width(), geoBlockLength, 1);
+    // Blocks run concurrently, following the thread placement. With a
+    // single block, the loops within the block run in parallel instead.
+    if (nBlocks > 1) {
+        isce3::core::forEachBlock(nBlocks, processBlock);
+    } else {
+        for (size_t block = 0; block < nBlocks; ++block) {
+            processBlock(block);
         }
-        // set output block of data
-    } // end loop over block of output grid
+    }
 }
 
 
+/**
+ * Geocode the SLC arrays of one radar grid to a range of lines of the geogrid,
+ * with the projection, interpolator and DEM set up by the caller.
+ *
+ * The geocoded arrays, phases and mask only cover the lines being geocoded.
+ * See the array overload of geocodeSlc for the other parameters.
+ *
+ * @param[in] lineStart         first line of the geogrid to geocode
+ * @param[in] geoBlockLength    number of lines of the geogrid to geocode
+ */
 template<typename AzRgFunc>
-void geocodeSlc(
+void geocodeSlcLines(
         std::vector<EArray2dc64>& geoDataBlocks,
         EArray2df64 carrierPhaseBlock,
         EArray2df64 flattenPhaseBlock,
         const std::vector<EArray2dc64>& rdrDataBlocks,
-        isce3::io::Raster& demRaster,
+        const isce3::geometry::DEMInterpolator& demInterp,
+        const isce3::core::ProjectionBase* proj,
+        const isce3::core::Interpolator<std::complex<float>>* sincInterp,
         const isce3::product::RadarGridParameters& radarGrid,
         const isce3::product::RadarGridParameters& slicedRadarGrid,
         const isce3::product::GeoGridParameters& geoGrid,
@@ -842,9 +947,9 @@ void geocodeSlc(
         const isce3::core::LUT2d<double>& nativeDoppler,
         const isce3::core::LUT2d<double>& imageGridDoppler,
         const isce3::core::Ellipsoid& ellipsoid,
-        const double& thresholdGeo2rdr, const int& numiterGeo2rdr,
+        const double thresholdGeo2rdr, const int numiterGeo2rdr,
         std::optional<isce3::geocode::EArray2duc8> maskBlock,
-        const size_t& azimuthFirstLine, const size_t& rangeFirstPixel,
+        const size_t azimuthFirstLine, const size_t rangeFirstPixel,
         const bool flatten, const bool reramp,
         const AzRgFunc& azCarrierPhase,
         const AzRgFunc& rgCarrierPhase,
@@ -852,51 +957,13 @@ void geocodeSlc(
         const isce3::core::LUT2d<double>& sRangeCorrection,
         const bool flattenWithCorrectedSRng,
         const std::complex<float> invalidValue,
-        const isce3::product::SubSwaths* subswaths)
+        const isce3::product::SubSwaths* subswaths,
+        const size_t lineStart, const size_t geoBlockLength)
 {
-    if (geoDataBlocks.size() != rdrDataBlocks.size()) {
-        std::string error_msg("number of geoDataBlocks != number of rdrDataBlocks");
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
-
-    // check all input and output arrays are of the same size
-    if (!array_sizes_consistent(geoDataBlocks)) {
-        std::string error_msg("geoDataBlocks arrays do not have the same size");
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
-    if (!array_sizes_consistent(rdrDataBlocks)) {
-        std::string error_msg("rdrDataBlocks arrays do not have the same size");
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
-
-    //
-    for (auto geoDataBlock : geoDataBlocks)
-        geoDataBlock.fill(invalidValue);
-
-    if(maskBlock.has_value())
-        maskBlock.value().fill(255);
-
-    validate_slice(radarGrid, slicedRadarGrid);
-
-    // create projection based on _epsg code
-    std::unique_ptr<isce3::core::ProjectionBase> proj(
-            isce3::core::createProj(geoGrid.epsg()));
-
-    // Interpolator pointer
-    auto sincInterp = std::make_unique<
-            isce3::core::Sinc2dInterpolator<std::complex<float>>>(
-            isce3::core::SINC_LEN, isce3::core::SINC_SUB);
-
-    // get a DEM interpolator for a block of DEM for the current geocoded
-    // grid
-    isce3::geometry::DEMInterpolator demInterp =
-        isce3::geometry::DEMRasterToInterpolator(demRaster, geoGrid, 0,
-                geoGrid.length(), geoGrid.width());
-
     // X and Y indices (in the radar coordinates) for the geocoded pixels
     // (after geo2rdr computation)
-    isce3::core::Matrix<double> rangeIndices(geoGrid.length(), geoGrid.width());
-    isce3::core::Matrix<double> azimuthIndices(geoGrid.length(), geoGrid.width());
+    isce3::core::Matrix<double> rangeIndices(geoBlockLength, geoGrid.width());
+    isce3::core::Matrix<double> azimuthIndices(geoBlockLength, geoGrid.width());
 
 
     // fill indices with NaNs. These do not need to be
@@ -908,7 +975,7 @@ void geocodeSlc(
     // Resize and fill uncorrected slant range if flag set
     isce3::core::Matrix<double> uncorrectedSRange;
     if (!flattenWithCorrectedSRng) {
-        uncorrectedSRange.resize(geoGrid.length(), geoGrid.width());
+        uncorrectedSRange.resize(geoBlockLength, geoGrid.width());
         uncorrectedSRange.fill(std::real(invalidValue));
     }
 
@@ -924,7 +991,7 @@ void geocodeSlc(
             maskBlock,
             demInterp,
             geoGrid,
-            geoGrid.length(),
+            geoBlockLength,
             geoGridWidth,
             radarGrid,
             slicedRadarGrid,
@@ -936,9 +1003,9 @@ void geocodeSlc(
             numiterGeo2rdr,
             azTimeCorrection,
             sRangeCorrection,
-            proj.get(),
+            proj,
             flattenWithCorrectedSRng,
-            0,
+            lineStart,
             subswaths);
 
     // loop over pairs of radar and geo block array
@@ -947,26 +1014,276 @@ void geocodeSlc(
         auto geoDataBlock = *gIt;
         auto rdrDataBlock = *rIt;
 
-        // interpolate and carrierPhaseRerampAndFlatten will only modify valid pixels
+        // interpolateRerampAndFlatten will only modify valid pixels
         // Remove doppler and carriers as needed
         carrierPhaseDeramp(rdrDataBlock, azCarrierPhase, rgCarrierPhase,
                 azimuthFirstLine, rangeFirstPixel, radarGrid);
 
-        // interpolate the data in radar grid to the geocoded grid.
-        interpolate(rdrDataBlock, geoDataBlock, rangeIndices, azimuthIndices,
-                azimuthFirstLine, rangeFirstPixel, sincInterp.get(),
-                radarGrid, nativeDoppler);
-
-        // Add back doppler and carriers as needed
-        carrierPhaseRerampAndFlatten(geoDataBlock, carrierPhaseBlock,
-                flattenPhaseBlock, rdrDataBlock, azCarrierPhase,
-                rgCarrierPhase, nativeDoppler, rangeIndices,
-                azimuthIndices, radarGrid, flatten, reramp,
+        // interpolate the data in radar grid to the geocoded grid and add
+        // back doppler and carriers as needed
+        interpolateRerampAndFlatten(rdrDataBlock, geoDataBlock,
+                carrierPhaseBlock, flattenPhaseBlock, azCarrierPhase,
+                rgCarrierPhase, nativeDoppler, rangeIndices, azimuthIndices,
+                sincInterp, radarGrid, flatten, reramp,
                 azimuthFirstLine, rangeFirstPixel, flattenWithCorrectedSRng,
                 uncorrectedSRange);
     }
 }
 
+
+template<typename AzRgFunc>
+void geocodeSlc(
+        std::vector<EArray2dc64>& geoDataBlocks,
+        EArray2df64 carrierPhaseBlock,
+        EArray2df64 flattenPhaseBlock,
+        const std::vector<EArray2dc64>& rdrDataBlocks,
+        isce3::io::Raster& demRaster,
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::product::RadarGridParameters& slicedRadarGrid,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::LUT2d<double>& nativeDoppler,
+        const isce3::core::LUT2d<double>& imageGridDoppler,
+        const isce3::core::Ellipsoid& ellipsoid,
+        const double& thresholdGeo2rdr, const int& numiterGeo2rdr,
+        std::optional<isce3::geocode::EArray2duc8> maskBlock,
+        const size_t& azimuthFirstLine, const size_t& rangeFirstPixel,
+        const bool flatten, const bool reramp,
+        const AzRgFunc& azCarrierPhase,
+        const AzRgFunc& rgCarrierPhase,
+        const isce3::core::LUT2d<double>& azTimeCorrection,
+        const isce3::core::LUT2d<double>& sRangeCorrection,
+        const bool flattenWithCorrectedSRng,
+        const std::complex<float> invalidValue,
+        const isce3::product::SubSwaths* subswaths)
+{
+    if (geoDataBlocks.size() != rdrDataBlocks.size()) {
+        std::string error_msg("number of geoDataBlocks != number of rdrDataBlocks");
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    // check all input and output arrays are of the same size
+    if (!array_sizes_consistent(geoDataBlocks)) {
+        std::string error_msg("geoDataBlocks arrays do not have the same size");
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    if (!array_sizes_consistent(rdrDataBlocks)) {
+        std::string error_msg("rdrDataBlocks arrays do not have the same size");
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    //
+    for (auto geoDataBlock : geoDataBlocks)
+        geoDataBlock.fill(invalidValue);
+
+    if(maskBlock.has_value())
+        maskBlock.value().fill(255);
+
+    validate_slice(radarGrid, slicedRadarGrid);
+
+    // create projection based on _epsg code
+    std::unique_ptr<isce3::core::ProjectionBase> proj(
+            isce3::core::createProj(geoGrid.epsg()));
+
+    // Interpolator pointer
+    auto sincInterp = std::make_unique<
+            isce3::core::Sinc2dInterpolator<std::complex<float>>>(
+            isce3::core::SINC_LEN, isce3::core::SINC_SUB);
+
+    // get a DEM interpolator for a block of DEM for the current geocoded
+    // grid
+    isce3::geometry::DEMInterpolator demInterp =
+        isce3::geometry::DEMRasterToInterpolator(demRaster, geoGrid, 0,
+                geoGrid.length(), geoGrid.width());
+
+    geocodeSlcLines(geoDataBlocks, carrierPhaseBlock, flattenPhaseBlock,
+            rdrDataBlocks, demInterp, proj.get(), sincInterp.get(),
+            radarGrid, slicedRadarGrid, geoGrid, orbit, nativeDoppler,
+            imageGridDoppler, ellipsoid, thresholdGeo2rdr, numiterGeo2rdr,
+            maskBlock, azimuthFirstLine, rangeFirstPixel, flatten, reramp,
+            azCarrierPhase, rgCarrierPhase, azTimeCorrection,
+            sRangeCorrection, flattenWithCorrectedSRng, invalidValue,
+            subswaths, 0, geoGrid.length());
+}
+
+
+/**
+ * Lines of the geogrid that may be covered by a radar grid, from the bounding
+ * box of the radar grid over the global height range. All the lines are
+ * returned if the bounding box cannot be computed.
+ *
+ * @param[in] radarGrid         radar grid
+ * @param[in] orbit             orbit of the radar grid
+ * @param[in] imageGridDoppler  doppler of the radar grid
+ * @param[in] geoGrid           geogrid
+ * @param[in] proj              projection of the geogrid
+ * @param[in] margin            number of lines added before and after
+ *
+ * \return  first line and number of lines
+ */
+std::pair<size_t, size_t> geogridLinesCovered(
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::LUT2d<double>& imageGridDoppler,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const isce3::core::ProjectionBase* proj,
+        const int margin)
+{
+    isce3::geometry::BoundingBox bbox;
+    try {
+        bbox = isce3::geometry::getGeoBoundingBox(radarGrid, orbit, proj,
+                imageGridDoppler, {isce3::core::GLOBAL_MIN_HEIGHT,
+                                   isce3::core::GLOBAL_MAX_HEIGHT});
+    } catch (const isce3::except::OutOfRange&) {
+        return {0, geoGrid.length()};
+    }
+    if (!std::isfinite(bbox.MinY) || !std::isfinite(bbox.MaxY)) {
+        return {0, geoGrid.length()};
+    }
+
+    // fractional lines at the edges of the bounding box
+    const double line0 = (bbox.MinY - geoGrid.startY()) / geoGrid.spacingY();
+    const double line1 = (bbox.MaxY - geoGrid.startY()) / geoGrid.spacingY();
+
+    const double first = std::floor(std::min(line0, line1)) - margin;
+    const double last = std::ceil(std::max(line0, line1)) + margin;
+    if (last < 0 || first >= geoGrid.length()) {
+        return {0, 0};
+    }
+
+    const size_t lineStart = static_cast<size_t>(std::max(first, 0.0));
+    const size_t lineEnd = static_cast<size_t>(
+            std::min(last, static_cast<double>(geoGrid.length() - 1)));
+    return {lineStart, lineEnd - lineStart + 1};
+}
+
+
+template<typename AzRgFunc>
+void geocodeSlcBursts(
+        std::vector<SlcBurst<AzRgFunc>>& bursts,
+        isce3::io::Raster& demRaster,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::Ellipsoid& ellipsoid,
+        const double& thresholdGeo2rdr, const int& numiterGeo2rdr,
+        const bool flatten, const bool reramp,
+        const bool flattenWithCorrectedSRng,
+        const std::complex<float> invalidValue)
+{
+    const size_t length = geoGrid.length();
+    const size_t width = geoGrid.width();
+    auto isGeogridSized = [&](const auto& block) {
+        return static_cast<size_t>(block.rows()) == length &&
+               static_cast<size_t>(block.cols()) == width;
+    };
+
+    // check the inputs of every burst before doing any work
+    for (const auto& burst : bursts) {
+        if (burst.geoDataBlocks.size() != burst.rdrDataBlocks.size()) {
+            std::string error_msg("number of geoDataBlocks != number of rdrDataBlocks");
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        if (!std::all_of(burst.geoDataBlocks.begin(),
+                    burst.geoDataBlocks.end(), isGeogridSized)) {
+            std::string error_msg("geoDataBlocks arrays do not have the geogrid size");
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        if (!array_sizes_consistent(burst.rdrDataBlocks)) {
+            std::string error_msg("rdrDataBlocks arrays do not have the same size");
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        if (burst.maskBlock.has_value() &&
+                !isGeogridSized(burst.maskBlock.value())) {
+            std::string error_msg("maskBlock does not have the geogrid size");
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+        }
+        validate_slice(burst.radarGrid, burst.slicedRadarGrid);
+    }
+
+    // Outputs may be shared by several bursts (e.g. a mosaic), so they are
+    // all initialized before any burst is geocoded.
+    for (auto& burst : bursts) {
+        for (auto geoDataBlock : burst.geoDataBlocks)
+            geoDataBlock.fill(invalidValue);
+        if (burst.maskBlock.has_value())
+            burst.maskBlock.value().fill(255);
+    }
+
+    // Setup shared by all bursts
+    std::unique_ptr<isce3::core::ProjectionBase> proj(
+            isce3::core::createProj(geoGrid.epsg()));
+
+    auto sincInterp = std::make_unique<
+            isce3::core::Sinc2dInterpolator<std::complex<float>>>(
+            isce3::core::SINC_LEN, isce3::core::SINC_SUB);
+
+    isce3::core::instrumentation::ScopedTimer demTimer(
+            "geocode_slc.load_dem");
+    isce3::geometry::DEMInterpolator demInterp =
+        isce3::geometry::DEMRasterToInterpolator(demRaster, geoGrid, 0,
+                length, width);
+    demTimer.stop();
+
+    // Lines of the geogrid covered by each burst, so that geo2rdr is only
+    // run over the footprint of the burst
+    const int lineMargin = 50;
+    const size_t nBursts = bursts.size();
+    std::vector<std::pair<size_t, size_t>> burstLines(nBursts);
+    std::vector<std::exception_ptr> errors(nBursts);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < nBursts; ++i) {
+        try {
+            burstLines[i] = geogridLinesCovered(bursts[i].slicedRadarGrid,
+                    orbit, bursts[i].imageGridDoppler, geoGrid, proj.get(),
+                    lineMargin);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    // Bursts are geocoded one after the other, each in parallel
+    for (size_t i = 0; i < nBursts; ++i) {
+        auto& burst = bursts[i];
+        const auto [lineStart, nLines] = burstLines[i];
+        if (nLines == 0)
+            continue;
+
+        isce3::core::instrumentation::count("geocode_slc.bursts");
+
+        // restrict the outputs to the lines covered by the burst
+        std::vector<EArray2dc64> geoDataLines;
+        for (auto geoDataBlock : burst.geoDataBlocks)
+            geoDataLines.emplace_back(geoDataBlock.middleRows(lineStart, nLines));
+
+        auto phaseLines = [&](EArray2df64 block) {
+            return isGeogridSized(block) ?
+                EArray2df64(block.middleRows(lineStart, nLines)) : block;
+        };
+
+        std::optional<EArray2duc8> maskLines;
+        if (burst.maskBlock.has_value())
+            maskLines.emplace(burst.maskBlock.value().middleRows(lineStart,
+                                                                 nLines));
+
+        geocodeSlcLines(geoDataLines, phaseLines(burst.carrierPhaseBlock),
+                phaseLines(burst.flattenPhaseBlock), burst.rdrDataBlocks,
+                demInterp, proj.get(), sincInterp.get(), burst.radarGrid,
+                burst.slicedRadarGrid, geoGrid, orbit, burst.nativeDoppler,
+                burst.imageGridDoppler, ellipsoid, thresholdGeo2rdr,
+                numiterGeo2rdr, maskLines, burst.azimuthFirstLine,
+                burst.rangeFirstPixel, flatten, reramp, burst.azCarrier,
+                burst.rgCarrier, burst.azTimeCorrection,
+                burst.sRangeCorrection, flattenWithCorrectedSRng,
+                invalidValue, burst.subswaths, lineStart, nLines);
+    }
+}
+
 #define EXPLICIT_INSTANTIATION(AzRgFunc)                                \
 template void geocodeSlc<AzRgFunc>(                                     \
         isce3::io::Raster& outputRaster, isce3::io::Raster& inputRaster,\
@@ -1029,7 +1346,17 @@ template void geocodeSlc<AzRgFunc>(                                     \
         const isce3::core::LUT2d<double>& sRangeCorrection,             \
         const bool flattenWithCorrectedSRng,                            \
         const std::complex<float> invalidValue,                         \
-        const isce3::product::SubSwaths*)
+        const isce3::product::SubSwaths*);                              \
+template void geocodeSlcBursts<AzRgFunc>(                               \
+        std::vector<SlcBurst<AzRgFunc>>& bursts,                        \
+        isce3::io::Raster& demRaster,                                   \
+        const isce3::product::GeoGridParameters& geoGrid,               \
+        const isce3::core::Orbit& orbit,                                \
+        const isce3::core::Ellipsoid& ellipsoid,                        \
+        const double& thresholdGeo2rdr, const int& numiterGeo2rdr,      \
+        const bool flatten, const bool reramp,                          \
+        const bool flattenWithCorrectedSRng,                            \
+        const std::complex<float> invalidValue)
 
 EXPLICIT_INSTANTIATION(isce3::core::LUT2d<double>);
 EXPLICIT_INSTANTIATION(isce3::core::Poly2d);
@@ -8,6 +8,7 @@
 #include <isce3/core/Poly2d.h>
 #include <isce3/io/forward.h>
 #include <isce3/product/forward.h>
+#include <isce3/product/RadarGridParameters.h>
 
 namespace isce3 { namespace geocode {
 
@@ -31,7 +32,8 @@ typedef Eigen::Ref<isce3::core::EArray2D<unsigned char>> EArray2duc8;
  * \param[in]  ellipsoid        ellipsoid object
  * \param[in]  thresholdGeo2rdr threshold for geo2rdr computations
  * \param[in]  numiterGeo2rdr   maximum number of iterations for Geo2rdr convergence
- * \param[in]  linesPerBlock    number of lines in each block
+ * \param[in]  linesPerBlock    number of lines in each block. Blocks are geocoded
+ *                              concurrently and share DEM reads
  * \param[in]  flatten          flag to flatten the geocoded SLC
  * \param[in]  reramp           flag to reramp the geocoded SLC
  * \param[in]  azCarrier        azimuth carrier phase of the SLC data, in radians, as a function of azimuth and range
@@ -194,4 +196,70 @@ void geocodeSlc(
                                 std::numeric_limits<float>::quiet_NaN()),
         const isce3::product::SubSwaths* subswaths = nullptr);
 
+/**
+ * Inputs and outputs of one burst geocoded by geocodeSlcBursts. See the
+ * array overload of geocodeSlc for the description of the members.
+ *
+ * The geocoded arrays and the mask must have the size of the geogrid. They
+ * may be shared by several bursts to mosaic them, in which case bursts later
+ * in the list take precedence where they overlap. The phase arrays are only
+ * written if they also have the size of the geogrid.
+ */
+template<typename AzRgFunc = isce3::core::Poly2d>
+struct SlcBurst {
+    std::vector<EArray2dc64> geoDataBlocks;
+    EArray2df64 carrierPhaseBlock;
+    EArray2df64 flattenPhaseBlock;
+    std::vector<EArray2dc64> rdrDataBlocks;
+    isce3::product::RadarGridParameters radarGrid;
+    isce3::product::RadarGridParameters slicedRadarGrid;
+    isce3::core::LUT2d<double> nativeDoppler;
+    isce3::core::LUT2d<double> imageGridDoppler;
+    std::optional<EArray2duc8> maskBlock = std::nullopt;
+    size_t azimuthFirstLine = 0;
+    size_t rangeFirstPixel = 0;
+    AzRgFunc azCarrier = AzRgFunc();
+    AzRgFunc rgCarrier = AzRgFunc();
+    isce3::core::LUT2d<double> azTimeCorrection = {};
+    isce3::core::LUT2d<double> sRangeCorrection = {};
+    const isce3::product::SubSwaths* subswaths = nullptr;
+};
+
+/**
+ * Geocode the SLC arrays of several bursts (e.g. the bursts of a Sentinel-1
+ * IW frame) to a common geogrid.
+ *
+ * The DEM, projection and interpolation kernel are set up once for all the
+ * bursts, and geo2rdr is only run over the lines of the geogrid covered by
+ * the footprint of each burst.
+ *
+ * \tparam[in]  AzRgFunc  2-D real-valued function of azimuth and range
+ *
+ * \param[in,out] bursts         inputs and outputs of each burst
+ * \param[in]  demRaster        raster of the DEM
+ * \param[in]  geoGrid          geo grid parameters shared by all bursts
+ * \param[in]  orbit            orbit shared by all bursts
+ * \param[in]  ellipsoid        ellipsoid object
+ * \param[in]  thresholdGeo2rdr threshold for geo2rdr computations
+ * \param[in]  numiterGeo2rdr   maximum number of iterations for Geo2rdr convergence
+ * \param[in]  flatten          flag to flatten the geocoded SLC
+ * \param[in]  reramp           flag to reramp the geocoded SLC
+ * \param[in]  flattenWithCorrectedSRng  flag to indicate whether geo2rdr slant-range additive values should be used for phase flattening
+ * \param[in]  invalidValue     invalid pixel fill value
+ */
+template<typename AzRgFunc = isce3::core::Poly2d>
+void geocodeSlcBursts(
+        std::vector<SlcBurst<AzRgFunc>>& bursts,
+        isce3::io::Raster& demRaster,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::Ellipsoid& ellipsoid,
+        const double& thresholdGeo2rdr, const int& numiterGeo2rdr,
+        const bool flatten = true,
+        const bool reramp = true,
+        const bool flattenWithCorrectedSRng = false,
+        const std::complex<float> invalidValue =
+            std::complex<float>(std::numeric_limits<float>::quiet_NaN(),
+                                std::numeric_limits<float>::quiet_NaN()));
+
 }} // namespace isce3::geocode
@@ -15,6 +15,7 @@
 #include <valarray>
 
 #include <isce3/core/Constants.h>
+#include <isce3/core/Instrumentation.h>
 
 #include "geometry.h"
 
@@ -22,6 +23,8 @@
 using isce3::io::Raster;
 using isce3::core::LUT1d;
 using isce3::core::Vec3;
+using isce3::core::instrumentation::ScopedTimer;
+namespace instrumentation = isce3::core::instrumentation;
 
 // Run geo2rdr with no offsets; internal creation of offset rasters
 void isce3::geometry::Geo2rdr::
@@ -95,6 +98,7 @@ geo2rdr(isce3::io::Raster & topoRaster,
         nBlocks += 1;
 
     // Loop over blocks
+    ScopedTimer timer("geo2rdr");
     size_t converged = 0;
     for (size_t block = 0; block < nBlocks; ++block) {
 
@@ -125,11 +129,16 @@ geo2rdr(isce3::io::Raster & topoRaster,
         std::valarray<double> rgoff(blockSize), azoff(blockSize);
 
         // Read block of topo data
+        ScopedTimer readTimer("geo2rdr.read");
         topoRaster.getBlock(x, 0, lineStart, demWidth, blockLength, 1);
         topoRaster.getBlock(y, 0, lineStart, demWidth, blockLength, 2);
         topoRaster.getBlock(hgt, 0, lineStart, demWidth, blockLength,3);
+        readTimer.stop();
+        instrumentation::count("geo2rdr.bytes_read",
+                3 * blockSize * sizeof(double));
 
         // Loop over DEM lines in block
+        ScopedTimer geo2rdrTimer("geo2rdr.geo2rdr");
         for (size_t blockLine = 0; blockLine < blockLength; ++blockLine) {
 
             // Global line index
@@ -170,10 +179,15 @@ geo2rdr(isce3::io::Raster & topoRaster,
                 }
             } // end OMP for loop pixels in block
         } // end for loop lines in block
+        geo2rdrTimer.stop();
+        instrumentation::count("geo2rdr.pixels", blockSize);
 
         // Write block of data
+        ScopedTimer writeTimer("geo2rdr.write");
         rgoffRaster.setBlock(rgoff, 0, lineStart, demWidth, blockLength);
         azoffRaster.setBlock(azoff, 0, lineStart, demWidth, blockLength);
+        instrumentation::count("geo2rdr.bytes_written",
+                2 * blockSize * sizeof(double));
 
     } // end for loop blocks in DEM image
 
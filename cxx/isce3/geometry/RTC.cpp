@@ -16,10 +16,13 @@
 #include <iostream>
 #include <string>
 
+#include <isce3/core/BufferPool.h>
 #include <isce3/core/Constants.h>
 #include <isce3/core/DateTime.h>
 #include <isce3/core/DenseMatrix.h>
 #include <isce3/core/Ellipsoid.h>
+#include <isce3/core/Instrumentation.h>
+#include <isce3/core/Numa.h>
 #include <isce3/core/Orbit.h>
 #include <isce3/core/Projections.h>
 #include <isce3/core/TypeTraits.h>
@@ -37,7 +40,10 @@
 using isce3::core::cartesian_t;
 using isce3::core::Mat3;
 using isce3::core::OrbitInterpBorderMode;
+using isce3::core::PooledArray2D;
 using isce3::core::Vec3;
+using isce3::core::instrumentation::ScopedTimer;
+namespace instrumentation = isce3::core::instrumentation;
 
 namespace isce3 { namespace geometry {
 
@@ -128,22 +134,26 @@ void _applyRtc(isce3::io::Raster& input_raster, isce3::io::Raster& input_rtc,
              << pyre::journal::endl;
 
         // get a block of data
-        _Pragma("omp parallel for schedule(dynamic)")
-            for (int block = 0; block < nblocks; ++block) {
+        isce3::core::forEachBlock(nblocks, [&](std::size_t block_index) {
+            const int block = block_index;
+
+            ScopedTimer timer("rtc.apply.block");
 
             int effective_block_length = block_length;
             if (block * block_length + effective_block_length > length - 1) {
                 effective_block_length = length - block * block_length;
             }
 
-            isce3::core::Matrix<float> rtc_ratio(effective_block_length, width);
+            // block buffers are borrowed from the buffer pool so that they
+            // are reused across blocks
+            PooledArray2D<float> rtc_ratio(effective_block_length, width);
             _Pragma("omp critical")
             {
                 input_rtc.getBlock(rtc_ratio.data(), 0, block * block_length,
                         width, effective_block_length, 1);
             }
 
-            isce3::core::Matrix<T> radar_data_block(block_length, width);
+            PooledArray2D<T> radar_data_block(block_length, width);
             if (!flag_complex_to_real_squared) {
                 _Pragma("omp critical")
                 {
@@ -173,7 +183,7 @@ void _applyRtc(isce3::io::Raster& input_raster, isce3::io::Raster& input_rtc,
                                 radar_data_block(i, jj), clip_min, clip_max);
                     }
             } else {
-                isce3::core::Matrix<std::complex<T>> radar_data_block_complex(
+                PooledArray2D<std::complex<T>> radar_data_block_complex(
                         block_length, width);
                 _Pragma("omp critical")
                 {
@@ -213,7 +223,9 @@ void _applyRtc(isce3::io::Raster& input_raster, isce3::io::Raster& input_rtc,
                         block * block_length, width, effective_block_length,
                         band + 1);
             }
-        }
+            instrumentation::count("rtc.apply.pixels",
+                    static_cast<long long>(effective_block_length) * width);
+        });
     }
 }
 
@@ -226,7 +238,8 @@ void _applyRtcMinValueDb(isce3::core::Matrix<float>& out_array,
         float rtc_min_value = std::pow(10., (rtc_min_value_db / 10.));
         info << "applying min. RTC value: " << rtc_min_value_db
              << " [dB] ~= " << rtc_min_value << pyre::journal::endl;
-        _Pragma("omp parallel for schedule(dynamic) collapse(2)")
+        // static schedule over rows, as the first touch of the array
+        _Pragma("omp parallel for schedule(static)")
             for (int i = 0; i < out_array.length(); ++i)
                 for (int j = 0; j < out_array.width(); ++j) {
                     if (out_array(i, j) >= rtc_min_value)
@@ -244,7 +257,8 @@ void _normalizeRtcArea(isce3::core::Matrix<float>& numerator_array,
         pyre::journal::info_t& info)
 {
     info << "normalizing gamma-naught area..." << pyre::journal::endl;
-    _Pragma("omp parallel for schedule(dynamic) collapse(2)") 
+    // static schedule over rows, as the first touch of the arrays
+    _Pragma("omp parallel for schedule(static)")
         for (int i = 0; i < numerator_array.length(); ++i) 
             for (int j = 0; j < numerator_array.width(); ++j) {
                 const float denominator_value = denominator_array(i, j);
@@ -674,6 +688,41 @@ double computeFacet(Vec3 xyz_center, Vec3 xyz_left, Vec3 xyz_right,
     return gamma_naught_area / divisor;
 }
 
+/* Compute the DEM coordinates of a row of geogrid points and transform
+ * them to LLH. The points are located at the map Y coordinate y and at
+ * the (upsampled) geogrid X positions x_offset, x_offset + 1, ...,
+ * x_offset + n - 1. The whole row is transformed with a single call to
+ * ProjectionBase::inverse_batch(); as ProjectionBase::inverse(), a
+ * RuntimeError is thrown if any point fails to transform. */
+static void _getDemRowLlh(const isce3::product::GeoGridParameters& geogrid,
+        double geogrid_upsampling, double x_offset, int n, double y,
+        const DEMInterpolator& dem_interp, isce3::core::ProjectionBase* proj,
+        const std::function<Vec3(double, double, const DEMInterpolator&,
+                isce3::core::ProjectionBase*)>& getDemCoords,
+        std::vector<Vec3>& llh)
+{
+    std::vector<double> dem_x(n), dem_y(n), dem_z(n), lon(n), lat(n), hgt(n);
+    for (int j = 0; j < n; ++j) {
+        const double x = geogrid.startX() +
+                         geogrid.spacingX() * (x_offset + j) /
+                                 geogrid_upsampling;
+        const Vec3 dem_xyz = getDemCoords(x, y, dem_interp, proj);
+        dem_x[j] = dem_xyz[0];
+        dem_y[j] = dem_xyz[1];
+        dem_z[j] = dem_xyz[2];
+    }
+
+    if (dem_interp.proj()->inverse_batch(n, dem_x.data(), dem_y.data(),
+                dem_z.data(), lon.data(), lat.data(), hgt.data()) != 0) {
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(),
+                "Inverse projection transformation failed");
+    }
+
+    llh.resize(n);
+    for (int j = 0; j < n; ++j)
+        llh[j] = {lon[j], lat[j], hgt[j]};
+}
+
 void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
         isce3::io::Raster& output_raster,
         const isce3::product::RadarGridParameters& radar_grid,
@@ -723,9 +772,13 @@ void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
     double xbound = radar_grid.width() - 1.0;
     double ybound = radar_grid.length() - 1.0;
 
-    // Output raster
+    // Output raster. Geogrid blocks may add to any radar-grid row, so the
+    // accumulation has no row partition to follow. The first touch follows
+    // the static row schedule of the normalization and min-value passes, and
+    // spreads the pages over the nodes of the threads.
     isce3::core::Matrix<float> out_array(radar_grid.length(), radar_grid.width());
-    out_array.fill(0);
+    isce3::core::firstTouchFill(out_array.data(), out_array.length(),
+            out_array.width(), 0.0f);
 
     // Output raster sigma
     isce3::core::Matrix<float> out_sigma_array;
@@ -740,7 +793,8 @@ void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
                                        rtcOutputTerrainRadiometry::SIGMA_NAUGHT);
     if (flag_compute_area_sigma_separately) {
         out_sigma_array.resize(radar_grid.length(), radar_grid.width());
-        out_sigma_array.fill(0);
+        isce3::core::firstTouchFill(out_sigma_array.data(),
+                out_sigma_array.length(), out_sigma_array.width(), 0.0f);
     }
 
     // ------------------------------------------------------------------------
@@ -772,12 +826,29 @@ void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
     }
 
     // Loop over DEM facets
+    ScopedTimer facetTimer("rtc.bilinear.facets");
     _Pragma("omp parallel for schedule(dynamic)")
         for (size_t ii = 0; ii < imax; ++ii)
     {
         double a = radar_grid.sensingMid();
         double r = radar_grid.midRange();
 
+        // LLH of the top and bottom vertices and of the centers of the
+        // facets of this line
+        const double dem_y0 = geogrid.startY() +
+                              geogrid.spacingY() * ii / upsample_factor;
+        const double dem_y1 = dem_y0 + geogrid.spacingY() / upsample_factor;
+        const double dem_ymid = geogrid.startY() + geogrid.spacingY() *
+                                                           (0.5 + ii) /
+                                                           upsample_factor;
+        std::vector<Vec3> llh_top, llh_bottom, llh_mid;
+        _getDemRowLlh(geogrid, upsample_factor, 0, jmax + 1, dem_y0,
+                dem_interp, proj.get(), getDemCoords, llh_top);
+        _getDemRowLlh(geogrid, upsample_factor, 0, jmax + 1, dem_y1,
+                dem_interp, proj.get(), getDemCoords, llh_bottom);
+        _getDemRowLlh(geogrid, upsample_factor, 0.5, jmax, dem_ymid,
+                dem_interp, proj.get(), getDemCoords, llh_mid);
+
         // The inner loop is not parallelized in order to keep the previous
         // solution from geo2rdr as the initial guess for the next call to
         // geo2rdr.
@@ -789,19 +860,8 @@ void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
                     printf("\rRTC progress: %d%%",
                         (int) ((numdone * 1e2 / imax) / jmax)),
                         fflush(stdout);
-            // Central DEM coordinates of facets
-            const double dem_ymid = geogrid.startY() + geogrid.spacingY() *
-                                                               (0.5 + ii) /
-                                                               upsample_factor;
-            const double dem_xmid = geogrid.startX() + geogrid.spacingX() *
-                                                               (0.5 + jj) /
-                                                               upsample_factor;
-
-            const Vec3 inputDEM =
-                    getDemCoords(dem_xmid, dem_ymid, dem_interp, proj.get());
-
-            // Compute facet-central LLH vector
-            const Vec3 inputLLH = dem_interp.proj()->inverse(inputDEM);
+            // Facet-central LLH vector
+            const Vec3& inputLLH = llh_mid[jj];
             // Should incorporate check on return status here
             int converged = geo2rdr(inputLLH, ellps, orbit, input_dop, a, r,
                     radar_grid.wavelength(), side, 1e-8, 100, 1e-8);
@@ -821,33 +881,11 @@ void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
             if (ranpix < -1 or x2 > xbound + 1 or azpix < -1 or y2 > ybound + 1)
                 continue;
 
-            // Current x/y-coords in DEM
-            const double dem_y0 = geogrid.startY() +
-                                  geogrid.spacingY() * ii / upsample_factor;
-            const double dem_y1 = dem_y0 + geogrid.spacingY() / upsample_factor;
-            const double dem_x0 = geogrid.startX() +
-                                  geogrid.spacingX() * jj / upsample_factor;
-            const double dem_x1 = dem_x0 + geogrid.spacingX() / upsample_factor;
-
-            // Set DEM-coordinate corner vectors
-            const Vec3 dem00 =
-                    getDemCoords(dem_x0, dem_y0, dem_interp, proj.get());
-            const Vec3 dem01 =
-                    getDemCoords(dem_x0, dem_y1, dem_interp, proj.get());
-            const Vec3 dem10 =
-                    getDemCoords(dem_x1, dem_y0, dem_interp, proj.get());
-            const Vec3 dem11 =
-                    getDemCoords(dem_x1, dem_y1, dem_interp, proj.get());
-
-            // Convert to XYZ
-            const Vec3 xyz00 =
-                    ellps.lonLatToXyz(dem_interp.proj()->inverse(dem00));
-            const Vec3 xyz01 =
-                    ellps.lonLatToXyz(dem_interp.proj()->inverse(dem01));
-            const Vec3 xyz10 =
-                    ellps.lonLatToXyz(dem_interp.proj()->inverse(dem10));
-            const Vec3 xyz11 =
-                    ellps.lonLatToXyz(dem_interp.proj()->inverse(dem11));
+            // Convert corner vectors to XYZ
+            const Vec3 xyz00 = ellps.lonLatToXyz(llh_top[jj]);
+            const Vec3 xyz01 = ellps.lonLatToXyz(llh_bottom[jj]);
+            const Vec3 xyz10 = ellps.lonLatToXyz(llh_top[jj + 1]);
+            const Vec3 xyz11 = ellps.lonLatToXyz(llh_bottom[jj + 1]);
 
             // Compute normal vectors for each facet
             const Vec3 normal_facet_1 = normalPlane(xyz00, xyz01, xyz10);
@@ -976,6 +1014,8 @@ void computeRtcBilinearDistribution(isce3::io::Raster& dem_raster,
 
     printf("\rRTC progress: 100%%");
     std::cout << std::endl;
+    facetTimer.stop();
+    instrumentation::count("rtc.bilinear.facets", imax * jmax);
 
     float min_hgt, max_hgt, avg_hgt;
 
@@ -1063,11 +1103,15 @@ void _RunBlock(const int jmax, const int block_size,
         rtcOutputTerrainRadiometry output_terrain_radiometry)
 {
 
+    ScopedTimer timer("rtc.area_proj.block");
+
     auto side = radar_grid.lookSide();
 
     int this_block_size = block_size;
     if ((block + 1) * block_size > geogrid.length())
         this_block_size = geogrid.length() % block_size;
+    instrumentation::count("rtc.area_proj.pixels",
+            static_cast<long long>(this_block_size) * geogrid.width());
 
     const int this_block_size_with_upsampling =
             this_block_size * geogrid_upsampling;
@@ -1126,18 +1170,21 @@ void _RunBlock(const int jmax, const int block_size,
     The algorithm iterates over the bottom-right vertices. An extra line is
     needed at the beggining to setup first line and first column. The
     algorithm iterates over the lines and previous ("bottom") computations
-    are saved as "last" line elements such as a_last, r_last, and dem_last.
+    are saved as "last" line elements such as a_last, r_last, and llh_last.
+    The LLH coordinates of the vertices and centers of each line are
+    transformed at once.
     */
 
     double a11 = radar_grid.sensingMid();
     double r11 = radar_grid.midRange();
-    Vec3 dem11;
+    Vec3 llh11;
+    std::vector<Vec3> llh_row, llh_center_row;
 
     std::vector<double> a_last(
             jmax + 1, std::numeric_limits<double>::quiet_NaN());
     std::vector<double> r_last(
             jmax + 1, std::numeric_limits<double>::quiet_NaN());
-    std::vector<Vec3> dem_last(
+    std::vector<Vec3> llh_last(
             jmax + 1, {std::numeric_limits<double>::quiet_NaN(),
                               std::numeric_limits<double>::quiet_NaN(),
                               std::numeric_limits<double>::quiet_NaN()});
@@ -1147,16 +1194,15 @@ void _RunBlock(const int jmax, const int block_size,
     */
     double dem_y1 =
             geogrid.startY() + (geogrid.spacingY() * ii_0) / geogrid_upsampling;
+    _getDemRowLlh(geogrid, geogrid_upsampling, 0, jmax + 1, dem_y1,
+            dem_interp_block, proj, getDemCoords, llh_row);
 
     for (int jj = 0; jj <= jmax; ++jj) {
-        const double dem_x1 = geogrid.startX() +
-                              (geogrid.spacingX() * jj) / geogrid_upsampling;
-
-        dem11 = getDemCoords(dem_x1, dem_y1, dem_interp_block, proj);
+        llh11 = llh_row[jj];
         // course
-        int converged = geo2rdr(dem_interp_block.proj()->inverse(dem11),
-                ellipsoid, orbit, dop, a11, r11, radar_grid.wavelength(), side,
-                threshold, num_iter, delta_range);
+        int converged = geo2rdr(llh11, ellipsoid, orbit, dop, a11, r11,
+                radar_grid.wavelength(), side, threshold, num_iter,
+                delta_range);
         if (!converged) {
             a11 = radar_grid.sensingMid();
             r11 = radar_grid.midRange();
@@ -1169,13 +1215,13 @@ void _RunBlock(const int jmax, const int block_size,
            different results for these elements when compared to
            the single-block solution.
         */
-        geo2rdr(dem_interp_block.proj()->inverse(dem11), ellipsoid, orbit, dop,
-                a11, r11, radar_grid.wavelength(), side, threshold, num_iter,
+        geo2rdr(llh11, ellipsoid, orbit, dop, a11, r11,
+                radar_grid.wavelength(), side, threshold, num_iter,
                 delta_range);
 
         a_last[jj] = a11;
         r_last[jj] = r11;
-        dem_last[jj] = dem11;
+        llh_last[jj] = llh11;
     }
 
     for (int i = 0; i < this_block_size_with_upsampling; ++i) {
@@ -1188,16 +1234,24 @@ void _RunBlock(const int jmax, const int block_size,
             r11 = r_last[0];
         }
 
-        // firt pixel on the left
-        const double dem_x1_0 = geogrid.startX();
+        // bottom vertices and centers of the facets of this line
         const double dem_y1 = geogrid.startY() + geogrid.spacingY() *
                                                          (1.0 + ii) /
                                                          geogrid_upsampling;
-        dem11 = getDemCoords(dem_x1_0, dem_y1, dem_interp_block, proj);
+        _getDemRowLlh(geogrid, geogrid_upsampling, 0, jmax + 1, dem_y1,
+                dem_interp_block, proj, getDemCoords, llh_row);
+        const double dem_y_c = geogrid.startY() + geogrid.spacingY() *
+                                                          (0.5 + ii) /
+                                                          geogrid_upsampling;
+        _getDemRowLlh(geogrid, geogrid_upsampling, 0.5, jmax, dem_y_c,
+                dem_interp_block, proj, getDemCoords, llh_center_row);
 
-        int converged = geo2rdr(dem_interp_block.proj()->inverse(dem11),
-                ellipsoid, orbit, dop, a11, r11, radar_grid.wavelength(), side,
-                threshold, num_iter, delta_range);
+        // firt pixel on the left
+        llh11 = llh_row[0];
+
+        int converged = geo2rdr(llh11, ellipsoid, orbit, dop, a11, r11,
+                radar_grid.wavelength(), side, threshold, num_iter,
+                delta_range);
         if (!converged) {
             a11 = std::numeric_limits<double>::quiet_NaN();
             r11 = std::numeric_limits<double>::quiet_NaN();
@@ -1214,22 +1268,22 @@ void _RunBlock(const int jmax, const int block_size,
             // bottom left (copy from previous bottom right)
             const double a10 = a11;
             const double r10 = r11;
-            const Vec3 dem10 = dem11;
+            const Vec3 llh10 = llh11;
 
-            // top left (copy from a_last, r_last, and dem_last)
+            // top left (copy from a_last, r_last, and llh_last)
             const double a00 = a_last[jj];
             const double r00 = r_last[jj];
-            const Vec3 dem00 = dem_last[jj];
+            const Vec3 llh00 = llh_last[jj];
 
-            // top right (copy from a_last, r_last, and dem_last)
+            // top right (copy from a_last, r_last, and llh_last)
             const double a01 = a_last[jj + 1];
             const double r01 = r_last[jj + 1];
-            const Vec3 dem01 = dem_last[jj + 1];
+            const Vec3 llh01 = llh_last[jj + 1];
 
             // update "last" vectors (from lower left vertex)
             a_last[jj] = a10;
             r_last[jj] = r10;
-            dem_last[jj] = dem10;
+            llh_last[jj] = llh10;
 
             // pre-calculate new bottom right
             if (!std::isnan(a10) && !std::isnan(a00) && !std::isnan(a01)) {
@@ -1243,15 +1297,11 @@ void _RunBlock(const int jmax, const int block_size,
                 r11 = r00;
             }
 
-            const double dem_x1 = geogrid.startX() + geogrid.spacingX() *
-                                                             (1.0 + jj) /
-                                                             geogrid_upsampling;
-
-            dem11 = getDemCoords(dem_x1, dem_y1, dem_interp_block, proj);
+            llh11 = llh_row[jj + 1];
 
-            int converged = geo2rdr(dem_interp_block.proj()->inverse(dem11),
-                    ellipsoid, orbit, dop, a11, r11, radar_grid.wavelength(),
-                    side, threshold, num_iter, delta_range);
+            int converged = geo2rdr(llh11, ellipsoid, orbit, dop, a11, r11,
+                    radar_grid.wavelength(), side, threshold, num_iter,
+                    delta_range);
             if (!converged) {
                 a11 = std::numeric_limits<double>::quiet_NaN();
                 r11 = std::numeric_limits<double>::quiet_NaN();
@@ -1262,7 +1312,7 @@ void _RunBlock(const int jmax, const int block_size,
             if (jj == jmax - 1) {
                 a_last[jj + 1] = a11;
                 r_last[jj + 1] = r11;
-                dem_last[jj + 1] = dem11;
+                llh_last[jj + 1] = llh11;
             }
 
             if (std::isnan(a00) || std::isnan(a01) || std::isnan(a10) ||
@@ -1329,21 +1379,14 @@ void _RunBlock(const int jmax, const int block_size,
             }
 
             // calculate center point
-            const double dem_y = geogrid.startY() + geogrid.spacingY() *
-                                                            (0.5 + ii) /
-                                                            geogrid_upsampling;
-            const double dem_x = geogrid.startX() + geogrid.spacingX() *
-                                                            (0.5 + jj) /
-                                                            geogrid_upsampling;
-            const Vec3 dem_c =
-                    getDemCoords(dem_x, dem_y, dem_interp_block, proj);
+            const Vec3& target_llh = llh_center_row[jj];
 
             double a_c = (a00 + a01 + a10 + a11) / 4.0;
             double r_c = (r00 + r01 + r10 + r11) / 4.0;
 
-            converged = geo2rdr(dem_interp_block.proj()->inverse(dem_c),
-                    ellipsoid, orbit, dop, a_c, r_c, radar_grid.wavelength(),
-                    side, threshold, num_iter, delta_range);
+            converged = geo2rdr(target_llh, ellipsoid, orbit, dop, a_c, r_c,
+                    radar_grid.wavelength(), side, threshold, num_iter,
+                    delta_range);
 
             if (!converged) {
                 a_c = std::numeric_limits<double>::quiet_NaN();
@@ -1360,15 +1403,10 @@ void _RunBlock(const int jmax, const int block_size,
                 continue;
 
             // Set DEM-coordinate corner vectors
-            const Vec3 xyz00 = ellipsoid.lonLatToXyz(
-                    dem_interp_block.proj()->inverse(dem00));
-            const Vec3 xyz10 = ellipsoid.lonLatToXyz(
-                    dem_interp_block.proj()->inverse(dem10));
-            const Vec3 xyz01 = ellipsoid.lonLatToXyz(
-                    dem_interp_block.proj()->inverse(dem01));
-            const Vec3 xyz11 = ellipsoid.lonLatToXyz(
-                    dem_interp_block.proj()->inverse(dem11));
-            const Vec3 target_llh = dem_interp_block.proj()->inverse(dem_c);
+            const Vec3 xyz00 = ellipsoid.lonLatToXyz(llh00);
+            const Vec3 xyz10 = ellipsoid.lonLatToXyz(llh10);
+            const Vec3 xyz01 = ellipsoid.lonLatToXyz(llh01);
+            const Vec3 xyz11 = ellipsoid.lonLatToXyz(llh11);
             const Vec3 xyz_c = ellipsoid.lonLatToXyz(target_llh);
 
             // Calculate look vector
@@ -1606,22 +1644,27 @@ void computeRtcAreaProj(isce3::io::Raster& dem_raster,
     const int imax = geogrid.length() * geogrid_upsampling;
     const int jmax = geogrid.width() * geogrid_upsampling;
 
-    // Output raster
+    // Output raster. As in the bilinear distribution, the first touch
+    // follows the static row schedule of the normalization and min-value
+    // passes, since geogrid blocks may add to any radar-grid row.
     using T = float;
     isce3::core::Matrix<T> out_gamma_array(radar_grid.length(), radar_grid.width());
-    out_gamma_array.fill(0);
+    isce3::core::firstTouchFill(out_gamma_array.data(),
+            out_gamma_array.length(), out_gamma_array.width(), T(0));
 
     isce3::core::Matrix<T> out_beta_array;
     if (rtc_area_mode == rtcAreaMode::AREA_FACTOR &&
             rtc_area_beta_mode != rtcAreaBetaMode::PIXEL_AREA) {
         out_beta_array.resize(radar_grid.length(), radar_grid.width());
-        out_beta_array.fill(0);
+        isce3::core::firstTouchFill(out_beta_array.data(),
+                out_beta_array.length(), out_beta_array.width(), T(0));
     }
 
     isce3::core::Matrix<float> out_sigma_array;
     if (out_sigma != nullptr) {
         out_sigma_array.resize(radar_grid.length(), radar_grid.width());
-        out_sigma_array.fill(0);
+        isce3::core::firstTouchFill(out_sigma_array.data(),
+                out_sigma_array.length(), out_sigma_array.width(), 0.0f);
     }
 
     const long long progress_block = ((long long) imax) * jmax / 100;
@@ -1646,8 +1689,7 @@ void computeRtcAreaProj(isce3::io::Raster& dem_raster,
     info << "block length (with upsampling): " << block_length_with_upsampling
          << pyre::journal::endl;
 
-    _Pragma("omp parallel for schedule(dynamic)")
-        for (int block = 0; block < nblocks; ++block) {
+    isce3::core::forEachBlock(nblocks, [&](std::size_t block) {
             _RunBlock(jmax, block_length, block_length_with_upsampling, block,
                 numdone, progress_block, geogrid_upsampling, interp_method,
                 dem_raster, out_geo_rdr, out_geo_grid, start, pixazm, dr, r0,
@@ -1656,7 +1698,7 @@ void computeRtcAreaProj(isce3::io::Raster& dem_raster,
                 out_beta_array, out_sigma_array, proj.get(), rtc_area_mode,
                 rtc_area_beta_mode, input_terrain_radiometry,
                 output_terrain_radiometry);
-        }
+        });
 
     printf("\rRTC progress: 100%%\n");
     std::cout << std::endl;
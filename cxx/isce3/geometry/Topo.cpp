@@ -1,7 +1,6 @@
 #include "Topo.h"
 
 #include <algorithm>
-#include <chrono>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -15,6 +14,7 @@
 #include <isce3/core/Constants.h>
 #include <isce3/core/Pixel.h>
 #include <isce3/core/DenseMatrix.h>
+#include <isce3/core/Instrumentation.h>
 #include <isce3/core/Utilities.h>
 
 #include <isce3/product/RadarGridProduct.h>
@@ -23,12 +23,15 @@
 #include <isce3/geometry/loadDem.h>
 #include "DEMInterpolator.h"
 #include "TopoLayers.h"
+#include "detail/Rdr2Geo.h"
 
 // pull in some isce3::core namespaces
 using isce3::core::Basis;
 using isce3::core::Mat3;
 using isce3::core::Pixel;
 using isce3::core::Vec3;
+using isce3::core::instrumentation::ScopedTimer;
+namespace instrumentation = isce3::core::instrumentation;
 using isce3::io::Raster;
 
 isce3::geometry::Topo::
@@ -122,7 +125,7 @@ topo(Raster & demRaster, TopoLayers & layers)
     pyre::journal::info_t info("isce.geometry.Topo");
 
     // Create and start a timer
-    auto timerStart = std::chrono::steady_clock::now();
+    ScopedTimer timer("topo");
 
     // Create a DEM interpolator
     DEMInterpolator demInterp(-500.0, _demMethod);
@@ -142,6 +145,7 @@ topo(Raster & demRaster, TopoLayers & layers)
 
     // Loop over blocks
     size_t totalconv = 0;
+    size_t totalfallback = 0;
     for (size_t block = 0; block < nBlocks; ++block) {
 
         // Get block extents
@@ -165,7 +169,10 @@ topo(Raster & demRaster, TopoLayers & layers)
              << pyre::journal::endl;
 
         // Load DEM subset for SLC image block
-        computeDEMBounds(demRaster, demInterp, lineStart, blockLength);
+        {
+            ScopedTimer demTimer("topo.load_dem");
+            computeDEMBounds(demRaster, demInterp, lineStart, blockLength);
+        }
 
         // Compute max and mean DEM height for the subset
         float demmin, demmax, dem_avg;
@@ -180,6 +187,7 @@ topo(Raster & demRaster, TopoLayers & layers)
         std::vector<Vec3> satPosition(blockLength);
 
         // For each line in block
+        ScopedTimer rdr2geoTimer("topo.rdr2geo");
         double tline;
         for (size_t blockLine = 0; blockLine < blockLength; ++blockLine) {
 
@@ -203,7 +211,7 @@ topo(Raster & demRaster, TopoLayers & layers)
             const double satVmag = vel.norm();
 
             // For each slant range bin
-            #pragma omp parallel for reduction(+:totalconv)
+            #pragma omp parallel for reduction(+ : totalconv, totalfallback)
             for (size_t rbin = 0; rbin < _radarGrid.width(); ++rbin) {
 
                 // Get current slant range
@@ -220,10 +228,11 @@ topo(Raster & demRaster, TopoLayers & layers)
                 Vec3 llh = demInterp.midLonLat();
 
                 // Perform rdr->geo iterations
-                int geostat = rdr2geo(
-                    pixel, TCNbasis, pos, vel, _ellipsoid, demInterp, llh,
-                    _radarGrid.lookSide(), _threshold, _numiter, _extraiter);
+                bool fallback = false;
+                int geostat = _rdr2geo(pixel, TCNbasis, pos, vel, demInterp,
+                                       llh, fallback);
                 totalconv += geostat;
+                totalfallback += fallback;
 
                 // Save data in output arrays
                 _setOutputTopoLayers(llh, layers, blockLine, pixel, pos, vel,
@@ -233,26 +242,34 @@ topo(Raster & demRaster, TopoLayers & layers)
         } // end for loop lines in block
         printf("\rTopo progress (block %d/%d): 100%%\n",
                (int) block + 1, (int) nBlocks), fflush(stdout);
+        rdr2geoTimer.stop();
+        instrumentation::count("topo.pixels",
+                blockLength * _radarGrid.width());
 
         // Compute layover/shadow masks for the block
         if (_computeMask) {
+            ScopedTimer maskTimer("topo.layover_shadow");
             setLayoverShadow(layers, demInterp, satPosition, block, nBlocks);
         }
 
         // Write out block of data for all topo layers
-        layers.writeData(0, lineStart);
+        {
+            ScopedTimer writeTimer("topo.write");
+            layers.writeData(0, lineStart);
+        }
 
     } // end for loop blocks
 
     // Print out convergence statistics
     info << "Total convergence: " << totalconv << " out of "
          << _radarGrid.size() << pyre::journal::endl;
+    if (_mixedPrecision) {
+        info << "Mixed precision fallbacks: " << totalfallback << " out of "
+             << _radarGrid.size() << pyre::journal::endl;
+    }
 
     // Print out timing information and reset
-    auto timerEnd = std::chrono::steady_clock::now();
-    const double elapsed = 1.0e-3 * std::chrono::duration_cast<std::chrono::milliseconds>(
-        timerEnd - timerStart).count();
-    info << "Elapsed processing time: " << elapsed << " sec"
+    info << "Elapsed processing time: " << timer.elapsed() << " sec"
          << pyre::journal::newline;
 }
 
@@ -263,7 +280,7 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
     pyre::journal::info_t info("isce.geometry.Topo");
 
     // Create and start a timer
-    auto timerStart = std::chrono::steady_clock::now();
+    ScopedTimer timer("topo");
 
     // Compute number of blocks needed to process image
     size_t nBlocks = _radarGrid.length() / _linesPerBlock;
@@ -277,6 +294,7 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
 
     // Loop over blocks
     size_t totalconv = 0;
+    size_t totalfallback = 0;
     for (size_t block = 0; block < nBlocks; ++block) {
 
         // Get block extents
@@ -312,6 +330,7 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
         std::vector<Vec3> satPosition(blockLength);
 
         // For each line in block
+        ScopedTimer rdr2geoTimer("topo.rdr2geo");
         double tline;
         for (size_t blockLine = 0; blockLine < blockLength; ++blockLine) {
 
@@ -335,7 +354,7 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
             const double satVmag = vel.norm();
 
             // For each slant range bin
-            #pragma omp parallel for reduction(+ : totalconv)
+            #pragma omp parallel for reduction(+ : totalconv, totalfallback)
             for (size_t rbin = 0; rbin < _radarGrid.width(); ++rbin) {
 
                 // Get current slant range
@@ -353,10 +372,11 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
                 Vec3 llh = demInterp.midLonLat();
 
                 // Perform rdr->geo iterations
-                int geostat = rdr2geo(pixel, TCNbasis, pos, vel, _ellipsoid,
-                                      demInterp, llh, _radarGrid.lookSide(),
-                                      _threshold, _numiter, _extraiter);
+                bool fallback = false;
+                int geostat = _rdr2geo(pixel, TCNbasis, pos, vel, demInterp,
+                                       llh, fallback);
                 totalconv += geostat;
+                totalfallback += fallback;
 
                 // Save data in output arrays
                 _setOutputTopoLayers(llh, layers, blockLine, pixel, pos, vel,
@@ -366,28 +386,34 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
         } // end for loop lines in block
         printf("\rTopo progress (block %d/%d): 100%%\n",
                (int) block + 1, (int) nBlocks), fflush(stdout);
+        rdr2geoTimer.stop();
+        instrumentation::count("topo.pixels",
+                blockLength * _radarGrid.width());
 
         // Compute layover/shadow masks for the block
         if (_computeMask) {
+            ScopedTimer maskTimer("topo.layover_shadow");
             setLayoverShadow(layers, demInterp, satPosition, block, nBlocks);
         }
 
         // Write out block of data for all topo layers
-        layers.writeData(0, lineStart);
+        {
+            ScopedTimer writeTimer("topo.write");
+            layers.writeData(0, lineStart);
+        }
 
     } // end for loop blocks
 
     // Print out convergence statistics
     info << "Total convergence: " << totalconv << " out of "
          << _radarGrid.size() << pyre::journal::endl;
+    if (_mixedPrecision) {
+        info << "Mixed precision fallbacks: " << totalfallback << " out of "
+             << _radarGrid.size() << pyre::journal::endl;
+    }
 
     // Print out timing information and reset
-    auto timerEnd = std::chrono::steady_clock::now();
-    const double elapsed =
-            1.0e-3 * std::chrono::duration_cast<std::chrono::milliseconds>(
-                             timerEnd - timerStart)
-                             .count();
-    info << "Elapsed processing time: " << elapsed << " sec"
+    info << "Elapsed processing time: " << timer.elapsed() << " sec"
          << pyre::journal::newline;
 }
 
@@ -441,6 +467,24 @@ _initAzimuthLine(size_t line, double& tline, Vec3& pos, Vec3& vel, Basis& TCNbas
     TCNbasis = Basis(pos, vel);
 }
 
+int isce3::geometry::Topo::
+_rdr2geo(const Pixel& pixel, const Basis& TCNbasis, const Vec3& pos,
+         const Vec3& vel, const DEMInterpolator& demInterp, Vec3& llh,
+         bool& fallback) const
+{
+    fallback = false;
+    if (not _mixedPrecision) {
+        return rdr2geo(pixel, TCNbasis, pos, vel, _ellipsoid, demInterp, llh,
+                       _radarGrid.lookSide(), _threshold, _numiter,
+                       _extraiter);
+    }
+    const detail::Rdr2GeoParams params = {_threshold, _numiter, _extraiter};
+    const auto status = detail::rdr2geo_mixed(&llh, pixel, TCNbasis, pos, vel,
+            demInterp, _ellipsoid, _radarGrid.lookSide(), llh[2], params,
+            std::numeric_limits<double>::quiet_NaN(), &fallback);
+    return status == isce3::error::ErrorCode::Success;
+}
+
 // Get DEM bounds using first/last azimuth line and slant range bin
 void isce3::geometry::Topo::
 computeDEMBounds(Raster & demRaster, DEMInterpolator & demInterp, size_t lineOffset,
@@ -149,6 +149,21 @@ public:
      */
     void linesPerBlock(size_t linesPerBlock) { _linesPerBlock = linesPerBlock; }
 
+    /**
+     * Set mixed precision flag
+     *
+     * When set, each pixel iterates in single precision on offsets from a
+     * double precision reference target, and only the final target position
+     * is computed in double precision. Thresholds finer than the single
+     * precision resolution (~1 mm) are met by refining in double precision.
+     * Pixels that fail to converge fall back to the double precision
+     * iteration, and the number of fallbacks is reported at the end of
+     * processing.
+     *
+     * @param[in] flag Boolean for mixed precision rdr2geo
+     */
+    void mixedPrecision(bool flag) { _mixedPrecision = flag; }
+
     // Get topo processing options
 
     /** Get distance convergence threshold used for processing */
@@ -181,6 +196,9 @@ public:
     /** Get linesPerBlock */
     size_t linesPerBlock() const { return _linesPerBlock; }
 
+    /** Get mixed precision flag */
+    bool mixedPrecision() const { return _mixedPrecision; }
+
     /** Get read-only reference to RadarGridParameters */
     const isce3::product::RadarGridParameters & radarGridParameters() const { return _radarGrid; }
 
@@ -355,6 +373,24 @@ private:
                           isce3::core::Vec3& pos, isce3::core::Vec3& vel,
                           isce3::core::Basis& TCNbasis);
 
+    /**
+     * Run rdr2geo for a pixel with the configured precision
+     *
+     * @param[in] pixel Pixel to transform
+     * @param[in] TCNbasis TCN basis of the azimuth line
+     * @param[in] pos Platform position
+     * @param[in] vel Platform velocity
+     * @param[in] demInterp DEM interpolator
+     * @param[in,out] llh Initial guess / solution
+     * @param[out] fallback Whether mixed precision fell back to double
+     * @returns 1 if converged, 0 otherwise
+     */
+    int _rdr2geo(const isce3::core::Pixel& pixel,
+                 const isce3::core::Basis& TCNbasis,
+                 const isce3::core::Vec3& pos, const isce3::core::Vec3& vel,
+                 const DEMInterpolator& demInterp, isce3::core::Vec3& llh,
+                 bool& fallback) const;
+
     /**
      * Write to output layers
      *
@@ -414,6 +450,7 @@ private:
     double _margin = 0.15;        //Margin for bounding box in decimal degrees
     size_t _linesPerBlock = 1000; //Block size for processing
     bool _computeMask = true;     //Flag for generating shadow-layover mask
+    bool _mixedPrecision = false; //Flag for mixed precision rdr2geo
 
     isce3::core::dataInterpMethod _demMethod;
 
@@ -4,6 +4,10 @@
 // cassert for assert()
 #include <cassert>
 
+#include <exception>
+#include <limits>
+#include <vector>
+
 // pyre::journal
 #include <pyre/journal.h>
 
@@ -16,7 +20,10 @@
 
 // isce3::geometry
 #include <isce3/geometry/geometry.h>
-#include <isce3/geometry/rdr2geo_roots.h>
+#include <isce3/geometry/detail/Rdr2Geo.h>
+
+// isce3::math
+#include <isce3/math/RootFind1dBracket.h>
 
 // isce3::except
 #include <isce3/except/Error.h>
@@ -30,102 +37,209 @@ using isce3::core::ProjectionBase;
 using isce3::core::Basis;
 
 
-isce3::geometry::Perimeter
-isce3::geometry::
-getGeoPerimeter(const isce3::product::RadarGridParameters &radarGrid,
-                const isce3::core::Orbit &orbit,
-                const isce3::core::ProjectionBase *proj,
-                const isce3::core::LUT2d<double> &doppler,
-                const isce3::geometry::DEMInterpolator &demInterp,
-                const int pointsPerEdge,
-                const double threshold)
-{
-
-    //Check for number of points on edge
-    if (pointsPerEdge < 2)
+namespace {
+
+// Radar coordinate and Doppler of a perimeter sample
+struct PerimeterSample {
+    double time, range, doppler;
+};
+
+/* Solver for the map coordinates of the perimeter of a radar grid.
+ *
+ * The Doppler is evaluated once per perimeter sample, so that the perimeter
+ * can be cheaply recomputed over several DEMs (e.g. constant heights).  The
+ * samples are split into short chunks that are solved in parallel with
+ * detail::rdr2geo_bracket.  Within a chunk, the pseudo-look angle bracket
+ * of each sample is centered on the solution of the same sample for the
+ * previous DEM, or on the solution of its neighbour when solving the first
+ * DEM.
+ */
+class PerimeterSolver {
+public:
+    PerimeterSolver(const isce3::product::RadarGridParameters& radarGrid,
+                    const isce3::core::Orbit& orbit,
+                    const isce3::core::LUT2d<double>& doppler,
+                    const int pointsPerEdge, const double threshold)
+        : _orbit(orbit), _wavelength(radarGrid.wavelength()),
+          _side(radarGrid.lookSide()), _threshold(threshold)
     {
-        std::string errstr = "At least 2 points per edge should be requested "
-                             "for perimeter estimation. " +
-                             std::to_string(pointsPerEdge) + " requested. ";
-        throw isce3::except::OutOfRange(ISCE_SRCINFO(), errstr);
-    }
+        // Check for number of points on edge
+        if (pointsPerEdge < 2) {
+            std::string errstr = "At least 2 points per edge should be "
+                                 "requested for perimeter estimation. " +
+                                 std::to_string(pointsPerEdge) +
+                                 " requested. ";
+            throw isce3::except::OutOfRange(ISCE_SRCINFO(), errstr);
+        }
 
-    //Journal for warning
-    pyre::journal::warning_t warning("isce.geometry.perimeter");
+        // Polygon ABCD defined by four corners of radar grid.
+        const double t0 = radarGrid.sensingTime(0);
+        const double t1 = radarGrid.sensingTime(radarGrid.length() - 1);
+        const double r0 = radarGrid.slantRange(0);
+        const double r1 = radarGrid.slantRange(radarGrid.width() - 1);
+
+        // To get stable counter-clockwise order on the map, we need to
+        // change definition of points based on radar look side.  Following
+        // discussion, folks prefer to start at (t0, r0) in both cases.
+        using RadarCoord = struct { double time, range; };
+        std::vector<RadarCoord> vertices;
+        if (radarGrid.lookSide() == isce3::core::LookSide::Left) {
+            vertices = {
+                RadarCoord{t0, r0},
+                RadarCoord{t1, r0},
+                RadarCoord{t1, r1},
+                RadarCoord{t0, r1}};
+        } else {
+            vertices = {
+                RadarCoord{t0, r0},
+                RadarCoord{t0, r1},
+                RadarCoord{t1, r1},
+                RadarCoord{t1, r0}};
+        }
+        // Close polygon by repeating first point.
+        vertices.push_back(vertices[0]);
+
+        // Construct edges between each vertex.  Note that the resulting
+        // polygon isn't closed yet.  Linear interpolation between radar
+        // (time, range) coordinates with t in [0, 1].
+        for (std::size_t iv = 0; iv < vertices.size() - 1; ++iv) {
+            const auto& current = vertices[iv], next = vertices[iv + 1];
+            for (int ie = 0; ie < pointsPerEdge - 1; ++ie) {
+                const double t = static_cast<double>(ie) / (pointsPerEdge - 1);
+                PerimeterSample sample;
+                sample.time = current.time + t * (next.time - current.time);
+                sample.range = current.range + t * (next.range - current.range);
+                _samples.push_back(sample);
+            }
+        }
 
-    //Ellipsoid being used for processing
-    const isce3::core::Ellipsoid &ellipsoid = proj->ellipsoid();
+        const int nsamples = _samples.size();
+        for (auto& sample : _samples)
+            sample.doppler = doppler.eval(sample.time, sample.range);
 
-    // Polygon ABCD defined by four corners of radar grid.
-    const double t0 = radarGrid.sensingTime(0);
-    const double t1 = radarGrid.sensingTime(radarGrid.length() - 1);
-    const double r0 = radarGrid.slantRange(0);
-    const double r1 = radarGrid.slantRange(radarGrid.width() - 1);
-
-    // To get stable counter-clockwise order on the map, we need to change
-    // definition of points based on radar look side.  Following discussion,
-    // folks prefer to start at (t0, r0) in both cases.
-    using RadarCoord = struct { double time, range; };
-    std::vector<RadarCoord> vertices;
-    if (radarGrid.lookSide() == isce3::core::LookSide::Left) {
-        vertices = {
-            RadarCoord{t0, r0},
-            RadarCoord{t1, r0},
-            RadarCoord{t1, r1},
-            RadarCoord{t0, r1}};
-    } else {
-        vertices = {
-            RadarCoord{t0, r0},
-            RadarCoord{t0, r1},
-            RadarCoord{t1, r1},
-            RadarCoord{t1, r0}};
+        _looks.assign(nsamples, std::numeric_limits<double>::quiet_NaN());
     }
-    // Close polygon by repeating first point.
-    vertices.push_back(vertices[0]);
-
-    // Convert radar to map coordinates.
-    const auto rdr2llh = [&](const RadarCoord& point) -> Vec3 {
-        Vec3 xyz, llh;
-        const auto fd = doppler.eval(point.time, point.range);
-
-        const auto converged = rdr2geo_bracket(point.time, point.range, fd,
-                orbit, demInterp, xyz, radarGrid.wavelength(),
-                radarGrid.lookSide(), threshold);
-
-        if (not converged) {
-            std::string err = "Error transforming RadarCoord(time=" +
-                std::to_string(point.time) + ", range=" +
-                std::to_string(point.range) + ") to ECEF XYZ coordinate.";
-            throw isce3::except::OutOfRange(ISCE_SRCINFO(), err);
-        }
 
-        ellipsoid.xyzToLonLat(xyz, llh);
-        return llh;
-    };
+    int size() const { return _samples.size(); }
 
-    // Linear interpolation between radar (time, range) coordinates.
-    // t in [0, 1] to slide between points a and b.
-    const auto lerp = [](const RadarCoord& a, const RadarCoord& b, double t) {
-        return RadarCoord{a.time + t * (b.time - a.time),
-            a.range + t * (b.range - a.range)};
-    };
+    const PerimeterSample& sample(int i) const { return _samples[i]; }
 
-    // Construct edges between each vertex.  Note that the resulting polygon
-    // isn't closed yet.
-    std::vector<Vec3> map_points;
-    for (decltype(vertices.size()) iv = 0; iv < vertices.size() - 1; ++iv) {
-        const auto& current = vertices[iv], next = vertices[iv + 1];
-        for (int ie = 0; ie < pointsPerEdge - 1; ++ie) {
-            const double t = static_cast<double>(ie) / (pointsPerEdge - 1);
-            const auto radar_point = lerp(current, next, t);
-            map_points.push_back(rdr2llh(radar_point));
+    /* Compute the ECEF XYZ coordinates of all samples over the given DEM.
+     * Returns the index of the first sample that failed to converge, or -1
+     * if all samples converged. */
+    int solve(const isce3::geometry::DEMInterpolator& dem,
+              std::vector<Vec3>& xyz)
+    {
+        const auto ellipsoid =
+                isce3::core::makeProjection(dem.epsgCode())->ellipsoid();
+        const int nsamples = _samples.size();
+        const int nchunks = (nsamples + chunk_size - 1) / chunk_size;
+        xyz.resize(nsamples);
+
+        int first_failed = nsamples;
+
+        _Pragma("omp parallel for reduction(min:first_failed)")
+        for (int chunk = 0; chunk < nchunks; ++chunk) {
+            const int start = chunk * chunk_size;
+            const int stop = std::min(start + chunk_size, nsamples);
+
+            double prev_look = std::numeric_limits<double>::quiet_NaN();
+            double prev_step = 0;
+            for (int i = start; i < stop; ++i) {
+                // Warm start from the previous DEM, otherwise from the
+                // neighbouring sample extrapolated by the last step.
+                double guess = _looks[i], half_width = initial_half_width;
+                if (std::isnan(guess) and not std::isnan(prev_look)) {
+                    guess = prev_look + prev_step;
+                    half_width = std::max(std::abs(prev_step),
+                                          initial_half_width);
+                }
+
+                double look;
+                if (not _solveSample(_samples[i], dem, ellipsoid, guess,
+                                     half_width, &xyz[i], &look)) {
+                    first_failed = std::min(first_failed, i);
+                    prev_look = std::numeric_limits<double>::quiet_NaN();
+                    continue;
+                }
+                prev_step = std::isnan(prev_look) ? 0 : look - prev_look;
+                prev_look = look;
+                _looks[i] = look;
+            }
         }
+        return (first_failed < nsamples) ? first_failed : -1;
+    }
+
+private:
+    // Samples solved sequentially by a single thread
+    static constexpr int chunk_size = 8;
+    // Smallest half-width (rad) of a warm-started look angle bracket
+    static constexpr double initial_half_width = 1e-3;
+    static constexpr double look_min = 0.0;
+    static constexpr double look_max = M_PI / 2;
+
+    std::vector<PerimeterSample> _samples;
+    std::vector<double> _looks;
+    const isce3::core::Orbit& _orbit;
+    double _wavelength;
+    isce3::core::LookSide _side;
+    double _threshold;
+
+    bool _solveSample(const PerimeterSample& sample,
+                      const isce3::geometry::DEMInterpolator& dem,
+                      const isce3::core::Ellipsoid& ellipsoid,
+                      double guess, double half_width, Vec3* xyz,
+                      double* look) const
+    {
+        // Grow the bracket around the first guess until it contains the
+        // root, ending with the full interval.
+        isce3::geometry::detail::Rdr2GeoBracketParams params;
+        params.tol_height = _threshold;
+        if (not std::isnan(guess)) {
+            params.look_min = std::max(look_min, guess - half_width);
+            params.look_max = std::min(look_max, guess + half_width);
+        }
+        while (true) {
+            const auto err = isce3::geometry::detail::rdr2geo_bracket(
+                    xyz, sample.time, sample.range, sample.doppler, _orbit,
+                    dem, ellipsoid, _wavelength, _side, params, look);
+            if (err == isce3::error::ErrorCode::Success)
+                return true;
+            if (err != isce3::error::ErrorCode::InvalidInterval or
+                (params.look_min == look_min and params.look_max == look_max))
+                return false;
+            half_width *= 8;
+            params.look_min = std::max(look_min, guess - half_width);
+            params.look_max = std::min(look_max, guess + half_width);
+        }
+    }
+};
+
+/* Compute the perimeter over the given DEM, throwing OutOfRange if any
+ * sample fails to converge or cannot be projected. */
+isce3::geometry::Perimeter _getGeoPerimeter(
+        PerimeterSolver& solver,
+        const isce3::core::ProjectionBase* proj,
+        const isce3::geometry::DEMInterpolator& demInterp)
+{
+    std::vector<Vec3> xyz;
+    const int failed = solver.solve(demInterp, xyz);
+    if (failed >= 0) {
+        const auto& sample = solver.sample(failed);
+        std::string err = "Error transforming RadarCoord(time=" +
+            std::to_string(sample.time) + ", range=" +
+            std::to_string(sample.range) + ") to ECEF XYZ coordinate.";
+        throw isce3::except::OutOfRange(ISCE_SRCINFO(), err);
     }
 
+    //Ellipsoid being used for processing
+    const isce3::core::Ellipsoid &ellipsoid = proj->ellipsoid();
+
     // Apply desired projection.
     isce3::geometry::Perimeter perimeter;
-    for (const auto& llh : map_points) {
-        Vec3 mapxyz;
+    for (const auto& point : xyz) {
+        Vec3 llh, mapxyz;
+        ellipsoid.xyzToLonLat(point, llh);
         int errorcode = proj->forward(llh, mapxyz);
         if (errorcode) {
             std::string errstr = "Error in transforming point (" + std::to_string(llh[0]) +
@@ -140,10 +254,26 @@ getGeoPerimeter(const isce3::product::RadarGridParameters &radarGrid,
     // always add one final point that is exactly equal to the first.
     perimeter.closeRings();
 
-    //Return points
     return perimeter;
 }
 
+} // namespace
+
+isce3::geometry::Perimeter
+isce3::geometry::
+getGeoPerimeter(const isce3::product::RadarGridParameters &radarGrid,
+                const isce3::core::Orbit &orbit,
+                const isce3::core::ProjectionBase *proj,
+                const isce3::core::LUT2d<double> &doppler,
+                const isce3::geometry::DEMInterpolator &demInterp,
+                const int pointsPerEdge,
+                const double threshold)
+{
+    PerimeterSolver solver(radarGrid, orbit, doppler, pointsPerEdge,
+                           threshold);
+    return _getGeoPerimeter(solver, proj, demInterp);
+}
+
 static void _addMarginToBoundingBox(isce3::geometry::BoundingBox& bbox,
                                     const double margin,
                                     const isce3::core::ProjectionBase* proj) {
@@ -175,12 +305,9 @@ static void _addMarginToBoundingBox(isce3::geometry::BoundingBox& bbox,
     }
 }
 
-isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBox(
-        const isce3::product::RadarGridParameters& radarGrid,
-        const isce3::core::Orbit& orbit, const isce3::core::ProjectionBase* proj,
-        const isce3::core::LUT2d<double>& doppler,
+static isce3::geometry::BoundingBox _getGeoBoundingBox(
+        PerimeterSolver& solver, const isce3::core::ProjectionBase* proj,
         const std::vector<double>& hgts, const double margin,
-        const int pointsPerEdge, const double threshold,
         bool ignore_out_of_range_exception) {
 
     // Check for number of points on edge
@@ -193,7 +320,8 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBox(
     // Initialize data structure for final output
     isce3::geometry::BoundingBox bbox;
 
-    // Loop over the heights
+    // Loop over the heights. Each height is warm-started from the solution
+    // of the previous one.
     for (const auto& height : hgts) {
         // Get perimeter for constant height
         isce3::geometry::DEMInterpolator constDEM(height);
@@ -201,16 +329,12 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBox(
 
         if (ignore_out_of_range_exception) {
             try {
-                perimeter = getGeoPerimeter(radarGrid, orbit, proj, doppler,
-                                            constDEM, pointsPerEdge, threshold);
-                                            
+                perimeter = _getGeoPerimeter(solver, proj, constDEM);
             } catch (const isce3::except::OutOfRange&) {
                 continue;
             }
         } else {
-            perimeter =
-                    getGeoPerimeter(radarGrid, orbit, proj, doppler, constDEM,
-                                    pointsPerEdge, threshold);
+            perimeter = _getGeoPerimeter(solver, proj, constDEM);
         }
 
         // Get bounding box for given height
@@ -242,6 +366,20 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBox(
     return bbox;
 }
 
+isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBox(
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::core::Orbit& orbit, const isce3::core::ProjectionBase* proj,
+        const isce3::core::LUT2d<double>& doppler,
+        const std::vector<double>& hgts, const double margin,
+        const int pointsPerEdge, const double threshold,
+        bool ignore_out_of_range_exception) {
+
+    PerimeterSolver solver(radarGrid, orbit, doppler, pointsPerEdge,
+                           threshold);
+    return _getGeoBoundingBox(solver, proj, hgts, margin,
+                              ignore_out_of_range_exception);
+}
+
 static bool _isValid(isce3::geometry::BoundingBox bbox) {
     auto valid = [](double x) {
         return not (std::isnan(x) or std::isinf(x));
@@ -251,12 +389,9 @@ static bool _isValid(isce3::geometry::BoundingBox bbox) {
 }
 
 static isce3::geometry::BoundingBox _getGeoBoundingBoxBinarySearch(
-        const isce3::product::RadarGridParameters& radarGrid,
-        const isce3::core::Orbit& orbit,
-        const isce3::core::ProjectionBase* proj,
-        const isce3::core::LUT2d<double>& doppler, double min_height,
-        double max_height, const double margin, const int pointsPerEdge,
-        const double threshold,
+        PerimeterSolver& solver,
+        const isce3::core::ProjectionBase* proj, double min_height,
+        double max_height, const double margin,
         bool find_lowest_valid_height,
         isce3::geometry::BoundingBox bbox_best_solution_from_other_end,
         const double height_threshold)
@@ -277,9 +412,8 @@ static isce3::geometry::BoundingBox _getGeoBoundingBoxBinarySearch(
     // Initialize data structure for final output
     double mid_height = (min_height + max_height) / 2.0;
 
-    isce3::geometry::BoundingBox bbox_mid = isce3::geometry::getGeoBoundingBox(
-            radarGrid, orbit, proj, doppler, {mid_height}, margin,
-            pointsPerEdge, threshold, true);
+    isce3::geometry::BoundingBox bbox_mid = _getGeoBoundingBox(
+            solver, proj, {mid_height}, margin, true);
 
     if (mid_height - min_height < height_threshold && _isValid(bbox_mid)) {
         return bbox_mid;
@@ -305,9 +439,9 @@ static isce3::geometry::BoundingBox _getGeoBoundingBoxBinarySearch(
         bbox_best_solution_from_other_end = bbox_mid;
 
     isce3::geometry::BoundingBox bbox_result = _getGeoBoundingBoxBinarySearch(
-            radarGrid, orbit, proj, doppler, new_min_height, new_max_height,
-            margin, pointsPerEdge, threshold, find_lowest_valid_height,
-            bbox_best_solution_from_other_end, height_threshold);
+            solver, proj, new_min_height, new_max_height, margin,
+            find_lowest_valid_height, bbox_best_solution_from_other_end,
+            height_threshold);
 
     return bbox_result;
 }
@@ -336,10 +470,13 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBoxHeightSearch(
     // Initialize data structure for final output
     const double margin_zero = 0;
 
+    // The perimeter samples are shared by all heights visited by the search
+    PerimeterSolver solver(radarGrid, orbit, doppler, pointsPerEdge,
+                           threshold);
+
     // Get BBox for min_height
-    BoundingBox bbox_min = getGeoBoundingBox(
-            radarGrid, orbit, proj, doppler, {min_height}, margin_zero,
-            pointsPerEdge, threshold, true);
+    BoundingBox bbox_min = _getGeoBoundingBox(
+            solver, proj, {min_height}, margin_zero, true);
 
     if (max_height == min_height && !_isValid(bbox_min)) {
         std::string errstr = "Bounding box not found for given parameters.";
@@ -350,9 +487,8 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBoxHeightSearch(
     }
 
     // Get BBox for max_height
-    BoundingBox bbox_max = getGeoBoundingBox(
-            radarGrid, orbit, proj, doppler, {max_height}, margin_zero,
-            pointsPerEdge, threshold, true);
+    BoundingBox bbox_max = _getGeoBoundingBox(
+            solver, proj, {max_height}, margin_zero, true);
 
     if (!_isValid(bbox_min) && !_isValid(bbox_max)) {
         // both are invalid
@@ -364,8 +500,7 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBoxHeightSearch(
         // only lower height is valid
         bool find_lowest_valid_height = false;
         bbox_max = _getGeoBoundingBoxBinarySearch(
-                radarGrid, orbit, proj, doppler, min_height, max_height,
-                margin_zero, pointsPerEdge, threshold,
+                solver, proj, min_height, max_height, margin_zero,
                 find_lowest_valid_height, bbox_min, height_threshold);
     } else if (!_isValid(bbox_min) && _isValid(bbox_max)) {
         // only upper height is valid
@@ -381,17 +516,15 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBoxHeightSearch(
                 satLLH[2] - radarGrid.startingRange() + height_threshold * 0.5;
 
         if (new_height > min_height) {
-            bbox_min = getGeoBoundingBox(
-                    radarGrid, orbit, proj, doppler, {new_height}, margin_zero,
-                    pointsPerEdge, threshold, true);
+            bbox_min = _getGeoBoundingBox(
+                    solver, proj, {new_height}, margin_zero, true);
             min_height = new_height;
         }
 
         if (!_isValid(bbox_min)) {
             bool find_lowest_valid_height = true;
             bbox_min = _getGeoBoundingBoxBinarySearch(
-                    radarGrid, orbit, proj, doppler, min_height, max_height,
-                    margin_zero, pointsPerEdge, threshold,
+                    solver, proj, min_height, max_height, margin_zero,
                     find_lowest_valid_height, bbox_max, height_threshold);
         }
     }
@@ -410,6 +543,67 @@ isce3::geometry::BoundingBox isce3::geometry::getGeoBoundingBoxHeightSearch(
     return bbox_min;
 }
 
+template<class F>
+static std::vector<isce3::geometry::BoundingBox> _getGeoBoundingBoxes(
+        const std::vector<isce3::product::RadarGridParameters>& radarGrids,
+        F&& getBoundingBox)
+{
+    const int ngrids = radarGrids.size();
+    std::vector<isce3::geometry::BoundingBox> bboxes(ngrids);
+
+    // Exceptions cannot leave the parallel region, so keep the first one
+    // (in radar grid order) and rethrow it afterwards.
+    std::vector<std::exception_ptr> errors(ngrids);
+
+    _Pragma("omp parallel for schedule(dynamic)")
+    for (int i = 0; i < ngrids; ++i) {
+        try {
+            bboxes[i] = getBoundingBox(radarGrids[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+    return bboxes;
+}
+
+std::vector<isce3::geometry::BoundingBox> isce3::geometry::getGeoBoundingBox(
+        const std::vector<isce3::product::RadarGridParameters>& radarGrids,
+        const isce3::core::Orbit& orbit, const isce3::core::ProjectionBase* proj,
+        const isce3::core::LUT2d<double>& doppler,
+        const std::vector<double>& hgts, const double margin,
+        const int pointsPerEdge, const double threshold,
+        bool ignore_out_of_range_exception) {
+
+    return _getGeoBoundingBoxes(radarGrids,
+        [&](const isce3::product::RadarGridParameters& radarGrid) {
+            return getGeoBoundingBox(radarGrid, orbit, proj, doppler, hgts,
+                                     margin, pointsPerEdge, threshold,
+                                     ignore_out_of_range_exception);
+        });
+}
+
+std::vector<isce3::geometry::BoundingBox>
+isce3::geometry::getGeoBoundingBoxHeightSearch(
+        const std::vector<isce3::product::RadarGridParameters>& radarGrids,
+        const isce3::core::Orbit& orbit, const isce3::core::ProjectionBase* proj,
+        const isce3::core::LUT2d<double>& doppler, double min_height,
+        double max_height, const double margin, const int pointsPerEdge,
+        const double threshold,
+        const double height_threshold) {
+
+    return _getGeoBoundingBoxes(radarGrids,
+        [&](const isce3::product::RadarGridParameters& radarGrid) {
+            return getGeoBoundingBoxHeightSearch(
+                    radarGrid, orbit, proj, doppler, min_height, max_height,
+                    margin, pointsPerEdge, threshold, height_threshold);
+        });
+}
+
 isce3::geometry::RadarGridBoundingBox isce3::geometry::getRadarBoundingBox(
         const isce3::product::GeoGridParameters& geo_grid,
         const isce3::product::RadarGridParameters& radar_grid,
@@ -35,6 +35,9 @@ struct RadarGridBoundingBox {
  *
  * The output of this method is an OGRLinearRing.
  *
+ * The edge points are solved in parallel, each one warm-started from the
+ * solution of its neighbour.
+ *
  * The sequence of walking the perimeter is guaranteed to have counter-clockwise
  * order on a map projection, which is required by the ISO 19125 specification
  * for Simple Features used by OGR/GDAL.  (Note that ESRI shapefiles use the
@@ -73,6 +76,8 @@ Perimeter getGeoPerimeter(const isce3::product::RadarGridParameters& radarGrid,
  * @param[in] threshold     Height threshold (m) for rdr2geo convergence
  *
  * The output of this method is an OGREnvelope.
+ *
+ * The perimeter of each height is warm-started from the previous height.
  */
 BoundingBox getGeoBoundingBox(
         const isce3::product::RadarGridParameters& radarGrid,
@@ -114,6 +119,44 @@ BoundingBox getGeoBoundingBoxHeightSearch(
         const double threshold = detail::DEFAULT_TOL_HEIGHT,
         const double height_threshold = 100);
 
+/** Compute the bounding boxes of several radar grids (e.g. the bursts of a
+ * data-take) using min/ max altitude for quick estimates.
+ *
+ * The radar grids are processed in parallel. See getGeoBoundingBox for
+ * the description of the parameters.
+ *
+ * @returns                 One OGREnvelope per radar grid
+ */
+std::vector<BoundingBox> getGeoBoundingBox(
+        const std::vector<isce3::product::RadarGridParameters>& radarGrids,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::ProjectionBase* proj,
+        const isce3::core::LUT2d<double>& doppler = {},
+        const std::vector<double>& hgts = {isce3::core::GLOBAL_MIN_HEIGHT,
+                isce3::core::GLOBAL_MAX_HEIGHT},
+        const double margin = 0.0, const int pointsPerEdge = 11,
+        const double threshold = detail::DEFAULT_TOL_HEIGHT,
+        bool ignore_out_of_range_exception = false);
+
+/** Compute the bounding boxes of several radar grids (e.g. the bursts of a
+ * data-take) with auto search within given min/ max height interval
+ *
+ * The radar grids are processed in parallel. See
+ * getGeoBoundingBoxHeightSearch for the description of the parameters.
+ *
+ * @returns                 One OGREnvelope per radar grid
+ */
+std::vector<BoundingBox> getGeoBoundingBoxHeightSearch(
+        const std::vector<isce3::product::RadarGridParameters>& radarGrids,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::ProjectionBase* proj,
+        const isce3::core::LUT2d<double>& doppler = {},
+        double min_height = isce3::core::GLOBAL_MIN_HEIGHT,
+        double max_height = isce3::core::GLOBAL_MAX_HEIGHT,
+        const double margin = 0.0, const int pointsPerEdge = 11,
+        const double threshold = detail::DEFAULT_TOL_HEIGHT,
+        const double height_threshold = 100);
+
 /** Compute bounding box of a geocoded grid within radar grid.
  *
  * The output of this function is a RadarGridBoundingBox object that defines
@@ -3,6 +3,7 @@
 #include <isce3/core/forward.h>
 
 #include <cmath>
+#include <limits>
 
 #include <isce3/core/Common.h>
 #include <isce3/core/LookSide.h>
@@ -80,6 +81,39 @@ rdr2geo(isce3::core::Vec3* llh, const isce3::core::Pixel& pixel,
         const isce3::core::Ellipsoid& ellipsoid, isce3::core::LookSide side,
         double h0 = 0., const Rdr2GeoParams& params = {});
 
+/**
+ * \internal
+ * Mixed-precision variant of the Pixel/TCN rdr2geo
+ *
+ * The fixed-point height iteration of rdr2geo is run in single precision on
+ * offsets from a reference target, which is computed in double precision on
+ * the range circle at \p h0 and moved to the current solution if the
+ * offsets grow too large. Only the DEM lookups and the final target
+ * position are computed in double precision. If the single precision
+ * residual is below \p params.threshold the output has the same accuracy as
+ * rdr2geo, otherwise the solution is refined with rdr2geo, which typically
+ * needs only one or two more iterations. If either stage fails, rdr2geo is
+ * run again from \p h0 and \p fallback (if not NULL) is set to true.
+ *
+ * Parameters are the same as rdr2geo.
+ *
+ * \param[in]  float_threshold Range residual (m) at which to stop the single
+ *                              precision iteration, if larger than
+ *                              \p params.threshold. It is limited below by
+ *                              the single precision resolution of the
+ *                              offsets.
+ * \param[out] fallback        Set to whether the full double precision
+ *                              solution was needed
+ */
+template<class DEMInterpolator>
+isce3::error::ErrorCode
+rdr2geo_mixed(isce3::core::Vec3* llh, const isce3::core::Pixel& pixel,
+        const isce3::core::Basis& tcnbasis, const isce3::core::Vec3& pos,
+        const isce3::core::Vec3& vel, const DEMInterpolator& dem,
+        const isce3::core::Ellipsoid& ellipsoid, isce3::core::LookSide side,
+        double h0 = 0., const Rdr2GeoParams& params = {},
+        double float_threshold = std::numeric_limits<double>::quiet_NaN(),
+        bool* fallback = nullptr);
 
 /** Default convergence tolerance for height (meters) */
 inline constexpr double DEFAULT_TOL_HEIGHT = 1e-5;
@@ -115,6 +149,8 @@ struct Rdr2GeoBracketParams {
  * \param[in]  wavelength Radar wavelength (wrt requested Doppler) (m)
  * \param[in]  side       Radar look side
  * \param[in]  params     Root finding algorithm parameters
+ * \param[out] look       Optional output pseudo-look angle of the solution
+ *                        (rad), e.g. to warm-start nearby solutions
  *
  * Note: Usually the look angle is defined as the angle between the line of
  * sight vector and the nadir vector.  Here the pseudo-look angle is defined in
@@ -128,7 +164,7 @@ rdr2geo_bracket(isce3::core::Vec3* xyz,
         double aztime, double slantRange, double doppler, const Orbit& orbit,
         const DEMInterpolator& dem, const isce3::core::Ellipsoid& ellipsoid,
         double wavelength, isce3::core::LookSide side,
-        const Rdr2GeoBracketParams& params = {});
+        const Rdr2GeoBracketParams& params = {}, double* look = nullptr);
 
 }}} // namespace isce3::geometry::detail
 
@@ -1,19 +1,23 @@
 #include "ResampSlc.h"
 
 #include <algorithm>
-#include <chrono>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include <pyre/journal.h>
 
 #include <isce3/core/Constants.h>
+#include <isce3/core/Instrumentation.h>
+#include <isce3/math/Phasor.h>
 
 #include "Tile.h"
 
 namespace isce3 { namespace image {
 
 using isce3::io::Raster;
+using isce3::core::instrumentation::ScopedTimer;
+namespace instrumentation = isce3::core::instrumentation;
 
 // Alternative generic resamp entry point: use filenames to internally create
 // rasters
@@ -68,7 +72,7 @@ void ResampSlc::resamp(isce3::io::Raster& inputSlc,
     std::cout << "Resampling using " << nTiles << " tiles of " << _linesPerTile
               << " lines per tile\n";
     // Start timer
-    auto timerStart = std::chrono::steady_clock::now();
+    ScopedTimer timer("resamp_slc");
 
     // For each full tile of _linesPerTile lines...
     for (size_t tileCount = 0; tileCount < nTiles; tileCount++) {
@@ -86,28 +90,34 @@ void ResampSlc::resamp(isce3::io::Raster& inputSlc,
 
         // Initialize offsets tiles
         Tile<double> azOffTile, rgOffTile;
+        ScopedTimer offsetTimer("resamp_slc.read_offsets");
         _initializeOffsetTiles(tile, azOffsetRaster, rgOffsetRaster, azOffTile,
                                rgOffTile, outWidth);
+        offsetTimer.stop();
 
         // Get corresponding image tile with read extents adjusted for offsets
         // sinc interpolation and chip.
         std::cout << "Reading in image data for tile " << tileCount << "\n";
+        ScopedTimer readTimer("resamp_slc.read_tile");
         _initializeTile(tile, inputSlc, azOffTile, outLength, rowBuffer,
                         chipSize / 2);
+        readTimer.stop();
+        instrumentation::count("resamp_slc.bytes_read",
+                tile.length() * tile.width() * sizeof(std::complex<float>) +
+                        2 * azOffTile.length() * outWidth * sizeof(double));
 
         // Perform interpolation
         std::cout << "Interpolating tile " << tileCount << "\n";
+        ScopedTimer interpTimer("resamp_slc.transform");
         _transformTile(tile, outputSlc, rgOffTile, azOffTile, inLength, flatten,
                        chipSize);
+        interpTimer.stop();
+        instrumentation::count("resamp_slc.pixels",
+                azOffTile.length() * outWidth);
     }
 
     // Print out timing information and reset
-    auto timerEnd = std::chrono::steady_clock::now();
-    const double elapsed =
-            1.0e-3 * std::chrono::duration_cast<std::chrono::milliseconds>(
-                             timerEnd - timerStart)
-                             .count();
-    std::cout << "Elapsed processing time: " << elapsed << " sec\n";
+    std::cout << "Elapsed processing time: " << timer.elapsed() << " sec\n";
 }
 
 // Initialize and read azimuth and range offsets
@@ -235,17 +245,16 @@ void ResampSlc::_initializeTile(Tile_t& tile, Raster& inputSlc,
                       tile.length(), _inputBand);
 
     // Remove carrier from input data
+    std::vector<double> phase(inWidth);
     for (size_t iRow = 0; iRow < tile.length(); iRow++) {
         const double az =  _sensingStart + (iRow + tile.firstImageRow()) / _prf;
         for (size_t iCol = 0; iCol < inWidth; iCol++) {
             const double rng = _startingRange + iCol * _rangePixelSpacing;
-            // Evaluate the pixel's carrier phase
-            const double phase = _rgCarrier.eval(az, rng)
-                + _azCarrier.eval(az, rng);
-            // Remove the carrier
-            std::complex<float> cpxPhase(std::cos(phase), -std::sin(phase));
-            tile(iRow, iCol) *= cpxPhase;
+            // Evaluate the pixel's carrier phase, to be removed
+            phase[iCol] = -(_rgCarrier.eval(az, rng)
+                + _azCarrier.eval(az, rng));
         }
+        isce3::math::rotate(&tile(iRow, 0), phase.data(), inWidth);
     }
 }
 
@@ -279,6 +288,8 @@ void ResampSlc::_transformTile(Tile_t& originalTile, Raster& outputSlc,
         // set half chip size
         // Allocate matrix for working sinc chip
         isce3::core::Matrix<std::complex<float>> chip(chipSize, chipSize);
+        // Doppler phasors of the chip rows
+        std::vector<std::complex<float>> chipPhasors(chipSize);
 
         for (size_t iRow = originalTile.rowStart(); iRow < originalTile.rowEnd(); ++iRow)
         {
@@ -360,15 +371,18 @@ void ResampSlc::_transformTile(Tile_t& originalTile, Raster& outputSlc,
                               ((1.0 / _refWavelength) - (1.0 / _wavelength)));
                 }
 
+                // Doppler phase of each chip row, -dop * (iChipRow - chipHalf),
+                // which is linear in the row
+                isce3::math::linearPhasors(dop * chipHalf, -dop,
+                        chipPhasors.data(), chipSize);
+
                 // Read data chip without the carrier phases
                 for (int iChipRow = 0; iChipRow < chipSize; ++iChipRow) {
                     // Row to read from
                     const int iChipRowInTile =
                             iRowResampled - originalTile.firstImageRow() + iChipRow - chipHalf;
                     // Carrier phase
-                    const double chipPhase = dop * (iChipRow - chipHalf);
-                    const std::complex<float> cval(
-                            std::cos(chipPhase), -std::sin(chipPhase));
+                    const std::complex<float> cval = chipPhasors[iChipRow];
                     // Set the data values after removing doppler in azimuth
                     for (int iChipCol = 0; iChipCol < chipSize; ++iChipCol) {
                         // Column to read from
@@ -397,7 +411,10 @@ void ResampSlc::_transformTile(Tile_t& originalTile, Raster& outputSlc,
     } // end multithreaded block
 
     // Write block of data
+    ScopedTimer writeTimer("resamp_slc.write");
     outputSlc.setBlock(resampledTile, 0, originalTile.rowStart(), outWidth, outLength);
+    instrumentation::count("resamp_slc.bytes_written",
+            outWidth * outLength * sizeof(std::complex<float>));
 }
 
 }} // namespace isce3::image
@@ -7,6 +7,7 @@
 //
 
 #include <algorithm>
+#include <filesystem>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -230,6 +231,28 @@ int isce3::io::Raster::setEPSG(int epsgcode)
 
     return status;
 }
+bool isce3::io::Raster::sharesDataset(const Raster& other) const {
+
+    if (_dataset == nullptr or other.dataset() == nullptr)
+        return false;
+    if (_dataset == other.dataset())
+        return true;
+
+    // Datasets without a file (e.g. in memory) have an empty description
+    const std::string path = _dataset->GetDescription();
+    const std::string other_path = other.dataset()->GetDescription();
+    if (path.empty() or other_path.empty())
+        return false;
+
+    // Resolve relative paths and links when both files exist, otherwise
+    // (e.g. /vsimem/ paths) compare the descriptions
+    std::error_code error;
+    const bool same_file = std::filesystem::equivalent(path, other_path, error);
+    if (!error)
+        return same_file;
+    return path == other_path;
+}
+
 // Destructor. When GDALOpenShared() is used the dataset is dereferenced
 // and closed only if the referenced count is less than 1.
 isce3::io::Raster::~Raster() {
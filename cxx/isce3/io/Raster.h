@@ -135,6 +135,13 @@ class isce3::io::Raster {
       /** GDALDataset owner getter*/
       inline bool dataset_owner()  const { return _owner; }
 
+      /** Whether this raster and another one refer to the same data, either
+       * through the same GDALDataset or through the same file opened twice
+       * (e.g. once read-only and once for update)
+       *
+       * @param[in] other Other raster*/
+      bool sharesDataset(const Raster& other) const;
+
       /** Return GDALDatatype of specified band
        *
        * @param[in] band Band number in 1-index*/
@@ -2,5 +2,6 @@
 
 namespace isce3 { namespace io {
 
+    class IGroup;
     class Raster;
 }}
@@ -0,0 +1,199 @@
+#include "Phasor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace isce3 { namespace math {
+
+namespace {
+
+// Phases are processed in blocks that fit in L1 cache, which also makes the
+// in-place (aliased) cases safe
+constexpr std::size_t BLOCK_SIZE = 256;
+
+// pi/2 split in parts of at most 24 significant bits, so that k * PIO2_1..3
+// is exact for |k| < 2^29
+constexpr double PIO2_1 = 0x1.921fb6p+0;
+constexpr double PIO2_2 = -0x1.777a5cp-25;
+constexpr double PIO2_3 = -0x1.ee59dap-50;
+constexpr double PIO2_4 = 0x1.98a2e03707345p-77;
+constexpr double TWO_OVER_PI = 0x1.45f306dc9c883p-1;
+
+// Adding and subtracting 1.5 * 2^52 rounds to the nearest integer
+constexpr double ROUND_MAGIC = 0x1.8p52;
+
+// fdlibm __kernel_sin and __kernel_cos coefficients on [-pi/4, pi/4]
+constexpr double S1 = -1.66666666666666324348e-01;
+constexpr double S2 = 8.33333333332248946124e-03;
+constexpr double S3 = -1.98412698298579493134e-04;
+constexpr double S4 = 2.75573137070700676789e-06;
+constexpr double S5 = -2.50507602534068634195e-08;
+constexpr double S6 = 1.58969099521155010221e-10;
+
+constexpr double C1 = 4.16666666666666019037e-02;
+constexpr double C2 = -1.38888888888741095749e-03;
+constexpr double C3 = 2.48015872894767294178e-05;
+constexpr double C4 = -2.75573143513906633035e-07;
+constexpr double C5 = 2.08757232129817482790e-09;
+constexpr double C6 = -1.13596475577881948265e-11;
+
+// sin and cos of at most BLOCK_SIZE phases, with s and c not aliasing x
+void sincosBlock(const double* x, double* s, double* c, std::size_t n)
+{
+#pragma omp simd
+    for (std::size_t i = 0; i < n; ++i) {
+        // quadrant and reduced argument in [-pi/4, pi/4]
+        const double k = (x[i] * TWO_OVER_PI + ROUND_MAGIC) - ROUND_MAGIC;
+        double r = x[i] - k * PIO2_1;
+        r -= k * PIO2_2;
+        r -= k * PIO2_3;
+        r -= k * PIO2_4;
+
+        const double z = r * r;
+        const double sr = r + r * z * (S1 + z * (S2 + z * (S3 + z * (S4 +
+                          z * (S5 + z * S6)))));
+        const double cr = 1.0 - 0.5 * z + z * z * (C1 + z * (C2 + z * (C3 +
+                          z * (C4 + z * (C5 + z * C6)))));
+
+        // k modulo 4, as q in {-2, -1, 0, 1, 2}
+        const double q = k - 4.0 * ((k * 0.25 + ROUND_MAGIC) - ROUND_MAGIC);
+        const bool swap = std::abs(q) == 1.0;
+        const bool half = std::abs(q) == 2.0;
+        const bool positive = q > 0.0;
+
+        s[i] = swap ? (positive ? cr : -cr) : (half ? -sr : sr);
+        c[i] = swap ? (positive ? -sr : sr) : (half ? -cr : cr);
+    }
+
+    // phases out of range of the reduction, including NaN and inf
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!(std::abs(x[i]) <= SINCOS_MAX_PHASE)) {
+            s[i] = std::sin(x[i]);
+            c[i] = std::cos(x[i]);
+        }
+    }
+}
+
+template<typename T>
+void unitPhasorsImpl(const double* phase, std::complex<T>* out,
+                     std::size_t n)
+{
+    double x[BLOCK_SIZE], s[BLOCK_SIZE], c[BLOCK_SIZE];
+    for (std::size_t start = 0; start < n; start += BLOCK_SIZE) {
+        const std::size_t m = std::min(BLOCK_SIZE, n - start);
+        std::copy(phase + start, phase + start + m, x);
+        sincosBlock(x, s, c, m);
+        for (std::size_t i = 0; i < m; ++i) {
+            out[start + i] = std::complex<T>(c[i], s[i]);
+        }
+    }
+}
+
+template<typename T>
+void rotateImpl(std::complex<T>* data, const double* phase, std::size_t n)
+{
+    double x[BLOCK_SIZE], s[BLOCK_SIZE], c[BLOCK_SIZE];
+    for (std::size_t start = 0; start < n; start += BLOCK_SIZE) {
+        const std::size_t m = std::min(BLOCK_SIZE, n - start);
+        std::copy(phase + start, phase + start + m, x);
+        sincosBlock(x, s, c, m);
+
+        // complex product written out so that it vectorizes (the sample is
+        // assumed finite, unlike std::complex operator*)
+        T* d = reinterpret_cast<T*>(data + start);
+#pragma omp simd
+        for (std::size_t i = 0; i < m; ++i) {
+            const T re = d[2 * i], im = d[2 * i + 1];
+            const T cr = static_cast<T>(c[i]), sr = static_cast<T>(s[i]);
+            d[2 * i] = re * cr - im * sr;
+            d[2 * i + 1] = re * sr + im * cr;
+        }
+    }
+}
+
+template<typename T>
+void linearPhasorsImpl(double phase0, double dphase, std::complex<T>* out,
+        std::size_t n, std::size_t anchorInterval)
+{
+    if (n == 0) {
+        return;
+    }
+    anchorInterval = std::max<std::size_t>(anchorInterval, 1);
+
+    // rotation applied between consecutive samples
+    double ds, dc;
+    sincosBlock(&dphase, &ds, &dc, 1);
+
+    double x[BLOCK_SIZE], s[BLOCK_SIZE], c[BLOCK_SIZE];
+    const std::size_t nAnchors = (n + anchorInterval - 1) / anchorInterval;
+    for (std::size_t first = 0; first < nAnchors; first += BLOCK_SIZE) {
+        const std::size_t m = std::min(BLOCK_SIZE, nAnchors - first);
+        for (std::size_t a = 0; a < m; ++a) {
+            x[a] = phase0 + static_cast<double>((first + a) * anchorInterval)
+                                    * dphase;
+        }
+        sincosBlock(x, s, c, m);
+
+        for (std::size_t a = 0; a < m; ++a) {
+            const std::size_t start = (first + a) * anchorInterval;
+            const std::size_t end = std::min(n, start + anchorInterval);
+            double re = c[a], im = s[a];
+            for (std::size_t i = start; i < end; ++i) {
+                out[i] = std::complex<T>(re, im);
+                const double next_re = re * dc - im * ds;
+                im = re * ds + im * dc;
+                re = next_re;
+            }
+        }
+    }
+}
+
+} // namespace
+
+void sincos(const double* x, double* s, double* c, std::size_t n)
+{
+    double xb[BLOCK_SIZE], sb[BLOCK_SIZE], cb[BLOCK_SIZE];
+    for (std::size_t start = 0; start < n; start += BLOCK_SIZE) {
+        const std::size_t m = std::min(BLOCK_SIZE, n - start);
+        std::copy(x + start, x + start + m, xb);
+        sincosBlock(xb, sb, cb, m);
+        std::copy(sb, sb + m, s + start);
+        std::copy(cb, cb + m, c + start);
+    }
+}
+
+void unitPhasors(const double* phase, std::complex<double>* out,
+                 std::size_t n)
+{
+    unitPhasorsImpl(phase, out, n);
+}
+
+void unitPhasors(const double* phase, std::complex<float>* out,
+                 std::size_t n)
+{
+    unitPhasorsImpl(phase, out, n);
+}
+
+void rotate(std::complex<float>* data, const double* phase, std::size_t n)
+{
+    rotateImpl(data, phase, n);
+}
+
+void rotate(std::complex<double>* data, const double* phase, std::size_t n)
+{
+    rotateImpl(data, phase, n);
+}
+
+void linearPhasors(double phase0, double dphase, std::complex<double>* out,
+        std::size_t n, std::size_t anchorInterval)
+{
+    linearPhasorsImpl(phase0, dphase, out, n, anchorInterval);
+}
+
+void linearPhasors(double phase0, double dphase, std::complex<float>* out,
+        std::size_t n, std::size_t anchorInterval)
+{
+    linearPhasorsImpl(phase0, dphase, out, n, anchorInterval);
+}
+
+}} // namespace isce3::math
@@ -0,0 +1,88 @@
+/** @file Phasor.h
+ * Array versions of sin, cos and exp(1j * phase) for the phase corrections
+ * applied in the per-pixel loops of geocoding, resampling and interferometry.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+
+namespace isce3 { namespace math {
+
+/** Largest |phase| (rad) handled by the vectorized kernel. Larger or
+ * non-finite phases fall back to std::sin and std::cos. */
+constexpr static double SINCOS_MAX_PHASE = 536870912.0; // 2^29
+
+/** Number of samples between the directly evaluated phasors of
+ * linearPhasors */
+constexpr static std::size_t LINEAR_PHASOR_ANCHOR_INTERVAL = 64;
+
+/**
+ * Compute the sine and cosine of an array of phases.
+ *
+ * The phases are reduced to [-pi/4, pi/4] with a four-part Cody-Waite
+ * reduction and evaluated with the fdlibm kernel polynomials, in a branch-free
+ * loop that the compiler vectorizes. For |x| <= SINCOS_MAX_PHASE the absolute
+ * error is below 2.5e-16, i.e. about 1 ulp of 1, independently of |x|; other
+ * values are computed with std::sin and std::cos.
+ *
+ * @param[in]  x    phases (rad)
+ * @param[out] s    sin(x), may alias x
+ * @param[out] c    cos(x), may alias x but not s
+ * @param[in]  n    number of phases
+ */
+void sincos(const double* x, double* s, double* c, std::size_t n);
+
+/**
+ * Compute exp(1j * phase) for an array of phases, see sincos for the accuracy.
+ *
+ * @param[in]  phase    phases (rad)
+ * @param[out] out      unit phasors
+ * @param[in]  n        number of phases
+ */
+void unitPhasors(const double* phase, std::complex<double>* out,
+                 std::size_t n);
+
+/** \copydoc unitPhasors(const double*, std::complex<double>*, std::size_t) */
+void unitPhasors(const double* phase, std::complex<float>* out,
+                 std::size_t n);
+
+/**
+ * Multiply an array by exp(1j * phase), i.e. rotate each sample by its phase.
+ *
+ * @param[in,out] data      samples to rotate
+ * @param[in]     phase     phases (rad)
+ * @param[in]     n         number of samples
+ */
+void rotate(std::complex<float>* data, const double* phase, std::size_t n);
+
+/** \copydoc rotate(std::complex<float>*, const double*, std::size_t) */
+void rotate(std::complex<double>* data, const double* phase, std::size_t n);
+
+/**
+ * Compute the phasors of a linear phase, out[i] = exp(1j * (phase0 + i *
+ * dphase)), by the rotation recurrence out[i + 1] = out[i] * exp(1j * dphase).
+ *
+ * Every anchorInterval samples the phasor is evaluated directly, which also
+ * restores its unit magnitude. The recurrence is done in double precision, so
+ * each step adds at most 4 ulp (about 9e-16) of error and the absolute error
+ * is below 9e-16 * anchorInterval, i.e. 6e-14 for the default interval, plus
+ * the rounding error of phase0 + i * dphase in double precision.
+ *
+ * @param[in]  phase0           phase of the first sample (rad)
+ * @param[in]  dphase           phase increment between samples (rad)
+ * @param[out] out              phasors
+ * @param[in]  n                number of samples
+ * @param[in]  anchorInterval   number of samples between directly evaluated
+ *                              phasors
+ */
+void linearPhasors(double phase0, double dphase, std::complex<double>* out,
+        std::size_t n,
+        std::size_t anchorInterval = LINEAR_PHASOR_ANCHOR_INTERVAL);
+
+/** \copydoc linearPhasors(double, double, std::complex<double>*, std::size_t, std::size_t) */
+void linearPhasors(double phase0, double dphase, std::complex<float>* out,
+        std::size_t n,
+        std::size_t anchorInterval = LINEAR_PHASOR_ANCHOR_INTERVAL);
+
+}} // namespace isce3::math
@@ -0,0 +1,199 @@
+#include "covariance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <isce3/core/TypeTraits.h>
+#include <isce3/core/detail/BlockPipeline.h>
+
+#include "detail/RasterBlocks.h"
+
+namespace isce3 { namespace polsar {
+
+using isce3::core::detail::pipelineSlots;
+using isce3::core::detail::runBlockPipeline;
+
+template<typename T>
+void _polarimetricMatrix(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster, isce3::io::Raster* diag_raster,
+        isce3::io::Raster* off_diag_raster, PolMatrixType matrix_type,
+        const int nlooks_range, const int nlooks_azimuth, const int nblocks,
+        const long block_length_looked, const bool overlap_io)
+{
+    using R = typename isce3::real<T>::type;
+
+    const long width = hh_raster.width();
+    const long length_looked = hh_raster.length() / nlooks_azimuth;
+    const long width_looked = width / nlooks_range;
+    const int nslots = pipelineSlots(nblocks, overlap_io);
+    const std::size_t input_size = block_length_looked * nlooks_azimuth * width;
+    const std::size_t output_size = block_length_looked * width_looked;
+
+    // Buffers of one block: the input channels and the three diagonal and
+    // three off-diagonal elements
+    struct Slot {
+        std::vector<T> hh, hv, vh, vv;
+        std::vector<std::vector<R>> diag;
+        std::vector<std::vector<T>> off_diag;
+    };
+    std::vector<Slot> slots(nslots);
+    for (auto& slot : slots) {
+        slot.hh.resize(input_size);
+        slot.hv.resize(input_size);
+        slot.vh.resize(input_size);
+        slot.vv.resize(input_size);
+        if (diag_raster != nullptr) {
+            slot.diag.assign(3, std::vector<R>(output_size));
+        }
+        if (off_diag_raster != nullptr) {
+            slot.off_diag.assign(3, std::vector<T>(output_size));
+        }
+    }
+
+    auto read = [&](int, int slot_index, long y0_looked,
+                        long block_length_looked) {
+        auto& slot = slots[slot_index];
+        const long y0 = y0_looked * nlooks_azimuth;
+        const long block_length = block_length_looked * nlooks_azimuth;
+        hh_raster.getBlock(slot.hh.data(), 0, y0, width, block_length, 1);
+        hv_raster.getBlock(slot.hv.data(), 0, y0, width, block_length, 1);
+        vh_raster.getBlock(slot.vh.data(), 0, y0, width, block_length, 1);
+        vv_raster.getBlock(slot.vv.data(), 0, y0, width, block_length, 1);
+    };
+
+    // Each output line accumulates its window of looks in double precision
+    // directly from the channels, so that no full-resolution element is
+    // stored
+    auto compute = [&](int slot_index, long i) {
+        auto& slot = slots[slot_index];
+        const double sqrt2 = std::sqrt(2.0);
+        const double nlooks = static_cast<double>(nlooks_range) *
+                              nlooks_azimuth;
+        for (long j = 0; j < width_looked; ++j) {
+            double m11 = 0, m22 = 0, m33 = 0;
+            std::complex<double> m12 = 0, m13 = 0, m23 = 0;
+            for (long ii = i * nlooks_azimuth; ii < (i + 1) * nlooks_azimuth;
+                    ++ii) {
+                const long k0 = ii * width + j * nlooks_range;
+                for (long k = k0; k < k0 + nlooks_range; ++k) {
+                    const std::complex<double> hh = slot.hh[k];
+                    const std::complex<double> vv = slot.vv[k];
+                    const std::complex<double> hv =
+                            0.5 * (std::complex<double>(slot.hv[k]) +
+                                    std::complex<double>(slot.vh[k]));
+                    std::complex<double> k1, k2, k3;
+                    if (matrix_type == PolMatrixType::Covariance) {
+                        k1 = hh;
+                        k2 = sqrt2 * hv;
+                        k3 = vv;
+                    } else {
+                        k1 = (hh + vv) / sqrt2;
+                        k2 = (hh - vv) / sqrt2;
+                        k3 = sqrt2 * hv;
+                    }
+                    m11 += std::norm(k1);
+                    m22 += std::norm(k2);
+                    m33 += std::norm(k3);
+                    m12 += k1 * std::conj(k2);
+                    m13 += k1 * std::conj(k3);
+                    m23 += k2 * std::conj(k3);
+                }
+            }
+            const long k_out = i * width_looked + j;
+            if (diag_raster != nullptr) {
+                slot.diag[0][k_out] = static_cast<R>(m11 / nlooks);
+                slot.diag[1][k_out] = static_cast<R>(m22 / nlooks);
+                slot.diag[2][k_out] = static_cast<R>(m33 / nlooks);
+            }
+            if (off_diag_raster != nullptr) {
+                slot.off_diag[0][k_out] = static_cast<T>(m12 / nlooks);
+                slot.off_diag[1][k_out] = static_cast<T>(m13 / nlooks);
+                slot.off_diag[2][k_out] = static_cast<T>(m23 / nlooks);
+            }
+        }
+    };
+
+    auto write = [&](int, int slot_index, long y0_looked,
+                         long block_length_looked) {
+        auto& slot = slots[slot_index];
+        for (std::size_t band = 0; band < slot.diag.size(); ++band) {
+            diag_raster->setBlock(slot.diag[band].data(), 0, y0_looked,
+                    width_looked, block_length_looked, band + 1);
+        }
+        for (std::size_t band = 0; band < slot.off_diag.size(); ++band) {
+            off_diag_raster->setBlock(slot.off_diag[band].data(), 0,
+                    y0_looked, width_looked, block_length_looked, band + 1);
+        }
+    };
+
+    runBlockPipeline(nblocks, block_length_looked, length_looked,
+            overlap_io, read, compute, write);
+}
+
+void polarimetricMatrix(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster, isce3::io::Raster* diag_raster,
+        isce3::io::Raster* off_diag_raster, PolMatrixType matrix_type,
+        int nlooks_range, int nlooks_azimuth,
+        isce3::core::MemoryModeBlocksY memory_mode, bool overlap_io,
+        long long min_block_size, long long max_block_size)
+{
+
+    pyre::journal::info_t info("isce3.polsar.polarimetricMatrix");
+
+    info << "Forming the polarimetric "
+         << (matrix_type == PolMatrixType::Covariance ? "covariance (C3)"
+                                                      : "coherency (T3)")
+         << " matrix with " << nlooks_range << " x " << nlooks_azimuth
+         << " (range x azimuth) looks" << pyre::journal::endl;
+
+    if (nlooks_range < 1 || nlooks_azimuth < 1) {
+        std::string error_msg = "ERROR the number of looks should be"
+                                " positive";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    detail::validateQuadPolRasters(hh_raster, hv_raster, vh_raster, vv_raster);
+
+    const long length_looked = hh_raster.length() / nlooks_azimuth;
+    const long width_looked = hh_raster.width() / nlooks_range;
+    if (length_looked < 1 || width_looked < 1) {
+        std::string error_msg = "ERROR the number of looks exceeds the"
+                                " dimensions of the input rasters";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    detail::validateOutputRaster(
+            diag_raster, "diagonal", 3, length_looked, width_looked);
+    detail::validateOutputRaster(
+            off_diag_raster, "off-diagonal", 3, length_looked, width_looked);
+    if (off_diag_raster != nullptr &&
+            !GDALDataTypeIsComplex(off_diag_raster->dtype(1))) {
+        std::string error_msg = "ERROR the off-diagonal raster should be"
+                                " complex";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    // Reads and writes of the same dataset are not overlapped
+    overlap_io = detail::overlapIO(overlap_io,
+            {&hh_raster, &hv_raster, &vh_raster, &vv_raster},
+            {diag_raster, off_diag_raster});
+
+    // Blocks hold whole windows of azimuth looks, so they are divided in
+    // output lines of four input channels of nlooks_azimuth lines each
+    int block_length_looked, nblocks;
+    detail::getBlockParameters(memory_mode, length_looked, hh_raster.width(),
+            4 * nlooks_azimuth, GDALGetDataTypeSizeBytes(hh_raster.dtype(1)),
+            overlap_io, info, &block_length_looked, &nblocks, min_block_size,
+            max_block_size);
+
+    detail::dispatchDataType<true>(hh_raster.dtype(1), [&](auto zero) {
+        _polarimetricMatrix<decltype(zero)>(hh_raster, hv_raster, vh_raster,
+                vv_raster, diag_raster, off_diag_raster, matrix_type,
+                nlooks_range, nlooks_azimuth, nblocks, block_length_looked,
+                overlap_io);
+    });
+}
+}} // namespace isce3::polsar
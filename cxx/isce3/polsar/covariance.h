@@ -0,0 +1,69 @@
+#pragma once
+
+#include <isce3/core/Constants.h>
+#include <isce3/core/blockProcessing.h>
+#include <isce3/io/Raster.h>
+
+namespace isce3 { namespace polsar {
+
+/** Polarimetric matrix formed from quad-pol channels */
+enum class PolMatrixType {
+    Covariance, /**< covariance matrix C3, from the lexicographic vector
+                     [HH, sqrt(2) HV, VV] */
+    Coherency,  /**< coherency matrix T3, from the Pauli vector
+                     [HH + VV, HH - VV, 2 HV] / sqrt(2) */
+};
+
+/** Form the multilooked covariance (C3) or coherency (T3) matrix of
+ * quad-pol data in a single pass.
+ *
+ * Each block of the four channels is read once, the cross-polarimetric
+ * channels are symmetrized as the average of HV and VH, and all the
+ * elements of the upper triangle of the matrix are accumulated over each
+ * window of looks while the block is in memory. As with
+ * isce3::signal::Looks, the output has length / nlooks_azimuth lines and
+ * width / nlooks_range columns, the remaining input lines and columns being
+ * dropped.
+ *
+ * The diagonal and off-diagonal elements are written to separate rasters,
+ * with the layout of the diagonal and off-diagonal terms of GeocodeCov, so
+ * that each can be geocoded band by band:
+ * - diagonal: M11, M22 and M33, in three real bands;
+ * - off-diagonal: M12, M13 and M23, in three complex bands.
+ *
+ * All the input channels are read from band 1 of complex rasters of the
+ * same data type.
+ *
+ * @param[in]  hh_raster           Raster containing the HH polarization
+ * channel
+ * @param[in]  hv_raster           Raster containing the HV polarization
+ * channel
+ * @param[in]  vh_raster           Raster containing the VH polarization
+ * channel
+ * @param[in]  vv_raster           Raster containing the VV polarization
+ * channel
+ * @param[out] diag_raster         Output diagonal elements, or nullptr
+ * @param[out] off_diag_raster     Output off-diagonal elements, or nullptr
+ * @param[in]  matrix_type         Covariance (C3) or coherency (T3) matrix
+ * @param[in]  nlooks_range        Number of looks in range
+ * @param[in]  nlooks_azimuth      Number of looks in azimuth
+ * @param[in]  memory_mode         Memory mode. Option AutoBlocksY (default)
+ * is equivalent to MultipleBlocksY.
+ * @param[in]  overlap_io          Read the next block and write the previous
+ * one while the current block is processed
+ * @param[in]  min_block_size      Minimum block size in bytes (per thread)
+ * @param[in]  max_block_size      Maximum block size in bytes (per thread)
+ */
+void polarimetricMatrix(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster, isce3::io::Raster* diag_raster,
+        isce3::io::Raster* off_diag_raster,
+        PolMatrixType matrix_type = PolMatrixType::Covariance,
+        int nlooks_range = 1, int nlooks_azimuth = 1,
+        isce3::core::MemoryModeBlocksY memory_mode =
+                isce3::core::MemoryModeBlocksY::AutoBlocksY,
+        bool overlap_io = true,
+        long long min_block_size = isce3::core::DEFAULT_MIN_BLOCK_SIZE,
+        long long max_block_size = isce3::core::DEFAULT_MAX_BLOCK_SIZE);
+
+}} // namespace isce3::polsar
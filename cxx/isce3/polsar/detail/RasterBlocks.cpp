@@ -0,0 +1,137 @@
+#include "RasterBlocks.h"
+
+namespace isce3 { namespace polsar { namespace detail {
+
+void validateRasters(isce3::io::Raster& raster_a,
+        const std::string& raster_a_name, int raster_a_band,
+        isce3::io::Raster& raster_b, const std::string& raster_b_name,
+        int raster_b_band)
+{
+    std::string error_msg;
+
+    if (raster_a_band < 1 || raster_a_band > raster_a.numBands()) {
+        error_msg = " Invalid band for " + raster_a_name + ": " +
+                    std::to_string(raster_a_band);
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    if (raster_b_band < 1 || raster_b_band > raster_b.numBands()) {
+        error_msg = " Invalid band for " + raster_b_name + ": " +
+                    std::to_string(raster_b_band);
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    error_msg = "ERROR the ";
+    error_msg += raster_a_name;
+    error_msg += " and ";
+    error_msg += raster_b_name;
+
+    if (raster_a.length() != raster_b.length()) {
+        error_msg += " raster dimensions to not match";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    if (raster_a.width() != raster_b.width()) {
+        error_msg += " raster dimensions to not match";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+
+    if (GDALDataTypeIsComplex(raster_a.dtype(raster_a_band)) xor
+            GDALDataTypeIsComplex(raster_b.dtype(raster_b_band))) {
+        error_msg += " raster data type to not match";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+}
+
+void validateQuadPolRasters(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster)
+{
+    validateRasters(hh_raster, "HH", 1, hv_raster, "HV", 1);
+    validateRasters(hh_raster, "HH", 1, vh_raster, "VH", 1);
+    validateRasters(hh_raster, "HH", 1, vv_raster, "VV", 1);
+    if (!GDALDataTypeIsComplex(hh_raster.dtype(1))) {
+        std::string error_msg = "ERROR the HH, HV, VH and VV rasters should"
+                                " be complex";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    if (hv_raster.dtype(1) != hh_raster.dtype(1) ||
+            vh_raster.dtype(1) != hh_raster.dtype(1) ||
+            vv_raster.dtype(1) != hh_raster.dtype(1)) {
+        std::string error_msg = "ERROR the HH, HV, VH and VV rasters should"
+                                " have the same data type";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+}
+
+void validateOutputRaster(isce3::io::Raster* raster,
+        const std::string& raster_name, std::size_t nbands, long length,
+        long width)
+{
+    if (raster == nullptr) {
+        return;
+    }
+    std::string error_msg = "ERROR the " + raster_name + " raster";
+    if (static_cast<long>(raster->length()) != length ||
+            static_cast<long>(raster->width()) != width) {
+        error_msg += " should have " + std::to_string(length) + " lines and " +
+                     std::to_string(width) + " columns";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+    if (raster->numBands() < nbands) {
+        error_msg += " should have at least " + std::to_string(nbands) +
+                     " band(s)";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+    }
+}
+
+bool shareDataset(
+        const isce3::io::Raster* raster_a, const isce3::io::Raster* raster_b)
+{
+    return raster_a != nullptr && raster_b != nullptr &&
+           raster_a->sharesDataset(*raster_b);
+}
+
+bool overlapIO(bool overlap_io,
+        std::initializer_list<const isce3::io::Raster*> inputs,
+        std::initializer_list<const isce3::io::Raster*> outputs)
+{
+    for (auto output : outputs) {
+        for (auto input : inputs) {
+            if (shareDataset(input, output)) {
+                return false;
+            }
+        }
+    }
+    return overlap_io;
+}
+
+void getBlockParameters(isce3::core::MemoryModeBlocksY memory_mode,
+        long length, long width, int nbands, int type_size, bool overlap_io,
+        pyre::journal::info_t& info, int* block_length, int* nblocks,
+        long long min_block_size, long long max_block_size)
+{
+    if (memory_mode == isce3::core::MemoryModeBlocksY::SingleBlockY) {
+        *nblocks = 1;
+        *block_length = static_cast<int>(length);
+        return;
+    }
+
+    // account for the buffers of all the slots of the pipeline
+    const int nslots = overlap_io ? 3 : 1;
+
+    // a block holds at least one line, even if larger than the max size
+    const long long line_size =
+            static_cast<long long>(nslots) * nbands * width * type_size;
+    if (max_block_size < line_size) {
+        *nblocks = static_cast<int>(length);
+        *block_length = 1;
+        info << "number of block(s): " << *nblocks << pyre::journal::newline
+             << "block length: 1" << pyre::journal::endl;
+        return;
+    }
+
+    isce3::core::getBlockProcessingParametersY(length, width, nslots * nbands,
+            type_size, &info, block_length, nblocks, min_block_size,
+            max_block_size);
+}
+
+}}} // namespace isce3::polsar::detail
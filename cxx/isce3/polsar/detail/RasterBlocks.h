@@ -0,0 +1,96 @@
+#pragma once
+
+#include <complex>
+#include <initializer_list>
+#include <string>
+
+#include <isce3/core/blockProcessing.h>
+#include <isce3/except/Error.h>
+#include <isce3/io/Raster.h>
+
+namespace isce3 { namespace polsar { namespace detail {
+
+/** Check that two bands of two rasters exist, that the rasters have the
+ * same dimensions, and that both or none of the bands are complex */
+void validateRasters(isce3::io::Raster& raster_a,
+        const std::string& raster_a_name, int raster_a_band,
+        isce3::io::Raster& raster_b, const std::string& raster_b_name,
+        int raster_b_band);
+
+/** Check that the HV, VH and VV rasters have the dimensions of the HH
+ * raster, and that band 1 of the four rasters is complex with the same data
+ * type */
+void validateQuadPolRasters(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster);
+
+/** Check that an output raster, if not null, has the given dimensions and
+ * at least nbands bands */
+void validateOutputRaster(isce3::io::Raster* raster,
+        const std::string& raster_name, std::size_t nbands, long length,
+        long width);
+
+/** Whether two rasters, if not null, share a GDAL dataset or a file, in
+ * which case they should not be read and written concurrently */
+bool shareDataset(
+        const isce3::io::Raster* raster_a, const isce3::io::Raster* raster_b);
+
+/** Disable the overlap of reads and writes if any output raster shares its
+ * data with an input raster. Null rasters are ignored. */
+bool overlapIO(bool overlap_io,
+        std::initializer_list<const isce3::io::Raster*> inputs,
+        std::initializer_list<const isce3::io::Raster*> outputs);
+
+/** Divide the lines to process in blocks according to the memory mode
+ *
+ * @param[in]  memory_mode     Memory mode. AutoBlocksY is equivalent to
+ * MultipleBlocksY.
+ * @param[in]  length          Number of lines to process
+ * @param[in]  width           Number of samples of each buffer line
+ * @param[in]  nbands          Number of buffer lines per processed line,
+ * for one slot of the block pipeline
+ * @param[in]  type_size       Size of a buffer sample in bytes
+ * @param[in]  overlap_io      Whether the block pipeline overlaps I/O and
+ * holds three slots of buffers
+ * @param[in]  info            Pyre info channel
+ * @param[out] block_length    Number of lines of each block
+ * @param[out] nblocks         Number of blocks
+ * @param[in]  min_block_size  Minimum block size in bytes (per thread)
+ * @param[in]  max_block_size  Maximum block size in bytes (per thread)
+ */
+void getBlockParameters(isce3::core::MemoryModeBlocksY memory_mode,
+        long length, long width, int nbands, int type_size, bool overlap_io,
+        pyre::journal::info_t& info, int* block_length, int* nblocks,
+        long long min_block_size = isce3::core::DEFAULT_MIN_BLOCK_SIZE,
+        long long max_block_size = isce3::core::DEFAULT_MAX_BLOCK_SIZE);
+
+/** Call f(T()) where T is the C++ type of a GDAL data type: float, double,
+ * std::complex<float> or std::complex<double>, or only the complex ones if
+ * ComplexOnly is true */
+template<bool ComplexOnly = false, class F>
+void dispatchDataType(GDALDataType dtype, F&& f)
+{
+    if (dtype == GDT_CFloat32) {
+        f(std::complex<float>());
+        return;
+    }
+    if (dtype == GDT_CFloat64) {
+        f(std::complex<double>());
+        return;
+    }
+    if constexpr (!ComplexOnly) {
+        if (dtype == GDT_Float32) {
+            f(float());
+            return;
+        }
+        if (dtype == GDT_Float64) {
+            f(double());
+            return;
+        }
+    }
+    std::string error_message =
+            "ERROR not implemented for input raster datatype";
+    throw isce3::except::RuntimeError(ISCE_SRCINFO(), error_message);
+}
+
+}}} // namespace isce3::polsar::detail
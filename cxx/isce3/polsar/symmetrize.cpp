@@ -1,88 +1,172 @@
 #include "symmetrize.h"
 
-#include <isce3/core/DenseMatrix.h>
-#include <isce3/math/complexOperations.h>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <isce3/core/TypeTraits.h>
+#include <isce3/core/detail/BlockPipeline.h>
+
+#include "detail/RasterBlocks.h"
 
 namespace isce3 { namespace polsar {
 
-static void _validate_rasters(isce3::io::Raster& raster_a,
-        std::string raster_a_name, int raster_a_band,
-        isce3::io::Raster& raster_b, std::string raster_b_name,
-        int raster_b_band)
-{
-    std::string error_msg;
+using isce3::core::detail::pipelineSlots;
+using isce3::core::detail::runBlockPipeline;
 
-    if (raster_a_band < 1 || raster_a_band > raster_a.numBands()) {
-        error_msg = " Invalid band for " + raster_a_name + ": " +
-                    std::to_string(raster_a_band);
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
-    if (raster_b_band < 1 || raster_b_band > raster_b.numBands()) {
-        error_msg = " Invalid band for " + raster_b_name + ": " +
-                    std::to_string(raster_b_band);
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
+template<typename T>
+void _symmetrizeCrossPolChannels(isce3::io::Raster* hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster* vv_raster, isce3::io::Raster* output_raster,
+        const FusedPolProducts& products, const int hv_raster_band,
+        const int vh_raster_band, const int output_raster_band,
+        const int nblocks, const long block_length, const bool overlap_io)
+{
+    using R = typename isce3::real<T>::type;
+
+    const long width = hv_raster.width();
+    const long length = hv_raster.length();
+    const bool fused = hh_raster != nullptr;
+    const int nslots = pipelineSlots(nblocks, overlap_io);
+    const std::size_t block_size = block_length * width;
+
+    // Buffers of one block
+    struct Slot {
+        std::vector<T> hh, hv, vh, vv, output;
+        std::vector<R> span;
+        std::vector<std::vector<T>> pauli, covariance;
+    };
+    std::vector<Slot> slots(nslots);
+    for (auto& slot : slots) {
+        slot.hv.resize(block_size);
+        slot.vh.resize(block_size);
+        if (fused) {
+            slot.hh.resize(block_size);
+            slot.vv.resize(block_size);
+        }
+        if (output_raster != nullptr) {
+            slot.output.resize(block_size);
+        }
+        if (products.span != nullptr) {
+            slot.span.resize(block_size);
+        }
+        if (products.pauli != nullptr) {
+            slot.pauli.assign(3, std::vector<T>(block_size));
+        }
+        if (products.covariance != nullptr) {
+            slot.covariance.assign(6, std::vector<T>(block_size));
+        }
     }
 
-    error_msg = "ERROR the ";
-    error_msg += raster_a_name;
-    error_msg += " and ";
-    error_msg += raster_b_name;
+    auto read = [&](int, int slot_index, long y0, long block_length) {
+        auto& slot = slots[slot_index];
+        hv_raster.getBlock(slot.hv.data(), 0, y0, width, block_length,
+                hv_raster_band);
+        vh_raster.getBlock(slot.vh.data(), 0, y0, width, block_length,
+                vh_raster_band);
+        if (fused) {
+            hh_raster->getBlock(
+                    slot.hh.data(), 0, y0, width, block_length, 1);
+            vv_raster->getBlock(
+                    slot.vv.data(), 0, y0, width, block_length, 1);
+        }
+    };
+
+    auto compute = [&](int slot_index, long i) {
+        auto& slot = slots[slot_index];
+        const R half = 0.5;
+        for (long k = i * width; k < (i + 1) * width; ++k) {
+            const T hv = half * (slot.hv[k] + slot.vh[k]);
+            if (output_raster != nullptr) {
+                slot.output[k] = hv;
+            }
+            if constexpr (isce3::is_complex<T>::value) {
+                if (!fused) {
+                    continue;
+                }
+                const R sqrt2 = std::sqrt(R(2));
+                const T hh = slot.hh[k];
+                const T vv = slot.vv[k];
+                if (products.span != nullptr) {
+                    slot.span[k] = std::norm(hh) + 2 * std::norm(hv) +
+                                   std::norm(vv);
+                }
+                if (products.pauli != nullptr) {
+                    slot.pauli[0][k] = (hh + vv) / sqrt2;
+                    slot.pauli[1][k] = (hh - vv) / sqrt2;
+                    slot.pauli[2][k] = sqrt2 * hv;
+                }
+                if (products.covariance != nullptr) {
+                    slot.covariance[0][k] = std::norm(hh);
+                    slot.covariance[1][k] = sqrt2 * hh * std::conj(hv);
+                    slot.covariance[2][k] = hh * std::conj(vv);
+                    slot.covariance[3][k] = 2 * std::norm(hv);
+                    slot.covariance[4][k] = sqrt2 * hv * std::conj(vv);
+                    slot.covariance[5][k] = std::norm(vv);
+                }
+            }
+        }
+    };
 
-    if (raster_a.length() != raster_b.length()) {
-        error_msg += " raster dimensions to not match";
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
-    if (raster_a.width() != raster_b.width()) {
-        error_msg += " raster dimensions to not match";
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
+    auto write = [&](int, int slot_index, long y0, long block_length) {
+        auto& slot = slots[slot_index];
+        if (output_raster != nullptr) {
+            output_raster->setBlock(slot.output.data(), 0, y0, width,
+                    block_length, output_raster_band);
+        }
+        if (products.span != nullptr) {
+            products.span->setBlock(
+                    slot.span.data(), 0, y0, width, block_length, 1);
+        }
+        for (std::size_t band = 0; band < slot.pauli.size(); ++band) {
+            products.pauli->setBlock(slot.pauli[band].data(), 0, y0, width,
+                    block_length, band + 1);
+        }
+        for (std::size_t band = 0; band < slot.covariance.size(); ++band) {
+            products.covariance->setBlock(slot.covariance[band].data(), 0,
+                    y0, width, block_length, band + 1);
+        }
+    };
 
-    if (GDALDataTypeIsComplex(raster_a.dtype(raster_a_band)) xor
-            GDALDataTypeIsComplex(raster_b.dtype(raster_b_band))) {
-        error_msg += " raster data type to not match";
-        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), error_msg);
-    }
+    runBlockPipeline(nblocks, block_length, length, overlap_io,
+            read, compute, write);
 }
 
-template<typename T>
-void _symmetrizeCrossPolChannels(isce3::io::Raster& hv_raster,
-        isce3::io::Raster& vh_raster, isce3::io::Raster& output_raster,
-        const long x0, const long block_width, const long y0,
-        const long block_length, const int hv_raster_band,
-        const int vh_raster_band, const int output_raster_band)
+// Block division and data type dispatch shared by the symmetrization
+// entry points
+static void _runSymmetrization(isce3::io::Raster* hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster* vv_raster, isce3::io::Raster* output_raster,
+        const FusedPolProducts& products,
+        isce3::core::MemoryModeBlocksY memory_mode, int hv_raster_band,
+        int vh_raster_band, int output_raster_band, bool overlap_io,
+        int nbuffers, pyre::journal::info_t& info)
 {
+    // Reads and writes of the same dataset are not overlapped
+    overlap_io = detail::overlapIO(overlap_io,
+            {hh_raster, &hv_raster, &vh_raster, vv_raster},
+            {output_raster, products.span, products.pauli,
+                    products.covariance});
 
-    using namespace isce3::math::complex_operations;
-
-    // Read HV array
-    isce3::core::Matrix<T> hv_array(block_length, block_width);
-    hv_raster.getBlock(
-            hv_array.data(), x0, y0, block_width, block_length, hv_raster_band);
-
-    // Read VH array
-    isce3::core::Matrix<T> vh_array(block_length, block_width);
-    vh_raster.getBlock(
-            vh_array.data(), x0, y0, block_width, block_length, vh_raster_band);
-
-    // Compute output
-    isce3::core::Matrix<T> output_array(block_length, block_width);
-    _Pragma("omp parallel for schedule(dynamic)") for (long i = 0;
-                                                       i < block_length; ++i)
-    {
-        for (long j = 0; j < block_width; ++j) {
-            output_array(i, j) = 0.5 * (hv_array(i, j) + vh_array(i, j));
-        }
-    }
-
-    // Set output block
-    output_raster.setBlock(output_array.data(), x0, y0, block_width,
-            block_length, output_raster_band);
+    int block_length, nblocks;
+    detail::getBlockParameters(memory_mode, hv_raster.length(),
+            hv_raster.width(), nbuffers,
+            GDALGetDataTypeSizeBytes(hv_raster.dtype(hv_raster_band)),
+            overlap_io, info, &block_length, &nblocks);
+
+    detail::dispatchDataType(hv_raster.dtype(hv_raster_band), [&](auto zero) {
+        _symmetrizeCrossPolChannels<decltype(zero)>(hh_raster, hv_raster,
+                vh_raster, vv_raster, output_raster, products,
+                hv_raster_band, vh_raster_band, output_raster_band, nblocks,
+                block_length, overlap_io);
+    });
 }
 
 void symmetrizeCrossPolChannels(isce3::io::Raster& hv_raster,
         isce3::io::Raster& vh_raster, isce3::io::Raster& output_raster,
         isce3::core::MemoryModeBlocksY memory_mode, int hv_raster_band,
-        int vh_raster_band, int output_raster_band)
+        int vh_raster_band, int output_raster_band, bool overlap_io)
 {
 
     pyre::journal::info_t info("isce3.polsar.symmetrizeCrossPolChannels");
@@ -90,65 +174,48 @@ void symmetrizeCrossPolChannels(isce3::io::Raster& hv_raster,
     info << "Symmetrizing cross-polarimetric channels (HV and VH)"
          << pyre::journal::endl;
 
-    _validate_rasters(
+    detail::validateRasters(
             hv_raster, "HV", hv_raster_band, vh_raster, "VH", vh_raster_band);
-    _validate_rasters(hv_raster, "HV", hv_raster_band, output_raster, "output",
-            output_raster_band);
-
-    const long x0 = 0;
-    auto block_width = hv_raster.width();
-    int block_length, nblocks;
-
-    switch (memory_mode) {
-    case isce3::core::MemoryModeBlocksY::SingleBlockY:
-        nblocks = 1;
-        block_length = static_cast<int>(hv_raster.length());
-        break;
-    case isce3::core::MemoryModeBlocksY::AutoBlocksY: [[fallthrough]];
-    case isce3::core::MemoryModeBlocksY::MultipleBlocksY:
-        const int out_nbands = 1;
-        isce3::core::getBlockProcessingParametersY(hv_raster.length(),
-                hv_raster.width(), out_nbands,
-                GDALGetDataTypeSizeBytes(hv_raster.dtype()), &info,
-                &block_length, &nblocks);
-    }
+    detail::validateRasters(hv_raster, "HV", hv_raster_band, output_raster,
+            "output", output_raster_band);
+
+    // HV, VH and output
+    const int nbuffers = 3;
+    _runSymmetrization(nullptr, hv_raster, vh_raster, nullptr, &output_raster,
+            FusedPolProducts(), memory_mode, hv_raster_band, vh_raster_band,
+            output_raster_band, overlap_io, nbuffers, info);
+}
 
-    for (int block = 0; block < nblocks; ++block) {
+void symmetrizeCrossPolChannels(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster, isce3::io::Raster* output_raster,
+        const FusedPolProducts& products,
+        isce3::core::MemoryModeBlocksY memory_mode, bool overlap_io)
+{
 
-        const long y0 = block * block_length;
-        int this_block_length = block_length;
-        if ((block + 1) * block_length > hv_raster.length()) {
-            this_block_length = hv_raster.length() % block_length;
-        }
+    pyre::journal::info_t info("isce3.polsar.symmetrizeCrossPolChannels");
 
-        if (nblocks > 1) {
-            info << "symmetrizing block: " << block + 1 << "/" << nblocks
-                 << pyre::journal::endl;
-        }
+    info << "Symmetrizing cross-polarimetric channels (HV and VH) and"
+         << " forming the polarimetric products" << pyre::journal::endl;
 
-        if (hv_raster.dtype() == GDT_Float32)
-            _symmetrizeCrossPolChannels<float>(hv_raster, vh_raster,
-                    output_raster, x0, block_width, y0, this_block_length,
-                    hv_raster_band, vh_raster_band, output_raster_band);
-        else if (hv_raster.dtype() == GDT_Float64)
-            _symmetrizeCrossPolChannels<double>(hv_raster, vh_raster,
-                    output_raster, x0, block_width, y0, this_block_length,
-                    hv_raster_band, vh_raster_band, output_raster_band);
-        else if (hv_raster.dtype() == GDT_CFloat32)
-            _symmetrizeCrossPolChannels<std::complex<float>>(hv_raster,
-                    vh_raster, output_raster, x0, block_width, y0,
-                    this_block_length, hv_raster_band, vh_raster_band,
-                    output_raster_band);
-        else if (hv_raster.dtype() == GDT_CFloat64)
-            _symmetrizeCrossPolChannels<std::complex<double>>(hv_raster,
-                    vh_raster, output_raster, x0, block_width, y0,
-                    this_block_length, hv_raster_band, vh_raster_band,
-                    output_raster_band);
-        else {
-            std::string error_message =
-                    "ERROR not implemented for input raster datatype";
-            throw isce3::except::RuntimeError(ISCE_SRCINFO(), error_message);
-        }
+    detail::validateQuadPolRasters(hh_raster, hv_raster, vh_raster, vv_raster);
+    if (output_raster != nullptr) {
+        detail::validateRasters(
+                hv_raster, "HV", 1, *output_raster, "output", 1);
     }
+    const long length = hv_raster.length(), width = hv_raster.width();
+    detail::validateOutputRaster(products.span, "span", 1, length, width);
+    detail::validateOutputRaster(products.pauli, "Pauli", 3, length, width);
+    detail::validateOutputRaster(
+            products.covariance, "covariance", 6, length, width);
+
+    // input channels, symmetrized channel and product bands
+    const int nbuffers = 4 + (output_raster != nullptr) +
+                         (products.span != nullptr) +
+                         3 * (products.pauli != nullptr) +
+                         6 * (products.covariance != nullptr);
+    _runSymmetrization(&hh_raster, hv_raster, vh_raster, &vv_raster,
+            output_raster, products, memory_mode, 1, 1, 1, overlap_io,
+            nbuffers, info);
 }
 }} // namespace isce3::polsar
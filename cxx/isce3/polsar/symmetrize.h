@@ -6,6 +6,24 @@
 
 namespace isce3 { namespace polsar {
 
+/** Polarimetric products formed in the same pass as the cross-polarimetric
+ * symmetrization. Products whose raster is not set are not computed.
+ *
+ * With the symmetrized cross-polarimetric channel HV, the products are
+ * defined from the lexicographic vector [HH, sqrt(2) HV, VV] and the Pauli
+ * vector [HH + VV, HH - VV, 2 HV] / sqrt(2).
+ */
+struct FusedPolProducts {
+    /** Total power |HH|^2 + 2 |HV|^2 + |VV|^2, one real band */
+    isce3::io::Raster* span = nullptr;
+    /** Pauli components (HH + VV) / sqrt(2), (HH - VV) / sqrt(2) and
+     * sqrt(2) HV, in three complex bands */
+    isce3::io::Raster* pauli = nullptr;
+    /** Upper triangle of the single-look covariance matrix C3, i.e. C11,
+     * C12, C13, C22, C23 and C33, in six complex bands */
+    isce3::io::Raster* covariance = nullptr;
+};
+
 /** Symmetrize cross-polarimetric channels.
  *
  * The current implementation considers that the cross-polarimetric
@@ -26,11 +44,46 @@ namespace isce3 { namespace polsar {
  * polarization channel within the `vh_raster`
  * @param[in]  output_band         Band (starting from 1) that will contain
  * the symmetrized cross-polarimetric channel
+ * @param[in]  overlap_io          Read the next block and write the previous
+ * one while the current block is processed
  */
 void symmetrizeCrossPolChannels(isce3::io::Raster& hv_raster_band,
         isce3::io::Raster& vh_raster, isce3::io::Raster& output_raster,
         isce3::core::MemoryModeBlocksY memory_mode =
                 isce3::core::MemoryModeBlocksY::AutoBlocksY,
-        int hv_band = 1, int vh_raster_band = 1, int output_band = 1);
+        int hv_band = 1, int vh_raster_band = 1, int output_band = 1,
+        bool overlap_io = true);
+
+/** Symmetrize cross-polarimetric channels and form polarimetric products
+ * of quad-pol data in a single pass.
+ *
+ * Each block of the four channels is read once, and the symmetrized
+ * cross-polarimetric channel and the requested products are computed and
+ * written in the same pass. All the input channels are read from band 1 of
+ * complex rasters of the same data type.
+ *
+ * @param[in]  hh_raster           Raster containing the HH polarization
+ * channel
+ * @param[in]  hv_raster           Raster containing the HV polarization
+ * channel
+ * @param[in]  vh_raster           Raster containing the VH polarization
+ * channel
+ * @param[in]  vv_raster           Raster containing the VV polarization
+ * channel
+ * @param[out] output_raster       Output symmetrized raster (band 1), or
+ * nullptr to only form the products
+ * @param[out] products            Rasters of the polarimetric products
+ * @param[in]  memory_mode         Memory mode. Option AutoBlocksY (default)
+ * is equivalent to MultipleBlocksY.
+ * @param[in]  overlap_io          Read the next block and write the previous
+ * one while the current block is processed
+ */
+void symmetrizeCrossPolChannels(isce3::io::Raster& hh_raster,
+        isce3::io::Raster& hv_raster, isce3::io::Raster& vh_raster,
+        isce3::io::Raster& vv_raster, isce3::io::Raster* output_raster,
+        const FusedPolProducts& products,
+        isce3::core::MemoryModeBlocksY memory_mode =
+                isce3::core::MemoryModeBlocksY::AutoBlocksY,
+        bool overlap_io = true);
 
 }} // namespace isce3::polsar
\ No newline at end of file
@@ -1,8 +1,22 @@
 #include "Crossmul.h"
 
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <isce3/core/Instrumentation.h>
+#include <isce3/core/detail/BlockPipeline.h>
+#include <isce3/math/Phasor.h>
+
 #include "Filter.h"
-#include "Looks.h"
 #include "Signal.h"
+#include "fftw3cxx.h"
+
+using isce3::core::instrumentation::ScopedTimer;
+namespace instrumentation = isce3::core::instrumentation;
 
 /**
  * Compute the frequency response due to a subpixel shift introduced by
@@ -43,11 +57,9 @@ void lookdownShiftImpact(size_t oversample, size_t fft_size, size_t blockRows,
 
     // compute the frequency response of the subpixel shift in range direction
     std::valarray<std::complex<float>> shiftImpactLine(oversample*fft_size);
-    for (size_t col=0; col<shiftImpactLine.size(); ++col) {
-        double phase = -1.0*shift*2.0*M_PI*rangeFrequencies[col];
-        shiftImpactLine[col] = std::complex<float> (std::cos(phase),
-                                                    std::sin(phase));
-    }
+    std::valarray<double> phase = -1.0*shift*2.0*M_PI*rangeFrequencies;
+    isce3::math::unitPhasors(&phase[0], &shiftImpactLine[0],
+                             shiftImpactLine.size());
 
     // The impact is the same for each range line. Therefore copying the line
     // for the block
@@ -65,6 +77,76 @@ size_t omp_thread_count() {
     return n;
 }
 
+namespace {
+
+/**
+ * Cross-multiply one line of reference and secondary samples, look down the
+ * oversampled samples and the range looks and accumulate the result.
+ *
+ * The interferogram of output column c accumulates
+ * sum_l geometry[c*rgLooks + l] * sum_j ref[k] * conj(sec[k]), with
+ * k = (c*rgLooks + l)*oversample + j, and the powers accumulate |ref[k]|^2
+ * and |sec[k]|^2 over the same samples. The sums are not normalized.
+ *
+ * @param[in] ref       reference samples, ncolsLooked*rgLooks*oversample
+ * @param[in] sec       secondary samples, ncolsLooked*rgLooks*oversample
+ * @param[in] geometry  conjugate of the geometric interferogram at the
+ *                      full resolution, or nullptr to skip the flattening
+ * @param[in] ncolsLooked number of output columns
+ * @param[in] rgLooks   number of range looks
+ * @param[in] oversample oversampling factor of ref and sec
+ * @param[in,out] ifg   interferogram accumulator, ncolsLooked
+ * @param[in,out] refPower reference power accumulator or nullptr
+ * @param[in,out] secPower secondary power accumulator or nullptr
+ */
+void crossmulLine(const std::complex<float>* ref,
+        const std::complex<float>* sec,
+        const std::complex<float>* geometry,
+        size_t ncolsLooked, size_t rgLooks, size_t oversample,
+        std::complex<float>* ifg, float* refPower, float* secPower)
+{
+    // work on interleaved floats so that the column loop vectorizes
+    const float* a = reinterpret_cast<const float*>(ref);
+    const float* b = reinterpret_cast<const float*>(sec);
+    const float* g = reinterpret_cast<const float*>(geometry);
+    float* out = reinterpret_cast<float*>(ifg);
+    const bool power = refPower != nullptr;
+
+    #pragma omp simd
+    for (size_t c = 0; c < ncolsLooked; ++c) {
+        float re = 0, im = 0, pa = 0, pb = 0;
+        for (size_t l = 0; l < rgLooks; ++l) {
+            const size_t col = c * rgLooks + l;
+            float sr = 0, si = 0;
+            for (size_t j = 0; j < oversample; ++j) {
+                const size_t k = 2 * (col * oversample + j);
+                const float ar = a[k], ai = a[k + 1];
+                const float br = b[k], bi = b[k + 1];
+                sr += ar * br + ai * bi;
+                si += ai * br - ar * bi;
+                pa += ar * ar + ai * ai;
+                pb += br * br + bi * bi;
+            }
+            if (g) {
+                const float gr = g[2 * col], gi = g[2 * col + 1];
+                const float tr = sr * gr - si * gi;
+                si = sr * gi + si * gr;
+                sr = tr;
+            }
+            re += sr;
+            im += si;
+        }
+        out[2 * c] += re;
+        out[2 * c + 1] += im;
+        if (power) {
+            refPower[c] += pa;
+            secPower[c] += pb;
+        }
+    }
+}
+
+} // namespace
+
 void isce3::signal::Crossmul::
 crossmul(isce3::io::Raster& refSlcRaster,
         isce3::io::Raster& secSlcRaster,
@@ -72,8 +154,8 @@ crossmul(isce3::io::Raster& refSlcRaster,
         isce3::io::Raster& coherenceRaster,
         isce3::io::Raster* rngOffsetRaster) const
 {
-    // setting local lines per block to avoid modifying class member
-    size_t linesPerBlock = _linesPerBlock;
+    using SC = std::complex<float>;
+    ScopedTimer timer("crossmul");
 
     // check consistency of input/output raster shapes
     size_t nrows = refSlcRaster.length();
@@ -90,10 +172,6 @@ crossmul(isce3::io::Raster& refSlcRaster,
     const auto output_rows = ifgRaster.length();
     const auto output_cols = ifgRaster.width();
     if (_multiLookEnabled) {
-        // Making sure that the number of rows in each block (linesPerBlock)
-        // to be an integer multiple of the number of azimuth looks.
-        linesPerBlock = (_linesPerBlock / _azimuthLooks) * _azimuthLooks;
-
         // checking only multilook interferogram shape is sufficient
         // interferogram and coherence shapes checked to match above
         if (output_rows != nrows / _azimuthLooks)
@@ -115,276 +193,225 @@ crossmul(isce3::io::Raster& refSlcRaster,
                     "full resolution input/output raster widths do not match");
     }
 
-    size_t nthreads = omp_thread_count();
+    // The output rows are processed independently: each one is formed from
+    // azimuthLooks input lines (a single line without multilooking), so the
+    // blocks hold a whole number of output rows.
+    const size_t azLooks = _multiLookEnabled ? _azimuthLooks : 1;
+    const size_t rgLooks = _multiLookEnabled ? _rangeLooks : 1;
+    const size_t nrowsLooked = output_rows;
+    const size_t ncolsLooked = output_cols;
+    const size_t rowsPerBlock = std::max<size_t>(1, _linesPerBlock / azLooks);
+    const size_t linesPerBlock = rowsPerBlock * azLooks;
+    const size_t ovs = _oversampleFactor;
 
     // Set flatten flag based range offset raster ptr value
     bool flatten = rngOffsetRaster ? true : false;
 
-    //signal object for refSlc
-    isce3::signal::Signal<float> refSignal(nthreads);
-
-    //signal object for secSlc
-    isce3::signal::Signal<float> secSignal(nthreads);
-
-    // instantiate Looks used for multi-looking the interferogram
-    isce3::signal::Looks<float> looksObj;
-
-    const size_t linesPerBlockMLooked = linesPerBlock / _azimuthLooks;
-    const size_t ncolsMultiLooked = ncols / _rangeLooks;
-    looksObj.nrows(linesPerBlock);
-    looksObj.ncols(ncols);
-    looksObj.rowsLooks(_azimuthLooks);
-    looksObj.colsLooks(_rangeLooks);
-    looksObj.nrowsLooked(linesPerBlockMLooked);
-    looksObj.ncolsLooked(ncolsMultiLooked);
-
     // Compute FFT size (power of 2)
     size_t fft_size;
-    refSignal.nextPowerOfTwo(ncols, fft_size);
+    isce3::signal::Signal<float>().nextPowerOfTwo(ncols, fft_size);
 
     if (fft_size > INT_MAX)
         throw isce3::except::LengthError(ISCE_SRCINFO(), "fft_size > INT_MAX");
-    if (_oversampleFactor * fft_size > INT_MAX)
+    if (ovs * fft_size > INT_MAX)
         throw isce3::except::LengthError(ISCE_SRCINFO(), "_oversampleFactor * fft_size > INT_MAX");
 
     // number of blocks to process
-    size_t nblocks = nrows / linesPerBlock;
-    if (nblocks == 0) {
-        nblocks = 1;
-    } else if (nrows % (nblocks * linesPerBlock) != 0) {
-        nblocks += 1;
-    }
-
-    // size of not-unsampled valarray
-    const auto spectrumSize = fft_size * linesPerBlock;
-
-    // size of unsampled valarray
-    const auto spectrumUpsampleSize = _oversampleFactor * spectrumSize;
-
-    // storage for a block of reference SLC data
-    std::valarray<std::complex<float>> refSlc(spectrumSize);
-
-    // storage for a block of secondary SLC data
-    std::valarray<std::complex<float>> secSlc(spectrumSize);
-
-    // storage for a block of range offsets
-    std::valarray<double> rngOffset(ncols*linesPerBlock);
-
-    // storage for a simulated interferogram which its phase is the
-    // interferometric phase due to the imaging geometry:
-    // phase = (4*PI/wavelength)*(rangePixelSpacing)*(rngOffset)
-    // complex conjugate of geometryIfgram
-    std::valarray<std::complex<float>> geometryIfgramConj(spectrumSize);
-
-    // upsampled interferogram
-    std::valarray<std::complex<float>> ifgramUpsampled(_oversampleFactor*ncols*linesPerBlock);
-
-    // full resolution interferogram
-    std::valarray<std::complex<float>> ifgram(ncols*linesPerBlock);
-
-    // multi-looked interferogram
-    std::valarray<std::complex<float>> ifgramMultiLooked;
-
-    // multi-looked power of reference SLC
-    std::valarray<float> refPowerLooked;
-
-    // multi-looked power of secondary SLC
-    std::valarray<float> secPowerLooked;
-
-    // coherence for multi-looked and full-res interferogram
-    std::valarray<float> coherence;
+    const int nblocks = std::max<size_t>(1,
+            (nrowsLooked + rowsPerBlock - 1) / rowsPerBlock);
+    std::cout << "nblocks : " << nblocks << std::endl;
 
-    if (_multiLookEnabled) {
-        // resize following valarrays from empty
-        const auto mlookSize = ncolsMultiLooked*linesPerBlockMLooked;
-        ifgramMultiLooked.resize(mlookSize);
-        coherence.resize(mlookSize);
-        refPowerLooked.resize(mlookSize);
-        secPowerLooked.resize(mlookSize);
+    // buffers of the blocks being read, processed and written
+    struct Slot {
+        std::vector<SC> refSlc, secSlc;
+        std::vector<double> rngOffset;
+        std::vector<SC> ifgram;
+        std::vector<float> coherence;
+    };
+    // an output written while the next block of an input sharing its
+    // dataset is read would race with the read
+    bool overlapIO = _overlapIO;
+    for (const auto output : {&ifgRaster, &coherenceRaster}) {
+        if (output->sharesDataset(refSlcRaster) ||
+                output->sharesDataset(secSlcRaster) ||
+                (flatten && output->sharesDataset(*rngOffsetRaster)))
+            overlapIO = false;
     }
-    else {
-        coherence.resize(ncols*linesPerBlock);
-    }
-
-    // storage for spectrum of the block of data in reference SLC
-    std::valarray<std::complex<float>> refSpectrum;
-
-    // storage for spectrum of the block of data in secondary SLC
-    std::valarray<std::complex<float>> secSpectrum;
-
-    // upsampled spectrum of the block of reference SLC
-    std::valarray<std::complex<float>> refSpectrumUpsampled;
-
-    // upsampled spectrum of the block of secondary SLC
-    std::valarray<std::complex<float>> secSpectrumUpsampled;
-
-    // upsampled block of reference SLC
-    std::valarray<std::complex<float>> refSlcUpsampled;
-
-    // upsampled block of secondary SLC
-    std::valarray<std::complex<float>> secSlcUpsampled;
-
-    // only resize valarrays and init FFT when oversampling
-    if (_oversampleFactor > 1) {
-        refSpectrum.resize(spectrumSize);
-        secSpectrum.resize(spectrumSize);
-
-        refSpectrumUpsampled.resize(spectrumUpsampleSize);
-        secSpectrumUpsampled.resize(spectrumUpsampleSize);
-        refSlcUpsampled.resize(spectrumUpsampleSize);
-        secSlcUpsampled.resize(spectrumUpsampleSize);
-
-        // make forward and inverse fft plans for the reference SLC
-        refSignal.forwardRangeFFT(refSlc, refSpectrum, fft_size, linesPerBlock);
-        refSignal.inverseRangeFFT(refSpectrumUpsampled, refSlcUpsampled,
-                fft_size*_oversampleFactor, linesPerBlock);
 
-        // make forward and inverse fft plans for the secondary SLC
-        secSignal.forwardRangeFFT(secSlc, secSpectrum, fft_size, linesPerBlock);
-        secSignal.inverseRangeFFT(secSpectrumUpsampled, secSlcUpsampled,
-                fft_size*_oversampleFactor, linesPerBlock);
+    const int nslots = isce3::core::detail::pipelineSlots(nblocks, overlapIO);
+    std::vector<Slot> slots(nslots);
+    for (auto& slot : slots) {
+        slot.refSlc.resize(linesPerBlock * ncols);
+        slot.secSlc.resize(linesPerBlock * ncols);
+        if (flatten)
+            slot.rngOffset.resize(linesPerBlock * ncols);
+        slot.ifgram.resize(rowsPerBlock * ncolsLooked);
+        slot.coherence.resize(rowsPerBlock * ncolsLooked);
     }
 
-    // looking down the upsampled interferogram may shift the samples by a fraction of a pixel
-    // depending on the oversample factor. predicting the impact of the shift in frequency domain
-    // which is a linear phase allows to account for it during the upsampling process
-    std::valarray<std::complex<float>> shiftImpact(spectrumUpsampleSize);
-    lookdownShiftImpact(_oversampleFactor,  fft_size,
-                        linesPerBlock, shiftImpact);
-
-    // loop over all blocks
-    std::cout << "nblocks : " << nblocks << std::endl;
-
-    for (size_t block = 0; block < nblocks; ++block) {
-        std::cout << "block: " << block << std::endl;
-        // start row for this block
-        const auto rowStart = block * linesPerBlock;
-
-        //number of lines of data in this block. blockRowsData<= linesPerBlock
-        //Note that linesPerBlock is fixed number of lines
-        //blockRowsData might be less than or equal to linesPerBlock.
-        //e.g. if nrows = 512, and linesPerBlock = 100, then
-        //blockRowsData for last block will be 12
-        const auto blockRowsData = std::min(nrows - rowStart, linesPerBlock);
-
-        // fill the valarray with zero before getting the block of the data
-        refSlc = 0;
-        secSlc = 0;
-        ifgramUpsampled = 0;
-        ifgram = 0;
-
-        // get a block of reference and secondary SLC data
-        // and a block of range offsets
-        // This will change once we have the functionality to
-        // get a block of data directly in to a slice
-        // This zero-pads SLCs in range
-        std::valarray<std::complex<float>> dataLine(ncols);
-        for (size_t line = 0; line < blockRowsData; ++line) {
-            refSlcRaster.getLine(dataLine, rowStart + line);
-            refSlc[std::slice(line*fft_size, ncols, 1)] = dataLine;
-            secSlcRaster.getLine(dataLine, rowStart + line);
-            secSlc[std::slice(line*fft_size, ncols, 1)] = dataLine;
+    // per-thread buffers for the upsampling, the flattening and the looks
+    struct LineBuffers {
+        std::vector<SC> padded, spectrum, spectrumUpsampled;
+        std::vector<SC> refUpsampled, secUpsampled;
+        std::vector<double> phase;
+        std::vector<SC> geometryIfgramConj;
+        std::vector<float> refPower, secPower;
+    };
+    const size_t nthreads = omp_thread_count();
+    std::vector<LineBuffers> buffers(nthreads);
+    for (auto& buf : buffers) {
+        if (ovs > 1) {
+            // the zero padding and the zeros in the middle of the upsampled
+            // spectrum are never overwritten
+            buf.padded.resize(fft_size);
+            buf.spectrum.resize(fft_size);
+            buf.spectrumUpsampled.resize(ovs * fft_size);
+            buf.refUpsampled.resize(ovs * fft_size);
+            buf.secUpsampled.resize(ovs * fft_size);
         }
-
-        // upsample the reference and secondary SLCs
-        if (_oversampleFactor == 1) {
-            refSlcUpsampled = refSlc;
-            secSlcUpsampled = secSlc;
-        } else {
-            refSignal.upsample(refSlc, refSlcUpsampled, linesPerBlock, fft_size,
-                               _oversampleFactor, shiftImpact);
-            secSignal.upsample(secSlc, secSlcUpsampled, linesPerBlock, fft_size,
-                               _oversampleFactor, shiftImpact);
+        if (flatten) {
+            buf.phase.resize(ncols);
+            buf.geometryIfgramConj.resize(ncols);
         }
-
-        // Compute oversampled interferogram data
-        #pragma omp parallel for
-        for (size_t line = 0; line < blockRowsData; line++) {
-            for (size_t col = 0; col < _oversampleFactor*ncols; col++) {
-                ifgramUpsampled[line*(_oversampleFactor*ncols) + col] =
-                        refSlcUpsampled[line*(_oversampleFactor*fft_size) + col]*
-                        std::conj(secSlcUpsampled[line*(_oversampleFactor*fft_size) + col]);
-            }
+        if (_multiLookEnabled) {
+            buf.refPower.resize(ncolsLooked);
+            buf.secPower.resize(ncolsLooked);
         }
+    }
 
+    // Single-line plans shared by all the threads through the new-array
+    // execute interface, which is thread-safe. Each execution already runs
+    // on one of the block threads, so the plans are made single-threaded to
+    // avoid oversubscribing the cores. The planner thread count is global,
+    // and like the other planners (Signal, isce3::fft) it is set explicitly.
+    isce3::fftw3cxx::plan<float> forwardPlan, inversePlan;
+    std::valarray<SC> shiftImpact;
+    if (ovs > 1) {
+        isce3::fftw3cxx::init_threads<float>();
+        isce3::fftw3cxx::plan_with_nthreads<float>(1);
+        const int n = fft_size;
+        const int nUpsampled = ovs * fft_size;
+        auto& buf = buffers[0];
+        forwardPlan = isce3::fftw3cxx::plan<float>::plan_dft_1d(n,
+                buf.padded.data(), buf.spectrum.data(), FFTW_FORWARD,
+                FFTW_ESTIMATE | FFTW_UNALIGNED);
+        inversePlan = isce3::fftw3cxx::plan<float>::plan_dft_1d(nUpsampled,
+                buf.spectrumUpsampled.data(), buf.refUpsampled.data(),
+                FFTW_BACKWARD, FFTW_ESTIMATE | FFTW_UNALIGNED);
+
+        // looking down the upsampled interferogram may shift the samples by
+        // a fraction of a pixel depending on the oversample factor.
+        // predicting the impact of the shift in frequency domain which is a
+        // linear phase allows to account for it during the upsampling
+        // process. The normalization of the inverse FFT is folded in.
+        shiftImpact.resize(ovs * fft_size);
+        lookdownShiftImpact(ovs, fft_size, 1, shiftImpact);
+        shiftImpact /= SC(fft_size);
+    }
+
+    // upsample one line of ncols samples into ovs*fft_size samples
+    auto upsample = [&](LineBuffers& buf, const SC* line, SC* upsampled) {
+        std::copy(line, line + ncols, buf.padded.begin());
+        forwardPlan.execute_dft(buf.padded.data(), buf.spectrum.data());
+
+        // the positive frequencies stay at the start and the negative ones
+        // are moved to the end of the upsampled spectrum
+        const size_t nlow = (fft_size + 1) / 2;
+        const size_t nhigh = fft_size / 2;
+        const size_t highStart = ovs * fft_size - nhigh;
+        for (size_t i = 0; i < nlow; ++i)
+            buf.spectrumUpsampled[i] = buf.spectrum[i] * shiftImpact[i];
+        for (size_t i = 0; i < nhigh; ++i)
+            buf.spectrumUpsampled[highStart + i] =
+                    buf.spectrum[nhigh + i] * shiftImpact[highStart + i];
+
+        inversePlan.execute_dft(buf.spectrumUpsampled.data(), upsampled);
+    };
+
+    auto read = [&](int, int s, long y0, long n) {
+        ScopedTimer readTimer("crossmul.read");
+        Slot& slot = slots[s];
+        const size_t line0 = y0 * azLooks;
+        const size_t nlines = std::min(n * azLooks, nrows - line0);
+        refSlcRaster.getBlock(slot.refSlc.data(), 0, line0, ncols, nlines);
+        secSlcRaster.getBlock(slot.secSlc.data(), 0, line0, ncols, nlines);
+        size_t bytes = 2 * nlines * ncols * sizeof(SC);
         if (flatten) {
-            // Read range offsets
-            std::valarray<double> offsetLine(ncols);
-            for (size_t line = 0; line < blockRowsData; ++line) {
-                rngOffsetRaster->getLine(offsetLine, rowStart + line);
-                rngOffset[std::slice(line*ncols, ncols, 1)] = offsetLine + _offsetStartingRangeShift / _rangePixelSpacing;
+            rngOffsetRaster->getBlock(slot.rngOffset.data(), 0, line0, ncols,
+                    nlines);
+            bytes += nlines * ncols * sizeof(double);
+        }
+        instrumentation::count("crossmul.bytes_read", bytes);
+        instrumentation::count("crossmul.pixels", nlines * ncols);
+    };
+
+    // form one output row from azLooks lines of the slot
+    auto compute = [&](int s, long row) {
+#ifdef _OPENMP
+        LineBuffers& buf = buffers[omp_get_thread_num()];
+#else
+        LineBuffers& buf = buffers[0];
+#endif
+        Slot& slot = slots[s];
+        SC* ifg = &slot.ifgram[row * ncolsLooked];
+        float* coherence = &slot.coherence[row * ncolsLooked];
+        std::fill(ifg, ifg + ncolsLooked, SC(0));
+        if (_multiLookEnabled) {
+            std::fill(buf.refPower.begin(), buf.refPower.end(), 0.0f);
+            std::fill(buf.secPower.begin(), buf.secPower.end(), 0.0f);
+        }
+
+        for (size_t i = 0; i < azLooks; ++i) {
+            const size_t line = row * azLooks + i;
+            const SC* ref = &slot.refSlc[line * ncols];
+            const SC* sec = &slot.secSlc[line * ncols];
+            if (ovs > 1) {
+                upsample(buf, ref, buf.refUpsampled.data());
+                upsample(buf, sec, buf.secUpsampled.data());
+                ref = buf.refUpsampled.data();
+                sec = buf.secUpsampled.data();
             }
 
-            #pragma omp parallel for
-            for (size_t line = 0; line < blockRowsData; ++line) {
+            // conjugate of the interferogram due to the imaging geometry:
+            // phase = (4*PI/wavelength)*(rangePixelSpacing)*(rngOffset)
+            const SC* geometry = nullptr;
+            if (flatten) {
+                const double* offset = &slot.rngOffset[line * ncols];
+                const double rangeShift =
+                        _offsetStartingRangeShift / _rangePixelSpacing;
                 for (size_t col = 0; col < ncols; ++col) {
-                    double phase = 4.0*M_PI*_rangePixelSpacing*rngOffset[line*ncols+col]/_wavelength;
-                    geometryIfgramConj[line*fft_size + col] = std::complex<float> (std::cos(phase),
-                                                                            -1.0*std::sin(phase));
-
+                    buf.phase[col] = -4.0 * M_PI * _rangePixelSpacing *
+                                     (offset[col] + rangeShift) / _wavelength;
                 }
+                isce3::math::unitPhasors(buf.phase.data(),
+                        buf.geometryIfgramConj.data(), ncols);
+                geometry = buf.geometryIfgramConj.data();
             }
-        }
 
-        // Reclaim the extra oversample looks across
-        float ov = _oversampleFactor;
-        #pragma omp parallel for
-        for (size_t line = 0; line < blockRowsData; line++) {
-            for (size_t col = 0; col < ncols; col++) {
-                std::complex<float> sum = 0;
-                for (size_t j=0; j< _oversampleFactor; j++)
-                    sum += ifgramUpsampled[line*(ncols*_oversampleFactor) + j + col*_oversampleFactor];
-                ifgram[line*ncols + col] = sum/ov;
-
-                if (flatten)
-                    ifgram[line*ncols + col] *= geometryIfgramConj[line*fft_size + col];
-            }
+            crossmulLine(ref, sec, geometry, ncolsLooked, rgLooks, ovs, ifg,
+                    _multiLookEnabled ? buf.refPower.data() : nullptr,
+                    _multiLookEnabled ? buf.secPower.data() : nullptr);
         }
 
-        // Take looks down (summing columns)
-        if (_multiLookEnabled) {
-
-            // mulitlook interferogram and set raster
-            looksObj.ncols(ncols);
-            looksObj.colsLooks(_rangeLooks);
-            looksObj.multilook(ifgram, ifgramMultiLooked);
-            ifgRaster.setBlock(ifgramMultiLooked, 0, rowStart/_azimuthLooks,
-                        ncols/_rangeLooks, blockRowsData/_azimuthLooks);
-
-            // multilook SLC to power for coherence computation
-            // refPowerLooked = average(abs(refSlc)^2)
-            if (_oversampleFactor == 1) {
-                looksObj.ncols(fft_size);
-                looksObj.multilook(refSlc, refPowerLooked, 2);
-                looksObj.multilook(secSlc, secPowerLooked, 2);
-            } else {
-                // update looksObj so SlcUpsampled can be mulitlooked
-                looksObj.ncols(_oversampleFactor*fft_size);
-                looksObj.colsLooks(_oversampleFactor*_rangeLooks);
-                looksObj.multilook(refSlcUpsampled, refPowerLooked, 2);
-                looksObj.multilook(secSlcUpsampled, secPowerLooked, 2);
-            }
-
-            // compute coherence
-            #pragma omp parallel for
-            for (size_t i = 0; i< ifgramMultiLooked.size(); ++i) {
-                coherence[i] = std::abs(ifgramMultiLooked[i])/
-                        std::sqrt(refPowerLooked[i]*secPowerLooked[i]);
-            }
-
-            // set coherence raster
-            coherenceRaster.setBlock(coherence, 0, rowStart/_azimuthLooks,
-                    ncols/_rangeLooks, blockRowsData/_azimuthLooks);
-        } else {
-            // set the block of interferogram
-            ifgRaster.setBlock(ifgram, 0, rowStart, ncols, blockRowsData);
+        // normalize the sums to the mean of the looks and compute the
+        // coherence (one without multilooking)
+        const float scale = 1.0f / (ovs * rgLooks * azLooks);
+        for (size_t col = 0; col < ncolsLooked; ++col) {
+            coherence[col] = _multiLookEnabled ?
+                    std::abs(ifg[col]) /
+                            std::sqrt(buf.refPower[col] * buf.secPower[col]) :
+                    1.0f;
+            ifg[col] *= scale;
+        }
+    };
 
-            // fill coherence with ones (no need to compute result)
-            coherence = 1.0;
+    auto write = [&](int, int s, long y0, long n) {
+        ScopedTimer outputTimer("crossmul.write");
+        Slot& slot = slots[s];
+        ifgRaster.setBlock(slot.ifgram.data(), 0, y0, ncolsLooked, n);
+        coherenceRaster.setBlock(slot.coherence.data(), 0, y0, ncolsLooked, n);
+    };
 
-            // set the block of coherence
-            coherenceRaster.setBlock(coherence, 0, rowStart, ncols,
-                                     blockRowsData);
-        }
-    }
+    isce3::core::detail::runBlockPipeline(nblocks, rowsPerBlock, nrowsLooked,
+            overlapIO, read, compute, write);
 }
@@ -26,6 +26,13 @@ class isce3::signal::Crossmul {
          * \param[out] coherenceRaster  output coherence raster
          * \param[in]  rngOffsetRaster  optional pointer to range offset raster
          *                              if provided, interferogram will be flattened
+         *
+         * The SLCs are streamed in blocks of linesPerBlock lines (rounded
+         * down to a multiple of the azimuth looks). When overlapIO is set,
+         * the next block is read and the previous one written while the
+         * current one is processed, so at most three blocks are held. The
+         * overlap is disabled if an output raster shares its dataset or file
+         * with an input raster.
          */
         void crossmul(isce3::io::Raster& refSlcRaster,
                     isce3::io::Raster& secSlcRaster,
@@ -91,6 +98,12 @@ class isce3::signal::Crossmul {
         /** Get linesPerBlock */
         inline size_t linesPerBlock() const { return _linesPerBlock; }
 
+        /** Set whether to overlap raster I/O with the processing */
+        inline void overlapIO(bool overlap) { _overlapIO = overlap; }
+
+        /** Get whether to overlap raster I/O with the processing */
+        inline bool overlapIO() const { return _overlapIO; }
+
         /** Get boolean multilook flag */
         inline bool multiLookEnabled() const { return _multiLookEnabled; }
 
@@ -136,6 +149,9 @@ class isce3::signal::Crossmul {
         // upsampling factor
         size_t _oversampleFactor = 1;
 
+        // overlap the reads and writes of the blocks with their processing
+        bool _overlapIO = true;
+
 
 };
 
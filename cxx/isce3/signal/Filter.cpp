@@ -270,9 +270,11 @@ constructAzimuthCommonbandFilter(const isce3::core::LUT1d<double> & refDoppler,
     fftfreq(1.0/prf, frequency);
     
     // Loop over range bins
+    size_t refCursor = 0, secCursor = 0;
     for (int j = 0; j < ncols; ++j) {
         // Compute center frequency of common band
-        const double fmid = 0.5 * (refDoppler.eval(j) + secDoppler.eval(j));
+        const double fmid = 0.5 * (refDoppler.eval(j, refCursor) +
+                                   secDoppler.eval(j, secCursor));
 
         // Compute filter
         for (size_t i = 0; i < frequency.size(); ++i) {
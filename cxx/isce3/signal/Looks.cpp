@@ -7,6 +7,13 @@
 
 #include "Looks.h"
 
+#include <Eigen/Dense>
+
+// Scratch arrays of the multilooking are not initialized, so that their pages
+// are first touched by the threads of the (static) loops that fill them
+template<class T>
+using ScratchArray = Eigen::Array<T, Eigen::Dynamic, 1>;
+
 bool isce3::signal::verifyComplexToRealCasting(isce3::io::Raster& input_raster,
                                               isce3::io::Raster& output_raster,
                                               int& exponent) {
@@ -87,10 +94,10 @@ void isce3::signal::Looks<T>::multilook(std::valarray<T>& input,
 
     // a temporary buffer to store the multi-looked data in range (columns)
     // direction
-    std::valarray<T> tempOutput(_nrows * _ncolsLooked);
+    ScratchArray<T> tempOutput(_nrows * _ncolsLooked);
 
 // multi-looking in range direction (columns)
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrows * _ncolsLooked; ++kk) {
         size_t line = kk / _ncolsLooked;
         size_t col = kk % _ncolsLooked;
@@ -102,7 +109,7 @@ void isce3::signal::Looks<T>::multilook(std::valarray<T>& input,
     }
 
 // multi-looking in azimuth direction (rows)
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _ncolsLooked * _nrowsLooked; ++kk) {
         size_t line = kk / _ncolsLooked;
         size_t col = kk % _ncolsLooked;
@@ -181,11 +188,11 @@ void isce3::signal::Looks<T>::multilook(std::valarray<T>& input,
 
     // temporary buffers used for mult-looking columns for the
     // data and the weights
-    std::valarray<T> tempOutput(_nrows * _ncolsLooked);
-    std::valarray<T> tempSumWeights(_nrows * _ncolsLooked);
+    ScratchArray<T> tempOutput(_nrows * _ncolsLooked);
+    ScratchArray<T> tempSumWeights(_nrows * _ncolsLooked);
 
 // weighted multi-looking the columns
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrows * _ncolsLooked; ++kk) {
         size_t line = kk / _ncolsLooked;
         size_t col = kk % _ncolsLooked;
@@ -200,7 +207,7 @@ void isce3::signal::Looks<T>::multilook(std::valarray<T>& input,
     }
 
     // weighted multi-looking the rows
-    #pragma omp parallel for
+    #pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrowsLooked*_ncolsLooked; ++kk){
         size_t line = kk/_ncolsLooked;
         size_t col = kk%_ncolsLooked;
@@ -231,9 +238,9 @@ void isce3::signal::Looks<T>::multilook(std::valarray<std::complex<T>>& input,
 
     // The implementation details are same as real data. See the notes above.
 
-    std::valarray<std::complex<T>> tempOutput(_nrows * _ncolsLooked);
+    ScratchArray<std::complex<T>> tempOutput(_nrows * _ncolsLooked);
 
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrows * _ncolsLooked; ++kk) {
         size_t line = kk / _ncolsLooked;
         size_t col = kk % _ncolsLooked;
@@ -244,7 +251,7 @@ void isce3::signal::Looks<T>::multilook(std::valarray<std::complex<T>>& input,
         tempOutput[line * _ncolsLooked + col] = sum;
     }
 
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrowsLooked * _ncolsLooked; ++kk){
         size_t line = kk/_ncolsLooked;
         size_t col = kk%_ncolsLooked;
@@ -315,10 +322,10 @@ multilook(std::valarray<std::complex<T>> &input,
             std::valarray<std::complex<T>> &output)
 {
 
-    std::valarray<std::complex<T>> tempOutput(_nrows*_ncolsLooked);
-    std::valarray<T> tempSumWeights(_nrows * _ncolsLooked);
+    ScratchArray<std::complex<T>> tempOutput(_nrows*_ncolsLooked);
+    ScratchArray<T> tempSumWeights(_nrows * _ncolsLooked);
 
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrows*_ncolsLooked; ++kk){
         size_t line = kk/_ncolsLooked;
         size_t col = kk%_ncolsLooked;
@@ -335,7 +342,7 @@ multilook(std::valarray<std::complex<T>> &input,
         tempSumWeights[line * _ncolsLooked + col] = sumWeights;
     }
 
-    #pragma omp parallel for
+    #pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrowsLooked * _ncolsLooked; ++kk){
         size_t line = kk/_ncolsLooked;
         size_t col = kk%_ncolsLooked;
@@ -365,9 +372,9 @@ void isce3::signal::Looks<T>::multilook(std::valarray<std::complex<T>>& input,
     if (exponent == 0)
         exponent = 2;
 
-    std::valarray<T> tempOutput(_nrows * _ncolsLooked);
+    ScratchArray<T> tempOutput(_nrows * _ncolsLooked);
 
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrows * _ncolsLooked; ++kk) {
         size_t line = kk / _ncolsLooked;
         size_t col = kk % _ncolsLooked;
@@ -378,7 +385,7 @@ void isce3::signal::Looks<T>::multilook(std::valarray<std::complex<T>>& input,
         tempOutput[line * _ncolsLooked + col] = sum;
     }
 
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
     for (size_t kk = 0; kk < _nrowsLooked * _ncolsLooked; ++kk){
         size_t line = kk/_ncolsLooked;
         size_t col = kk%_ncolsLooked;
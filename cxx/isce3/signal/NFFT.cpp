@@ -9,11 +9,21 @@
 #include "NFFT.h"
 #include <isce3/except/Error.h>
 #include <isce3/core/Interp1d.h>
+#include <algorithm>
 #include <cmath>
 #include <memory>
+#include <numeric>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using isce3::except::InvalidArgument;
 using isce3::except::LengthError;
 
+// Maximum number of lines transformed together by the batch interface.
+static constexpr size_t max_batch_size = 16;
+
 // Constructor
 template<class T>
 isce3::signal::NFFT<T>::
@@ -68,21 +78,45 @@ set_spectrum(size_t size, size_t stride, const std::complex<T> *x)
     if (size != _n) {
         throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
     }
+    _pad_spectrum(stride, x, &_xf[0]);
+    // Transform to (expanded) time-domain.
+    _fft.inverse(_xf, _xt);
+}
+
+template<class T>
+void
+isce3::signal::NFFT<T>::
+_pad_spectrum(size_t stride, const std::complex<T> *x,
+              std::complex<T> *xf) const
+{
     // Clear any old data.
     for (size_t i=0; i<_fft_size; ++i) {
-        _xf[i] = 0;
+        xf[i] = 0;
     }
     // Zero-pad and scale spectrum.
-    size_t n2 = size / 2;
+    size_t n2 = _n / 2;
     for (size_t i=0; i<n2; ++i) {
-        _xf[i] = x[i*stride] * _weights[i];
+        xf[i] = x[i*stride] * _weights[i];
     }
     for (size_t i=n2; i>0; --i) {
-        _xf[_fft_size-i] = x[(size-i)*stride] * _weights[size-i];
+        xf[_fft_size-i] = x[(_n-i)*stride] * _weights[_n-i];
     }
     // NOTE For even lengths we're not splitting Nyquist bin.
-    // Transform to (expanded) time-domain.
-    _fft.inverse(_xf, _xt);
+}
+
+template<class T>
+void
+isce3::signal::NFFT<T>::
+_unpad_spectrum(const std::complex<T> *xf, size_t stride,
+                std::complex<T> *x) const
+{
+    const long n2 = _n / 2;
+    for (long i=0; i<n2; ++i) {
+        x[i*stride] = _n * _weights[i] * xf[i];
+    }
+    for (long i=n2; i>0; --i) {
+        x[(_n-i)*stride] = _n * _weights[_n-i] * xf[_fft_size-i];
+    }
 }
 
 // valarray version
@@ -180,13 +214,7 @@ execute_adjoint(size_t isize, size_t istride,
     // FFT
     _fft.forward(_xt, _xf);
     // Remove filter response and copy to output.
-    const long n2 = _n / 2;
-    for (long i=0; i<n2; ++i) {
-        spectrum[i*ostride] = _n * _weights[i] * _xf[i];
-    }
-    for (long i=n2; i>0; --i) {
-        spectrum[(_n-i)*ostride] = _n * _weights[_n-i] * _xf[_fft_size-i];
-    }
+    _unpad_spectrum(&_xf[0], ostride, spectrum);
 }
 
 template<class T>
@@ -201,5 +229,207 @@ execute_adjoint(const std::valarray<std::complex<T>> &time_series,
                     spectrum.size(), 1, &spectrum[0]);
 }
 
+template<class T>
+void
+isce3::signal::NFFT<T>::
+set_times(size_t tsize, size_t tstride, const double *times)
+{
+    const long width = size_kernel();
+    const long fft_size = _fft_size;
+    _psi.resize(tsize * width);
+    _psi_low.resize(tsize);
+
+    // Same kernel placement as interp(), see isce3::core::interp1d.
+    _Pragma("omp parallel for")
+    for (size_t i=0; i<tsize; ++i) {
+        const double t = times[i*tstride] * _fft_size / _n;
+        const long low = (long)std::round(t) - (long)_m;
+        for (long j=0; j<width; ++j) {
+            _psi[i*width + j] = _kernel(j + low - t);
+        }
+        // XXX Unlike Python, C++ modulo takes sign of dividend.
+        long k = low % fft_size;
+        if (k < 0) k += fft_size;
+        _psi_low[i] = k;
+    }
+
+    // Sort samples into bins at least as wide as the kernel.  Samples in
+    // bins b and b+2 never touch the same grid points, so all even bins can
+    // be spread concurrently, followed by all odd bins.  Use an even number
+    // of bins so the last bin (which wraps around to the start of the grid)
+    // never shares a pass with the first.
+    int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+    long nbins = std::min<long>(fft_size / width, 8 * nthreads);
+    nbins = (nbins >= 2) ? (nbins / 2) * 2 : 1;
+    const long bin_width = fft_size / nbins;
+    auto bin = [&](size_t i) {
+        return std::min(_psi_low[i] / bin_width, nbins - 1);
+    };
+
+    _order.resize(tsize);
+    std::iota(_order.begin(), _order.end(), 0);
+    std::stable_sort(_order.begin(), _order.end(), [&](size_t a, size_t b) {
+        return _psi_low[a] < _psi_low[b];
+    });
+    _bin_start.assign(nbins + 1, tsize);
+    for (size_t i=tsize; i>0; --i) {
+        _bin_start[bin(_order[i-1])] = i - 1;
+    }
+    // Fill in empty bins so that bin b spans [_bin_start[b], _bin_start[b+1])
+    for (long b=nbins-1; b>=0; --b) {
+        _bin_start[b] = std::min(_bin_start[b], _bin_start[b+1]);
+    }
+}
+
+template<class T>
+void
+isce3::signal::NFFT<T>::
+set_times(const std::valarray<double> &times)
+{
+    set_times(times.size(), /*stride*/1, &times[0]);
+}
+
+template<class T>
+void
+isce3::signal::NFFT<T>::
+_plan_batch(size_t howmany)
+{
+    if (howmany == _batch_size) {
+        return;
+    }
+    _batch_size = howmany;
+    _xf_batch.resize(howmany * _fft_size);
+    _xt_batch.resize(howmany * _fft_size);
+    int sizes[] = {(int)_fft_size};
+    const int dist = _fft_size;
+    _fft_batch.fftPlanBackward(_xf_batch, _xt_batch, /*rank*/1, &sizes[0],
+                               /*howmany*/howmany,
+                               /*inembed*/NULL, /*istride*/1, /*idist*/dist,
+                               /*onembed*/NULL, /*ostride*/1, /*odist*/dist,
+                               FFTW_BACKWARD);
+    _fft_batch.fftPlanForward(_xt_batch, _xf_batch, /*rank*/1, &sizes[0],
+                              /*howmany*/howmany,
+                              /*inembed*/NULL, /*istride*/1, /*idist*/dist,
+                              /*onembed*/NULL, /*ostride*/1, /*odist*/dist,
+                              FFTW_FORWARD);
+}
+
+template<class T>
+void
+isce3::signal::NFFT<T>::
+execute_batch(size_t howmany,
+              const std::complex<T> *spectrum, size_t idist,
+              std::complex<T> *out, size_t odist)
+{
+    if (howmany == 0) {
+        throw InvalidArgument(ISCE_SRCINFO(),
+                              "Number of transforms must be positive.");
+    }
+    if (_bin_start.empty()) {
+        throw LengthError(ISCE_SRCINFO(), "Must call set_times first.");
+    }
+    const long nt = size_times();
+    const long width = size_kernel();
+    const long fft_size = _fft_size;
+    _plan_batch(std::min(howmany, max_batch_size));
+    const long nb = _batch_size;
+
+    for (size_t first=0; first<howmany; first+=_batch_size) {
+        // Unused lines in last batch are just zero-filled.
+        const long nlines = std::min(_batch_size, howmany - first);
+        _Pragma("omp parallel for")
+        for (long l=0; l<nb; ++l) {
+            auto xf = &_xf_batch[l * _fft_size];
+            if (l < nlines) {
+                _pad_spectrum(1, &spectrum[(first + l) * idist], xf);
+            } else {
+                std::fill(xf, xf + _fft_size, std::complex<T>(0));
+            }
+        }
+        _fft_batch.inverse(_xf_batch, _xt_batch);
+
+        // Interpolate using precomputed weights.
+        _Pragma("omp parallel for collapse(2)")
+        for (long l=0; l<nlines; ++l) {
+            for (long i=0; i<nt; ++i) {
+                const auto xt = &_xt_batch[l * _fft_size];
+                const T *psi = &_psi[i * width];
+                const long low = _psi_low[i];
+                std::complex<T> sum = 0;
+                if (low + width <= fft_size) {
+                    for (long j=0; j<width; ++j) {
+                        sum += psi[j] * xt[low + j];
+                    }
+                } else {
+                    for (long j=0; j<width; ++j) {
+                        sum += psi[j] * xt[(low + j) % fft_size];
+                    }
+                }
+                out[(first + l) * odist + i] = sum;
+            }
+        }
+    }
+}
+
+template<class T>
+void
+isce3::signal::NFFT<T>::
+execute_adjoint_batch(size_t howmany,
+                      const std::complex<T> *time_series, size_t idist,
+                      std::complex<T> *spectrum, size_t odist)
+{
+    if (howmany == 0) {
+        throw InvalidArgument(ISCE_SRCINFO(),
+                              "Number of transforms must be positive.");
+    }
+    if (_bin_start.empty()) {
+        throw LengthError(ISCE_SRCINFO(), "Must call set_times first.");
+    }
+    const long width = size_kernel();
+    const long fft_size = _fft_size;
+    const long nbins = _bin_start.size() - 1;
+    _plan_batch(std::min(howmany, max_batch_size));
+
+    for (size_t first=0; first<howmany; first+=_batch_size) {
+        const long nlines = std::min(_batch_size, howmany - first);
+        std::fill(std::begin(_xt_batch), std::end(_xt_batch),
+                  std::complex<T>(0));
+
+        // Spread samples onto the grid, visiting even bins then odd bins so
+        // that no two threads write to the same grid point.  Lines are
+        // independent, so those are parallelized too.
+        for (long parity=0; parity<2; ++parity) {
+            const long nparity = (nbins - parity + 1) / 2;
+            _Pragma("omp parallel for collapse(2) schedule(dynamic)")
+            for (long l=0; l<nlines; ++l) {
+                for (long ib=0; ib<nparity; ++ib) {
+                    const long b = parity + 2 * ib;
+                    const auto x = &time_series[(first + l) * idist];
+                    const auto xt = &_xt_batch[l * _fft_size];
+                    for (size_t k=_bin_start[b]; k<_bin_start[b+1]; ++k) {
+                        const size_t i = _order[k];
+                        const T *psi = &_psi[i * width];
+                        const long low = _psi_low[i];
+                        for (long j=0; j<width; ++j) {
+                            xt[(low + j) % fft_size] += psi[j] * x[i];
+                        }
+                    }
+                }
+            }
+        }
+        _fft_batch.forward(_xt_batch, _xf_batch);
+
+        // Remove filter response and copy to output.
+        _Pragma("omp parallel for")
+        for (long l=0; l<nlines; ++l) {
+            _unpad_spectrum(&_xf_batch[l * _fft_size], /*stride*/1,
+                            &spectrum[(first + l) * odist]);
+        }
+    }
+}
+
 template class isce3::signal::NFFT<float>;
 template class isce3::signal::NFFT<double>;
@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <valarray>
+#include <vector>
 
 #include <isce3/core/Constants.h>
 #include <isce3/core/Kernels.h>
@@ -38,6 +39,11 @@
  *      -# Sample locations do not need to be specified in advance.  You can
  *         use NFFT.set_spectrum and then NFFT.interp all the points you want
  *         on the fly.  The NFFT.execute convenience function combines these.
+ *
+ * When many transforms share the same sample locations (e.g., every range bin
+ * of a block of azimuth lines) use NFFT.set_times once and then
+ * NFFT.execute_batch or NFFT.execute_adjoint_batch.  These use a precomputed
+ * table of kernel weights and multithreaded interpolation and spreading.
  */
 template<class T>
 class isce3::signal::NFFT {
@@ -160,14 +166,102 @@ class isce3::signal::NFFT {
          */
         std::complex<T> interp(double t) const;
 
+        /** Precompute interpolation weights for a fixed set of locations.
+         *
+         * Stores the kernel weights at every sample location (the PSI matrix
+         * in @cite keiner2009) and sorts the locations into bins on the
+         * oversampled grid so that spreading in the adjoint transform can be
+         * done in parallel without write conflicts.
+         *
+         * @param[in] tsize     Number of time samples.
+         * @param[in] tstride   Stride between elements of time array.
+         * @param[in] times     Sample locations in [0:n)
+         *
+         * @see execute_batch
+         * @see execute_adjoint_batch
+         */
+        void set_times(size_t tsize, size_t tstride, const double *times);
+
+        /** Precompute interpolation weights for a fixed set of locations.
+         *
+         * @param[in] times     Sample locations in [0:n)
+         */
+        void set_times(const std::valarray<double> &times);
+
+        /** Execute several transforms at the locations given to set_times.
+         *
+         * Each transform is equivalent to execute() with the same times.
+         *
+         * @param[in]  howmany  Number of transforms (positive).
+         * @param[in]  spectrum Signals to transform, in FFTW order, each of
+         *                      length size_spectrum().
+         * @param[in]  idist    Distance between first elements of
+         *                      consecutive spectra.
+         * @param[out] out      Storage for output signals, each of length
+         *                      size_times().
+         * @param[in]  odist    Distance between first elements of
+         *                      consecutive output signals.
+         */
+        void execute_batch(size_t howmany,
+                           const std::complex<T> *spectrum, size_t idist,
+                           std::complex<T> *out, size_t odist);
+
+        /** Execute several adjoint transforms at the locations given to
+         * set_times.
+         *
+         * Each transform is equivalent to execute_adjoint() with the same
+         * times.
+         *
+         * @param[in]  howmany      Number of transforms (positive).
+         * @param[in]  time_series  Signals to transform, each of length
+         *                          size_times().
+         * @param[in]  idist        Distance between first elements of
+         *                          consecutive input signals.
+         * @param[out] spectrum     Storage for output spectra, each of
+         *                          length size_spectrum().
+         * @param[in]  odist        Distance between first elements of
+         *                          consecutive spectra.
+         */
+        void execute_adjoint_batch(size_t howmany,
+                                   const std::complex<T> *time_series,
+                                   size_t idist,
+                                   std::complex<T> *spectrum, size_t odist);
+
         size_t size_kernel() const {return 2*_m+1;}
         size_t size_spectrum() const {return _n;}
         size_t size_transform() const {return _fft_size;}
+        size_t size_times() const {return _psi_low.size();}
 
     private:
+        // Scale and zero-pad spectrum x into transform buffer xf.
+        void _pad_spectrum(size_t stride, const std::complex<T> *x,
+                           std::complex<T> *xf) const;
+
+        // Remove filter response from transform buffer xf and copy the
+        // spectrum to x.
+        void _unpad_spectrum(const std::complex<T> *xf, size_t stride,
+                             std::complex<T> *x) const;
+
+        // Allocate and plan batch transform buffers.
+        void _plan_batch(size_t howmany);
+
         size_t _m, _n, _fft_size;
         std::valarray<std::complex<T>> _xf, _xt;
         std::valarray<T> _weights;
         isce3::core::NFFTKernel<T> _kernel;
         isce3::signal::Signal<T> _fft;
+
+        // Precomputed kernel weights, size_times() x size_kernel(), and
+        // index of first weight on the oversampled grid (in [0, fft_size)).
+        std::valarray<T> _psi;
+        std::vector<long> _psi_low;
+        // Sample indices sorted by grid location and offsets into this list
+        // for the start of each bin (length number of bins + 1).
+        std::vector<size_t> _order;
+        std::vector<size_t> _bin_start;
+
+        // Buffers and plans for batched transforms.
+        size_t _batch_size = 0;
+        std::valarray<std::complex<T>> _xf_batch, _xt_batch;
+        isce3::signal::Signal<T> _fft_batch;
 };
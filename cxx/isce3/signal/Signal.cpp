@@ -1,11 +1,113 @@
 #include "Signal.h"
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <isce3/core/BufferPool.h>
 #include "fftw3cxx.h"
 
+namespace {
+
+// Thresholds of the automatic mode, measured with single-threaded
+// FFTW_ESTIMATE plans of FFTW 3.3.10 on complex<float> blocks (x86-64, 48 KiB
+// L1d, 2 MiB L2). Transposing was 1.6-5x faster than the strided plan from
+// 256 rows up for rows of 128 samples or more, but 1.5-3x slower at 128 rows
+// or fewer whatever the row size, and break-even at 256 rows of 64 samples.
+// AzimuthFFTMode overrides them where another machine disagrees.
+
+// Smallest row size (bytes) for which the automatic mode transposes the
+// azimuth FFTs
+constexpr size_t TRANSPOSED_AZIMUTH_MIN_ROW_BYTES = 1024;
+
+// Smallest number of rows for which the automatic mode transposes the
+// azimuth FFTs
+constexpr int TRANSPOSED_AZIMUTH_MIN_ROWS = 256;
+
+// Side of the square tiles of the blocked transpose, so that a tile of the
+// input and of the output fit together in L1 cache
+constexpr int TRANSPOSE_TILE = 32;
+
+// Transpose a row-major nrows x ncols array into a row-major ncols x nrows
+// array, tile by tile
+template<class T>
+void transposeBlocked(const std::complex<T>* in, std::complex<T>* out,
+                      int nrows, int ncols)
+{
+    #pragma omp parallel for collapse(2) schedule(static)
+    for (int i0 = 0; i0 < nrows; i0 += TRANSPOSE_TILE) {
+        for (int j0 = 0; j0 < ncols; j0 += TRANSPOSE_TILE) {
+            const int i1 = std::min(i0 + TRANSPOSE_TILE, nrows);
+            const int j1 = std::min(j0 + TRANSPOSE_TILE, ncols);
+            for (int j = j0; j < j1; ++j) {
+                for (int i = i0; i < i1; ++i) {
+                    out[size_t(j) * nrows + i] = in[size_t(i) * ncols + j];
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
 template<class T>
 struct isce3::signal::Signal<T>::impl {
     isce3::fftw3cxx::plan<T> _plan_fwd;
     isce3::fftw3cxx::plan<T> _plan_inv;
+
+    isce3::signal::AzimuthFFTMode _azimuth_mode =
+            isce3::signal::AzimuthFFTMode::Auto;
+
+    // shape of the blocks of the plans made for the transposed azimuth
+    // FFTs, the plans being strided when they are false
+    bool _fwd_transposed = false;
+    bool _inv_transposed = false;
+    int _fwd_ncolumns = 0, _fwd_nrows = 0;
+    int _inv_ncolumns = 0, _inv_nrows = 0;
+
+    bool useTransposedAzimuth(int ncolumns, int nrows) const {
+        switch (_azimuth_mode) {
+            case isce3::signal::AzimuthFFTMode::Strided:
+                return false;
+            case isce3::signal::AzimuthFFTMode::Transposed:
+                return true;
+            default:
+                return nrows >= TRANSPOSED_AZIMUTH_MIN_ROWS &&
+                       ncolumns * sizeof(std::complex<T>) >=
+                               TRANSPOSED_AZIMUTH_MIN_ROW_BYTES;
+        }
+    }
+
+    // transposed block, borrowed from the buffer pool so that repeated
+    // transforms do not allocate. Its buffers are page-aligned, so that the
+    // plans made on one of them may execute on another.
+    static isce3::core::PooledBuffer work(size_t size) {
+        return isce3::core::BufferPool::instance().acquire(
+                size * sizeof(std::complex<T>));
+    }
+
+    // unit-stride transforms of the ncolumns rows of nrows samples of the
+    // transposed block, in place in the work buffer. FFTW_ESTIMATE does not
+    // write the buffer, so it is only needed while planning.
+    isce3::fftw3cxx::plan<T> planTransposedAzimuth(int ncolumns, int nrows,
+                                                   int sign) {
+        auto buffer = work(size_t(ncolumns) * nrows);
+        auto* data = static_cast<std::complex<T>*>(buffer.data());
+        return isce3::fftw3cxx::plan<T>::plan_many_dft(1, &nrows, ncolumns,
+                data, nullptr, 1, nrows,
+                data, nullptr, 1, nrows,
+                sign, FFTW_ESTIMATE);
+    }
+
+    // Each call borrows its own work buffer, so that the forward and inverse
+    // transforms may run concurrently like the strided ones
+    void executeTransposed(const isce3::fftw3cxx::plan<T>& plan,
+                           std::complex<T>* input, std::complex<T>* output,
+                           int ncolumns, int nrows) const {
+        auto buffer = work(size_t(ncolumns) * nrows);
+        auto* data = static_cast<std::complex<T>*>(buffer.data());
+        transposeBlocked(input, data, nrows, ncolumns);
+        plan.execute_dft(data, data);
+        transposeBlocked(data, output, ncolumns, nrows);
+    }
 };
 
 template <class T>
@@ -19,6 +121,35 @@ Signal(int nthreads) : pimpl(new impl, [](impl* p) { delete p; }) {
     fftw3cxx::plan_with_nthreads<T>(nthreads);
 }
 
+/** @param[in] mode memory access of the complex azimuth FFTs */
+template <class T>
+void
+isce3::signal::Signal<T>::
+azimuthFFTMode(isce3::signal::AzimuthFFTMode mode)
+{
+    pimpl->_azimuth_mode = mode;
+}
+
+template <class T>
+isce3::signal::AzimuthFFTMode
+isce3::signal::Signal<T>::
+azimuthFFTMode() const
+{
+    return pimpl->_azimuth_mode;
+}
+
+/**
+ * @param[in] ncolumns number of columns of the block
+ * @param[in] nrows number of rows of the block
+ */
+template <class T>
+bool
+isce3::signal::Signal<T>::
+transposedAzimuthFFT(int ncolumns, int nrows) const
+{
+    return pimpl->useTransposedAzimuth(ncolumns, nrows);
+}
+
 /**
 *  @param[in] input block of data
 *  @param[out] output block of data
@@ -75,6 +206,7 @@ fftPlanForward(std::complex<T> *input, std::complex<T> *output,
     _fwd_configure(rank, n, howmany, 
                inembed, istride, idist, 
                onembed, ostride, odist);
+    pimpl->_fwd_transposed = false;
 
     pimpl->_plan_fwd = fftw3cxx::plan<T>::plan_many_dft(rank, n, howmany,
                                             input, inembed, istride, idist,
@@ -135,6 +267,7 @@ fftPlanForward(T *input, std::complex<T> *output,
     _fwd_configure(rank, n, howmany, 
                inembed, istride, idist, 
                onembed, ostride, odist);
+    pimpl->_fwd_transposed = false;
 
     pimpl->_plan_fwd = fftw3cxx::plan<T>::plan_many_dft_r2c(rank, n, howmany,
                                             input, inembed, istride, idist,
@@ -201,6 +334,7 @@ fftPlanBackward(std::complex<T> *input, std::complex<T> *output,
     _rev_configure(rank, n, howmany, 
                inembed, istride, idist, 
                onembed, ostride, odist);
+    pimpl->_inv_transposed = false;
 
     pimpl->_plan_inv = fftw3cxx::plan<T>::plan_many_dft(rank, n, howmany,
                                             input, inembed, istride, idist,
@@ -263,6 +397,7 @@ fftPlanBackward(std::complex<T> *input, T *output,
     _rev_configure(rank, n, howmany, 
                inembed, istride, idist, 
                onembed, ostride, odist);
+    pimpl->_inv_transposed = false;
 
     pimpl->_plan_inv = fftw3cxx::plan<T>::plan_many_dft_c2r(rank, n, howmany,
                                             input, inembed, istride, idist,
@@ -280,7 +415,7 @@ void
 isce3::signal::Signal<T>::
 forward(std::valarray<std::complex<T>> &input, std::valarray<std::complex<T>> &output)
 {
-    pimpl->_plan_fwd.execute_dft(&input[0], &output[0]);
+    forward(&input[0], &output[0]);
 }
 
 /** unnormalized forward transform
@@ -292,7 +427,12 @@ void
 isce3::signal::Signal<T>::
 forward(std::complex<T> *input, std::complex<T> *output)
 {
-    pimpl->_plan_fwd.execute_dft(input, output);
+    if (pimpl->_fwd_transposed) {
+        pimpl->executeTransposed(pimpl->_plan_fwd, input, output,
+                                 pimpl->_fwd_ncolumns, pimpl->_fwd_nrows);
+    } else {
+        pimpl->_plan_fwd.execute_dft(input, output);
+    }
 }
 
 /** unnormalized forward transform
@@ -333,7 +473,7 @@ void
 isce3::signal::Signal<T>::
 inverse(std::valarray<std::complex<T>> &input, std::valarray<std::complex<T>> &output)
 {
-    pimpl->_plan_inv.execute_dft(&input[0], &output[0]);
+    inverse(&input[0], &output[0]);
 }
 
 /** unnormalized inverse transform.*/
@@ -342,7 +482,12 @@ void
 isce3::signal::Signal<T>::
 inverse(std::complex<T> *input, std::complex<T> *output)
 {
-    pimpl->_plan_inv.execute_dft(input, output);
+    if (pimpl->_inv_transposed) {
+        pimpl->executeTransposed(pimpl->_plan_inv, input, output,
+                                 pimpl->_inv_ncolumns, pimpl->_inv_nrows);
+    } else {
+        pimpl->_plan_inv.execute_dft(input, output);
+    }
 }
 
 /** unnormalized inverse transform.*/
@@ -474,6 +619,15 @@ forwardAzimuthFFT(std::complex<T> *signal,
 
     _fwd_configureAzimuthFFT(ncolumns, nrows);
 
+    if (pimpl->useTransposedAzimuth(ncolumns, nrows)) {
+        pimpl->_plan_fwd = pimpl->planTransposedAzimuth(ncolumns, nrows,
+                                                        FFTW_FORWARD);
+        pimpl->_fwd_transposed = true;
+        pimpl->_fwd_ncolumns = ncolumns;
+        pimpl->_fwd_nrows = nrows;
+        return;
+    }
+
     fftPlanForward(signal, spectrum, _fwd_rank, _fwd_n, _fwd_howmany,
                 _fwd_inembed, _fwd_istride, _fwd_idist,
                 _fwd_onembed, _fwd_ostride, _fwd_odist, FFTW_FORWARD);
@@ -785,11 +939,7 @@ inverseAzimuthFFT(std::valarray<std::complex<T>> &spectrum,
                 int ncolumns, int nrows)
 {
 
-    _rev_configureAzimuthFFT(ncolumns, nrows);
-
-    fftPlanBackward(spectrum, signal, _rev_rank, _rev_n, _rev_howmany,
-                    _rev_inembed, _rev_istride, _rev_idist,
-                    _rev_onembed, _rev_ostride, _rev_odist, FFTW_BACKWARD);
+    inverseAzimuthFFT(&spectrum[0], &signal[0], ncolumns, nrows);
 }
 
 /**
@@ -807,6 +957,15 @@ inverseAzimuthFFT(std::complex<T>* spectrum,
 
     _rev_configureAzimuthFFT(ncolumns, nrows);
 
+    if (pimpl->useTransposedAzimuth(ncolumns, nrows)) {
+        pimpl->_plan_inv = pimpl->planTransposedAzimuth(ncolumns, nrows,
+                                                        FFTW_BACKWARD);
+        pimpl->_inv_transposed = true;
+        pimpl->_inv_ncolumns = ncolumns;
+        pimpl->_inv_nrows = nrows;
+        return;
+    }
+
     fftPlanBackward(spectrum, signal, _rev_rank, _rev_n, _rev_howmany,
                     _rev_inembed, _rev_istride, _rev_idist,
                     _rev_onembed, _rev_ostride, _rev_odist, FFTW_BACKWARD);
@@ -16,6 +16,21 @@
 #include <isce3/core/Constants.h>
 #include <isce3/core/EMatrix.h>
 
+namespace isce3 { namespace signal {
+
+/** Memory access of the complex azimuth FFTs planned by
+ * Signal::forwardAzimuthFFT and Signal::inverseAzimuthFFT */
+enum class AzimuthFFTMode {
+    Auto,       /**< Transposed for blocks of at least 256 rows of at
+                     least 1 KiB, Strided otherwise */
+    Strided,    /**< transform the columns in place, with a stride of one
+                     row between consecutive samples */
+    Transposed, /**< transpose the block by tiles into a work buffer,
+                     transform its contiguous rows and transpose back */
+};
+
+}} // namespace isce3::signal
+
 /** A class to handle 2D FFT or 1D FFT in range or azimuth directions 
  */
 template<class T> 
@@ -29,6 +44,18 @@ class isce3::signal::Signal {
 
         ~Signal() {};
 
+        /** Set the memory access of the complex azimuth FFTs. Takes effect
+         * on the next call to forwardAzimuthFFT or inverseAzimuthFFT. */
+        void azimuthFFTMode(isce3::signal::AzimuthFFTMode mode);
+
+        /** Get the memory access of the complex azimuth FFTs */
+        isce3::signal::AzimuthFFTMode azimuthFFTMode() const;
+
+        /** Whether the complex azimuth FFTs of a block of the given shape
+         * are transposed under the current mode. A transposed transform
+         * allocates a work buffer of the size of the block for each call. */
+        bool transposedAzimuthFFT(int ncolumns, int nrows) const;
+
         /** \brief initiate forward FFTW3 plan for a block of complex data
          *  input parameters follow FFTW3 interface for fftw_plan_many_dft
          */
@@ -176,7 +203,8 @@ class isce3::signal::Signal {
         /** \brief initiate plan for forward FFT in azimuth direction 
          * for a block of complex data.
          * azimuth direction is assumed to be in the direction of the
-         * rows of the array.
+         * rows of the array. See azimuthFFTMode for the memory access
+         * of the planned transforms.
          */
         void forwardAzimuthFFT(std::valarray<std::complex<T>> &signal,
                                 std::valarray<std::complex<T>> &spectrum,
@@ -185,7 +213,8 @@ class isce3::signal::Signal {
         /** \brief initiate plan for forward FFT in azimuth direction
          * for a block of complex data.
          * azimuth direction is assumed to be in the direction of the
-         * rows of the array.
+         * rows of the array. See azimuthFFTMode for the memory access
+         * of the planned transforms.
          */
         void forwardAzimuthFFT(std::complex<T>* signal,
                                 std::complex<T>* spectrum,
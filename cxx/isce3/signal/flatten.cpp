@@ -1,6 +1,9 @@
 #include "flatten.h"
 
+#include <vector>
+
 #include <isce3/except/Error.h>
+#include <isce3/math/Phasor.h>
 
 void isce3::signal::flatten(
         Eigen::Ref<isce3::core::EArray2D<std::complex<float>>> ifgram,
@@ -27,14 +30,19 @@ void isce3::signal::flatten(
         throw isce3::except::DomainError(
                 ISCE_SRCINFO(), "Radar wavelength must be a positive number.");
     }
-    isce3::core::EArray2D<std::complex<float>> geometry_ifg(ifgram.rows(),
-                                                            ifgram.cols());
-    auto range_offset_phase =
-            4.0 * M_PI * range_spacing * range_offset / wavelength;
-
-    // store phase in complex container
-    geometry_ifg.real() = range_offset_phase.cos().cast<float>();
-    geometry_ifg.imag() = range_offset_phase.sin().cast<float>();
+    const double phase_scale = 4.0 * M_PI * range_spacing / wavelength;
+    const auto rows = ifgram.rows();
+    const auto cols = ifgram.cols();
 
-    ifgram *= geometry_ifg.conjugate();
+    // remove the geometric phase of each line
+#pragma omp parallel
+    {
+        std::vector<double> phase(cols);
+#pragma omp for
+        for (Eigen::Index i = 0; i < rows; ++i) {
+            for (Eigen::Index j = 0; j < cols; ++j)
+                phase[j] = -phase_scale * range_offset(i, j);
+            isce3::math::rotate(&ifgram(i, 0), phase.data(), cols);
+        }
+    }
 }
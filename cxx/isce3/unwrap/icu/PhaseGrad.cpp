@@ -1,5 +1,7 @@
 #include <complex> // std::complex, std::conj, std::arg
 
+#include <isce3/core/Numa.h> // firstTouchFill
+
 #include "PhaseGrad.h" // calcPhaseGrad
 
 namespace isce3::unwrap::icu
@@ -29,17 +31,13 @@ void _calcPhaseGrad(
     }
     for (int i = 0; i < WINSIZE * WINSIZE; ++i) { weights[i] /= sum; }
 
-    // Init phase slope.
-    const size_t tilesize = length * width;
-    for (size_t i = 0; i < tilesize; ++i)
-    {
-        phasegradx[i] = 0.f;
-        phasegrady[i] = 0.f;
-    }
+    // Init phase slope, with the static schedule over rows of the loop below.
+    isce3::core::firstTouchFill(phasegradx, length, width, 0.f);
+    isce3::core::firstTouchFill(phasegrady, length, width, 0.f);
 
     // Compute smoothed phase slope using a weighted average of phase
     // differences.
-    #pragma omp parallel for collapse(2)
+    #pragma omp parallel for schedule(static)
     for (size_t j = WINSIZE/2 + 1; j < length - WINSIZE/2; ++j)
     {
         for (size_t i = WINSIZE/2 + 1; i < width - WINSIZE/2; ++i)
@@ -92,17 +90,13 @@ void _calcPhaseGrad(
     }
     for (int i = 0; i < winsize * winsize; ++i) { weights[i] /= sum; }
 
-    // Init phase slope.
-    const size_t tilesize = length * width;
-    for (size_t i = 0; i < tilesize; ++i)
-    {
-        phasegradx[i] = 0.f;
-        phasegrady[i] = 0.f;
-    }
+    // Init phase slope, with the static schedule over rows of the loop below.
+    isce3::core::firstTouchFill(phasegradx, length, width, 0.f);
+    isce3::core::firstTouchFill(phasegrady, length, width, 0.f);
 
     // Compute smoothed phase slope using a weighted average of phase
     // differences.
-    #pragma omp parallel for collapse(2)
+    #pragma omp parallel for schedule(static)
     for (size_t j = winsize/2 + 1; j < length - winsize/2; ++j)
     {
         for (size_t i = winsize/2 + 1; i < width - winsize/2; ++i)
@@ -2,6 +2,8 @@
 #include <cstring> // std::memcpy
 #include <exception> // std::domain_error
 
+#include <isce3/core/Instrumentation.h> // ScopedTimer
+
 #include "ICU.h" // ICU, isce3::io::Raster, size_t, uint8_t
 
 namespace isce3::unwrap::icu
@@ -62,29 +64,42 @@ void ICU::unwrap(
     }
 
     // Loop over tiles.
+    namespace instrumentation = isce3::core::instrumentation;
     for (int t = 0; t < ntiles; ++t)
     {
+        instrumentation::ScopedTimer tileTimer("icu.tile");
+
         // Read interferogram, correlation lines.
         size_t startline = t * step;
         size_t tilelen = std::min(_NumBufLines, length - startline);
+        instrumentation::ScopedTimer readTimer("icu.read");
         intf.getBlock(intftile, 0, startline, width, tilelen);
         corr.getBlock(corrtile, 0, startline, width, tilelen);
+        readTimer.stop();
+        instrumentation::count("icu.pixels", tilelen * width);
 
         // Compute wrapped phase.
         size_t tilesize = tilelen * width;
         for (size_t i = 0; i < tilesize; ++i) { phase[i] = std::arg(intftile[i]); }
 
         // Get residue charges.
+        instrumentation::ScopedTimer residueTimer("icu.residues");
         getResidues(charge, phase, tilelen, width);
+        residueTimer.stop();
 
         // Generate neutrons to guide the tree-growing process.
+        instrumentation::ScopedTimer neutronTimer("icu.neutrons");
         genNeutrons(neut, intftile, corrtile, tilelen, width);
+        neutronTimer.stop();
 
         // Grow trees (make branch cuts).
+        instrumentation::ScopedTimer treeTimer("icu.trees");
         growTrees(tree, charge, neut, tilelen, width, seed);
+        treeTimer.stop();
 
         // Grow grass (find connected components and unwrap phase). If not first 
         // tile, bootstrap phase from previous tile.
+        instrumentation::ScopedTimer grassTimer("icu.grass");
         if (t == 0)
         {
             growGrass<false>(
@@ -98,6 +113,8 @@ void ICU::unwrap(
                 tree, corrtile, _InitCorrThr, tilelen, width);
         }
 
+        grassTimer.stop();
+
         // If not last tile, get bootstrap data for processing next tile.
         if (t < ntiles-1)
         {
@@ -110,6 +127,7 @@ void ICU::unwrap(
         }
 
         // Write out unwrapped phase, connected component labels.
+        instrumentation::ScopedTimer writeTimer("icu.write");
         unw.setBlock(unwtile, 0, startline, width, tilelen);
         ccl.setBlock(ccltile, 0, startline, width, tilelen);
     }
@@ -15,6 +15,7 @@
 #include "PhaseStatistics.h"
 #include "ASSP.h"
 #include "BMFS.h"
+#include "PixelQueue.h"
 #include "Point.h"
 #include "sort.h"
 
@@ -1131,11 +1132,12 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
 
   double two_pi = 2.0 * 3.14159265;
   double x, seed_phase;
-  Point point, seed;
+  Point seed;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelQueue workq(nr_lines * nr_pixels);
+  const LineOfIndex line_of(nr_pixels);
 
   for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
     //  char unwrapped = seed_id + 1;
@@ -1149,15 +1151,15 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
     visit[seed_y][seed_x] = unwrapped;
     phase_data[seed_y][seed_x] += seeds[seed_id].nr_2pi * two_pi;
 
-    workq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push(seed_y * nr_pixels + seed_x);
 
     // cerr << "Seed: " << Point(seed_x, seed_y) << "  nr_2pi: " << seeds[seed_id].nr_2pi << "  seed phase: " << phase_data[seed_y][seed_x] << endl;
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      const uint32_t index = workq.pop();
+      line  = line_of(index);
+      pixel = index - line * nr_pixels;
 //      visit[line][pixel] = unwrapped;
 
       seed_phase = phase_data[line][pixel];
@@ -1169,7 +1171,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
 
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
+	  workq.push(line_minus * nr_pixels + pixel);
 	  x = phase_data[line_minus][pixel] - seed_phase;
 	  phase_data[line_minus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_minus][pixel] = unwrapped;
@@ -1177,7 +1179,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       }
       if(line < nr_lines - 1) {   // facing down ......
 	if(flows[line + 1][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
+	  workq.push(line_plus * nr_pixels + pixel);
 	  x = phase_data[line_plus][pixel] - seed_phase;
 	  phase_data[line_plus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_plus][pixel] = unwrapped;
@@ -1185,7 +1187,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
+	  workq.push(line * nr_pixels + pixel_minus);
 	  x = phase_data[line][pixel_minus] - seed_phase;
 	  phase_data[line][pixel_minus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_minus] = unwrapped;
@@ -1193,7 +1195,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
+	  workq.push(line * nr_pixels + pixel_plus);
 	  x = phase_data[line][pixel_plus] - seed_phase;
 	  phase_data[line][pixel_plus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_plus] = unwrapped;
@@ -1244,11 +1246,12 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
     }
   }
 
-  Point point, seed;
+  Point seed;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelQueue workq(nr_lines * nr_pixels);
+  const LineOfIndex line_of(nr_pixels);
 
   int region_id = 0;
 
@@ -1268,7 +1271,8 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
 
 
       int count = 0;
-      workq.push(Point(jj, ii));
+      workq.clear();
+      workq.push(ii * nr_pixels + jj);
 
       visit[ii][jj] = unwrapped;
 
@@ -1277,10 +1281,9 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
       tmp_seeds[region_id].nr_2pi = 0;
 
       while( !workq.empty() ) {
-	point = workq.front();
-	workq.pop();
-	line  = point.get_Y();
-	pixel = point.get_X();
+	const uint32_t index = workq.pop();
+	line  = line_of(index);
+	pixel = index - line * nr_pixels;
 
 	count ++;
 
@@ -1298,25 +1301,25 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
 
 	if(line > 0) {              // facing up ......
 	  if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	    workq.push(Point(pixel, line_minus));
+	    workq.push(line_minus * nr_pixels + pixel);
 	    visit[line_minus][pixel] = unwrapped;
 	  }
 	}
 	if(line < nr_lines - 1) {   // facing down ......
 	  if(flows[line_plus][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	    workq.push(Point(pixel, line_plus));
+	    workq.push(line_plus * nr_pixels + pixel);
 	    visit[line_plus][pixel] = unwrapped;
 	  }
 	}
 	if(pixel > 0) {             // facing left ......
 	  if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	    workq.push(Point(pixel_minus, line));
+	    workq.push(line * nr_pixels + pixel_minus);
 	    visit[line][pixel_minus] = unwrapped;
 	  }
 	}
 	if(pixel < nr_pixels - 1) {// facing right ......
 	  if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	    workq.push(Point(pixel_plus, line));
+	    workq.push(line * nr_pixels + pixel_plus);
 	    visit[line][pixel_plus] = unwrapped;
 	  }
 	}
@@ -1397,11 +1400,12 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
 
   double two_pi = 2.0 * 3.14159265;
   double x, seed_phase;
-  Point point, seed;
+  Point seed;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq, backupq;
+  PixelQueue workq(nr_lines * nr_pixels);
+  const LineOfIndex line_of(nr_pixels);
 
   int nr_amb = 21;
   int *histogram = new int[nr_amb];
@@ -1421,16 +1425,15 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
 
     phase_data[seed_y][seed_x] += seeds[seed_id].nr_2pi * two_pi;
 
-    workq.push(Point(seed_x, seed_y));
-    backupq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push(seed_y * nr_pixels + seed_x);
 
     for(int i = 0; i < nr_amb; i++) histogram[i] = 0;
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      const uint32_t index = workq.pop();
+      line  = line_of(index);
+      pixel = index - line * nr_pixels;
       visit[line][pixel] = unwrapped;
 
       seed_phase = phase_data[line][pixel];
@@ -1448,8 +1451,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
 
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
-	  backupq.push(Point(pixel, line_minus));
+	  workq.push(line_minus * nr_pixels + pixel);
 	  x = phase_data[line_minus][pixel] - seed_phase;
 	  phase_data[line_minus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_minus][pixel] = unwrapped;
@@ -1457,8 +1459,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       }
       if(line < nr_lines - 1) {   // facing down ......
 	if(flows[line + 1][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
-	  backupq.push(Point(pixel, line_plus));
+	  workq.push(line_plus * nr_pixels + pixel);
 	  x = phase_data[line_plus][pixel] - seed_phase;
 	  phase_data[line_plus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_plus][pixel] = unwrapped;
@@ -1466,8 +1467,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
-	  backupq.push(Point(pixel_minus, line));
+	  workq.push(line * nr_pixels + pixel_minus);
 	  x = phase_data[line][pixel_minus] - seed_phase;
 	  phase_data[line][pixel_minus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_minus] = unwrapped;
@@ -1475,8 +1475,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
-	  backupq.push(Point(pixel_plus, line));
+	  workq.push(line * nr_pixels + pixel_plus);
 	  x = phase_data[line][pixel_plus] - seed_phase;
 	  phase_data[line][pixel_plus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_plus] = unwrapped;
@@ -1498,19 +1497,13 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
     if(N != 0) {
       seeds[seed_id].nr_2pi -= N;
       double phase_adjust = two_pi * N;
-      while( !backupq.empty() ) {
-        point = backupq.front();
-        backupq.pop();
-        line  = point.get_Y();
-        pixel = point.get_X();
+      // every pixel pushed for this seed, in fill order
+      for(const uint32_t index : workq.pushed()) {
+        line  = line_of(index);
+        pixel = index - line * nr_pixels;
 	phase_data[line][pixel] -= phase_adjust;
       }
     }
-    else {
-      while( !backupq.empty() ) {
-        backupq.pop();
-      }
-    }
   }
 
   for(line = 0; line < nr_lines; line ++) {
@@ -1551,11 +1544,12 @@ DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds
     }
   }
 
-  Point point, seed;
+  Point seed;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelQueue workq(nr_lines * nr_pixels);
+  const LineOfIndex line_of(nr_pixels);
 
   for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
 
@@ -1565,13 +1559,13 @@ DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds
 
     if(visit[seed_y][seed_x] != not_unwrapped) continue;
 
-    workq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push(seed_y * nr_pixels + seed_x);
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      const uint32_t index = workq.pop();
+      line  = line_of(index);
+      pixel = index - line * nr_pixels;
       visit[line][pixel] = seed_id;
 
 
@@ -1582,25 +1576,25 @@ DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds
 
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
+	  workq.push(line_minus * nr_pixels + pixel);
 	  visit[line_minus][pixel] = seed_id;
 	}
       }
       if(line < nr_lines - 1) {   // facing down ......
 	if(flows[line + 1][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
+	  workq.push(line_plus * nr_pixels + pixel);
 	  visit[line_plus][pixel] = seed_id;
 	}
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
+	  workq.push(line * nr_pixels + pixel_minus);
 	  visit[line][pixel_minus] = seed_id;
 	}
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
+	  workq.push(line * nr_pixels + pixel_plus);
 	  visit[line][pixel_plus] = seed_id;
 	}
       }
@@ -1632,11 +1626,12 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
     }
   }
 
-  Point point, seed;
+  Point seed;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelQueue workq(nr_lines * nr_pixels);
+  const LineOfIndex line_of(nr_pixels);
 
   for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
 
@@ -1646,13 +1641,13 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
 
     if(regions[seed_y][seed_x] != not_unwrapped) continue;
 
-    workq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push(seed_y * nr_pixels + seed_x);
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      const uint32_t index = workq.pop();
+      line  = line_of(index);
+      pixel = index - line * nr_pixels;
       regions[line][pixel] = seed_id;
 
 
@@ -1663,25 +1658,25 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
 
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && regions[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
+	  workq.push(line_minus * nr_pixels + pixel);
 	  regions[line_minus][pixel] = seed_id;
 	}
       }
       if(line < nr_lines - 1) {   // facing down ......
 	if(flows[line + 1][pixel].toRight == 0 && regions[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
+	  workq.push(line_plus * nr_pixels + pixel);
 	  regions[line_plus][pixel] = seed_id;
 	}
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && regions[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
+	  workq.push(line * nr_pixels + pixel_minus);
 	  regions[line][pixel_minus] = seed_id;
 	}
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && regions[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
+	  workq.push(line * nr_pixels + pixel_plus);
 	  regions[line][pixel_plus] = seed_id;
 	}
       }
@@ -1936,11 +1931,9 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 
   // First scan the nodes in S and initialize them ......
 
-  int nr_queues = cost_scale * min(ncols, nrows) * 2;
-
-  queue<Point> *dist_queues = new queue<Point>[nr_queues];
-
-  Point point;
+  // labeled pixels as linear indices, by distance
+  BucketQueue dist_queues;
+  const LineOfIndex line_of(ncols);
 
   uint d, curr_dist, reduced_cost;
 
@@ -1978,9 +1971,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
       if(nodes[line][pixel].supply == 0) continue;   // if Residue discharged
       dists[ line ][ pixel ] = 0;  // Otherwise set all left-over supplys to zero distance
       visit[line][pixel] = labeled;
-      point.x = pixel;
-      point.y = line;
-      dist_queues[0].push(point);
+      dist_queues.push(0, line * ncols + pixel);
 
 //cerr << "s: " << s << "  point: " << point << "  dist: " << dists[ line ][ pixel ] << endl;
 
@@ -1994,12 +1985,10 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 //    int scanned_count = 0;
     int min_dist = 0;
     int max_dist = 0;
-    while(!dist_queues[min_dist].empty()) {  // as long as the labeled_set is not empty, do the following ......
-      point = dist_queues[min_dist].front();
-      dist_queues[min_dist].pop();
-
-      line = point.y;
-      pixel = point.x;
+    while(!dist_queues.empty(min_dist)) {  // as long as the labeled_set is not empty, do the following ......
+      const uint32_t index = dist_queues.pop(min_dist);
+      line = line_of(index);
+      pixel = index - line * ncols;
 
 //	if(pixel == 3 && line == 3) cerr << "iter: " << iter << "   min_dist: " << min_dist << "  scanned: " << point << "  dist: " << dists[line][pixel] << endl;
 
@@ -2008,14 +1997,12 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
       if(visit[line][pixel] == scanned) {
 	//if(nodes[line][pixel].supply == demand) scanned_count ++;
 
-	while( dist_queues[min_dist].empty()){
+	if(dist_queues.empty()) break;
+	while( dist_queues.empty(min_dist)){
 	  min_dist ++;
-	  if(min_dist >= nr_queues) break;
 	}
 //	if(pixel == 3 && line == 3) cerr << "after   min_dist: " << min_dist << endl;
 
-	if(min_dist >= nr_queues) break;
-
 	continue;
       }
 
@@ -2042,9 +2029,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
           visit[line][pixel - 1] = labeled;
 	  dists[line][pixel - 1] = d;
 	  branches[line][pixel - 1] = flow_right;
-	  point.x = pixel - 1;
-	  point.y = line;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, line * ncols + pixel - 1);
 	  if(d > max_dist) max_dist = d;
 	  if(d < tmp_mind) tmp_mind = d;
 
@@ -2068,9 +2053,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 	  visit[line][pixel + 1] = labeled;
 	  dists[line][pixel + 1] = d;
 	  branches[line][pixel + 1] = flow_left;
-	  point.x = pixel + 1;
-	  point.y = line;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, line * ncols + pixel + 1);
 	  if(d > max_dist) max_dist = d;
 	  if(d < tmp_mind) tmp_mind = d;
 	  // cerr << "Right  d : " << d << endl;
@@ -2093,9 +2076,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 	  visit[line - 1][pixel] = labeled;
 	  dists[line - 1][pixel] = d;
 	  branches[line - 1][pixel] = flow_down;
-	  point.x = pixel;
-	  point.y = line - 1;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, (line - 1) * ncols + pixel);
 	  if(d > max_dist) max_dist = d;
 	  if(d < tmp_mind) tmp_mind = d;
 	  // cerr << "UP  d : " << d << endl;
@@ -2118,9 +2099,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 	  visit[line + 1][pixel] = labeled;
 	  dists[line + 1][pixel] = d;
 	  branches[line + 1][pixel] = flow_up;
-	  point.x = pixel;
-	  point.y = line + 1;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, (line + 1) * ncols + pixel);
 	  if(d < tmp_mind) tmp_mind = d;
 	  if(d > max_dist) max_dist = d;
 
@@ -2133,7 +2112,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 
       if(tmp_mind < min_dist) min_dist = tmp_mind;
 
-      while( dist_queues[min_dist].empty()){
+      while( dist_queues.empty(min_dist)){
 	min_dist ++;
 	if(min_dist > max_dist) break;
       }
@@ -2380,7 +2359,6 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
   delete[] indexes;
   delete[] dd;
 
-  if(dist_queues) delete[] dist_queues;
   delete[] S;
   delete[] T;
 
@@ -6,7 +6,278 @@
 
 #include "Phass.h"
 
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <pyre/journal.h>
+
+#include <isce3/core/Numa.h>
 #include <isce3/core/Utilities.h>
+#include <isce3/except/Error.h>
+
+#include "DataPatch.h"
+
+namespace {
+
+using isce3::io::Raster;
+
+// Neighbours of a tile
+constexpr int LEFT = 0;
+constexpr int RIGHT = 1;
+constexpr int UP = 2;
+constexpr int DOWN = 3;
+
+constexpr int opposite(int side) { return side ^ 1; }
+
+// Tile of the scene. The tile is unwrapped over [y0, y1) x [x0, x1), and
+// writes its outputs over the core [coreY0, coreY1) x [coreX0, coreX1),
+// which does not overlap the cores of the other tiles.
+struct Tile {
+    size_t coreY0, coreY1, coreX0, coreX1;
+    size_t y0, y1, x0, x1;
+    // index of the neighbouring tile on each side, -1 if none
+    std::array<long, 4> neighbours;
+};
+
+// Unwrapped phase and local labels (-1 outside of any region) of a tile over
+// the pixels it shares with one of its neighbours
+struct Seam {
+    std::vector<float> unw;
+    std::vector<int> labels;
+};
+
+// Split [0, size) into cores of tileSize elements and extend each core by
+// half of the overlap on both sides
+std::vector<std::array<size_t, 4>> tileExtents(size_t size, size_t tileSize,
+                                                size_t overlap)
+{
+    if (tileSize == 0 || tileSize >= size) {
+        return {{0, size, 0, size}};
+    }
+    std::vector<std::array<size_t, 4>> extents;
+    for (size_t core0 = 0; core0 < size; core0 += tileSize) {
+        const size_t core1 = std::min(size, core0 + tileSize);
+        const size_t start = core0 > overlap / 2 ? core0 - overlap / 2 : 0;
+        const size_t end = std::min(size, core1 + overlap - overlap / 2);
+        extents.push_back({core0, core1, start, end});
+    }
+    return extents;
+}
+
+std::vector<Tile> makeTiles(size_t nrows, size_t ncols, size_t tileLength,
+                            size_t tileWidth, size_t overlap)
+{
+    const auto rows = tileExtents(nrows, tileLength, overlap);
+    const auto cols = tileExtents(ncols, tileWidth, overlap);
+    const long nTileRows = rows.size();
+    const long nTileCols = cols.size();
+
+    std::vector<Tile> tiles;
+    for (long i = 0; i < nTileRows; ++i) {
+        for (long j = 0; j < nTileCols; ++j) {
+            Tile tile;
+            tile.coreY0 = rows[i][0];
+            tile.coreY1 = rows[i][1];
+            tile.y0 = rows[i][2];
+            tile.y1 = rows[i][3];
+            tile.coreX0 = cols[j][0];
+            tile.coreX1 = cols[j][1];
+            tile.x0 = cols[j][2];
+            tile.x1 = cols[j][3];
+            const long index = i * nTileCols + j;
+            tile.neighbours[LEFT] = j > 0 ? index - 1 : -1;
+            tile.neighbours[RIGHT] = j + 1 < nTileCols ? index + 1 : -1;
+            tile.neighbours[UP] = i > 0 ? index - nTileCols : -1;
+            tile.neighbours[DOWN] = i + 1 < nTileRows ? index + nTileCols : -1;
+            tiles.push_back(tile);
+        }
+    }
+    return tiles;
+}
+
+// Union-find of the regions of all the tiles, keeping for each region the
+// number of cycles to add to its unwrapped phase to match the root region
+class RegionMerger {
+public:
+    explicit RegionMerger(size_t nRegions)
+        : _parent(nRegions), _cycles(nRegions, 0)
+    {
+        std::iota(_parent.begin(), _parent.end(), 0);
+    }
+
+    // Root of a region, and cycles to add to the region to match the root
+    std::pair<size_t, long> find(size_t region)
+    {
+        size_t root = region;
+        long cycles = 0;
+        while (_parent[root] != root) {
+            cycles += _cycles[root];
+            root = _parent[root];
+        }
+        // point the path to the root
+        long remaining = cycles;
+        while (_parent[region] != region) {
+            const size_t next = _parent[region];
+            const long step = _cycles[region];
+            _parent[region] = root;
+            _cycles[region] = remaining;
+            remaining -= step;
+            region = next;
+        }
+        return {root, cycles};
+    }
+
+    // Merge region b into region a, where the phase of a is that of b plus
+    // the given number of cycles. Regions already merged are left as they
+    // are.
+    void merge(size_t a, size_t b, long cycles)
+    {
+        const auto [rootA, cyclesA] = find(a);
+        const auto [rootB, cyclesB] = find(b);
+        if (rootA != rootB) {
+            _parent[rootB] = rootA;
+            _cycles[rootB] = cycles + cyclesA - cyclesB;
+        }
+    }
+
+private:
+    std::vector<size_t> _parent;
+    std::vector<long> _cycles;
+};
+
+// Link between a region of a tile and a region of a later neighbouring tile
+struct RegionLink {
+    size_t votes;
+    size_t tileA, tileB;
+    int labelA, labelB;
+    long cycles;
+};
+
+// Rectangle shared by two tiles
+std::array<size_t, 4> sharedExtent(const Tile& a, const Tile& b)
+{
+    return {std::max(a.y0, b.y0), std::min(a.y1, b.y1),
+            std::max(a.x0, b.x0), std::min(a.x1, b.x1)};
+}
+
+// Read the inputs of a tile, unwrap it, keep its seams and write the
+// unwrapped phase and local labels (region + 1) over its core. Returns the
+// number of regions of the tile.
+int unwrapTile(const std::vector<Tile>& tiles, size_t index,
+               Raster& phaseRaster, Raster* powerRaster, Raster& corrRaster,
+               Raster& unwRaster, Raster& labelRaster, std::mutex& ioMutex,
+               double corrThr, double goodCorr, int minPixels,
+               std::array<Seam, 4>& seams)
+{
+    const Tile& tile = tiles[index];
+    const int nrows = tile.y1 - tile.y0;
+    const int ncols = tile.x1 - tile.x0;
+
+    DataPatch<float> phasePatch(ncols, nrows);
+    DataPatch<float> corrPatch(ncols, nrows);
+    std::unique_ptr<DataPatch<float>> powerPatch;
+    if (powerRaster) {
+        powerPatch = std::make_unique<DataPatch<float>>(ncols, nrows);
+    }
+    DataPatch<int> regionPatch(ncols, nrows);
+
+    {
+        std::lock_guard<std::mutex> lock(ioMutex);
+        phaseRaster.getBlock(phasePatch.get_data_ptr(), tile.x0, tile.y0,
+                             ncols, nrows);
+        corrRaster.getBlock(corrPatch.get_data_ptr(), tile.x0, tile.y0,
+                            ncols, nrows);
+        if (powerRaster) {
+            powerRaster->getBlock(powerPatch->get_data_ptr(), tile.x0,
+                                  tile.y0, ncols, nrows);
+        }
+    }
+
+    float** phase = phasePatch.get_data_lines_ptr();
+    int** regions = regionPatch.get_data_lines_ptr();
+    phass_unwrap(nrows, ncols, phase, corrPatch.get_data_lines_ptr(),
+                 powerPatch ? powerPatch->get_data_lines_ptr() : nullptr,
+                 regions, corrThr, goodCorr, minPixels);
+
+    const int* regionData = regionPatch.get_data_ptr();
+    const int nRegions =
+            *std::max_element(regionData, regionData + nrows * ncols) + 1;
+
+    for (int side = 0; side < 4; ++side) {
+        if (tile.neighbours[side] < 0) {
+            continue;
+        }
+        const auto [y0, y1, x0, x1] =
+                sharedExtent(tile, tiles[tile.neighbours[side]]);
+        Seam& seam = seams[side];
+        seam.unw.reserve((y1 - y0) * (x1 - x0));
+        seam.labels.reserve((y1 - y0) * (x1 - x0));
+        for (size_t line = y0; line < y1; ++line) {
+            for (size_t col = x0; col < x1; ++col) {
+                seam.unw.push_back(phase[line - tile.y0][col - tile.x0]);
+                seam.labels.push_back(regions[line - tile.y0][col - tile.x0]);
+            }
+        }
+    }
+
+    const size_t coreRows = tile.coreY1 - tile.coreY0;
+    const size_t coreCols = tile.coreX1 - tile.coreX0;
+    std::vector<float> unw(coreRows * coreCols);
+    std::vector<int> labels(coreRows * coreCols);
+    for (size_t line = 0; line < coreRows; ++line) {
+        for (size_t col = 0; col < coreCols; ++col) {
+            const size_t tileLine = line + tile.coreY0 - tile.y0;
+            const size_t tileCol = col + tile.coreX0 - tile.x0;
+            unw[line * coreCols + col] = phase[tileLine][tileCol];
+            labels[line * coreCols + col] = regions[tileLine][tileCol] + 1;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(ioMutex);
+    unwRaster.setBlock(unw, tile.coreX0, tile.coreY0, coreCols, coreRows);
+    labelRaster.setBlock(labels, tile.coreX0, tile.coreY0, coreCols,
+                         coreRows);
+    return nRegions;
+}
+
+// Link the regions of two neighbouring tiles that share pixels, with the
+// number of cycles most common over their shared pixels
+void linkRegions(const Seam& a, const Seam& b, size_t tileA, size_t tileB,
+                 std::vector<RegionLink>& links)
+{
+    const double twoPi = 2.0 * M_PI;
+    std::map<std::tuple<int, int, long>, size_t> votes;
+    for (size_t i = 0; i < a.labels.size(); ++i) {
+        if (a.labels[i] >= 0 && b.labels[i] >= 0) {
+            const long cycles = std::lround((a.unw[i] - b.unw[i]) / twoPi);
+            ++votes[{a.labels[i], b.labels[i], cycles}];
+        }
+    }
+
+    std::map<std::pair<int, int>, RegionLink> best;
+    for (const auto& [key, count] : votes) {
+        const auto [labelA, labelB, cycles] = key;
+        auto& link = best[{labelA, labelB}];
+        if (count > link.votes) {
+            link = {count, tileA, tileB, labelA, labelB, cycles};
+        }
+    }
+    for (const auto& [key, link] : best) {
+        links.push_back(link);
+    }
+}
+
+} // namespace
 
 /**
  * @param[in] phaseRaster wrapped phase
@@ -47,83 +318,126 @@ unwrap(isce3::io::Raster & phaseRaster,
         isce3::io::Raster & unwRaster,
         isce3::io::Raster & labelRaster)
 {
+    const size_t nrows = phaseRaster.length();
+    const size_t ncols = phaseRaster.width();
 
-    int nrows = phaseRaster.length();
-    int ncols = phaseRaster.width();
-
-    float *phase_data_1D = new float[nrows*ncols];
-    float *corr_data_1D = new float[nrows*ncols];
-    float *power_data_1D = new float[nrows*ncols];
-
-    phaseRaster.getBlock(phase_data_1D, 0, 0, ncols, nrows);
-    corrRaster.getBlock(corr_data_1D, 0, 0, ncols, nrows);
-
-    if (_usePower) {
-        powerRaster.getBlock(power_data_1D, 0, 0, ncols, nrows);
+    const bool tiledRows = _tileLength > 0 && _tileLength < nrows;
+    const bool tiledCols = _tileWidth > 0 && _tileWidth < ncols;
+    if ((tiledRows && _tileOverlap >= _tileLength) ||
+            (tiledCols && _tileOverlap >= _tileWidth)) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "tile overlap must be smaller than the tile length and width");
     }
-
-    float **phase_data  = new float*[nrows];
-    float **corr_data   = new float*[nrows]; 
-    float **power_data  = new float*[nrows];
-        
-        
-    int **region_map = new int*[nrows];
-    for (int line=0; line<nrows; line++){
-        region_map[line] = new int[ncols];
+    if ((tiledRows || tiledCols) && _tileOverlap == 0) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "tile overlap must be nonzero to merge regions across tiles");
     }
 
-    for (int line = 0 ; line < nrows ; ++line) {
-        phase_data[line] = &phase_data_1D[line*ncols];
-        corr_data[line] = &corr_data_1D[line*ncols];
-    }
+    const auto tiles = makeTiles(nrows, ncols, _tileLength, _tileWidth,
+                                 _tileOverlap);
+    const size_t nTiles = tiles.size();
 
-    if (_usePower) {
-        for (int line = 0 ; line < nrows ; ++line) {
-            power_data[line] = &power_data_1D[line*ncols];
+    // the solver indexes the nodes, one more line and pixel than the tile,
+    // with 32-bit integers, and computes the index from int lines and pixels
+    for (const auto& tile : tiles) {
+        if ((tile.y1 - tile.y0 + 1) * (tile.x1 - tile.x0 + 1) > INT_MAX) {
+            throw isce3::except::LengthError(ISCE_SRCINFO(),
+                    "Phass tiles must have fewer than 2^31 pixels, set a "
+                    "smaller tile length or width");
         }
-    } else {
-        power_data  = NULL;
+    }
+    if (nTiles > 1) {
+        pyre::journal::info_t info("isce.unwrap.phass.Phass");
+        info << "unwrapping " << nTiles << " tiles" << pyre::journal::endl;
     }
 
+    // (1) unwrap the tiles independently. A seam is linked to the seam of
+    // the neighbouring tile as soon as both tiles are done and then freed,
+    // so only the seams of the tiles next to pending ones are kept, about a
+    // row of tiles when they are processed in order.
+    std::vector<std::array<Seam, 4>> seams(nTiles);
+    std::vector<bool> done(nTiles, false);
+    std::vector<int> nRegions(nTiles);
+    std::vector<RegionLink> links;
+    std::mutex ioMutex, seamMutex;
+    isce3::core::forEachBlock(nTiles, [&](size_t index) {
+        nRegions[index] = unwrapTile(tiles, index, phaseRaster,
+                _usePower ? &powerRaster : nullptr, corrRaster, unwRaster,
+                labelRaster, ioMutex, _correlationThreshold, _goodCorrelation,
+                _minPixelsPerRegion, seams[index]);
 
-    phass_unwrap(nrows, ncols, 
-                phase_data, corr_data, power_data, region_map,
-                _correlationThreshold, _goodCorrelation,  _minPixelsPerRegion); 
-
-    for (size_t line = 0; line < nrows; ++line) {
-        for (size_t col = 0; col < ncols; ++col) {
-            phase_data_1D[line*ncols + col] = phase_data[line][col];
+        std::lock_guard<std::mutex> lock(seamMutex);
+        done[index] = true;
+        for (int side = 0; side < 4; ++side) {
+            const long neighbour = tiles[index].neighbours[side];
+            if (neighbour < 0 || !done[neighbour]) {
+                continue;
+            }
+            // link from the earlier tile to the later one
+            Seam& mine = seams[index][side];
+            Seam& theirs = seams[neighbour][opposite(side)];
+            if (size_t(neighbour) < index) {
+                linkRegions(theirs, mine, neighbour, index, links);
+            } else {
+                linkRegions(mine, theirs, index, neighbour, links);
+            }
+            mine = Seam();
+            theirs = Seam();
         }
+    });
+
+    if (nTiles == 1) {
+        return;
     }
 
-    unwRaster.setBlock(phase_data_1D, 0, 0, ncols, nrows);
+    // (2) merge the regions across the seams, the strongest links first.
+    // The tiles finish in any order, so ties are broken by tile and label
+    // to make the result independent of the number of threads.
+    std::vector<size_t> firstRegion(nTiles + 1, 0);
+    for (size_t index = 0; index < nTiles; ++index) {
+        firstRegion[index + 1] = firstRegion[index] + nRegions[index];
+    }
+    std::sort(links.begin(), links.end(),
+            [](const RegionLink& a, const RegionLink& b) {
+                return std::make_tuple(b.votes, a.tileA, a.tileB, a.labelA,
+                                       a.labelB) <
+                       std::make_tuple(a.votes, b.tileA, b.tileB, b.labelA,
+                                       b.labelB);
+            });
+    RegionMerger merger(firstRegion[nTiles]);
+    for (const auto& link : links) {
+        merger.merge(firstRegion[link.tileA] + link.labelA,
+                     firstRegion[link.tileB] + link.labelB, link.cycles);
+    }
 
-    float *labels_1D = new float[nrows*ncols];
-    for (size_t line = 0; line < nrows; ++line) {
-        for (size_t col = 0; col < ncols; ++col) {
-            labels_1D[line*ncols + col] = region_map[line][col] + 1;
+    // (3) relabel the regions and shift their phase, numbering the merged
+    // regions in the order they are met
+    const double twoPi = 2.0 * M_PI;
+    std::vector<int> mergedLabel(firstRegion[nTiles], 0);
+    int nLabels = 0;
+    for (size_t index = 0; index < nTiles; ++index) {
+        const Tile& tile = tiles[index];
+        const size_t coreRows = tile.coreY1 - tile.coreY0;
+        const size_t coreCols = tile.coreX1 - tile.coreX0;
+        std::vector<float> unw(coreRows * coreCols);
+        std::vector<int> labels(coreRows * coreCols);
+        unwRaster.getBlock(unw, tile.coreX0, tile.coreY0, coreCols, coreRows);
+        labelRaster.getBlock(labels, tile.coreX0, tile.coreY0, coreCols,
+                             coreRows);
+        for (size_t i = 0; i < labels.size(); ++i) {
+            if (labels[i] == 0) {
+                continue;
+            }
+            const auto [root, cycles] =
+                    merger.find(firstRegion[index] + labels[i] - 1);
+            if (mergedLabel[root] == 0) {
+                mergedLabel[root] = ++nLabels;
+            }
+            labels[i] = mergedLabel[root];
+            unw[i] += twoPi * cycles;
         }
+        unwRaster.setBlock(unw, tile.coreX0, tile.coreY0, coreCols, coreRows);
+        labelRaster.setBlock(labels, tile.coreX0, tile.coreY0, coreCols,
+                             coreRows);
     }
-
-    labelRaster.setBlock(labels_1D, 0, 0, ncols, nrows);
-    
-    /*for (int line = 0; line <nrows; ++line) {
-        std::cout << line << std::endl;
-        delete[] phase_data[line];
-        delete[] corr_data[line];
-        delete[] power_data[line];
-        delete[] region_map[line];
-    }*/ 
-
-    delete[] labels_1D;
-    delete[] phase_data_1D;
-    delete[] power_data_1D;
-
-    delete[] phase_data;
-    delete[] corr_data;
-    delete[] power_data;
-    delete[] region_map;   
-
 }
-
-
@@ -25,6 +25,9 @@ public:
         _goodCorrelation = 0.7;
         _minPixelsPerRegion = 200.0;
         _usePower = true;
+        _tileLength = 0;
+        _tileWidth = 0;
+        _tileOverlap = 64;
     };
 
     /** Destructor */
@@ -37,7 +40,25 @@ public:
         isce3::io::Raster & unwRaster,
         isce3::io::Raster & labelRaster);
 
-    /** Unwrap the interferometric wrapped phase. */
+    /**
+     * Unwrap the interferometric wrapped phase.
+     *
+     * If a tile length or width is set, the scene is split into tiles that
+     * extend over their neighbours by the tile overlap. The tiles are
+     * unwrapped independently and in parallel, each from its own contiguous
+     * buffers, so that the memory used scales with the tile size and the
+     * number of threads rather than with the scene size. The regions of
+     * neighbouring tiles that share pixels in the overlap are linked as soon
+     * as both tiles are done, so only the overlaps next to pending tiles,
+     * about one row of tiles, are kept. The linked regions are then merged
+     * into one connected component, and the unwrapped phase of each region
+     * is shifted by the number of cycles most common over the shared pixels.
+     * The outputs are written tile by tile, and read back once to apply the
+     * merged labels and cycle shifts, so they must be readable.
+     *
+     * A region cut by a tile edge is only kept by the tiles where it covers
+     * at least minPixelsPerRegion pixels.
+     */
     void unwrap(
         isce3::io::Raster & phaseRaster,
         isce3::io::Raster & powerRaster,
@@ -63,12 +84,35 @@ public:
     /** Set minimum size of a region to be unwrapped. */
     void minPixelsPerRegion(const int);
 
+    /** Get number of lines of a tile, 0 for the scene length. */
+    size_t tileLength() const;
+
+    /** Set number of lines of a tile, 0 for the scene length. */
+    void tileLength(const size_t);
+
+    /** Get number of pixels of a tile, 0 for the scene width. */
+    size_t tileWidth() const;
+
+    /** Set number of pixels of a tile, 0 for the scene width. */
+    void tileWidth(const size_t);
+
+    /** Get number of lines and pixels shared by neighbouring tiles. */
+    size_t tileOverlap() const;
+
+    /** Set number of lines and pixels shared by neighbouring tiles. It
+     * must be nonzero when the scene is tiled, since regions are merged
+     * across tiles over the shared pixels. */
+    void tileOverlap(const size_t);
+
 
     private:
         double _correlationThreshold = 0.2;
         double _goodCorrelation = 0.7; 
         int _minPixelsPerRegion = 200.0;
         bool _usePower = true;
+        size_t _tileLength = 0;
+        size_t _tileWidth = 0;
+        size_t _tileOverlap = 64;
 
 };
 
@@ -0,0 +1,168 @@
+// Copyright (c) 2017-, California Institute of Technology ("Caltech"). U.S.
+// Government sponsorship acknowledged.
+// All rights reserved.
+//
+// Author(s):
+//
+//  ======================================================================
+//
+//  FILENAME: PixelQueue.h
+//
+//  Work lists of the flood fills and of the shortest path search, holding
+//  linear pixel indices (line * nr_pixels + pixel) in flat arrays.
+//
+//  ======================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+
+// FIFO of pixel indices. The storage is reserved once and only reused after
+// clear(), so it suits flood fills that push each pixel at most once.
+class PixelQueue {
+
+  public:
+
+    explicit PixelQueue(size_t capacity = 0) { items.reserve(capacity); }
+
+    bool empty() const { return head == items.size(); }
+
+    void push(uint32_t index) { items.push_back(index); }
+
+    uint32_t pop() { return items[head++]; }
+
+    // Forget all the pixels pushed so far
+    void clear() { items.clear(); head = 0; }
+
+    // Pixels pushed since the last clear(), in push order
+    const std::vector<uint32_t>& pushed() const { return items; }
+
+  private:
+
+    std::vector<uint32_t> items;
+    size_t head = 0;
+};
+
+//------------------------------------------------------------------------------
+
+// Dial bucket queue of pixel indices keyed by integer distance. The buckets
+// are kept in a circular array indexed by the distance modulo its size, and
+// each bucket is a flat FIFO whose storage is reused once it is drained, so
+// that the pixels of one distance are contiguous and pushing rarely
+// allocates. Each bucket records the distance it holds; the ring doubles if
+// two live distances fall on the same slot, so the pop order does not depend
+// on a bound of the distance spread.
+class BucketQueue {
+
+  public:
+
+    explicit BucketQueue(size_t nr_buckets = 1024)
+    {
+      size_t size = 1;
+      while (size < nr_buckets) size *= 2;
+      ring.resize(size);
+      mask = size - 1;
+    }
+
+    // No pixel in any bucket
+    bool empty() const { return nr_items == 0; }
+
+    bool empty(size_t dist) const
+    {
+      const Bucket& bucket = ring[dist & mask];
+      return bucket.items.empty() || bucket.dist != dist;
+    }
+
+    void push(size_t dist, uint32_t index)
+    {
+      Bucket* bucket = &ring[dist & mask];
+      if (!bucket->items.empty() && bucket->dist != dist) {
+        grow(dist);
+        bucket = &ring[dist & mask];
+      }
+      if (bucket->items.empty()) bucket->dist = dist;
+      bucket->items.push_back(index);
+      nr_items ++;
+    }
+
+    // Pop the oldest pixel of a non-empty bucket
+    uint32_t pop(size_t dist)
+    {
+      Bucket& bucket = ring[dist & mask];
+      const uint32_t index = bucket.items[bucket.head++];
+      if (bucket.head == bucket.items.size()) {
+        bucket.items.clear();
+        bucket.head = 0;
+      }
+      nr_items --;
+      return index;
+    }
+
+  private:
+
+    struct Bucket {
+      std::vector<uint32_t> items;
+      size_t head = 0;
+      size_t dist = 0;
+    };
+
+    // Double the ring until the live buckets and dist all have their own slot
+    void grow(size_t dist)
+    {
+      std::vector<Bucket> old_ring;
+      old_ring.swap(ring);
+      size_t size = old_ring.size();
+      bool collision = true;
+      while (collision) {
+        size *= 2;
+        std::vector<char> used(size, 0);
+        used[dist & (size - 1)] = 1;
+        collision = false;
+        for (const Bucket& bucket : old_ring) {
+          if (bucket.items.empty()) continue;
+          char& slot = used[bucket.dist & (size - 1)];
+          if (slot) { collision = true; break; }
+          slot = 1;
+        }
+      }
+      ring.resize(size);
+      mask = size - 1;
+      for (Bucket& bucket : old_ring) {
+        if (!bucket.items.empty()) ring[bucket.dist & mask] = std::move(bucket);
+      }
+    }
+
+    std::vector<Bucket> ring;
+    size_t mask = 0;
+    size_t nr_items = 0;
+};
+
+//------------------------------------------------------------------------------
+
+// Line of a pixel index, i.e. index / nr_pixels, computed as the high word of
+// a product with a precomputed 64-bit reciprocal, which is exact for all
+// 32-bit indices and line lengths (Lemire, Kaser & Kurz, 2019). This keeps an
+// integer division out of the loops that pop pixels.
+class LineOfIndex {
+
+  public:
+
+    explicit LineOfIndex(uint32_t nr_pixels)
+      : nr_pixels(nr_pixels), magic(UINT64_MAX / nr_pixels + 1) {}
+
+    uint32_t operator() (uint32_t index) const
+    {
+      if (nr_pixels == 1) return index;
+      return (uint32_t)(((__uint128_t)magic * index) >> 64);
+    }
+
+  private:
+
+    uint32_t nr_pixels;
+    uint64_t magic;
+};
@@ -16,6 +16,7 @@ core/Constants.cpp
 core/DateTime.cpp
 core/Ellipsoid.cpp
 core/EulerAngles.cpp
+core/Instrumentation.cpp
 core/Interp1d.cpp
 core/Interp2d.cpp
 core/Kernels.cpp
@@ -74,6 +75,7 @@ matchtemplate/matchtemplate.cpp
 matchtemplate/pycuampcor.cpp
 math/math.cpp
 math/Stats.cpp
+polsar/covariance.cpp
 polsar/symmetrize.cpp
 polsar/polsar.cpp
 signal/signal.cpp
@@ -83,6 +85,7 @@ signal/CrossMultiply.cpp
 signal/flatten.cpp
 signal/filter2D.cpp
 signal/multilook.cpp
+signal/NFFT.cpp
 product/GeoGridParameters.cpp
 product/product.cpp
 product/RadarGridParameters.cpp
@@ -11,13 +11,33 @@
 #include <isce3/core/Linspace.h>
 #include <isce3/core/Orbit.h>
 #include <isce3/core/Poly1d.h>
+#include <isce3/except/Error.h>
 #include <isce3/geometry/DEMInterpolator.h>
 
 // Alias
 namespace py = pybind11;
 using namespace isce3::core;
 using isce3::antenna::ElPatternEst;
+using isce3::except::InvalidArgument;
 using isce3::geometry::DEMInterpolator;
+using RowMatrixXcf = ElPatternEst::RowMatrixXcf;
+using echo_array_t = py::array_t<std::complex<float>,
+        py::array::c_style | py::array::forcecast>;
+
+// Views of the channels of a 3-D array of echoes (channels, pulses, range)
+static std::vector<Eigen::Ref<const RowMatrixXcf>> echoChannels(
+        const echo_array_t& echo_mats)
+{
+    if (echo_mats.ndim() != 3)
+        throw InvalidArgument(ISCE_SRCINFO(),
+                "echoes of several channels must be a 3-D array");
+    std::vector<Eigen::Ref<const RowMatrixXcf>> channels;
+    for (py::ssize_t chan = 0; chan < echo_mats.shape(0); ++chan)
+        channels.emplace_back(Eigen::Map<const RowMatrixXcf>(
+                echo_mats.data(chan, 0, 0), echo_mats.shape(1),
+                echo_mats.shape(2)));
+    return channels;
+}
 
 void addbinding(py::class_<ElPatternEst>& pyElPatternEst)
 {
@@ -53,16 +73,58 @@ void addbinding(py::class_<ElPatternEst>& pyElPatternEst)
                     &ElPatternEst::isCenterScalePolyfit)
 
             // methods
-            .def("power_pattern_2way", &ElPatternEst::powerPattern2way,
+            .def("power_pattern_2way",
+                    py::overload_cast<const Eigen::Ref<const RowMatrixXcf>&,
+                            double, double, double, std::optional<double>, int,
+                            bool>(&ElPatternEst::powerPattern2way, py::const_),
                     py::arg("echo_mat"), py::arg("sr_spacing"),
                     py::arg("chirp_rate"), py::arg("chirp_dur"),
                     py::arg("az_time") = std::nullopt, py::arg("size_avg") = 8,
                     py::arg("inc_corr") = true)
-            .def("power_pattern_1way", &ElPatternEst::powerPattern1way,
+            .def("power_pattern_2way",
+                    [](const ElPatternEst& self, const echo_array_t& echo_mats,
+                            double sr_spacing, double chirp_rate,
+                            double chirp_dur, std::optional<double> az_time,
+                            int size_avg, bool inc_corr) {
+                        auto channels = echoChannels(echo_mats);
+                        py::gil_scoped_release release;
+                        return self.powerPattern2way(channels, sr_spacing,
+                                chirp_rate, chirp_dur, az_time, size_avg,
+                                inc_corr);
+                    },
+                    py::arg("echo_mats"), py::arg("sr_spacing"),
+                    py::arg("chirp_rate"), py::arg("chirp_dur"),
+                    py::arg("az_time") = std::nullopt, py::arg("size_avg") = 8,
+                    py::arg("inc_corr") = true,
+                    "Two-way power patterns of all the channels of a 3-D "
+                    "array of echoes (channels, pulses, range bins), as a "
+                    "list with one tuple per channel.")
+            .def("power_pattern_1way",
+                    py::overload_cast<const Eigen::Ref<const RowMatrixXcf>&,
+                            double, double, double, std::optional<double>, int,
+                            bool>(&ElPatternEst::powerPattern1way, py::const_),
                     py::arg("echo_mat"), py::arg("sr_spacing"),
                     py::arg("chirp_rate"), py::arg("chirp_dur"),
                     py::arg("az_time") = std::nullopt, py::arg("size_avg") = 8,
                     py::arg("inc_corr") = true)
+            .def("power_pattern_1way",
+                    [](const ElPatternEst& self, const echo_array_t& echo_mats,
+                            double sr_spacing, double chirp_rate,
+                            double chirp_dur, std::optional<double> az_time,
+                            int size_avg, bool inc_corr) {
+                        auto channels = echoChannels(echo_mats);
+                        py::gil_scoped_release release;
+                        return self.powerPattern1way(channels, sr_spacing,
+                                chirp_rate, chirp_dur, az_time, size_avg,
+                                inc_corr);
+                    },
+                    py::arg("echo_mats"), py::arg("sr_spacing"),
+                    py::arg("chirp_rate"), py::arg("chirp_dur"),
+                    py::arg("az_time") = std::nullopt, py::arg("size_avg") = 8,
+                    py::arg("inc_corr") = true,
+                    "One-way power patterns of all the channels of a 3-D "
+                    "array of echoes (channels, pulses, range bins), as a "
+                    "list with one tuple per channel.")
             .doc() = R"(
 A class for estimating one-way or two-way elevation (EL) power 
 pattern from 2-D raw echo data over quasi-homogenous scene 
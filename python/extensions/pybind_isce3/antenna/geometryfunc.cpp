@@ -177,6 +177,98 @@ References
 ----------
 .. [1] https://github.jpl.nasa.gov/SALSA-REE/REE_DOC/blob/master/REE_TECHNICAL_DESCRIPTION.pdf
 
+)");
+
+    m.def(
+            "ant2rgdop",
+            [](const Eigen::Ref<const Eigen::VectorXd>& el_theta,
+                    const Eigen::Ref<const Eigen::VectorXd>& az_phi,
+                    const std::vector<Vec3>& pos_ecef,
+                    const std::vector<Vec3>& vel_ecef,
+                    const std::vector<Quaternion>& quat, double wavelength,
+                    const DEMInterpolator& dem_interp = {},
+                    double abs_tol = 0.5, int max_iter = 10,
+                    const ant::Frame& frame = {},
+                    const Ellipsoid& ellips = {}) {
+                return ant::ant2rgdop(el_theta, az_phi, pos_ecef, vel_ecef,
+                        quat, wavelength, dem_interp, abs_tol, max_iter, frame,
+                        ellips);
+            },
+            py::arg("el_theta"), py::arg("az_phi"), py::arg("pos_ecef"),
+            py::arg("vel_ecef"), py::arg("quaternion"), py::arg("wavelength"),
+            py::arg_v("dem_interp", DEMInterpolator(), "0.0"),
+            py::arg("abs_tol") = 0.5, py::arg("max_iter") = 10,
+            py::arg_v("frame", ant::Frame(), "EL_AND_AZ"),
+            py::arg_v("ellips", Ellipsoid(), "WGS84"),
+            py::call_guard<py::gil_scoped_release>(),
+            R"(
+Estimate Radar products, Slant ranges and Doppler centroids, over a grid
+of spherical angles in antenna body-fixed domain for several spacecraft
+positions, velocities and attitudes, e.g. at several azimuth times, at a
+certain height w.r.t. an ellipsoid.
+
+The (time, azimuth) rows of the grid are processed in parallel, and the
+height estimation of each elevation angle starts from the height of the
+previous one in its row, so the results agree with the scalar version
+within `abs_tol`.
+
+Parameters
+----------
+el_theta : list(float)
+    a list of either elevation or theta angles in radians
+    depending on the 'frame' object.
+az_phi : list(float)
+    a list of either azimuth or phi angles in radians depending
+    on the 'frame' object.
+pos_ecef : list(isce3.core.Vec3)
+    antenna/spacecraft positions in ECEF (m,m,m), one per azimuth time.
+vel_ecef : list(isce3.core.Vec3)
+    spacecraft velocities in ECEF (m/s,m/s,m/s), one per azimuth time.
+quaternion : list(isce3.core.Quaternion)
+    quaternion objects for transformation from antenna
+    body-fixed to ECEF, one per azimuth time.
+wavelength : float
+    Radar wavelength in (m).
+dem_interp : isce3.geometry.DEMInterpolator, default=0.0
+    isce3 DEMInterpolator object.
+abs_tol : float, default=0.5
+    Abs error/tolerance in height estimation (m) between desired
+    input height and final output height.
+max_iter : int, default=10
+    Max number of iterations in height estimation.
+frame : isce3.antenna.Frame, default=EL_AND_AZ
+   isce3 Frame object to define antenna spherical coordinate system.
+ellips : isce3.core.Ellipsoid, default=WGS84
+   isce3 Ellipsoid object defining the ellipsoidal planet.
+
+Returns
+-------
+numpy.ndarray(float)
+    2-D array of slant ranges in (m) with shape
+    (len(pos_ecef) * len(az_phi), len(el_theta)), whose row
+    `t * len(az_phi) + j` is for time `t` and angle `az_phi[j]`.
+numpy.ndarray(float)
+    2-D array of Doppler centroids in (Hz) with the same shape.
+bool
+    convergence, true if all height tolerances is met,false otherwise.
+
+Raises
+------
+InvalidArgument
+    for bad input argument
+LengthError
+    for mismatched numbers of positions, velocities and quaternions
+RuntimeError
+    for non-positive slant range
+
+Notes
+-----
+See reference [1]_ for algorithm and equations
+
+References
+----------
+.. [1] https://github.jpl.nasa.gov/SALSA-REE/REE_DOC/blob/master/REE_TECHNICAL_DESCRIPTION.pdf
+
 )");
 
     m.def(
@@ -320,6 +412,94 @@ References
 ----------
 .. [1] https://github.jpl.nasa.gov/SALSA-REE/REE_DOC/blob/master/REE_TECHNICAL_DESCRIPTION.pdf
 
+)");
+
+    m.def(
+            "ant2geo",
+            [](const Eigen::Ref<const Eigen::VectorXd>& el_theta,
+                    const Eigen::Ref<const Eigen::VectorXd>& az_phi,
+                    const std::vector<Vec3>& pos_ecef,
+                    const std::vector<Quaternion>& quat,
+                    const DEMInterpolator& dem_interp = {},
+                    double abs_tol = 0.5, int max_iter = 10,
+                    const ant::Frame& frame = {},
+                    const Ellipsoid& ellips = {}) {
+                return ant::ant2geo(el_theta, az_phi, pos_ecef, quat,
+                        dem_interp, abs_tol, max_iter, frame, ellips);
+            },
+            py::arg("el_theta"), py::arg("az_phi"), py::arg("pos_ecef"),
+            py::arg("quaternion"),
+            py::arg_v("dem_interp", DEMInterpolator(), "0.0"),
+            py::arg("abs_tol") = 0.5, py::arg("max_iter") = 10,
+            py::arg_v("frame", ant::Frame(), "EL_AND_AZ"),
+            py::arg_v("ellips", Ellipsoid(), "WGS84"),
+            py::call_guard<py::gil_scoped_release>(),
+            R"(
+Estimate geodetic geolocation (longitude, latitude, height) over a grid
+of spherical angles in antenna body-fixed domain for several spacecraft
+positions and attitudes, e.g. at several azimuth times, at a certain
+height w.r.t. an ellipsoid.
+
+The (time, azimuth) rows of the grid are processed in parallel, and the
+height estimation of each elevation angle starts from the height of the
+previous one in its row, so the results agree with the scalar version
+within `abs_tol`.
+
+Parameters
+----------
+el_theta : list(float)
+    a list of either elevation or theta angles in radians
+    depending on the 'frame' object.
+az_phi : list(float)
+    a list of either azimuth or phi angles in radians depending
+    on the 'frame' object.
+pos_ecef : list(isce3.core.Vec3)
+    antenna/spacecraft positions in ECEF (m,m,m), one per azimuth time.
+quaternion : list(isce3.core.Quaternion)
+    quaternion objects for transformation from antenna
+    body-fixed to ECEF, one per azimuth time.
+dem_interp : isce3.geometry.DEMInterpolator, default=0.0
+    isce3 DEMInterpolator object.
+abs_tol : float, default=0.5
+    Abs error/tolerance in height estimation (m) between desired
+    input height and final output height.
+max_iter : int, default=10
+    Max number of iterations in height estimation.
+frame : isce3.antenna.Frame, default=EL_AND_AZ
+   isce3 Frame object to define antenna spherical coordinate system.
+ellips : isce3.core.Ellipsoid, default=WGS84
+   isce3 Ellipsoid object defining the ellipsoidal planet.
+
+Returns
+-------
+numpy.ndarray(float)
+    2-D array of geodetic longitudes in (rad) with shape
+    (len(pos_ecef) * len(az_phi), len(el_theta)), whose row
+    `t * len(az_phi) + j` is for time `t` and angle `az_phi[j]`.
+numpy.ndarray(float)
+    2-D array of geodetic latitudes in (rad) with the same shape.
+numpy.ndarray(float)
+    2-D array of heights in (m) with the same shape.
+bool
+    convergence, true if all height tolerances is met, false otherwise.
+
+Raises
+------
+InvalidArgument
+    for bad input argument
+LengthError
+    for mismatched numbers of positions and quaternions
+RuntimeError
+    for non-positive slant range
+
+Notes
+-----
+See reference [1]_ for algorithm and equations
+
+References
+----------
+.. [1] https://github.jpl.nasa.gov/SALSA-REE/REE_DOC/blob/master/REE_TECHNICAL_DESCRIPTION.pdf
+
 )");
 
     m.def("range_az_to_xyz", &ant::rangeAzToXyz, py::arg("slant_range"),
@@ -0,0 +1,70 @@
+#include "Instrumentation.h"
+
+#include <isce3/core/BufferPool.h>
+#include <isce3/core/Instrumentation.h>
+
+namespace py = pybind11;
+
+namespace instrumentation = isce3::core::instrumentation;
+
+void addbinding_instrumentation(py::module& core)
+{
+    py::module m = core.def_submodule("instrumentation",
+            R"(Per-stage timers, counters and histograms recorded by the
+            processing loops. Recording is disabled by default unless the
+            ISCE3_INSTRUMENTATION environment variable is set.)");
+
+    m.def("enable", &instrumentation::enable, py::arg("flag") = true,
+            py::arg("trace") = false,
+            R"(Enable or disable recording.
+
+            Parameters
+            ----------
+            flag: bool, optional
+                Whether to record timers, counters and histograms
+            trace: bool, optional
+                Whether to also keep every timed scope so that a Chrome trace
+                can be written
+            )");
+    m.def("enabled", &instrumentation::enabled,
+            "Whether recording is enabled");
+    m.def("reset", &instrumentation::reset,
+            "Discard everything recorded so far");
+    m.def("count", &instrumentation::count, py::arg("name"),
+            py::arg("value") = 1, "Add value to the named counter");
+    m.def("record", &instrumentation::record, py::arg("name"),
+            py::arg("value"), "Add value to the named histogram");
+    m.def(
+            "report_json",
+            []() { return instrumentation::toJSON(instrumentation::report()); },
+            "Merged timers, counters and histograms of all threads as JSON");
+    m.def("write_json", &instrumentation::writeJSON, py::arg("filename"),
+            "Write the merged report of all threads as JSON");
+    m.def("write_chrome_trace", &instrumentation::writeChromeTrace,
+            py::arg("filename"),
+            "Write the timed scopes of all threads as a Chrome trace");
+
+    m.def(
+            "buffer_pool_stats",
+            []() {
+                const auto stats = isce3::core::BufferPool::instance().stats();
+                py::dict d;
+                d["bytes_in_use"] = stats.bytesInUse;
+                d["high_water_bytes"] = stats.highWaterBytes;
+                d["bytes_reserved"] = stats.bytesReserved;
+                d["hits"] = stats.hits;
+                d["misses"] = stats.misses;
+                return d;
+            },
+            R"(Usage of the pool of block buffers shared by the processing
+            loops. high_water_bytes is the largest number of bytes borrowed at
+            once, i.e. the block memory a node needs.)");
+    m.def(
+            "reset_buffer_pool",
+            []() {
+                auto& pool = isce3::core::BufferPool::instance();
+                pool.trim();
+                pool.resetHighWater();
+            },
+            "Free the idle block buffers and restart the high water mark");
+}
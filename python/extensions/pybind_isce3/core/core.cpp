@@ -7,6 +7,7 @@
 #include "DateTime.h"
 #include "Ellipsoid.h"
 #include "EulerAngles.h"
+#include "Instrumentation.h"
 #include "Interp1d.h"
 #include "Interp2d.h"
 #include "Kernels.h"
@@ -124,6 +125,7 @@ void addsubmodule_core(py::module & m)
     addbinding(pyPolarStereo);
     addbinding(pyCEA);
 
+    addbinding_instrumentation(m_core);
     addbinding_interp1d(m_core);
     addbinding_interp2d(m_core);
     addbinding_avgLUT2dToLUT1d(m_core);
@@ -79,18 +79,7 @@ auto get_unique_ids(const py::array_t<int64_t>& ids)
     auto ids_ = ids.unchecked<1>();
     for (auto i = 0; i < n; ++i) { unique_ids[i] = ids_(i); }
 
-    // remove consecutive duplicates
-    // numpy skips this step, see
-    // https://github.com/numpy/numpy/blob/db4f43983cb938f12c311e1f5b7165e270c393b4/numpy/lib/arraysetops.py#L336
-    auto last = std::unique(unique_ids.begin(), unique_ids.end());
-    unique_ids.erase(last, unique_ids.end());
-
-    // sort the smaller list
-    std::sort(unique_ids.begin(), unique_ids.end());
-
-    // now remove all duplicates
-    last = std::unique(unique_ids.begin(), unique_ids.end());
-    unique_ids.erase(last, unique_ids.end());
+    unique_ids = getUniqueIds(std::move(unique_ids));
 
     // copy back to numpy array
     // avoid compiler warning about narrowing cast: since nu <= n there's no
@@ -105,6 +94,40 @@ auto get_unique_ids(const py::array_t<int64_t>& ids)
 }
 
 
+// see Python docstring below
+void presum_pulse(
+    py::array_t<std::complex<float>>& out,
+    const Kernel<double>& acorr,
+    const Eigen::Ref<const Eigen::VectorXd>& pulse_times,
+    double tout,
+    long offset,
+    const py::array_t<int64_t>& ids,
+    const py::array_t<std::complex<float>,
+                      py::array::c_style | py::array::forcecast>& pulses,
+    const Eigen::Ref<const Eigen::VectorXd>& doppler)
+{
+    const auto n = ids.size();
+    if ((ids.ndim() != 1) or (out.ndim() != 1) or (out.size() != n)) {
+        throw std::length_error(
+            "Expected 1D ids and output vectors of the same length");
+    }
+    if (out.strides(0) != sizeof(std::complex<float>)) {
+        throw std::invalid_argument("Output vector must be contiguous");
+    }
+    if ((pulses.ndim() != 2) or (pulses.shape(1) != n)) {
+        throw std::length_error(
+            "Raw data dimensions don't match the number of ids");
+    }
+
+    std::vector<std::uint64_t> ids_(n);
+    auto ids_view = ids.unchecked<1>();
+    for (auto i = 0; i < n; ++i) { ids_[i] = ids_view(i); }
+
+    presumPulse(out.mutable_data(), acorr, pulse_times, tout, offset,
+                pulses.shape(0), ids_, pulses.data(), doppler);
+}
+
+
 // python docstring below
 auto compute_ids_from_mask(const py::array_t<bool>& mask)
 {
@@ -214,6 +237,42 @@ void addbindings_presum(pybind11::module& m)
             Vector of unique identifiers
         )", py::arg("ids")
     )
+    .def("presum_pulse", &presum_pulse,
+        R"(Reconstruct a uniformly sampled pulse from raw data with gaps.
+
+        Presum weights are solved once per unique gap pattern (in parallel),
+        then applied together with the Doppler deramp.  Equivalent to
+        computing the weights of each unique id with get_presum_weights,
+        filling them with fill_weights and calling apply_presum_weights.
+
+        Parameters
+        ----------
+        out : np.ndarray[np.complex64]
+            Output pulse.
+            shape (num_ranges,)
+        acorr : isce3.core.Kernel
+            Autocorrelation function (argument same units as pulse_times).
+        pulse_times : np.ndarray[np.float64]
+            Times of all the pulses of the raw data (sorted).
+        tout : float
+            Desired output time.
+        offset : int
+            Index of the first pulse in play, as returned by
+            get_presum_weights(acorr, pulse_times, tout)
+        ids : np.ndarray[np.int64]
+            Gap pattern identifier of each range bin, bit j set when pulse
+            offset + j is valid (see compute_ids_from_mask).
+            shape (num_ranges,)
+        pulses : np.ndarray[np.complex64]
+            Raw echo data of the pulses in play.
+            shape (num_pulses, num_ranges), num_pulses <= 64
+        doppler : np.ndarray[np.float64]
+            Doppler in Hz for each range sample.
+            shape (num_ranges,)
+        )", py::arg("out"), py::arg("acorr"), py::arg("pulse_times"),
+        py::arg("tout"), py::arg("offset"), py::arg("ids"), py::arg("pulses"),
+        py::arg("doppler")
+    )
     .def("compute_ids_from_mask", &compute_ids_from_mask,
         R"(Compute identifier for each pattern of gaps in a valid data mask.
 
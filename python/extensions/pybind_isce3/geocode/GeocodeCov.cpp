@@ -8,12 +8,15 @@
 #include <isce3/core/Constants.h>
 #include <isce3/core/blockProcessing.h>
 #include <isce3/geometry/RTC.h>
+#include <isce3/io/IH5.h>
 #include <isce3/io/Raster.h>
 
 namespace py = pybind11;
 
 using isce3::core::parseDataInterpMethod;
+using isce3::geocode::AreaProjOperator;
 using isce3::geocode::Geocode;
+using isce3::geocode::InterpOperator;
 using isce3::core::GeocodeMemoryMode;
 using isce3::geocode::geocodeOutputMode;
 using isce3::geometry::rtcAlgorithm;
@@ -115,6 +118,8 @@ void addbinding(py::class_<Geocode<T>>& pyGeocode)
                             isce3::core::DEFAULT_MAX_BLOCK_SIZE,
                     py::arg("dem_interp_method") =
                             isce3::core::BIQUINTIC_METHOD,
+                    py::arg("out_area_proj_operator") = nullptr,
+                    py::arg("out_interp_operator") = nullptr,
                     R"(
                     Geocode data from slant-range to map coordinates
 
@@ -220,9 +225,181 @@ void addbinding(py::class_<Geocode<T>>& pyGeocode)
                         Maximum block size (per thread)
                     dem_interp_method: isce3.core.DataInterpMethod, optional
                         DEM interpolation method
+                    out_area_proj_operator: isce3.geocode.AreaProjOperator, optional
+                        Output sparse area-projection operator (area
+                        projection only), to be applied to other rasters
+                        with `apply_area_proj_operator`
+                    out_interp_operator: isce3.geocode.InterpOperator, optional
+                        Output interpolation operator (interpolation only),
+                        to be applied to other rasters with
+                        `apply_interp_operator`
+                    )")
+            .def("apply_area_proj_operator",
+                    &Geocode<T>::applyAreaProjOperator,
+                    py::arg("area_proj_operator"), py::arg("input_raster"),
+                    py::arg("output_raster"),
+                    py::arg("out_off_diag_terms") = nullptr,
+                    py::arg("clip_min") =
+                            std::numeric_limits<float>::quiet_NaN(),
+                    py::arg("clip_max") =
+                            std::numeric_limits<float>::quiet_NaN(),
+                    R"(
+                    Geocode a raster with a precomputed area-projection
+                    operator, skipping the geometry computations
+
+                    Parameters
+                    ----------
+                    area_proj_operator: isce3.geocode.AreaProjOperator
+                        Area-projection operator obtained from `geocode`
+                    input_raster: isce3.io.Raster
+                        Input raster, with the dimensions of the raster used
+                        to build the operator
+                    output_raster: isce3.io.Raster
+                        Output raster, over the geogrid of the operator
+                    out_off_diag_terms: isce3.io.Raster, optional
+                        Output off-diagonal terms of the covariance matrix
+                    clip_min: float, optional
+                        Clip (limit) minimum output values
+                    clip_max: float, optional
+                        Clip (limit) maximum output values
+                    )")
+            .def("apply_interp_operator",
+                    &Geocode<T>::applyInterpOperator,
+                    py::arg("interp_operator"), py::arg("radar_grid"),
+                    py::arg("input_raster"), py::arg("output_raster"),
+                    py::arg("flag_az_baseband_doppler") = false,
+                    py::arg("flatten") = false,
+                    py::arg("abs_cal_factor") = 1,
+                    py::arg("clip_min") =
+                            std::numeric_limits<float>::quiet_NaN(),
+                    py::arg("clip_max") =
+                            std::numeric_limits<float>::quiet_NaN(),
+                    py::arg("phase_screen") = nullptr,
+                    py::arg("input_rtc") = nullptr,
+                    py::arg("input_layover_shadow_mask_raster") = nullptr,
+                    py::arg("sub_swaths") = nullptr,
+                    py::arg("apply_valid_samples_sub_swath_masking") =
+                            std::nullopt,
+                    R"(
+                    Geocode a raster with a precomputed interpolation
+                    operator, skipping the geometry computations
+
+                    Parameters
+                    ----------
+                    interp_operator: isce3.geocode.InterpOperator
+                        Interpolation operator obtained from `geocode`
+                    radar_grid: isce3.product.RadarGridParameters
+                        Radar grid of the operator
+                    input_raster: isce3.io.Raster
+                        Input raster, over the radar grid
+                    output_raster: isce3.io.Raster
+                        Output raster, over the geogrid of the operator
+                    flag_az_baseband_doppler: bool, optional
+                        Shift SLC azimuth spectrum to baseband (using Doppler
+                        centroid) before interpolation
+                    flatten: bool, optional
+                        Flatten the geocoded SLC
+                    abs_cal_factor: float, optional
+                        Absolute calibration factor.
+                    clip_min: float, optional
+                        Clip (limit) minimum output values
+                    clip_max: float, optional
+                        Clip (limit) maximum output values
+                    phase_screen: isce3.io.Raster, optional
+                        Phase screen to be removed before geocoding
+                    input_rtc: isce3.io.Raster, optional
+                        Input RTC area factor (in slant-range). If provided,
+                        the RTC area normalization is applied.
+                    input_layover_shadow_mask_raster: isce3.io.Raster, optional
+                        Input layover/shadow mask raster (in radar geometry).
+                        Samples identified as SHADOW or LAYOVER_AND_SHADOW are
+                        considered invalid.
+                    sub_swaths: isce3.product.SubSwaths, optional
+                        Sub-swaths metadata
+                    apply_valid_samples_sub_swath_masking: bool, optional
+                        Flag indicating whether the valid-samples sub-swath
+                        masking should be applied. If not given, then
+                        sub-swath masking will be applied if the sub_swaths
+                        parameter is provided.
                     )");
 }
 
+void addbinding(py::class_<AreaProjOperator>& pyAreaProjOperator)
+{
+    pyAreaProjOperator.def(py::init<>())
+            .def_property_readonly("empty", &AreaProjOperator::empty)
+            .def_property_readonly("nnz", &AreaProjOperator::nnz)
+            .def_property_readonly("memory_size",
+                    &AreaProjOperator::memorySize)
+            .def_property_readonly("num_blocks", &AreaProjOperator::numBlocks)
+            .def_property_readonly(
+                    "geogrid_length", &AreaProjOperator::geogridLength)
+            .def_property_readonly(
+                    "geogrid_width", &AreaProjOperator::geogridWidth)
+            .def("clear", &AreaProjOperator::clear)
+            .def_static("load_from_h5", [](py::object h5py_group) {
+                    auto id = h5py_group.attr("id").attr("id").cast<hid_t>();
+                    isce3::io::IGroup group(id);
+
+                    AreaProjOperator area_proj_operator;
+                    area_proj_operator.loadFromH5(group);
+
+                    return area_proj_operator;
+                },
+                "De-serialize the operator from h5py.Group object",
+                py::arg("h5py_group"))
+            .def("save_to_h5", [](const AreaProjOperator& self,
+                                       py::object h5py_group) {
+                    auto id = h5py_group.attr("id").attr("id").cast<hid_t>();
+                    isce3::io::IGroup group(id);
+                    self.saveToH5(group);
+                },
+                "Serialize the operator to h5py.Group object",
+                py::arg("h5py_group"))
+            .doc() = R"(
+    Sparse radar-to-geo operator of the area-projection geocoding, holding
+    the contributions of the radar samples to each geogrid pixel
+    )";
+}
+
+void addbinding(py::class_<InterpOperator>& pyInterpOperator)
+{
+    pyInterpOperator.def(py::init<>())
+            .def_property_readonly("empty", &InterpOperator::empty)
+            .def_property_readonly(
+                    "num_valid_pixels", &InterpOperator::numValidPixels)
+            .def_property_readonly("memory_size", &InterpOperator::memorySize)
+            .def_property_readonly("num_blocks", &InterpOperator::numBlocks)
+            .def_property_readonly(
+                    "geogrid_length", &InterpOperator::geogridLength)
+            .def_property_readonly(
+                    "geogrid_width", &InterpOperator::geogridWidth)
+            .def("clear", &InterpOperator::clear)
+            .def_static("load_from_h5", [](py::object h5py_group) {
+                    auto id = h5py_group.attr("id").attr("id").cast<hid_t>();
+                    isce3::io::IGroup group(id);
+
+                    InterpOperator interp_operator;
+                    interp_operator.loadFromH5(group);
+
+                    return interp_operator;
+                },
+                "De-serialize the operator from h5py.Group object",
+                py::arg("h5py_group"))
+            .def("save_to_h5", [](const InterpOperator& self,
+                                       py::object h5py_group) {
+                    auto id = h5py_group.attr("id").attr("id").cast<hid_t>();
+                    isce3::io::IGroup group(id);
+                    self.saveToH5(group);
+                },
+                "Serialize the operator to h5py.Group object",
+                py::arg("h5py_group"))
+            .doc() = R"(
+    Radar-to-geo operator of the geocoding with interpolation, holding the
+    radar-grid position of each geogrid pixel
+    )";
+}
+
 void addbinding(pybind11::enum_<geocodeOutputMode>& pyGeocodeOutputMode)
 {
     pyGeocodeOutputMode.value("INTERP", geocodeOutputMode::INTERP)
@@ -6,3 +6,5 @@
 template<typename T>
 void addbinding(pybind11::class_<isce3::geocode::Geocode<T>>&);
 void addbinding(pybind11::enum_<isce3::geocode::geocodeOutputMode> &);
+void addbinding(pybind11::class_<isce3::geocode::AreaProjOperator>&);
+void addbinding(pybind11::class_<isce3::geocode::InterpOperator>&);
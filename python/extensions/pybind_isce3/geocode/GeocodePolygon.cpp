@@ -109,6 +109,71 @@ void addbinding(py::class_<GeocodePolygon<T>> &pyGeocodePolygon)
         output_weights      Polygon weights (level of intersection
     between the polygon with the radar grid) (output).
         interp_method       Data interpolation method
+     )")
+        .def_static("get_polygon_means", &GeocodePolygon<T>::getPolygonMeans,
+            py::arg("x_vects"),
+            py::arg("y_vects"),
+            py::arg("radar_grid"),
+            py::arg("orbit"),
+            py::arg("ellipsoid"),
+            py::arg("input_dop"),
+            py::arg("input_raster"),
+            py::arg("output_raster"),
+            py::arg("dem_raster"),
+            py::arg("flag_apply_rtc") = false,
+            py::arg("input_terrain_radiometry") = rtcInputTerrainRadiometry::BETA_NAUGHT,
+            py::arg("output_terrain_radiometry") =
+                            rtcOutputTerrainRadiometry::GAMMA_NAUGHT,
+            py::arg("exponent") = 0,
+            py::arg("geogrid_upsampling") = 1,
+            py::arg("rtc_min_value_db") = std::numeric_limits<float>::quiet_NaN(),
+            py::arg("abs_cal_factor") = 1,
+            py::arg("radargrid_nlooks") = 1,
+            py::arg("output_off_diag_terms") = nullptr,
+            py::arg("interp_mode") = isce3::core::BIQUINTIC_METHOD,
+            py::arg("threshold") = 1e-8,
+            py::arg("num_iter") = 100,
+            py::arg("delta_range") = 1e-8,
+            py::arg("max_block_size") = 1 << 24,
+            R"(
+    Calculate the mean value of radar-grid samples for many polygons defined
+    over geographical coordinates. Radar-grid bounding boxes of nearby
+    polygons are merged so that each block is read only once, and the
+    polygons are integrated in parallel.
+    Arguments:
+        x_vects             Vertices Lon/Easting positions of each polygon
+        y_vects             Vertices Lat/Northing positions of each polygon
+        radar_grid          Radar grid
+        orbit               Orbit
+        ellipsoid           Ellipsoid
+        input_dop           Doppler LUT associated with the radar grid
+        input_raster        Input raster
+        output_raster       Output raster with one line per polygon and one
+    column per input band (output)
+        dem_raster          Input DEM raster
+        flag_apply_rtc      Apply radiometric terrain correction (RTC)
+        input_terrain_radiometry   Input terrain radiometry
+        output_terrain_radiometry  Output terrain radiometry
+        exponent            Exponent to be applied to the input data.
+    The value 0 indicates that the the exponent is based on the data type of
+    the input raster (1 for real and 2 for complex rasters).
+        geogrid_upsampling  Geogrid upsampling (in each direction)
+        rtc_min_value_db    Minimum value for the RTC area factor.
+    Radar data with RTC area factor below this limit are ignored.
+        abs_cal_factor      Absolute calibration factor.
+        radar_grid_nlooks   Radar grid number of looks. This
+    parameters determines the multilooking factor used to compute out_nlooks.
+        output_off_diag_terms Output raster containing the
+    off-diagonal terms of the covariance matrix with one line per polygon
+    (output)
+        interp_method       Data interpolation method
+        threshold           Azimuth time threshold for convergence (s)
+        num_iter            Maximum number of Newton-Raphson iterations
+        delta_range         Step size used for computing Doppler derivative
+        max_block_size      Maximum number of pixels of a merged DEM or
+    radar-grid block
+    Returns:
+        out_nlooks          Number of looks of each polygon
      )");
 }
 
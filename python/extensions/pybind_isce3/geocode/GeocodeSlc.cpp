@@ -5,6 +5,7 @@
 #include <isce3/core/LUT2d.h>
 #include <isce3/core/Orbit.h>
 #include <isce3/core/Poly2d.h>
+#include <isce3/except/Error.h>
 #include <isce3/geocode/geocodeSlc.h>
 #include <isce3/io/Raster.h>
 #include <isce3/product/GeoGridParameters.h>
@@ -332,6 +333,183 @@ void addbinding_geocodeslc(py::module & m)
             SubSwaths from RSLC to be used for masking geocoded output. If None,
             no subswath masking is performed. Defaults to None.
         )");
+    m.def("_geocode_slc_bursts",
+        [](std::vector<std::vector<isce3::geocode::EArray2dc64>>& geo_data_blocks,
+           std::vector<isce3::geocode::EArray2df64> carrier_phase_blocks,
+           std::vector<isce3::geocode::EArray2df64> flatten_phase_blocks,
+           const std::vector<std::vector<isce3::geocode::EArray2dc64>>& rdr_data_blocks,
+           isce3::io::Raster& dem_raster,
+           const std::vector<isce3::product::RadarGridParameters>& radargrids,
+           const std::vector<isce3::product::RadarGridParameters>& sliced_radargrids,
+           const isce3::product::GeoGridParameters& geogrid,
+           const isce3::core::Orbit& orbit,
+           const std::vector<isce3::core::LUT2d<double>>& native_dopplers,
+           const std::vector<isce3::core::LUT2d<double>>& image_grid_dopplers,
+           const isce3::core::Ellipsoid& ellipsoid,
+           const double threshold_geo2rdr, const int numiter_geo2rdr,
+           std::vector<std::optional<isce3::geocode::EArray2duc8>> mask_blocks,
+           std::vector<size_t> azimuth_first_lines,
+           std::vector<size_t> range_first_pixels,
+           const bool flatten, const bool reramp,
+           std::vector<AzRgFunc> az_carriers,
+           std::vector<AzRgFunc> rg_carriers,
+           std::vector<isce3::core::LUT2d<double>> az_time_corrections,
+           std::vector<isce3::core::LUT2d<double>> srange_corrections,
+           const bool flatten_with_corrected_srange,
+           const std::complex<float> invalid_value,
+           std::vector<const isce3::product::SubSwaths*> subswaths) {
+            const size_t n = geo_data_blocks.size();
+
+            // Optional per-burst arguments default to the values of the
+            // single burst API when not given
+            auto check_size = [n](size_t size, const std::string& name) {
+                if (size != n) {
+                    throw isce3::except::LengthError(ISCE_SRCINFO(),
+                            name + " must have one item per burst");
+                }
+            };
+            auto fill_default = [&](auto& items, const std::string& name,
+                                    auto value) {
+                if (items.empty())
+                    items.resize(n, value);
+                check_size(items.size(), name);
+            };
+            check_size(rdr_data_blocks.size(), "rdr_data_blocks");
+            check_size(radargrids.size(), "radargrids");
+            check_size(sliced_radargrids.size(), "sliced_radargrids");
+            check_size(native_dopplers.size(), "native_dopplers");
+            check_size(image_grid_dopplers.size(), "image_grid_dopplers");
+            check_size(carrier_phase_blocks.size(), "carrier_phase_blocks");
+            check_size(flatten_phase_blocks.size(), "flatten_phase_blocks");
+            fill_default(mask_blocks, "mask_blocks",
+                    std::optional<isce3::geocode::EArray2duc8>());
+            fill_default(azimuth_first_lines, "azimuth_first_lines", size_t(0));
+            fill_default(range_first_pixels, "range_first_pixels", size_t(0));
+            fill_default(az_carriers, "az_carriers", AzRgFunc());
+            fill_default(rg_carriers, "rg_carriers", AzRgFunc());
+            fill_default(az_time_corrections, "az_time_corrections",
+                    isce3::core::LUT2d<double>());
+            fill_default(srange_corrections, "srange_corrections",
+                    isce3::core::LUT2d<double>());
+            fill_default(subswaths, "subswaths",
+                    static_cast<const isce3::product::SubSwaths*>(nullptr));
+
+            std::vector<isce3::geocode::SlcBurst<AzRgFunc>> bursts;
+            bursts.reserve(n);
+            for (size_t i = 0; i < n; ++i) {
+                bursts.push_back({geo_data_blocks[i], carrier_phase_blocks[i],
+                        flatten_phase_blocks[i], rdr_data_blocks[i],
+                        radargrids[i], sliced_radargrids[i],
+                        native_dopplers[i], image_grid_dopplers[i],
+                        mask_blocks[i], azimuth_first_lines[i],
+                        range_first_pixels[i], az_carriers[i], rg_carriers[i],
+                        az_time_corrections[i], srange_corrections[i],
+                        subswaths[i]});
+            }
+
+            py::gil_scoped_release release;
+            isce3::geocode::geocodeSlcBursts(bursts, dem_raster, geogrid,
+                    orbit, ellipsoid, threshold_geo2rdr, numiter_geo2rdr,
+                    flatten, reramp, flatten_with_corrected_srange,
+                    invalid_value);
+        },
+        py::arg("geo_data_blocks"),
+        py::arg("carrier_phase_blocks"),
+        py::arg("flatten_phase_blocks"),
+        py::arg("rdr_data_blocks"),
+        py::arg("dem_raster"),
+        py::arg("radargrids"),
+        py::arg("sliced_radargrids"),
+        py::arg("geogrid"),
+        py::arg("orbit"),
+        py::arg("native_dopplers"),
+        py::arg("image_grid_dopplers"),
+        py::arg("ellipsoid"),
+        py::arg("threshold_geo2rdr"), py::arg("numiter_geo2rdr"),
+        py::arg("mask_blocks") = py::list(),
+        py::arg("azimuth_first_lines") = py::list(),
+        py::arg("range_first_pixels") = py::list(),
+        py::arg("flatten") = true,
+        py::arg("reramp") = true,
+        py::arg("az_carriers") = py::list(),
+        py::arg("rg_carriers") = py::list(),
+        py::arg("az_time_corrections") = py::list(),
+        py::arg("srange_corrections") = py::list(),
+        py::arg("flatten_with_corrected_srange") = false,
+        py::arg("invalid_value") =
+            std::complex<float>(std::numeric_limits<float>::quiet_NaN(),
+                                std::numeric_limits<float>::quiet_NaN()),
+        py::arg("subswaths") = py::list(),
+        R"(
+        Geocode the SLC arrays of several bursts sharing an orbit to a common
+        geogrid. The DEM, projection and interpolation kernel are set up once
+        for all bursts, and geo2rdr only runs over the lines of the geogrid
+        covered by each burst.
+
+        Every argument given as a list has one item per burst and has the
+        meaning of the corresponding argument of _geocode_slc. Optional lists
+        may be left empty to use the default of every burst.
+
+        The geocoded arrays and masks must have the size of the geogrid. The
+        same arrays may be given for several bursts to mosaic them, in which
+        case later bursts take precedence where they overlap.
+
+        Parameters
+        ----------
+        geo_data_blocks: list of list of numpy.ndarray
+            Output arrays containing the geocoded SLC of each burst
+        carrier_phase_blocks: list of numpy.ndarray
+            Output arrays containing the geocoded carrier phase of each burst
+        flatten_phase_blocks: list of numpy.ndarray
+            Output arrays containing the geocoded flattening phase of each
+            burst
+        rdr_data_blocks: list of list of numpy.ndarray
+            Input arrays of the SLC of each burst in radar coordinates
+        dem_raster: Raster
+            Raster of the DEM
+        radargrids: list of RadarGridParameters
+            Radar grid parameters of each burst
+        sliced_radargrids: list of RadarGridParameters
+            Valid portion of the radar grid of each burst
+        geogrid: GeoGridParameters
+            Geo grid parameters shared by all bursts
+        orbit: isce3.core.Orbit
+            Orbit shared by all bursts
+        native_dopplers: list of LUT2d
+            2D LUT doppler of the SLC image of each burst
+        image_grid_dopplers: list of LUT2d
+            2D LUT doppler of the image grid of each burst
+        ellipsoid: Ellipsoid
+            Ellipsoid object
+        threshold_geo2rdr: float
+            Threshold for geo2rdr computations
+        numiter_geo2rdr: int
+            Maximum number of iterations for geo2rdr convergence
+        mask_blocks: list of numpy.ndarray or None
+            Geocoded subswath labels of each burst
+        azimuth_first_lines: list of int
+            First line of the radar data of each burst
+        range_first_pixels: list of int
+            First pixel of the radar data of each burst
+        flatten: bool
+            Flag to flatten the geocoded SLC
+        reramp: bool
+            Flag to reramp the geocoded SLC
+        az_carriers: list of [LUT2d, Poly2d]
+            Azimuth carrier phase of each burst, in radians
+        rg_carriers: list of [LUT2d, Poly2d]
+            Range carrier phase of each burst, in radians
+        az_time_corrections: list of LUT2d
+            geo2rdr azimuth additive correction of each burst, in seconds
+        srange_corrections: list of LUT2d
+            geo2rdr slant range additive correction of each burst, in meters
+        flatten_with_corrected_srange: bool
+            flag to indicate whether geo2rdr slant-range additive values should be used for phase flattening
+        invalid_value: complex
+            invalid pixel fill value
+        subswaths: list of isce3.product.SubSwaths or None
+            SubSwaths used to mask the geocoded output of each burst
+        )");
 }
 
 template void addbinding_geocodeslc<isce3::core::LUT2d<double>>(py::module & m);
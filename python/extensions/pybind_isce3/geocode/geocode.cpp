@@ -14,6 +14,10 @@ void addsubmodule_geocode(py::module & m)
     addbinding_geocodeslc<isce3::core::Poly2d>(geocode);
 
     // forward declare bound classes
+    py::class_<isce3::geocode::AreaProjOperator>
+        pyAreaProjOperator(geocode, "AreaProjOperator");
+    py::class_<isce3::geocode::InterpOperator>
+        pyInterpOperator(geocode, "InterpOperator");
     py::class_<isce3::geocode::Geocode<float>>
         pyGeocodeFloat32(geocode, "GeocodeFloat32");
     py::class_<isce3::geocode::Geocode<double>>
@@ -37,6 +41,8 @@ void addsubmodule_geocode(py::module & m)
         pyGeocodeOutputMode(geocode, "GeocodeOutputMode");
 
     // add bindings
+    addbinding(pyAreaProjOperator);
+    addbinding(pyInterpOperator);
     addbinding(pyGeocodeFloat32);
     addbinding(pyGeocodeFloat64);
     addbinding(pyGeocodeCFloat32);
@@ -272,5 +272,10 @@ void addbinding(py::class_<Topo>& pyRdr2Geo)
                     py::overload_cast<bool>(&Topo::computeMask))
             .def_property("lines_per_block",
                     py::overload_cast<>(&Topo::linesPerBlock, py::const_),
-                    py::overload_cast<size_t>(&Topo::linesPerBlock));
+                    py::overload_cast<size_t>(&Topo::linesPerBlock))
+            .def_property("mixed_precision",
+                    py::overload_cast<>(&Topo::mixedPrecision, py::const_),
+                    py::overload_cast<bool>(&Topo::mixedPrecision),
+                    "Iterate in single precision relative to a double "
+                    "precision reference target");
 }
@@ -0,0 +1,74 @@
+#include "covariance.h"
+
+#include <isce3/io/Raster.h>
+
+namespace py = pybind11;
+
+using isce3::polsar::PolMatrixType;
+
+void addbinding(pybind11::enum_<PolMatrixType>& pyPolMatrixType)
+{
+    pyPolMatrixType
+        .value("Covariance", PolMatrixType::Covariance,
+                "covariance matrix C3, from the lexicographic vector"
+                " [HH, sqrt(2) HV, VV]")
+        .value("Coherency", PolMatrixType::Coherency,
+                "coherency matrix T3, from the Pauli vector"
+                " [HH + VV, HH - VV, 2 HV] / sqrt(2)");
+}
+
+void addbinding_covariance(pybind11::module& m)
+{
+    m.def("polarimetric_matrix", &isce3::polsar::polarimetricMatrix,
+            py::arg("hh_raster"), py::arg("hv_raster"), py::arg("vh_raster"),
+            py::arg("vv_raster"), py::arg("diag_raster") = nullptr,
+            py::arg("off_diag_raster") = nullptr,
+            py::arg("matrix_type") = PolMatrixType::Covariance,
+            py::arg("nlooks_range") = 1, py::arg("nlooks_azimuth") = 1,
+            py::arg("memory_mode") = isce3::core::MemoryModeBlocksY::AutoBlocksY,
+            py::arg("overlap_io") = true,
+            py::arg("min_block_size") = isce3::core::DEFAULT_MIN_BLOCK_SIZE,
+            py::arg("max_block_size") = isce3::core::DEFAULT_MAX_BLOCK_SIZE,
+            R"(Form the multilooked covariance (C3) or coherency (T3) matrix
+           of quad-pol data in a single pass.
+
+           The cross-polarimetric channels are symmetrized as the average of
+           HV and VH, and all the elements of the upper triangle of the
+           matrix are accumulated over each window of looks. The output has
+           length // nlooks_azimuth lines and width // nlooks_range columns.
+           The diagonal and off-diagonal elements are written with the layout
+           of the diagonal and off-diagonal terms of GCOV, so that each
+           raster can be geocoded band by band.
+
+          Parameters
+          ---------
+          hh_raster : isce3.io.Raster
+              Raster containing the HH polarization channel (band 1)
+          hv_raster : isce3.io.Raster
+              Raster containing the HV polarization channel (band 1)
+          vh_raster : isce3.io.Raster
+              Raster containing the VH polarization channel (band 1)
+          vv_raster : isce3.io.Raster
+              Raster containing the VV polarization channel (band 1)
+          diag_raster : isce3.io.Raster, optional
+              Output diagonal elements M11, M22 and M33 (3 real bands)
+          off_diag_raster : isce3.io.Raster, optional
+              Output off-diagonal elements M12, M13 and M23 (3 complex
+              bands)
+          matrix_type : isce3.polsar.PolMatrixType, optional
+              Covariance (C3) or coherency (T3) matrix
+          nlooks_range : int, optional
+              Number of looks in range
+          nlooks_azimuth : int, optional
+              Number of looks in azimuth
+          memory_mode : isce3.core.MemoryModeBlocksY, optional
+              Select memory mode
+          overlap_io : bool, optional
+              Read the next block and write the previous one while the
+              current block is processed
+          min_block_size: int, optional
+              Minimum block size in bytes (per thread)
+          max_block_size: int, optional
+              Maximum block size in bytes (per thread)
+          )");
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <isce3/polsar/covariance.h>
+
+void addbinding(pybind11::enum_<isce3::polsar::PolMatrixType>&);
+void addbinding_covariance(pybind11::module& m);
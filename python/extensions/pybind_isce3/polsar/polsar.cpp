@@ -1,10 +1,16 @@
 #include "polsar.h"
 
+#include "covariance.h"
 #include "symmetrize.h"
 
 void addsubmodule_polsar(py::module& m)
 {
     py::module m_polsar = m.def_submodule("polsar");
 
+    py::enum_<isce3::polsar::PolMatrixType> pyPolMatrixType(
+            m_polsar, "PolMatrixType");
+    addbinding(pyPolMatrixType);
+
     addbinding_symmetrize(m_polsar);
+    addbinding_covariance(m_polsar);
 }
@@ -11,7 +11,7 @@ void addbinding_symmetrize(pybind11::module& m)
             py::arg("vh_raster"), py::arg("output_raster"),
             py::arg("memory_mode") = isce3::core::MemoryModeBlocksY::AutoBlocksY,
             py::arg("hv_raster_band") = 1, py::arg("vh_raster_band") = 1,
-            py::arg("output_raster_band") = 1,
+            py::arg("output_raster_band") = 1, py::arg("overlap_io") = true,
             R"(Symmetrize cross-polarimetric channels.
 
            The current implementation considers that the cross-polarimetric 
@@ -37,5 +37,67 @@ void addbinding_symmetrize(pybind11::module& m)
           output_raster_band : int
               Band (starting from 1) that will contain the symmetrized 
               cross-polarimetric channel
+          overlap_io : bool, optional
+              Read the next block and write the previous one while the
+              current block is processed
+          )");
+
+    m.def("symmetrize_cross_pol_channels",
+            [](isce3::io::Raster& hh_raster, isce3::io::Raster& hv_raster,
+                    isce3::io::Raster& vh_raster, isce3::io::Raster& vv_raster,
+                    isce3::io::Raster* output_raster,
+                    isce3::io::Raster* span_raster,
+                    isce3::io::Raster* pauli_raster,
+                    isce3::io::Raster* covariance_raster,
+                    isce3::core::MemoryModeBlocksY memory_mode,
+                    bool overlap_io) {
+                isce3::polsar::FusedPolProducts products;
+                products.span = span_raster;
+                products.pauli = pauli_raster;
+                products.covariance = covariance_raster;
+                isce3::polsar::symmetrizeCrossPolChannels(hh_raster,
+                        hv_raster, vh_raster, vv_raster, output_raster,
+                        products, memory_mode, overlap_io);
+            },
+            py::arg("hh_raster"), py::arg("hv_raster"), py::arg("vh_raster"),
+            py::arg("vv_raster"), py::arg("output_raster") = nullptr,
+            py::arg("span_raster") = nullptr,
+            py::arg("pauli_raster") = nullptr,
+            py::arg("covariance_raster") = nullptr,
+            py::arg("memory_mode") = isce3::core::MemoryModeBlocksY::AutoBlocksY,
+            py::arg("overlap_io") = true,
+            R"(Symmetrize cross-polarimetric channels and form polarimetric
+           products of quad-pol data in a single pass.
+
+           With the symmetrized cross-polarimetric channel HV, the products
+           are defined from the lexicographic vector [HH, sqrt(2) HV, VV]
+           and the Pauli vector [HH + VV, HH - VV, 2 HV] / sqrt(2). Products
+           whose raster is None are not computed.
+
+          Parameters
+          ---------
+          hh_raster : isce3.io.Raster
+              Raster containing the HH polarization channel (band 1)
+          hv_raster : isce3.io.Raster
+              Raster containing the HV polarization channel (band 1)
+          vh_raster : isce3.io.Raster
+              Raster containing the VH polarization channel (band 1)
+          vv_raster : isce3.io.Raster
+              Raster containing the VV polarization channel (band 1)
+          output_raster : isce3.io.Raster, optional
+              Output symmetrized raster (band 1)
+          span_raster : isce3.io.Raster, optional
+              Output total power |HH|^2 + 2 |HV|^2 + |VV|^2 (1 band)
+          pauli_raster : isce3.io.Raster, optional
+              Output Pauli components (HH + VV) / sqrt(2),
+              (HH - VV) / sqrt(2) and sqrt(2) HV (3 bands)
+          covariance_raster : isce3.io.Raster, optional
+              Output upper triangle of the covariance matrix, i.e. C11, C12,
+              C13, C22, C23 and C33 (6 bands)
+          memory_mode : isce3.core.MemoryModeBlocksY, optional
+              Select memory mode
+          overlap_io : bool, optional
+              Read the next block and write the previous one while the
+              current block is processed
           )");
 }
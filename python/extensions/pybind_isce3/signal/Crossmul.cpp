@@ -76,6 +76,9 @@ void addbinding(py::class_<Crossmul> & pyCrossmul)
         .def_property("lines_per_block",
                 py::overload_cast<>(&Crossmul::linesPerBlock, py::const_),
                 py::overload_cast<size_t>(&Crossmul::linesPerBlock))
+        .def_property("overlap_io",
+                py::overload_cast<>(&Crossmul::overlapIO, py::const_),
+                py::overload_cast<bool>(&Crossmul::overlapIO))
         .def_property_readonly("multilook_enabled", &Crossmul::multiLookEnabled)
         ;
 }
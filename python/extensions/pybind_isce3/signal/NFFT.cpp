@@ -0,0 +1,118 @@
+#include "NFFT.h"
+
+#include <complex>
+#include <pybind11/complex.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+#include <stdexcept>
+#include <vector>
+
+using isce3::signal::NFFT;
+namespace py = pybind11;
+
+template<typename T>
+void addbinding(py::class_<NFFT<T>>& pyNFFT)
+{
+    using C = std::complex<T>;
+    using Array2D = py::array_t<C, py::array::c_style | py::array::forcecast>;
+
+    pyNFFT
+            .def(py::init<size_t, size_t, size_t>(), py::arg("m"),
+                 py::arg("n"), py::arg("fft_size"),
+                 R"(
+            Non-equispaced fast Fourier transform (NFFT).
+
+            Parameters
+            ----------
+            m : int
+                Half-width of the interpolation kernel.
+            n : int
+                Length of the spectrum (even).
+            fft_size : int
+                Length of the oversampled transform, greater than n.
+            )")
+            .def(
+                    "set_times",
+                    [](NFFT<T>& self,
+                       const Eigen::Ref<const Eigen::VectorXd>& times) {
+                        self.set_times(times.size(), 1, times.data());
+                    },
+                    py::arg("times"), R"(
+            Precompute the interpolation weights at fixed sample locations
+            shared by the batched transforms.
+
+            Parameters
+            ----------
+            times : np.ndarray[np.float64]
+                Sample locations in [0, n).
+            )")
+            .def(
+                    "execute_batch",
+                    [](NFFT<T>& self, const Array2D& spectra) {
+                        const size_t nf = self.size_spectrum();
+                        const size_t nt = self.size_times();
+                        if ((spectra.ndim() != 2) or (spectra.shape(0) < 1) or
+                                (size_t(spectra.shape(1)) != nf)) {
+                            throw std::length_error(
+                                    "Expected spectra of shape "
+                                    "(howmany, size_spectrum)");
+                        }
+                        const size_t howmany = spectra.shape(0);
+                        py::array_t<C> out(std::vector<py::ssize_t> {
+                                py::ssize_t(howmany), py::ssize_t(nt)});
+                        self.execute_batch(howmany, spectra.data(), nf,
+                                           out.mutable_data(), nt);
+                        return out;
+                    },
+                    py::arg("spectra"), R"(
+            Transform several spectra to the locations given to set_times.
+
+            Parameters
+            ----------
+            spectra : np.ndarray
+                Spectra in FFTW order, shape (howmany, size_spectrum).
+
+            Returns
+            -------
+            np.ndarray
+                Signals at the sample locations, shape (howmany, size_times).
+            )")
+            .def(
+                    "execute_adjoint_batch",
+                    [](NFFT<T>& self, const Array2D& signals) {
+                        const size_t nf = self.size_spectrum();
+                        const size_t nt = self.size_times();
+                        if ((signals.ndim() != 2) or (signals.shape(0) < 1) or
+                                (size_t(signals.shape(1)) != nt)) {
+                            throw std::length_error(
+                                    "Expected signals of shape "
+                                    "(howmany, size_times)");
+                        }
+                        const size_t howmany = signals.shape(0);
+                        py::array_t<C> out(std::vector<py::ssize_t> {
+                                py::ssize_t(howmany), py::ssize_t(nf)});
+                        self.execute_adjoint_batch(howmany, signals.data(), nt,
+                                                   out.mutable_data(), nf);
+                        return out;
+                    },
+                    py::arg("signals"), R"(
+            Adjoint transform of several signals sampled at the locations
+            given to set_times.
+
+            Parameters
+            ----------
+            signals : np.ndarray
+                Signals at the sample locations, shape (howmany, size_times).
+
+            Returns
+            -------
+            np.ndarray
+                Spectra in FFTW order, shape (howmany, size_spectrum).
+            )")
+            .def_property_readonly("size_kernel", &NFFT<T>::size_kernel)
+            .def_property_readonly("size_spectrum", &NFFT<T>::size_spectrum)
+            .def_property_readonly("size_transform", &NFFT<T>::size_transform)
+            .def_property_readonly("size_times", &NFFT<T>::size_times);
+}
+
+template void addbinding(py::class_<NFFT<double>>&);
@@ -6,6 +6,7 @@
 #include "flatten.h"
 #include "filter2D.h"
 #include "multilook.h"
+#include "NFFT.h"
 
 namespace py = pybind11;
 
@@ -19,10 +20,12 @@ void addsubmodule_signal(py::module & m)
     py::class_<isce3::signal::Crossmul> pyCrossmul(m_signal, "Crossmul");
     py::class_<isce3::signal::CrossMultiply> pyCrossMultiply(m_signal,
                                                              "CrossMultiply");
+    py::class_<isce3::signal::NFFT<double>> pyNFFT(m_signal, "NFFT");
 
     // add bindings
     addbinding(pyCrossmul);
     addbinding(pyCrossMultiply);
+    addbinding(pyNFFT);
     addbinding_flatten(m_signal);
     addbinding_filter2D(m_signal);
     addbinding_convolve2D<float>(m_signal);
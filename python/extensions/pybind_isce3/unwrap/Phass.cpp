@@ -19,24 +19,40 @@ void addbinding(py::class_<Phass> & pyPhass)
         Good correlation threshold
     min_pixels_region : int
         Minimum size of a region to be unwrapped
+    tile_length : int
+        Number of lines of a tile, 0 for the scene length
+    tile_width : int
+        Number of pixels of a tile, 0 for the scene width
+    tile_overlap : int
+        Number of lines and pixels shared by neighboring tiles, nonzero
+        when the scene is tiled
     )";
 
     pyPhass
     // Constructor
     .def(py::init([](const double correlation_threshold,
                      const double good_correlation,
-                     const int min_pixels_region)
+                     const int min_pixels_region,
+                     const size_t tile_length,
+                     const size_t tile_width,
+                     const size_t tile_overlap)
                {
                      Phass phass;
                      phass.correlationThreshold(correlation_threshold);
                      phass.goodCorrelation(good_correlation);
                      phass.minPixelsPerRegion(min_pixels_region);
+                     phass.tileLength(tile_length);
+                     phass.tileWidth(tile_width);
+                     phass.tileOverlap(tile_overlap);
 
                      return phass;
                 }),
                 py::arg("correlation_threshold") = 0.2,
                 py::arg("good_correlation") = 0.7,
-                py::arg("min_pixels_region") = 200
+                py::arg("min_pixels_region") = 200,
+                py::arg("tile_length") = 0,
+                py::arg("tile_width") = 0,
+                py::arg("tile_overlap") = 64
                 )
     .def("unwrap", py::overload_cast<Raster&, Raster&, Raster&, Raster&>(&Phass::unwrap),
                 py::arg("phase"),
@@ -92,5 +108,14 @@ void addbinding(py::class_<Phass> & pyPhass)
     .def_property("min_pixels_region",
              py::overload_cast<>(&Phass::minPixelsPerRegion, py::const_),
              py::overload_cast<int>(&Phass::minPixelsPerRegion))
+    .def_property("tile_length",
+             py::overload_cast<>(&Phass::tileLength, py::const_),
+             py::overload_cast<size_t>(&Phass::tileLength))
+    .def_property("tile_width",
+             py::overload_cast<>(&Phass::tileWidth, py::const_),
+             py::overload_cast<size_t>(&Phass::tileWidth))
+    .def_property("tile_overlap",
+             py::overload_cast<>(&Phass::tileOverlap, py::const_),
+             py::overload_cast<size_t>(&Phass::tileOverlap))
     ;
 }
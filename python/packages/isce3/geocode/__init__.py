@@ -1,2 +1,2 @@
 from isce3.ext.isce3.geocode import *
-from .geocode_slc import geocode_slc
+from .geocode_slc import geocode_slc, geocode_slc_bursts
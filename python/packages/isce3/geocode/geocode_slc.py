@@ -3,7 +3,7 @@ from types import SimpleNamespace
 from typing import Union
 
 import isce3
-from isce3.ext.isce3.geocode import _geocode_slc
+from isce3.ext.isce3.geocode import _geocode_slc, _geocode_slc_bursts
 import journal
 import numpy as np
 
@@ -238,3 +238,117 @@ def geocode_slc(geo_data_blocks: Union[np.ndarray, list[np.ndarray]],
                  flatten_with_corrected_srange=flatten_with_corrected_srange,
                  invalid_value=invalid_value,
                  subswaths=subswaths)
+
+
+def geocode_slc_bursts(bursts: list[dict], dem_raster, geogrid, orbit,
+                       ellipsoid, threshold_geo2rdr, num_iter_geo2rdr,
+                       flatten=True, reramp=True,
+                       flatten_with_corrected_srange=False,
+                       invalid_value=np.nan + np.nan * 1j):
+    '''
+    Geocode the SLC arrays of several bursts sharing an orbit to a common
+    geogrid in one call. The DEM, projection and interpolation kernel are set
+    up once for all bursts instead of once per geocode_slc call.
+
+    The geocoded arrays (and masks) must have the shape of the geogrid. The
+    same arrays may be given for several bursts to mosaic them, in which case
+    later bursts take precedence where they overlap.
+
+    Parameters
+    ----------
+    bursts: list of dict
+        Per-burst arguments, with the same keys and defaults as the
+        corresponding arguments of geocode_slc: geo_data_blocks,
+        rdr_data_blocks, radargrid, native_doppler, image_grid_doppler,
+        and optionally mask_block, sliced_radargrid, subswaths,
+        first_azimuth_line, first_range_sample, az_carrier, rg_carrier,
+        az_time_correction, srange_correction, carrier_phase_block and
+        flatten_phase_block
+    dem_raster: isce3.io.Raster
+        Raster of the DEM
+    geogrid: GeoGridParameters
+        Geo grid parameters shared by all bursts
+    orbit: isce3.core.Orbit
+        Orbit shared by all bursts
+    ellipsoid: Ellipsoid
+        Ellipsoid object
+    threshold_geo2rdr: float
+        Threshold for geo2rdr computations
+    num_iter_geo2rdr: int
+        Maximum number of iterations for geo2rdr convergence
+    flatten: bool
+        Flag to flatten the geocoded SLC
+    reramp: bool
+        Flag to reramp the geocoded SLC
+    flatten_with_corrected_srange: bool
+        flag to indicate whether geo2rdr slant-range additive values should be used for phase flattening
+    invalid_value: complex
+        invalid pixel fill value
+    '''
+    args = {key: [] for key in ['geo_data_blocks', 'carrier_phase_blocks',
+                                'flatten_phase_blocks', 'rdr_data_blocks',
+                                'radargrids', 'sliced_radargrids',
+                                'native_dopplers', 'image_grid_dopplers',
+                                'mask_blocks', 'azimuth_first_lines',
+                                'range_first_pixels', 'az_carriers',
+                                'rg_carriers', 'az_time_corrections',
+                                'srange_corrections', 'subswaths']}
+
+    for burst in bursts:
+        geo_data_blocks = burst['geo_data_blocks']
+        rdr_data_blocks = burst['rdr_data_blocks']
+        geo_io_checks = _io_value_check(geo_data_blocks)
+        rdr_io_checks = _io_value_check(rdr_data_blocks)
+        _io_valid(geo_io_checks, rdr_io_checks)
+        if geo_io_checks.is_array and rdr_io_checks.is_array:
+            geo_data_blocks = [geo_data_blocks]
+            rdr_data_blocks = [rdr_data_blocks]
+
+        empty = np.array([], dtype=np.float64)
+        carrier_phase_block = burst.get('carrier_phase_block', empty)
+        flatten_phase_block = burst.get('flatten_phase_block', empty)
+        mask_block = burst.get('mask_block')
+        for output_arr, which_output in zip([carrier_phase_block,
+                                             flatten_phase_block,
+                                             mask_block],
+                                            ['carrier', 'flattening', 'mask']):
+            _output_array_valid(output_arr, geo_data_blocks[0], which_output)
+
+        radargrid = burst['radargrid']
+        sliced_radargrid = burst.get('sliced_radargrid')
+        if sliced_radargrid is None:
+            sliced_radargrid = radargrid
+
+        args['geo_data_blocks'].append(geo_data_blocks)
+        args['carrier_phase_blocks'].append(carrier_phase_block)
+        args['flatten_phase_blocks'].append(flatten_phase_block)
+        args['rdr_data_blocks'].append(rdr_data_blocks)
+        args['radargrids'].append(radargrid)
+        args['sliced_radargrids'].append(sliced_radargrid)
+        args['native_dopplers'].append(burst['native_doppler'])
+        args['image_grid_dopplers'].append(burst['image_grid_doppler'])
+        args['mask_blocks'].append(mask_block)
+        args['azimuth_first_lines'].append(
+            burst.get('first_azimuth_line', 0))
+        args['range_first_pixels'].append(burst.get('first_range_sample', 0))
+        args['az_carriers'].append(
+            burst.get('az_carrier', isce3.core.LUT2d()))
+        args['rg_carriers'].append(
+            burst.get('rg_carrier', isce3.core.LUT2d()))
+        args['az_time_corrections'].append(
+            burst.get('az_time_correction', isce3.core.LUT2d()))
+        args['srange_corrections'].append(
+            burst.get('srange_correction', isce3.core.LUT2d()))
+        args['subswaths'].append(burst.get('subswaths'))
+
+    _geocode_slc_bursts(**args,
+                        dem_raster=dem_raster,
+                        geogrid=geogrid,
+                        orbit=orbit,
+                        ellipsoid=ellipsoid,
+                        threshold_geo2rdr=threshold_geo2rdr,
+                        numiter_geo2rdr=num_iter_geo2rdr,
+                        flatten=flatten,
+                        reramp=reramp,
+                        flatten_with_corrected_srange=flatten_with_corrected_srange,
+                        invalid_value=invalid_value)
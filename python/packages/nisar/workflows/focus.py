@@ -1031,33 +1031,17 @@ def resample(raw: np.ndarray, t: np.ndarray,
                 mask[start:end, iw] = True
         # The pattern of missing samples in any given column can change
         # depending on the gap structure.  Recomputing weights is expensive,
-        # though, so compute a hash we can use to cache the unique weight
-        # vectors.
-        twiddle = 1 << np.arange(nw)
+        # though, so compute a hash of the pattern.  Weights are then solved
+        # once per unique pattern and applied in C++.
         ids = isce3.focus.compute_ids_from_mask(mask)
-        # Compute weights for each unique mask pattern.
-        lut = dict()
-        for uid in isce3.focus.get_unique_ids(ids):
-            # Invert the hash to get the mask back
-            valid = (uid & twiddle).astype(bool)
-            # Pull out valid times for this mask config and compute weights.
-            tj = t[offset:offset+nw][valid]
-            joff, jwgt = isce3.focus.get_presum_weights(acor, tj, tout)
-            assert joff == 0
-            # Now insert zeros where data is invalid to get full-length weights.
-            jwgt_full = np.zeros_like(weights)
-            jwgt_full[valid] = jwgt
-            lut[uid] = jwgt_full
-        # Fill weights for entire block using look up table.
-        w = isce3.focus.fill_weights(ids, lut)
         # Read raw data.
         block = np.s_[offset:offset+nw, :]
         x = raw[block]
         # Apply weights and Doppler deramp.  Zero phase at tout means no need to
         # re-ramp afterwards.
-        trel = t[offset:offset+nw] - tout
         fd = doppler.eval(tout, r)
-        isce3.focus.apply_presum_weights(regridded[i,:], trel, fd, w, x)
+        isce3.focus.presum_pulse(regridded[i,:], acor, t, tout, offset, ids,
+                                 x, fd)
     return regridded
 
 
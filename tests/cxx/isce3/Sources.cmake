@@ -1,18 +1,23 @@
 set(TESTFILES
 antenna/edge_method_cost_func.cpp
 antenna/frame.cpp
+antenna/geometryfunc.cpp
 container/rsd.cpp
 core/attitude/quaternion_euler.cpp
 core/attitude/attitude.cpp
 core/attitude/representations.cpp
+core/blockpipeline/blockpipeline.cpp
+core/bufferpool/bufferpool.cpp
 core/datetime/datetime.cpp
 core/ellipsoid/ellipsoid.cpp
+core/instrumentation/instrumentation.cpp
 core/interp1d.cpp
 core/interpolator/interpolator.cpp
 core/linspace/linspace.cpp
 core/lut/lut1d.cpp
 core/lut/lut2d.cpp
 core/matrix/matrix.cpp
+core/numa/numa.cpp
 core/orbit/orbit.cpp
 core/poly/poly1d.cpp
 core/poly/poly2d.cpp
@@ -33,6 +38,7 @@ focus/gaps.cpp
 focus/presum.cpp
 focus/rangecomp.cpp
 geocode/geocodeCov.cpp
+geocode/geocodePolygon.cpp
 geocode/geocodeSlc.cpp
 geometry/dem/dem.cpp
 geometry/geo2rdr/geo2rdr.cpp
@@ -61,8 +67,10 @@ io/raster/rastermatrix.cpp
 io/raster/rasterview.cpp
 math/bessel/bessel53.cpp
 math/sinc.cpp
+math/phasor.cpp
 math/polyfunc.cpp
 math/root_find1d.cpp
+polsar/covariance.cpp
 polsar/symmetrize.cpp
 product/serialization/serializeProduct.cpp
 product/serialization/serializeProductMetadata.cpp
@@ -79,7 +87,9 @@ signal/shift_signal.cpp
 signal/signal.cpp
 signal/signal_utils.cpp
 unwrap/icu/icu.cpp
+unwrap/phass/assp.cpp
 unwrap/phass/phass.cpp
+unwrap/phass/pixelqueue.cpp
 )
 
 #This is a temporary fix - since GDAL does not support
@@ -0,0 +1,156 @@
+// Test suite for the batched antenna geometry functions
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <gtest/gtest.h>
+
+#include <isce3/antenna/Frame.h>
+#include <isce3/antenna/geometryfunc.h>
+#include <isce3/core/Ellipsoid.h>
+#include <isce3/core/Matrix.h>
+#include <isce3/core/Quaternion.h>
+#include <isce3/core/Vector.h>
+#include <isce3/geometry/DEMInterpolator.h>
+#include <isce3/io/Raster.h>
+
+using namespace isce3::antenna;
+using isce3::core::Quaternion;
+using isce3::core::Vec3;
+using isce3::geometry::DEMInterpolator;
+
+struct GeometryFuncTest : public ::testing::Test {
+
+    void SetUp() override
+    {
+        // same geometry as the python test of the antenna geometry functions
+        const Quaternion q_ant2sc(-90 * d2r, mb_ang * d2r, 0.0);
+        const Quaternion q_sc2ecef(
+                quat_vec[0], quat_vec[1], quat_vec[2], quat_vec[3]);
+        const Quaternion q_ant2ecef(q_sc2ecef * q_ant2sc);
+        const Vec3 sc_pos = wgs84.lonLatToXyz(
+                {sc_pos_llh[0] * d2r, sc_pos_llh[1] * d2r, sc_pos_llh[2]});
+        const Vec3 sc_vel = sc_vel_mag * q_sc2ecef.rotate(Vec3 {1, 0, 0});
+
+        // two azimuth times
+        pos = {sc_pos, sc_pos + Vec3 {100., -50., 20.}};
+        vel = {sc_vel, sc_vel};
+        quat = {q_ant2ecef, q_ant2ecef};
+
+        el = Eigen::VectorXd::LinSpaced(9, -(mb_ang + 2) * d2r,
+                -(mb_ang - 2) * d2r);
+        az = Eigen::Vector3d(-0.5 * d2r, 0.0, 0.5 * d2r);
+    }
+
+    // Build a DEM raster, planar in longitude and latitude, that covers the
+    // footprint of the EL x AZ grid with a margin of one degree
+    DEMInterpolator slopedDem()
+    {
+        const auto [lon, lat, hgt, conv] = ant2geo(el, az, pos, quat);
+        const double x0 = lon.minCoeff() / d2r - 1;
+        const double y0 = lat.maxCoeff() / d2r + 1;
+        const double spacing = 0.01;
+        const int width = std::ceil((lon.maxCoeff() / d2r + 1 - x0) / spacing);
+        const int length = std::ceil((y0 - lat.minCoeff() / d2r + 1) / spacing);
+
+        // a few percent of slope in both directions
+        isce3::core::Matrix<float> dem_array(length, width);
+        for (int i = 0; i < length; ++i)
+            for (int j = 0; j < width; ++j)
+                dem_array(i, j) = dem_hgt + 2000.0 * (j - width / 2) * spacing +
+                                  1000.0 * (i - length / 2) * spacing;
+
+        isce3::io::Raster dem_raster(
+                "sloped_dem.bin", width, length, 1, GDT_Float32, "ENVI");
+        dem_raster.setBlock(dem_array.data(), 0, 0, width, length, 1);
+        double geotransform[] = {x0, spacing, 0, y0, 0, -spacing};
+        dem_raster.setGeoTransform(geotransform);
+        dem_raster.setEPSG(4326);
+
+        DEMInterpolator dem_interp;
+        dem_interp.loadDEM(dem_raster);
+        return dem_interp;
+    }
+
+    // tolerance of the height iteration, tight enough to compare the
+    // batched and per-row results regardless of the first height guess
+    const double abs_tol = 1e-3;
+    const int max_iter = 50;
+
+    const double d2r = M_PI / 180.0;
+    const double mb_ang = 37.0;
+    const double wl = 0.24;
+    const double sc_vel_mag = 7566.7;
+    const double sc_pos_llh[3] = {-116.8531, 41.0549, 755451.5};
+    const double quat_vec[4] = {-0.17266, 0.71085, 0.56772, 0.37759};
+    const double dem_hgt = 200.0;
+
+    isce3::core::Ellipsoid wgs84;
+    std::vector<Vec3> pos, vel;
+    std::vector<Quaternion> quat;
+    Eigen::VectorXd el, az;
+};
+
+TEST_F(GeometryFuncTest, Ant2RgDopGridSlopedDem)
+{
+    const auto dem_interp = slopedDem();
+    const auto [slantrange, doppler, converge] = ant2rgdop(el, az, pos, vel,
+            quat, wl, dem_interp, abs_tol, max_iter);
+    ASSERT_TRUE(converge);
+    ASSERT_EQ(slantrange.rows(), pos.size() * az.size());
+    ASSERT_EQ(slantrange.cols(), el.size());
+
+    for (std::size_t itime = 0; itime < pos.size(); ++itime) {
+        for (Eigen::Index iaz = 0; iaz < az.size(); ++iaz) {
+            const auto [sr_ref, dop_ref, conv_ref] = ant2rgdop(el, az[iaz],
+                    pos[itime], vel[itime], quat[itime], wl, dem_interp,
+                    abs_tol, max_iter);
+            ASSERT_TRUE(conv_ref);
+            const auto row = itime * az.size() + iaz;
+            for (Eigen::Index iel = 0; iel < el.size(); ++iel) {
+                EXPECT_NEAR(slantrange(row, iel), sr_ref[iel], 1e-2)
+                        << "Wrong slant range at row " << row << ", EL "
+                        << iel;
+                EXPECT_NEAR(doppler(row, iel), dop_ref[iel], 1e-6)
+                        << "Wrong Doppler at row " << row << ", EL " << iel;
+            }
+        }
+    }
+}
+
+TEST_F(GeometryFuncTest, Ant2GeoGridSlopedDem)
+{
+    const auto dem_interp = slopedDem();
+    const auto [lon, lat, hgt, converge] =
+            ant2geo(el, az, pos, quat, dem_interp, abs_tol, max_iter);
+    ASSERT_TRUE(converge);
+
+    // the sloped DEM must actually vary over the grid
+    EXPECT_GT(hgt.maxCoeff() - hgt.minCoeff(), 100.0);
+
+    for (std::size_t itime = 0; itime < pos.size(); ++itime) {
+        for (Eigen::Index iaz = 0; iaz < az.size(); ++iaz) {
+            const auto [llh_ref, conv_ref] = ant2geo(el, az[iaz], pos[itime],
+                    quat[itime], dem_interp, abs_tol, max_iter);
+            ASSERT_TRUE(conv_ref);
+            const auto row = itime * az.size() + iaz;
+            for (Eigen::Index iel = 0; iel < el.size(); ++iel) {
+                EXPECT_NEAR(lon(row, iel), llh_ref[iel][0], 1e-8)
+                        << "Wrong longitude at row " << row << ", EL "
+                        << iel;
+                EXPECT_NEAR(lat(row, iel), llh_ref[iel][1], 1e-8)
+                        << "Wrong latitude at row " << row << ", EL " << iel;
+                EXPECT_NEAR(hgt(row, iel), llh_ref[iel][2], 1e-2)
+                        << "Wrong height at row " << row << ", EL " << iel;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,158 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <isce3/core/detail/BlockPipeline.h>
+
+using isce3::core::detail::pipelineSlots;
+using isce3::core::detail::runBlockPipeline;
+
+// Lines of one value each, doubled by the compute stage
+struct Pipeline {
+    Pipeline(int nblocks, long block_length, long length, bool overlap_io) :
+        nblocks(nblocks), block_length(block_length), length(length),
+        overlap_io(overlap_io), input(length), output(length, -1),
+        reads(nblocks), writes(nblocks),
+        slots(pipelineSlots(nblocks, overlap_io),
+                std::vector<long>(block_length))
+    {
+        for (long i = 0; i < length; ++i)
+            input[i] = 3 * i + 1;
+    }
+
+    // run the pipeline, throwing from the given stage and block
+    void run(const std::string& stage = "", int bad_block = -1)
+    {
+        auto fail = [&](const std::string& name, int block) {
+            if (name == stage && block == bad_block)
+                throw std::runtime_error(name + " " + std::to_string(block));
+        };
+        // slot of the block computed by each line, to know which block
+        // "compute" is working on
+        std::vector<int> slot_block(slots.size(), -1);
+
+        runBlockPipeline(nblocks, block_length, length, overlap_io,
+                [&](int block, int slot, long y0, long n) {
+                    ++reads[block];
+                    fail("read", block);
+                    for (long i = 0; i < n; ++i)
+                        slots[slot][i] = input[y0 + i];
+                    slot_block[slot] = block;
+                },
+                [&](int slot, long i) {
+                    fail("compute", slot_block[slot]);
+                    slots[slot][i] *= 2;
+                },
+                [&](int block, int slot, long y0, long n) {
+                    ++writes[block];
+                    fail("write", block);
+                    for (long i = 0; i < n; ++i)
+                        output[y0 + i] = slots[slot][i];
+                });
+    }
+
+    int nblocks;
+    long block_length, length;
+    bool overlap_io;
+    std::vector<long> input, output;
+    std::vector<int> reads, writes;
+    std::vector<std::vector<long>> slots;
+};
+
+struct BlockPipelineTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(BlockPipelineTest, MultipleBlocks)
+{
+    const bool overlap_io = GetParam();
+    // the last block is shorter than the others
+    const long block_length = 5, length = 33;
+    const int nblocks = (length + block_length - 1) / block_length;
+
+    Pipeline pipeline(nblocks, block_length, length, overlap_io);
+    EXPECT_EQ(pipeline.slots.size(), overlap_io ? 3u : 1u);
+    pipeline.run();
+
+    for (long i = 0; i < length; ++i)
+        EXPECT_EQ(pipeline.output[i], 2 * pipeline.input[i]) << "line " << i;
+    for (int block = 0; block < nblocks; ++block) {
+        EXPECT_EQ(pipeline.reads[block], 1) << "block " << block;
+        EXPECT_EQ(pipeline.writes[block], 1) << "block " << block;
+    }
+}
+
+TEST_P(BlockPipelineTest, SingleBlock)
+{
+    const bool overlap_io = GetParam();
+    Pipeline pipeline(1, 10, 10, overlap_io);
+    EXPECT_EQ(pipeline.slots.size(), 1u);
+    pipeline.run();
+
+    for (long i = 0; i < 10; ++i)
+        EXPECT_EQ(pipeline.output[i], 2 * pipeline.input[i]);
+}
+
+// An exception raised by any stage of a block is rethrown, and the pipeline
+// stops: at most the two following blocks are read, and none is written
+TEST_P(BlockPipelineTest, Exceptions)
+{
+    const bool overlap_io = GetParam();
+    const int nblocks = 6, bad_block = 2;
+
+    for (const std::string stage : {"read", "compute", "write"}) {
+        Pipeline pipeline(nblocks, 4, 4 * nblocks, overlap_io);
+        try {
+            pipeline.run(stage, bad_block);
+            FAIL() << "no exception from " << stage;
+        } catch (const std::runtime_error& error) {
+            EXPECT_EQ(error.what(), stage + " " + std::to_string(bad_block));
+        }
+
+        // blocks before the bad one are complete
+        for (int block = 0; block < bad_block; ++block) {
+            EXPECT_EQ(pipeline.reads[block], 1) << stage << " " << block;
+            if (stage != "read" || !overlap_io)
+                EXPECT_EQ(pipeline.writes[block], 1) << stage << " " << block;
+        }
+        for (int block = bad_block + 1; block < nblocks; ++block)
+            EXPECT_EQ(pipeline.writes[block], 0) << stage << " " << block;
+        for (int block = bad_block + 3; block < nblocks; ++block)
+            EXPECT_EQ(pipeline.reads[block], 0) << stage << " " << block;
+        if (!overlap_io) {
+            for (int block = bad_block + 1; block < nblocks; ++block)
+                EXPECT_EQ(pipeline.reads[block], 0) << stage << " " << block;
+        }
+    }
+}
+
+// When several blocks fail in the same step, the error of the first one is
+// rethrown
+TEST(BlockPipelineErrorTest, FirstErrorRethrown)
+{
+    // block 3 is read while block 1 is written
+    try {
+        runBlockPipeline(6, 4, 24, true,
+                [&](int block, int, long, long) {
+                    if (block == 3)
+                        throw std::runtime_error("read 3");
+                },
+                [&](int, long) {},
+                [&](int block, int, long, long) {
+                    if (block == 1)
+                        throw std::runtime_error("write 1");
+                });
+        FAIL() << "no exception";
+    } catch (const std::runtime_error& error) {
+        EXPECT_STREQ(error.what(), "write 1");
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockPipeline, BlockPipelineTest,
+        ::testing::Values(false, true));
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
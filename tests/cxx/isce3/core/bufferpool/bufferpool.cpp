@@ -0,0 +1,158 @@
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <isce3/core/BufferPool.h>
+
+using isce3::core::BufferPool;
+using isce3::core::BUFFER_POOL_ALIGNMENT;
+using isce3::core::BUFFER_POOL_MIN_CLASS;
+
+TEST(BufferPoolTest, SizeClass)
+{
+    EXPECT_EQ(BufferPool::sizeClass(1), BUFFER_POOL_MIN_CLASS);
+    EXPECT_EQ(BufferPool::sizeClass(BUFFER_POOL_MIN_CLASS),
+              BUFFER_POOL_MIN_CLASS);
+    EXPECT_EQ(BufferPool::sizeClass(BUFFER_POOL_MIN_CLASS + 1),
+              BUFFER_POOL_MIN_CLASS * 5 / 4);
+    EXPECT_EQ(BufferPool::sizeClass(3 << 20), std::size_t(3 << 20));
+
+    // classes are increasing and waste at most a quarter of a buffer
+    for (std::size_t bytes = 1000; bytes < (std::size_t(1) << 34);
+         bytes = bytes * 3 / 2) {
+        const auto size = BufferPool::sizeClass(bytes);
+        EXPECT_GE(size, bytes);
+        if (bytes > BUFFER_POOL_MIN_CLASS) {
+            EXPECT_LE(size, bytes + bytes / 4);
+        }
+        EXPECT_LE(size, BufferPool::sizeClass(bytes + 1));
+    }
+}
+
+TEST(BufferPoolTest, ReuseAndStats)
+{
+    BufferPool pool;
+    const std::size_t bytes = 1 << 20;
+
+    {
+        auto a = pool.acquire(bytes);
+        auto b = pool.acquire(bytes);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.data()) %
+                          BUFFER_POOL_ALIGNMENT, 0u);
+        EXPECT_EQ(a.size(), bytes);
+
+        const auto stats = pool.stats();
+        EXPECT_EQ(stats.bytesInUse, 2 * bytes);
+        EXPECT_EQ(stats.highWaterBytes, 2 * bytes);
+        EXPECT_EQ(stats.bytesReserved, 2 * bytes);
+        EXPECT_EQ(stats.misses, 2u);
+    }
+    EXPECT_EQ(pool.stats().bytesInUse, 0u);
+
+    // returned buffers are reused
+    {
+        auto c = pool.acquire(bytes - 100);
+        EXPECT_TRUE(c.data() != nullptr);
+        EXPECT_EQ(pool.stats().hits, 1u);
+        EXPECT_EQ(pool.stats().bytesReserved, 2 * bytes);
+
+        // moving keeps a single owner
+        auto d = std::move(c);
+        EXPECT_EQ(c.data(), nullptr);
+        EXPECT_EQ(pool.stats().bytesInUse, bytes);
+        d.release();
+        EXPECT_EQ(pool.stats().bytesInUse, 0u);
+    }
+    EXPECT_EQ(pool.stats().highWaterBytes, 2 * bytes);
+    pool.resetHighWater();
+    EXPECT_EQ(pool.stats().highWaterBytes, 0u);
+
+    pool.trim();
+    EXPECT_EQ(pool.stats().bytesReserved, 0u);
+}
+
+TEST(BufferPoolTest, IdleCap)
+{
+    BufferPool pool;
+    const std::size_t bytes = 1 << 20;
+    EXPECT_EQ(pool.maxIdleBytes(), isce3::core::BUFFER_POOL_DEFAULT_MAX_IDLE);
+
+    // returned buffers above the cap are freed
+    pool.maxIdleBytes(2 * bytes);
+    {
+        auto a = pool.acquire(bytes);
+        auto b = pool.acquire(bytes);
+        auto c = pool.acquire(bytes);
+        EXPECT_EQ(pool.stats().bytesReserved, 3 * bytes);
+    }
+    EXPECT_EQ(pool.stats().bytesInUse, 0u);
+    EXPECT_EQ(pool.stats().bytesReserved, 2 * bytes);
+
+    // lowering the cap frees idle buffers, largest first
+    {
+        auto d = pool.acquire(4 * bytes);
+    }
+    pool.maxIdleBytes(8 * bytes);
+    {
+        auto d = pool.acquire(4 * bytes);
+    }
+    EXPECT_EQ(pool.stats().bytesReserved, 6 * bytes);
+    pool.trim(3 * bytes);
+    EXPECT_EQ(pool.stats().bytesReserved, 2 * bytes);
+    {
+        auto e = pool.acquire(bytes);
+        EXPECT_EQ(pool.stats().misses, 5u);
+    }
+
+    // buffers in use are not affected by the cap
+    {
+        auto f = pool.acquire(bytes);
+        pool.maxIdleBytes(0);
+        EXPECT_EQ(pool.stats().bytesReserved, bytes);
+    }
+    EXPECT_EQ(pool.stats().bytesReserved, 0u);
+}
+
+TEST(BufferPoolTest, Threads)
+{
+    BufferPool pool;
+    const int n = 64;
+    #pragma omp parallel for
+    for (int i = 0; i < n; ++i) {
+        auto buffer = pool.acquire(200000);
+        static_cast<char*>(buffer.data())[0] = 1;
+    }
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.bytesInUse, 0u);
+    EXPECT_EQ(stats.hits + stats.misses, std::uint64_t(n));
+    // with a single size class, no more buffers than the peak in use
+    EXPECT_LE(stats.bytesReserved, stats.highWaterBytes);
+}
+
+TEST(BufferPoolTest, PooledArray2D)
+{
+    BufferPool pool;
+    isce3::core::PooledArray2D<std::complex<float>> a(300, 500, pool);
+    EXPECT_EQ(a.length(), 300u);
+    EXPECT_EQ(a.width(), 500u);
+    EXPECT_GE(pool.stats().bytesInUse, 300 * 500 * sizeof(std::complex<float>));
+
+    a.fill({1.0f, 2.0f});
+    a(299, 499) = {3.0f, 4.0f};
+
+    // binds to Eigen::Ref like an EArray2D
+    auto sum = [](Eigen::Ref<isce3::core::EArray2D<std::complex<float>>> x) {
+        return x.sum();
+    };
+    const auto expected = std::complex<float>(300 * 500 - 1, 2 * (300 * 500 - 1)) +
+                          std::complex<float>(3.0f, 4.0f);
+    EXPECT_NEAR(std::abs(sum(a) - expected), 0.0, 1e-2 * std::abs(expected));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
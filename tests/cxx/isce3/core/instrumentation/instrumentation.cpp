@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <isce3/core/Instrumentation.h>
+
+namespace instr = isce3::core::instrumentation;
+
+struct InstrumentationTest : public ::testing::Test {
+    void SetUp() override
+    {
+        instr::enable(true, true);
+        instr::reset();
+    }
+
+    void TearDown() override
+    {
+        instr::reset();
+        instr::enable(false);
+    }
+};
+
+TEST_F(InstrumentationTest, Disabled)
+{
+    instr::enable(false);
+    {
+        instr::ScopedTimer timer("disabled.scope");
+    }
+    instr::count("disabled.counter", 3);
+    instr::record("disabled.histogram", 1.0);
+
+    const auto report = instr::report();
+    EXPECT_TRUE(report.timers.empty());
+    EXPECT_TRUE(report.counters.empty());
+    EXPECT_TRUE(report.histograms.empty());
+    EXPECT_TRUE(report.events.empty());
+}
+
+TEST_F(InstrumentationTest, MergeThreads)
+{
+    const int n = 100;
+    #pragma omp parallel for
+    for (int i = 0; i < n; ++i) {
+        instr::ScopedTimer timer("test.block");
+        instr::count("test.pixels", 10);
+        instr::record("test.value", 0.75);
+    }
+
+    const auto report = instr::report();
+    ASSERT_EQ(report.timers.count("test.block"), 1);
+    EXPECT_EQ(report.timers.at("test.block").count, n);
+    EXPECT_EQ(report.counters.at("test.pixels"), 10 * n);
+    EXPECT_EQ(report.events.size(), n);
+
+    // 0.75 lies in [2^-1, 2^0)
+    const auto& h = report.histograms.at("test.value");
+    EXPECT_EQ(h.count, n);
+    EXPECT_DOUBLE_EQ(h.sum, 0.75 * n);
+    EXPECT_DOUBLE_EQ(h.min, 0.75);
+    EXPECT_DOUBLE_EQ(h.max, 0.75);
+    const int k = -1 - instr::HISTOGRAM_MIN_EXPONENT;
+    EXPECT_EQ(h.bins[k], n);
+    EXPECT_DOUBLE_EQ(instr::Histogram::binLowerEdge(k), 0.5);
+}
+
+TEST_F(InstrumentationTest, Output)
+{
+    {
+        instr::ScopedTimer timer("test.\"quoted\"");
+    }
+    instr::count("test.bytes", 4096);
+
+    const auto report = instr::report();
+    const auto json = instr::toJSON(report);
+    EXPECT_NE(json.find("\"test.\\\"quoted\\\"\": {\"count\": 1"),
+            std::string::npos);
+    EXPECT_NE(json.find("\"test.bytes\": 4096"), std::string::npos);
+
+    const auto trace = instr::toChromeTrace(report);
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\": \"X\""), std::string::npos);
+
+    instr::reset();
+    EXPECT_TRUE(instr::report().timers.empty());
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -308,6 +308,35 @@ TEST_F(Interp1dTest, ChebyKnab)
     test_rand_offsets(0.998, 5.0, 0.5, 0.5, kernel);
 }
 
+TEST_F(Interp1dTest, FixedWidthTable)
+{
+    auto knab = isce3::core::KnabKernel<double>(9.0, 0.8);
+    auto table = isce3::core::TabulatedKernel<double>(knab, 2048);
+    auto kernel = isce3::core::TabulatedKernelN<double, 9>(knab, 2048);
+    test_rand_offsets(0.998, 5.0, 0.5, 0.5, kernel);
+
+    // Should match the runtime-width table exactly, including near the edges
+    // of the signal and with periodic boundaries.
+    auto times = gen_rand_times();
+    times.push_back(0.2);
+    times.push_back(n - 1.3);
+    std::vector<std::complex<double>> batch(times.size());
+    const auto x = &signal[0];
+    for (bool periodic : {false, true}) {
+        interp1d(kernel, x, n, 1, times.data(), batch.data(), times.size(),
+                 periodic);
+        for (size_t i = 0; i < times.size(); ++i) {
+            const auto ref = interp1d(table, x, n, 1, times[i], periodic);
+            EXPECT_EQ(interp1d(kernel, x, n, 1, times[i], periodic), ref);
+            EXPECT_EQ(batch[i], ref);
+        }
+    }
+
+    // Width must match number of taps
+    using Kernel8 = isce3::core::TabulatedKernelN<double, 8>;
+    EXPECT_THROW(Kernel8(knab, 2048), isce3::except::LengthError);
+}
+
 TEST_F(Interp1dTest, NFFT)
 {
     // FFT the signal set up by the test class to get a spectrum.
@@ -55,6 +55,36 @@ TEST(LUT1dTest, Lookup) {
     }
 }
 
+TEST(LUT1dTest, CursorLookup) {
+
+    // Non-uniform coordinates
+    const size_t n = 10;
+    std::valarray<double> coords(n), values(n);
+    for (size_t i = 0; i < n; ++i) {
+        coords[i] = i * i;
+        values[i] = std::exp(-1.0 * i / 3.0);
+    }
+    isce3::core::LUT1d<double> lut(coords, values, true);
+
+    // Increasing, decreasing and jumping evaluation points should all agree
+    // with the binary search
+    std::vector<double> xvec = isce3::core::linspace(-5.0, 90.0, 200);
+    std::vector<double> xjump {40.0, 3.5, 81.0, 81.0, 0.0, 64.2, 2.0};
+    size_t cursor = 0;
+    for (auto x : xvec)
+        EXPECT_DOUBLE_EQ(lut.eval(x, cursor), lut.eval(x));
+    for (auto it = xvec.rbegin(); it != xvec.rend(); ++it)
+        EXPECT_DOUBLE_EQ(lut.eval(*it, cursor), lut.eval(*it));
+    for (auto x : xjump)
+        EXPECT_DOUBLE_EQ(lut.eval(x, cursor), lut.eval(x));
+
+    // Batch evaluation
+    Eigen::ArrayXd xarr = Eigen::Map<Eigen::ArrayXd>(xvec.data(), xvec.size());
+    const Eigen::ArrayXd out = lut.eval(xarr);
+    for (size_t i = 0; i < xvec.size(); ++i)
+        EXPECT_DOUBLE_EQ(out(i), lut.eval(xvec[i]));
+}
+
 TEST(LUT1dTest, AvgLUT2dToLUT1d) {
     // Create indices
     std::vector<double> xvec = isce3::core::arange(0., 3., 1.);
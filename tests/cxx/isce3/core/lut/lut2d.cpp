@@ -1,5 +1,6 @@
 #include <iostream>
 #include <cmath>
+#include <complex>
 #include <vector>
 #include <valarray>
 #include <string>
@@ -56,6 +57,46 @@ TEST(LUT2dTest, Evaluation) {
     ASSERT_TRUE((error / N_pts) < 0.058);
 }
 
+// Test row evaluation against point evaluation
+TEST(LUT2dTest, RowEvaluation) {
+
+    const size_t nx = 20, ny = 15;
+    isce3::core::Matrix<std::complex<float>> M(ny, nx);
+    for (size_t i = 0; i < ny; ++i) {
+        for (size_t j = 0; j < nx; ++j) {
+            M(i,j) = std::complex<float>(std::sin(0.3 * i + 0.1 * j),
+                                         std::cos(0.2 * i * j));
+        }
+    }
+
+    // Evaluation points include the edges, exact grid points and points
+    // outside of the LUT (clamped)
+    std::vector<double> x = isce3::core::linspace(-1.0, 110.0, 301);
+    std::vector<double> y {-3.0, 0.0, 7.0, 12.3, 42.0, 70.0, 75.0};
+
+    for (auto method : {isce3::core::BILINEAR_METHOD,
+                        isce3::core::NEAREST_METHOD}) {
+        isce3::core::LUT2d<std::complex<float>> lut(
+                0.0, 0.0, 5.0, 5.0, M, method, false);
+        std::vector<std::complex<float>> out(x.size());
+        for (auto yy : y) {
+            lut.eval(yy, x.data(), out.data(), x.size());
+            for (size_t i = 0; i < x.size(); ++i) {
+                const auto ref = lut.eval(yy, x[i]);
+                EXPECT_NEAR(out[i].real(), ref.real(), 1e-6);
+                EXPECT_NEAR(out[i].imag(), ref.imag(), 1e-6);
+            }
+        }
+    }
+
+    // No data
+    isce3::core::LUT2d<std::complex<float>> lut;
+    std::vector<std::complex<float>> out(x.size(), 1.0f);
+    lut.eval(0.0, x.data(), out.data(), x.size());
+    for (auto value : out)
+        EXPECT_EQ(value, std::complex<float>(0.0f));
+}
+
 void loadInterpData(isce3::core::Matrix<double> & M) {
     /*
     Load ground truth interpolation data. The test data is the function:
@@ -0,0 +1,176 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <isce3/core/Numa.h>
+
+using isce3::core::ThreadPlacement;
+
+struct NumaTest : public ::testing::TestWithParam<ThreadPlacement> {
+    void TearDown() override
+    {
+        isce3::core::setThreadPlacement(ThreadPlacement::Default);
+    }
+};
+
+TEST(NumaTopologyTest, NodeCpus)
+{
+    const auto nodes = isce3::core::numaNodeCpus();
+    ASSERT_FALSE(nodes.empty());
+    for (const auto& cpus : nodes) {
+        EXPECT_FALSE(cpus.empty());
+    }
+}
+
+TEST_P(NumaTest, EveryBlockOnce)
+{
+    isce3::core::setThreadPlacement(GetParam());
+    const std::size_t n = 257;
+    std::vector<std::atomic<int>> calls(n);
+    isce3::core::forEachBlock(n, [&](std::size_t block) { ++calls[block]; });
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(calls[i].load(), 1);
+    }
+
+    // zero and one block
+    isce3::core::forEachBlock(0, [](std::size_t) { FAIL(); });
+    int single = 0;
+    isce3::core::forEachBlock(1, [&](std::size_t) { ++single; });
+    EXPECT_EQ(single, 1);
+}
+
+TEST_P(NumaTest, FirstErrorRethrown)
+{
+    isce3::core::setThreadPlacement(GetParam());
+    std::atomic<int> done {0};
+    try {
+        isce3::core::forEachBlock(100, [&](std::size_t block) {
+            if (block == 17 || block == 60) {
+                throw std::runtime_error(std::to_string(block));
+            }
+            ++done;
+        });
+        FAIL() << "expected an exception";
+    } catch (const std::runtime_error& e) {
+        EXPECT_EQ(std::string(e.what()), "17");
+    }
+    // the other blocks are still processed
+    EXPECT_EQ(done.load(), 98);
+}
+
+INSTANTIATE_TEST_SUITE_P(Placements, NumaTest,
+        ::testing::Values(ThreadPlacement::Default, ThreadPlacement::Pinned,
+                ThreadPlacement::PerNode));
+
+#if defined(__linux__)
+// Number of CPUs the calling thread may run on
+static int affinityCount()
+{
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    sched_getaffinity(0, sizeof(mask), &mask);
+    return CPU_COUNT(&mask);
+}
+
+TEST(NumaTopologyTest, PerNodeTwoNodes)
+{
+    // split the usable CPUs in two nodes, so that the PerNode path runs on
+    // any machine
+    std::vector<int> cpus;
+    for (const auto& node : isce3::core::numaNodeCpus()) {
+        cpus.insert(cpus.end(), node.begin(), node.end());
+    }
+    const std::size_t half = (cpus.size() + 1) / 2;
+    std::vector<std::vector<int>> nodes {
+            {cpus.begin(), cpus.begin() + half},
+            {cpus.begin() + half, cpus.end()}};
+    if (nodes[1].empty()) {
+        nodes[1] = nodes[0];
+    }
+
+#ifdef _OPENMP
+    const int levels = omp_get_max_active_levels();
+#endif
+    const int affinity = affinityCount();
+
+    // each block is processed once, by a thread pinned to the CPUs of the
+    // node owning its contiguous range
+    const std::size_t n = 101;
+    std::vector<std::atomic<int>> calls(n);
+    std::atomic<int> misplaced {0};
+    isce3::core::detail::forEachBlock(n, [&](std::size_t block) {
+        ++calls[block];
+        const auto& node = nodes[block < n / 2 ? 0 : 1];
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        sched_getaffinity(0, sizeof(mask), &mask);
+        bool inNode = CPU_COUNT(&mask) == 1;
+        if (inNode) {
+            inNode = false;
+            for (int cpu : node) {
+                inNode = inNode || CPU_ISSET(cpu, &mask);
+            }
+        }
+        if (!inNode) {
+            ++misplaced;
+        }
+    }, ThreadPlacement::PerNode, nodes);
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(calls[i].load(), 1);
+    }
+    EXPECT_EQ(misplaced.load(), 0);
+
+    // errors of the nested teams are rethrown
+    try {
+        isce3::core::detail::forEachBlock(n, [&](std::size_t block) {
+            if (block == 80) {
+                throw std::runtime_error("80");
+            }
+        }, ThreadPlacement::PerNode, nodes);
+        FAIL() << "expected an exception";
+    } catch (const std::runtime_error& e) {
+        EXPECT_EQ(std::string(e.what()), "80");
+    }
+
+    // the nesting level and the affinity of the calling thread, and of the
+    // threads reused by later parallel regions, are restored
+#ifdef _OPENMP
+    EXPECT_EQ(omp_get_max_active_levels(), levels);
+#endif
+    EXPECT_EQ(affinityCount(), affinity);
+    std::atomic<int> pinned {0};
+#pragma omp parallel
+    {
+        if (affinityCount() != affinity) {
+            ++pinned;
+        }
+    }
+    EXPECT_EQ(pinned.load(), 0);
+}
+#endif
+
+TEST(NumaTopologyTest, FirstTouchFill)
+{
+    const std::size_t rows = 123, cols = 45;
+    std::vector<float> data(rows * cols);
+    isce3::core::firstTouchFill(data.data(), rows, cols, 2.5f);
+    for (float value : data) {
+        EXPECT_EQ(value, 2.5f);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -76,6 +76,12 @@ ceaTest(Point15, {  2.032593025432839e+00,   1.474564625955619e+00,
           3.491994915674123e+03}, {  1.123669588782941e+07,   7.307956458783941e+06,
           3.491994915674123e+03});
 
+// Row of points of the batch and row transforms
+TEST_F(CEATest, Batch)
+{
+    batchTest(proj, {-1.5e6, 3.0e6, 500.}, 1.0e5);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
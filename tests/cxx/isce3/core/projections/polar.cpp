@@ -114,6 +114,17 @@ polarTest(North, North15, { 1.896312874775227e+00,   1.411713711367596e+00, 1.68
         { 4.391289593706741e+05,   8.865894956770649e+05, 1.689205800030411e+03});
 
 
+// Rows of points of the batch and row transforms
+TEST_F(PolarTest, BatchNorth)
+{
+    batchTest(North, {4.0e5, -8.0e5, 100.}, 2.0e4);
+}
+
+TEST_F(PolarTest, BatchSouth)
+{
+    batchTest(South, {-1.0e6, 1.5e6, 100.}, 2.0e4);
+}
+
 int main(int argc, char **argv) {
 
     ::testing::InitGoogleTest(&argc, argv);
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <optional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -21,6 +25,102 @@ auto projTest(const ProjectionBase& p, const Vec3& ref_llh, const Vec3& ref_xyz)
     EXPECT_NEAR(llh[0], ref_llh[0], 1e-9);
     EXPECT_NEAR(llh[1], ref_llh[1], 1e-9);
     EXPECT_NEAR(llh[2], ref_llh[2], 1e-6);
+
+    // Batch transforms should agree with the single point ones
+    double x, y, z;
+    EXPECT_EQ(p.forward_batch(1, &ref_llh[0], &ref_llh[1], &ref_llh[2], &x,
+                              &y, &z), 0);
+    EXPECT_NEAR(x, ref_xyz[0], 1e-6);
+    EXPECT_NEAR(y, ref_xyz[1], 1e-6);
+    EXPECT_NEAR(z, ref_xyz[2], 1e-6);
+
+    double lon, lat, hgt;
+    EXPECT_EQ(p.inverse_batch(1, &ref_xyz[0], &ref_xyz[1], &ref_xyz[2], &lon,
+                              &lat, &hgt), 0);
+    EXPECT_NEAR(lon, ref_llh[0], 1e-9);
+    EXPECT_NEAR(lat, ref_llh[1], 1e-9);
+    EXPECT_NEAR(hgt, ref_llh[2], 1e-6);
+
+    // Row transform is only defined for zero height
+    if (ref_xyz[2] == 0.) {
+        EXPECT_EQ(p.inverse_row(1, &ref_xyz[0], ref_xyz[1], &lon, &lat), 0);
+        EXPECT_NEAR(lon, ref_llh[0], 1e-9);
+        EXPECT_NEAR(lat, ref_llh[1], 1e-9);
+    }
+}
+
+// Batch and row transforms of a row of points spaced by dx around ref_xyz,
+// with varying heights, should agree with the single point ones. The
+// optional points that fail to transform, an X coordinate on the same row
+// for the inverse transforms and a LLH point for the forward one, are
+// appended to the row and should be set to NaN and counted.
+void batchTest(const ProjectionBase& p, const Vec3& ref_xyz, double dx,
+               std::optional<double> bad_x = {},
+               std::optional<Vec3> bad_llh = {})
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const int ngood = 9;
+    const int n = ngood + bad_x.has_value();
+
+    std::vector<double> x(n), y(n, ref_xyz[1]), z(n, 0.);
+    std::vector<Vec3> ref_llh(n, Vec3 {nan, nan, nan});
+    for (int i = 0; i < ngood; ++i) {
+        x[i] = ref_xyz[0] + (i - ngood / 2) * dx;
+        z[i] = ref_xyz[2] + 10. * i;
+        ref_llh[i] = p.inverse(Vec3 {x[i], y[i], z[i]});
+    }
+    if (bad_x)
+        x[ngood] = *bad_x;
+
+    std::vector<double> lon(n), lat(n), hgt(n);
+    EXPECT_EQ(p.inverse_batch(n, x.data(), y.data(), z.data(), lon.data(),
+                              lat.data(), hgt.data()), n - ngood);
+    for (int i = 0; i < n; ++i) {
+        if (i >= ngood) {
+            EXPECT_TRUE(std::isnan(lon[i]) && std::isnan(lat[i]) &&
+                        std::isnan(hgt[i]));
+            continue;
+        }
+        EXPECT_NEAR(lon[i], ref_llh[i][0], 1e-12) << "point " << i;
+        EXPECT_NEAR(lat[i], ref_llh[i][1], 1e-12) << "point " << i;
+        EXPECT_NEAR(hgt[i], ref_llh[i][2], 1e-9) << "point " << i;
+    }
+
+    // the row terms are shared by all the points of the row
+    EXPECT_EQ(p.inverse_row(n, x.data(), ref_xyz[1], lon.data(), lat.data()),
+              n - ngood);
+    for (int i = 0; i < n; ++i) {
+        if (i >= ngood) {
+            EXPECT_TRUE(std::isnan(lon[i]) && std::isnan(lat[i]));
+            continue;
+        }
+        EXPECT_NEAR(lon[i], ref_llh[i][0], 1e-12) << "point " << i;
+        EXPECT_NEAR(lat[i], ref_llh[i][1], 1e-12) << "point " << i;
+    }
+
+    // forward transform of the LLH points of the row
+    const int nf = ngood + bad_llh.has_value();
+    std::vector<double> lon_f(nf), lat_f(nf), hgt_f(nf);
+    for (int i = 0; i < nf; ++i) {
+        const Vec3 llh = i < ngood ? ref_llh[i] : *bad_llh;
+        lon_f[i] = llh[0];
+        lat_f[i] = llh[1];
+        hgt_f[i] = llh[2];
+    }
+    std::vector<double> xf(nf), yf(nf), zf(nf);
+    EXPECT_EQ(p.forward_batch(nf, lon_f.data(), lat_f.data(), hgt_f.data(),
+                              xf.data(), yf.data(), zf.data()), nf - ngood);
+    for (int i = 0; i < nf; ++i) {
+        if (i >= ngood) {
+            EXPECT_TRUE(std::isnan(xf[i]) && std::isnan(yf[i]) &&
+                        std::isnan(zf[i]));
+            continue;
+        }
+        const Vec3 xyz = p.forward(ref_llh[i]);
+        EXPECT_NEAR(xf[i], xyz[0], 1e-6) << "point " << i;
+        EXPECT_NEAR(yf[i], xyz[1], 1e-6) << "point " << i;
+        EXPECT_NEAR(zf[i], xyz[2], 1e-6) << "point " << i;
+    }
 }
 
 #define PROJ_TEST(testclass, proj, name, ...)                                  \
@@ -518,6 +518,20 @@ utmSouthTest(59, { 2.959352714231888e+00, -1.074158844609437e+00, 1.991679650882
 utmSouthTest(60, { 3.038341419519374e+00, -8.883583150753551e-01, 1.479453617383727e+03},
         {  2.949702298669473e+05,   4.357336082772384e+06, 1.479453617383727e+03});
 
+// Rows of points of the batch and row transforms, with points outside of
+// the UTM domain
+TEST_F(UTMTest, BatchNorth)
+{
+    batchTest(UTM {32611}, {4.0e5, 4.0e6, 100.}, 2.5e4, 5.0e5 + 3.0e7,
+              Vec3 {(-117. + 89.99) * M_PI / 180., 0., 0.});
+}
+
+TEST_F(UTMTest, BatchSouth)
+{
+    batchTest(UTM {32755}, {6.0e5, 5.2e6, -50.}, 2.5e4, 5.0e5 - 3.0e7,
+              Vec3 {(147. - 89.99) * M_PI / 180., 0., 0.});
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
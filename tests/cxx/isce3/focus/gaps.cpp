@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
+#include <isce3/except/Error.h>
 #include <isce3/focus/GapMask.h>
+#include <memory>
 
 TEST(GapDetectionTest, Mask)
 {
@@ -22,6 +24,50 @@ TEST(GapDetectionTest, Mask)
     }
 }
 
+TEST(GapDetectionTest, Block)
+{
+    // Variable PRI so that the number of gaps changes from pulse to pulse.
+    int m = 50;
+    std::vector<double> t(m);
+    for (int i = 1; i < m; ++i) {
+        t[i] = t[i - 1] + 1.0 + 0.25 * (i % 3);
+    }
+    int n = 200;
+    double fs = 10.0;
+    double dwp = 3.1;
+    double chirplen = 0.4;
+    double guard = 0.05;
+    isce3::focus::GapMask masker(t, n, dwp, fs, chirplen, guard);
+
+    const int pulse = 5, npulses = 30;
+    std::unique_ptr<bool[]> mask(new bool[npulses * n]);
+    masker.mask(mask.get(), pulse, npulses);
+
+    const int maxgaps = masker.maxGapsPerPulse();
+    std::vector<std::pair<int, int>> intervals(npulses * maxgaps);
+    std::vector<int> count(npulses);
+    masker.gaps(intervals.data(), count.data(), pulse, npulses, maxgaps);
+
+    for (int i = 0; i < npulses; ++i) {
+        const auto expected_mask = masker.mask(pulse + i);
+        for (int j = 0; j < n; ++j) {
+            EXPECT_EQ(mask[i * n + j], expected_mask[j]);
+        }
+        const auto expected_gaps = masker.gaps(pulse + i);
+        ASSERT_EQ(count[i], expected_gaps.size());
+        for (int k = 0; k < count[i]; ++k) {
+            EXPECT_EQ(intervals[i * maxgaps + k], expected_gaps[k]);
+        }
+    }
+
+    // Table too small
+    EXPECT_THROW(masker.gaps(intervals.data(), count.data(), pulse, npulses,
+                             0), isce3::except::LengthError);
+    // Out of bounds
+    EXPECT_THROW(masker.mask(mask.get(), m - 1, 2),
+                 isce3::except::DomainError);
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
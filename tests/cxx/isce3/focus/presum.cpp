@@ -1,5 +1,9 @@
+#include <cmath>
+#include <complex>
 #include <gtest/gtest.h>
+#include <set>
 #include <isce3/core/Kernels.h>
+#include <isce3/focus/GapMask.h>
 #include <isce3/focus/Presum.h>
 
 
@@ -76,6 +80,105 @@ TEST(Presum, NoData)
 }
 
 
+// Variable-PRI pulse times and gap mask shared by the gap pattern tests.
+struct PresumGapsTest : public ::testing::Test {
+    const int npulses = 64;
+    const int nr = 100;
+    std::vector<double> t;
+    Eigen::VectorXd teig;
+    isce3::focus::GapMask gaps;
+
+    static std::vector<double> pulseTimes(int n)
+    {
+        // PRI varies over a cycle of eight pulses.
+        std::vector<double> t(n);
+        double ti = 0.0;
+        for (int i = 0; i < n; ++i) {
+            t[i] = ti;
+            ti += 1.0 + 0.1 * (i % 8);
+        }
+        return t;
+    }
+
+    PresumGapsTest()
+        : t(pulseTimes(npulses)),
+          teig(Eigen::Map<const Eigen::VectorXd>(t.data(), t.size())),
+          // fs = 10 and dwp = 4.05 means each RX window of 10 s spans several
+          // 0.5 s transmit events, each blocking about 5 samples.
+          gaps(t, nr, 4.05, 10.0, 0.5)
+    {}
+};
+
+TEST_F(PresumGapsTest, PatternIds)
+{
+    const long offset = 10;
+    const int nw = 5;
+    const auto ids = isce3::focus::getGapPatternIds(gaps, offset, nw);
+    ASSERT_EQ(ids.size(), nr);
+    // Make sure the test setup actually exercises several gap patterns.
+    EXPECT_GT(std::set<std::uint64_t>(ids.begin(), ids.end()).size(), 2);
+    for (int j = 0; j < nw; ++j) {
+        const auto mask = gaps.mask(offset + j);
+        for (int k = 0; k < nr; ++k) {
+            EXPECT_EQ(bool((ids[k] >> j) & 1), not mask[k]);
+        }
+    }
+}
+
+TEST_F(PresumGapsTest, Pulse)
+{
+    // Compare against weights computed independently for each range bin.
+    isce3::core::AzimuthKernel<double> acorr(3.0);
+    const double tout = 30.3;
+
+    std::vector<std::complex<float>> raw(npulses * nr);
+    Eigen::VectorXd doppler(nr);
+    for (int k = 0; k < nr; ++k) {
+        doppler(k) = 0.01 * (k - nr / 2);
+    }
+    for (int i = 0; i < npulses; ++i) {
+        for (int k = 0; k < nr; ++k) {
+            raw[i * nr + k] = std::complex<float>(std::cos(0.1 * i * k),
+                                                  std::sin(0.3 * i + k));
+        }
+    }
+
+    std::vector<std::complex<float>> out(nr);
+    isce3::focus::presumPulse(out.data(), acorr, teig, tout, gaps,
+                              raw.data(), doppler);
+
+    long offset = 0;
+    const int nw = isce3::focus::getPresumWeights(acorr, t, tout, &offset)
+                           .size();
+    ASSERT_GT(nw, 0);
+    for (int k = 0; k < nr; ++k) {
+        std::vector<double> tk;
+        std::vector<std::complex<float>> zk;
+        for (int j = 0; j < nw; ++j) {
+            const auto mask = gaps.mask(offset + j);
+            if (not mask[k]) {
+                const double tj = t[offset + j] - tout;
+                const double phi = -2 * M_PI * tj * doppler(k);
+                tk.push_back(t[offset + j]);
+                zk.push_back(std::complex<float>(std::cos(phi), std::sin(phi))
+                             * raw[(offset + j) * nr + k]);
+            }
+        }
+        std::complex<double> expected = 0.0;
+        if (not tk.empty()) {
+            long koff = 0;
+            const auto w = isce3::focus::getPresumWeights(acorr, tk, tout,
+                                                          &koff);
+            for (int i = 0; i < w.size(); ++i) {
+                expected += w(i) * std::complex<double>(zk[koff + i]);
+            }
+        }
+        EXPECT_NEAR(out[k].real(), expected.real(), 1e-4);
+        EXPECT_NEAR(out[k].imag(), expected.imag(), 1e-4);
+    }
+}
+
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -183,6 +183,30 @@ TEST(RangeCompTest, ConvolveMode)
     }
 }
 
+TEST(RangeCompTest, FFTThreads)
+{
+    int chirpsize = 5;
+    int inputsize = 9;
+    int maxbatch = 3;
+    std::vector<std::complex<float>> chirp(chirpsize, 1.);
+    std::vector<std::complex<float>> input(maxbatch * inputsize);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = {float(i % 7), float(i % 3)};
+    }
+
+    // single-threaded FFT plans must give the same output as the default ones
+    RangeComp rcproc(chirp, inputsize, maxbatch);
+    RangeComp rcproc1(chirp, inputsize, maxbatch, RangeComp::Mode::Full, 1);
+
+    std::vector<std::complex<float>> output(maxbatch * rcproc.outputSize());
+    std::vector<std::complex<float>> output1(output.size());
+    rcproc.rangecompress(output.data(), input.data(), maxbatch);
+    rcproc1.rangecompress(output1.data(), input.data(), maxbatch);
+
+    float errtol = 1e-5;
+    EXPECT_LT(maxAbsError(output1, output), errtol);
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
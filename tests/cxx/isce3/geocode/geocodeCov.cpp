@@ -320,6 +320,181 @@ TEST(GeocodeTest, TestGeocodeCov) {
 
     geoComplexObj.geocode(radar_grid, slc_x_conj_y_raster, geocoded_slc_x_conj_y_raster,
                           demRaster, output_mode);
+
+    // Test the area-projection operator: geocoding the full covariance with
+    // the operator saved by geocode() should reproduce its outputs
+    for (auto geocode_memory_mode :
+            {geocode_memory_mode_1, geocode_memory_mode_2}) {
+
+        isce3::geocode::AreaProjOperator area_proj_operator;
+
+        isce3::io::Raster ref_diag_raster("area_proj_ref_geo_diag.bin",
+                geoGridWidth, geoGridLength, 2, GDT_Float32, "ENVI");
+        isce3::io::Raster ref_off_diag_raster("area_proj_ref_geo_off_diag.bin",
+                geoGridWidth, geoGridLength, 1, GDT_CFloat32, "ENVI");
+
+        geoComplexObj.geocode(radar_grid, slc_raster_xy, ref_diag_raster,
+                demRaster, output_mode, flag_az_baseband_doppler, flatten,
+                geogrid_upsampling, flag_upsample_radar_grid, flag_apply_rtc,
+                input_terrain_radiometry, output_terrain_radiometry, exponent,
+                rtc_min_value_db, rtc_geogrid_upsampling, rtc_algorithm,
+                rtc_area_beta_mode, abs_cal_factor, clip_min,
+                clip_max, min_nlooks, radar_grid_nlooks,
+                &ref_off_diag_raster, out_geo_rdr, out_geo_dem,
+                out_geo_nlooks, out_geo_rtc, out_geo_rtc_gamma0_to_sigma0,
+                phase_screen_raster,
+                az_time_correction_full_cov, slant_range_correction_full_cov,
+                input_rtc, output_rtc, input_layover_shadow_mask_raster,
+                sub_swaths, apply_valid_samples_sub_swath_masking, out_mask,
+                geocode_memory_mode, min_block_size, max_block_size,
+                isce3::core::BIQUINTIC_METHOD, &area_proj_operator);
+
+        ASSERT_FALSE(area_proj_operator.empty());
+        ASSERT_GT(area_proj_operator.nnz(), 0);
+
+        // round trip through HDF5
+        {
+            isce3::io::IH5File op_file("area_proj_operator.h5", 'x');
+            isce3::io::IGroup op_group = op_file.createGroup("operator");
+            area_proj_operator.saveToH5(op_group);
+        }
+        isce3::geocode::AreaProjOperator loaded_area_proj_operator;
+        {
+            isce3::io::IH5File op_file("area_proj_operator.h5");
+            isce3::io::IGroup op_group = op_file.openGroup("operator");
+            loaded_area_proj_operator.loadFromH5(op_group);
+        }
+        ASSERT_EQ(loaded_area_proj_operator.numBlocks(),
+                area_proj_operator.numBlocks());
+        ASSERT_EQ(loaded_area_proj_operator.nnz(), area_proj_operator.nnz());
+
+        isce3::io::Raster op_diag_raster("area_proj_op_geo_diag.bin",
+                geoGridWidth, geoGridLength, 2, GDT_Float32, "ENVI");
+        isce3::io::Raster op_off_diag_raster("area_proj_op_geo_off_diag.bin",
+                geoGridWidth, geoGridLength, 1, GDT_CFloat32, "ENVI");
+
+        geoComplexObj.applyAreaProjOperator(loaded_area_proj_operator,
+                slc_raster_xy, op_diag_raster, &op_off_diag_raster);
+
+        const size_t size = geoGridLength * geoGridWidth;
+        std::valarray<std::complex<double>> ref_array(size), op_array(size);
+        double max_err = 0;
+        int nvalid = 0;
+        for (int band = 1; band <= 3; ++band) {
+            if (band <= 2) {
+                ref_diag_raster.getBlock(ref_array, 0, 0, geoGridWidth,
+                        geoGridLength, band);
+                op_diag_raster.getBlock(op_array, 0, 0, geoGridWidth,
+                        geoGridLength, band);
+            } else {
+                ref_off_diag_raster.getBlock(ref_array, 0, 0, geoGridWidth,
+                        geoGridLength);
+                op_off_diag_raster.getBlock(op_array, 0, 0, geoGridWidth,
+                        geoGridLength);
+            }
+            for (size_t k = 0; k < size; ++k) {
+                const bool ref_nan = std::isnan(std::abs(ref_array[k]));
+                ASSERT_EQ(ref_nan, std::isnan(std::abs(op_array[k])));
+                if (ref_nan)
+                    continue;
+                max_err = std::max(max_err, std::abs(ref_array[k] -
+                        op_array[k]) / (1 + std::abs(ref_array[k])));
+                nvalid++;
+            }
+        }
+        ASSERT_GE(nvalid, 2400);
+        ASSERT_LT(max_err, 1.0e-5);
+    }
+
+    // Test the interpolation operator: geocoding the SLCs with the operator
+    // saved by geocode() (and reloaded from HDF5) should reproduce its
+    // outputs, with small blocks and with a single block, whose radar window
+    // covers the whole radar grid, flattened and baseband
+    output_mode = isce3::geocode::geocodeOutputMode::INTERP;
+
+    for (const bool single_block : {false, true}) {
+        const std::string suffix = single_block ? "_single_block" : "";
+        const bool flag_az_baseband_doppler_op = single_block;
+        const bool flatten_op = single_block;
+        const auto interp_memory_mode =
+                single_block ? isce3::core::GeocodeMemoryMode::SingleBlock
+                             : geocode_memory_mode_1;
+
+        isce3::geocode::InterpOperator interp_operator;
+
+        isce3::io::Raster interp_ref_raster(
+                "interp_ref_geo_slc" + suffix + ".bin", geoGridWidth,
+                geoGridLength, 2, GDT_CFloat32, "ENVI");
+
+        geoComplexObj.geocode(radar_grid, slc_raster_xy, interp_ref_raster,
+                demRaster, output_mode, flag_az_baseband_doppler_op,
+                flatten_op, geogrid_upsampling, flag_upsample_radar_grid,
+                flag_apply_rtc, input_terrain_radiometry,
+                output_terrain_radiometry, exponent, rtc_min_value_db,
+                rtc_geogrid_upsampling, rtc_algorithm, rtc_area_beta_mode,
+                abs_cal_factor, clip_min, clip_max, min_nlooks,
+                radar_grid_nlooks, nullptr, out_geo_rdr, out_geo_dem,
+                out_geo_nlooks, out_geo_rtc, out_geo_rtc_gamma0_to_sigma0,
+                phase_screen_raster, az_time_correction_full_cov,
+                slant_range_correction_full_cov, input_rtc, output_rtc,
+                input_layover_shadow_mask_raster, sub_swaths,
+                apply_valid_samples_sub_swath_masking, out_mask,
+                interp_memory_mode, min_block_size, max_block_size,
+                isce3::core::BIQUINTIC_METHOD, nullptr, &interp_operator);
+
+        ASSERT_FALSE(interp_operator.empty());
+        ASSERT_GT(interp_operator.numValidPixels(), 0);
+        if (single_block)
+            ASSERT_EQ(interp_operator.numBlocks(), 1u);
+
+        const std::string op_file_name = "interp_operator" + suffix + ".h5";
+        {
+            isce3::io::IH5File op_file(op_file_name, 'x');
+            isce3::io::IGroup op_group = op_file.createGroup("operator");
+            interp_operator.saveToH5(op_group);
+        }
+        isce3::geocode::InterpOperator loaded_interp_operator;
+        {
+            isce3::io::IH5File op_file(op_file_name);
+            isce3::io::IGroup op_group = op_file.openGroup("operator");
+            loaded_interp_operator.loadFromH5(op_group);
+        }
+        ASSERT_EQ(loaded_interp_operator.numBlocks(),
+                interp_operator.numBlocks());
+        ASSERT_EQ(loaded_interp_operator.numValidPixels(),
+                interp_operator.numValidPixels());
+
+        isce3::io::Raster interp_op_raster(
+                "interp_op_geo_slc" + suffix + ".bin", geoGridWidth,
+                geoGridLength, 2, GDT_CFloat32, "ENVI");
+
+        geoComplexObj.applyInterpOperator(loaded_interp_operator, radar_grid,
+                slc_raster_xy, interp_op_raster, flag_az_baseband_doppler_op,
+                flatten_op);
+
+        const size_t size = geoGridLength * geoGridWidth;
+        std::valarray<std::complex<double>> ref_array(size), op_array(size);
+        double max_err = 0;
+        int nvalid = 0;
+        for (int band = 1; band <= 2; ++band) {
+            interp_ref_raster.getBlock(ref_array, 0, 0, geoGridWidth,
+                    geoGridLength, band);
+            interp_op_raster.getBlock(op_array, 0, 0, geoGridWidth,
+                    geoGridLength, band);
+            for (size_t k = 0; k < size; ++k) {
+                const bool ref_nan = std::isnan(std::abs(ref_array[k]));
+                ASSERT_EQ(ref_nan, std::isnan(std::abs(op_array[k])))
+                        << "pixel " << k << " of band " << band << suffix;
+                if (ref_nan)
+                    continue;
+                max_err = std::max(max_err, std::abs(ref_array[k] -
+                        op_array[k]) / (1 + std::abs(ref_array[k])));
+                nvalid++;
+            }
+        }
+        ASSERT_GE(nvalid, 1500);
+        ASSERT_LT(max_err, 1.0e-5);
+    }
 }
 
 
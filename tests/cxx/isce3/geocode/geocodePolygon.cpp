@@ -0,0 +1,127 @@
+#include <cmath>
+#include <limits>
+#include <string>
+#include <valarray>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <isce3/core/Ellipsoid.h>
+#include <isce3/core/LUT2d.h>
+#include <isce3/core/Orbit.h>
+#include <isce3/geocode/GeocodePolygon.h>
+#include <isce3/io/IH5.h>
+#include <isce3/io/Raster.h>
+#include <isce3/product/RadarGridParameters.h>
+#include <isce3/product/RadarGridProduct.h>
+
+using isce3::geocode::GeocodePolygon;
+
+struct GeocodePolygonTest : public ::testing::TestWithParam<bool> {
+
+    isce3::core::Orbit orbit;
+    isce3::core::Ellipsoid ellipsoid;
+    isce3::core::LUT2d<double> doppler;
+    isce3::product::RadarGridParameters radar_grid;
+
+    std::vector<std::vector<double>> x_vects, y_vects;
+
+    void SetUp() override
+    {
+        isce3::io::IH5File file(TESTDATA_DIR "envisat.h5");
+        isce3::product::RadarGridProduct product(file);
+
+        orbit = product.metadata().orbit();
+        doppler = product.metadata().procInfo().dopplerCentroid('A');
+        radar_grid = isce3::product::RadarGridParameters(
+                product.swath('A'), product.lookSide());
+
+        // input raster: a ramp over the radar grid
+        const int length = radar_grid.length();
+        const int width = radar_grid.width();
+        std::valarray<float> data(length * width);
+        for (int i = 0; i < length; ++i)
+            for (int j = 0; j < width; ++j)
+                data[i * width + j] = 1 + 0.01 * i + 0.002 * j;
+        isce3::io::Raster input_raster("polygon_input.bin", width, length, 1,
+                                       GDT_Float32, "ENVI");
+        input_raster.setBlock(data, 0, 0, width, length);
+
+        // a row of adjacent squares (that share DEM and radar-grid blocks)
+        // and an isolated one
+        const double size = 0.004;
+        for (int k = 0; k < 4; ++k) {
+            const double x0 = -115.595 + k * size;
+            const double y0 = 34.81;
+            x_vects.push_back({x0, x0 + size, x0 + size, x0});
+            y_vects.push_back({y0, y0, y0 + size, y0 + size});
+        }
+        x_vects.push_back({-115.54, -115.535, -115.537});
+        y_vects.push_back({34.822, 34.822, 34.827});
+    }
+};
+
+// Each line of getPolygonMeans() must match getPolygonMean() for the same
+// polygon, regardless of how polygons are grouped into blocks
+TEST_P(GeocodePolygonTest, MatchesSinglePolygon)
+{
+    const bool flag_apply_rtc = GetParam();
+
+    isce3::io::Raster input_raster("polygon_input.bin");
+    isce3::io::Raster dem_raster(TESTDATA_DIR "srtm_cropped.tif");
+    const int npolygons = x_vects.size();
+
+    std::vector<float> ref_means(npolygons), ref_nlooks(npolygons);
+    for (int i = 0; i < npolygons; ++i) {
+        GeocodePolygon<float> polygon(x_vects[i], y_vects[i], radar_grid,
+                                      orbit, ellipsoid, doppler, dem_raster);
+        isce3::io::Raster output_raster(
+                "polygon_output_" + std::to_string(i) + ".bin", 1, 1, 1,
+                GDT_Float32, "ENVI");
+        polygon.getPolygonMean(radar_grid, doppler, input_raster,
+                               output_raster, dem_raster, flag_apply_rtc);
+        output_raster.getValue(ref_means[i], 0, 0, 1);
+        ref_nlooks[i] = polygon.out_nlooks();
+        ASSERT_GT(ref_nlooks[i], 0);
+    }
+
+    // the default block size groups the adjacent polygons, while a block
+    // size of one sample keeps each polygon in its own block
+    for (long long max_block_size : {1LL << 24, 1LL}) {
+        isce3::io::Raster output_raster("polygon_means.bin", 1, npolygons, 1,
+                                        GDT_Float32, "ENVI");
+        const std::vector<float> nlooks =
+                GeocodePolygon<float>::getPolygonMeans(
+                        x_vects, y_vects, radar_grid, orbit, ellipsoid,
+                        doppler, input_raster, output_raster, dem_raster,
+                        flag_apply_rtc,
+                        isce3::geometry::rtcInputTerrainRadiometry::
+                                BETA_NAUGHT,
+                        isce3::geometry::rtcOutputTerrainRadiometry::
+                                GAMMA_NAUGHT,
+                        0, std::numeric_limits<double>::quiet_NaN(),
+                        std::numeric_limits<float>::quiet_NaN(), 1, 1,
+                        nullptr, isce3::core::dataInterpMethod::
+                                         BIQUINTIC_METHOD,
+                        1e-8, 100, 1e-8, max_block_size);
+        ASSERT_EQ(nlooks.size(), x_vects.size());
+
+        std::valarray<float> means(npolygons);
+        output_raster.getBlock(means, 0, 0, 1, npolygons);
+
+        for (int i = 0; i < npolygons; ++i) {
+            EXPECT_NEAR(means[i], ref_means[i],
+                        1e-6 * std::abs(ref_means[i]));
+            EXPECT_NEAR(nlooks[i], ref_nlooks[i], 1e-6 * ref_nlooks[i]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GeocodePolygon, GeocodePolygonTest,
+                         ::testing::Values(false, true));
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
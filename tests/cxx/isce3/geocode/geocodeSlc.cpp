@@ -297,6 +297,142 @@ TEST(GeocodeTest, CheckGeocodeSlc)
     ASSERT_EQ(nFails, 0);
 }
 
+TEST(GeocodeTest, GeocodeSlcBlocksPerDemTile)
+{
+    // Blocks sharing a DEM tile, and processed concurrently, must give the
+    // same output as geocoding the whole grid as a single block
+    isce3::io::IH5File file(TESTDATA_DIR "envisat.h5");
+    isce3::product::RadarGridProduct product(file);
+    isce3::core::Orbit orbit = product.metadata().orbit();
+    isce3::core::Ellipsoid ellipsoid;
+    isce3::core::LUT2d<double> doppler =
+            product.metadata().procInfo().dopplerCentroid('A');
+    isce3::product::RadarGridParameters radarGrid(product, 'A');
+
+    const int geoGridLength = 500, geoGridWidth = 500;
+    isce3::product::GeoGridParameters geoGrid(-115.65, 34.84, 0.0002,
+            -8.0e-5, geoGridWidth, geoGridLength, 4326);
+
+    isce3::io::Raster demRaster("zero_height_dem_geo.bin");
+    isce3::io::Raster inputSlc("xslc_rdr.bin", GA_ReadOnly);
+    const auto no_carrier = isce3::core::LUT2d<double>();
+
+    // one block, and ten blocks of 50 lines that fit in a single DEM tile
+    std::vector<std::valarray<std::complex<float>>> outputs;
+    for (size_t linesPerBlock : {500, 50}) {
+        const std::string fileName =
+                "xslc_geo_blocks" + std::to_string(linesPerBlock) + ".bin";
+        {
+            isce3::io::Raster geoRaster(fileName, geoGridWidth, geoGridLength,
+                    1, GDT_CFloat32, "ENVI");
+            isce3::geocode::geocodeSlc(geoRaster, inputSlc, demRaster,
+                    radarGrid, geoGrid, orbit, doppler, doppler, ellipsoid,
+                    1.0e-9, 25, linesPerBlock, false, true, no_carrier,
+                    no_carrier);
+        }
+        isce3::io::Raster geoRaster(fileName);
+        outputs.emplace_back(geoGridLength * geoGridWidth);
+        geoRaster.getBlock(outputs.back(), 0, 0, geoGridWidth, geoGridLength);
+    }
+
+    size_t nvalid = 0;
+    for (size_t i = 0; i < outputs[0].size(); ++i) {
+        const auto ref = outputs[0][i], val = outputs[1][i];
+        ASSERT_EQ(std::isnan(ref.real()), std::isnan(val.real()));
+        if (std::isnan(ref.real()))
+            continue;
+        ++nvalid;
+        ASSERT_NEAR(std::abs(val - ref), 0.0, 1.0e-6 * std::abs(ref));
+    }
+    ASSERT_GT(nvalid, 0);
+}
+
+TEST(GeocodeTest, GeocodeSlcBursts)
+{
+    // Geocoding the two halves of a radar grid as bursts mosaicked into the
+    // same output should match geocoding the whole radar grid at once.
+    isce3::io::IH5File file(TESTDATA_DIR "envisat.h5");
+    isce3::product::RadarGridProduct product(file);
+    isce3::core::Orbit orbit = product.metadata().orbit();
+    isce3::core::Ellipsoid ellipsoid;
+    isce3::core::LUT2d<double> imageGridDoppler =
+            product.metadata().procInfo().dopplerCentroid('A');
+    isce3::core::Matrix<double> M(imageGridDoppler.length(),
+                                  imageGridDoppler.width());
+    M.zeros();
+    isce3::core::LUT2d<double> nativeDoppler(
+            imageGridDoppler.xStart(), imageGridDoppler.yStart(),
+            imageGridDoppler.xSpacing(), imageGridDoppler.ySpacing(), M);
+    isce3::product::RadarGridParameters radarGrid(product, 'A');
+
+    const int geoGridLength = 500;
+    const int geoGridWidth = 500;
+    isce3::product::GeoGridParameters geoGrid(-115.65, 34.84, 0.0002, -8.0e-5,
+            geoGridWidth, geoGridLength, 4326);
+
+    isce3::io::Raster demRaster("zero_height_dem_geo.bin");
+    isce3::io::Raster inputSlc("xslc_rdr.bin", GA_ReadOnly);
+
+    const double thresholdGeo2rdr = 1.0e-9;
+    const int numiterGeo2rdr = 25;
+    const bool flatten = false;
+    const bool reramp = true;
+    auto dummy = isce3::core::EArray2D<double>();
+
+    // reference geocoded over the whole radar grid
+    isce3::core::EArray2D<std::complex<float>> rdrDataArr(
+            inputSlc.length(), inputSlc.width());
+    inputSlc.getBlock(rdrDataArr.data(), 0, 0, inputSlc.width(),
+            inputSlc.length(), 1);
+    isce3::core::EArray2D<std::complex<float>> refArr(geoGridLength,
+                                                      geoGridWidth);
+    std::vector<isce3::geocode::EArray2dc64> refVec = {refArr};
+    std::vector<isce3::geocode::EArray2dc64> rdrVec = {rdrDataArr};
+    isce3::geocode::geocodeSlc(refVec, dummy, dummy, rdrVec, demRaster,
+            radarGrid, radarGrid, geoGrid, orbit, nativeDoppler,
+            imageGridDoppler, ellipsoid, thresholdGeo2rdr, numiterGeo2rdr,
+            std::nullopt, 0, 0, flatten, reramp);
+
+    // each burst gets its own copy of the radar data as it is deramped in
+    // place, and both write to the same geocoded array
+    isce3::core::EArray2D<std::complex<float>> geoDataArr(geoGridLength,
+                                                          geoGridWidth);
+    // the bursts overlap like real bursts do, so that no pixel falls
+    // between their sliced radar grids
+    const size_t halfLength = radarGrid.length() / 2;
+    const size_t overlap = 10;
+    std::vector<isce3::core::EArray2D<std::complex<float>>> rdrCopies(2);
+    std::vector<isce3::geocode::SlcBurst<isce3::core::LUT2d<double>>> bursts;
+    for (size_t i = 0; i < 2; ++i) {
+        rdrCopies[i] = rdrDataArr;
+        const size_t lineStart = (i == 0) ? 0 : halfLength - overlap;
+        const size_t length = (i == 0) ? halfLength + overlap
+                                       : radarGrid.length() - lineStart;
+        bursts.push_back({{geoDataArr}, dummy, dummy, {rdrCopies[i]},
+                radarGrid,
+                radarGrid.offsetAndResize(lineStart, 0, length,
+                                          radarGrid.width()),
+                nativeDoppler, imageGridDoppler});
+    }
+    isce3::geocode::geocodeSlcBursts(bursts, demRaster, geoGrid, orbit,
+            ellipsoid, thresholdGeo2rdr, numiterGeo2rdr, flatten, reramp);
+
+    size_t nValid = 0, nMismatch = 0;
+    for (int i = 0; i < geoGridLength; ++i) {
+        for (int j = 0; j < geoGridWidth; ++j) {
+            const auto ref = refArr(i, j);
+            const auto val = geoDataArr(i, j);
+            if (std::isnan(ref.real()) && std::isnan(val.real()))
+                continue;
+            ++nValid;
+            if (ref != val)
+                ++nMismatch;
+        }
+    }
+    EXPECT_GT(nValid, 0);
+    EXPECT_EQ(nMismatch, 0);
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -11,6 +11,9 @@
 #include <sstream>
 #include <fstream>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <tuple>
 #include <vector>
 
 // isce3::core
@@ -28,6 +31,7 @@
 // isce3::geometry
 #include <isce3/geometry/DEMInterpolator.h>
 #include <isce3/geometry/boundingbox.h>
+#include <isce3/geometry/geometry.h>
 
 using isce3::core::LookSide;
 
@@ -290,6 +294,135 @@ TEST_P(PerimeterTest, DateLine) {
 }
 
 
+TEST_P(PerimeterTest, MatchesRdr2Geo) {
+
+    LookSide side = std::get<0>(GetParam());
+    int azlooks = std::get<1>(GetParam());
+    int rglooks = std::get<2>(GetParam());
+
+    const double degrees = 180.0 / M_PI;
+    Setup_orbit(0.0, 0.1 / degrees, 10);
+    Setup_grid(azlooks, rglooks, side);
+
+    std::unique_ptr<isce3::core::ProjectionBase> proj(
+            isce3::core::createProj(4326));
+
+    // Doppler varying over the grid
+    isce3::core::Matrix<double> fd(2, 2);
+    fd(0, 0) = 100.0;
+    fd(0, 1) = 150.0;
+    fd(1, 0) = -50.0;
+    fd(1, 1) = 20.0;
+    const isce3::core::LUT2d<double> doppler(grid.startingRange(),
+            grid.sensingStart(), grid.endingRange() - grid.startingRange(),
+            grid.sensingStop() - grid.sensingStart(), fd,
+            isce3::core::BILINEAR_METHOD, false);
+
+    const int nPtsPerEdge = 11;
+    const double htol = 1e-8;
+
+    for (double hgt : {0.0, 1200.0}) {
+        const isce3::geometry::DEMInterpolator dem(hgt);
+        const auto perimeter = isce3::geometry::getGeoPerimeter(
+                grid, orbit, proj.get(), doppler, dem, nPtsPerEdge, htol);
+        ASSERT_EQ(perimeter.getNumPoints(), 4 * nPtsPerEdge - 4 + 1);
+
+        const double t0 = grid.sensingTime(0);
+        const double t1 = grid.sensingTime(grid.length() - 1);
+        const double r0 = grid.slantRange(0);
+        const double r1 = grid.slantRange(grid.width() - 1);
+        std::vector<std::tuple<double, double>> vertices = {
+                {t0, r0}, {t0, r1}, {t1, r1}, {t1, r0}};
+        if (side == LookSide::Left) {
+            std::reverse(vertices.begin() + 1, vertices.end());
+        }
+
+        int ii = 0;
+        for (int iv = 0; iv < 4; ++iv) {
+            const auto& current = vertices[iv];
+            const auto& next = vertices[(iv + 1) % 4];
+            for (int ie = 0; ie < nPtsPerEdge - 1; ++ie, ++ii) {
+                const double t = static_cast<double>(ie) / (nPtsPerEdge - 1);
+                const double tinp = std::get<0>(current) +
+                        t * (std::get<0>(next) - std::get<0>(current));
+                const double rng = std::get<1>(current) +
+                        t * (std::get<1>(next) - std::get<1>(current));
+
+                isce3::core::Vec3 llh = {0.0, 0.0, hgt};
+                const int converged = isce3::geometry::rdr2geo(tinp, rng,
+                        doppler.eval(tinp, rng), orbit, ellipsoid, dem, llh,
+                        grid.wavelength(), side, htol, 50, 10);
+                ASSERT_TRUE(converged);
+
+                OGRPoint pt;
+                perimeter.getPoint(ii, &pt);
+                EXPECT_NEAR(pt.getX(), llh[0] * degrees, 1.0e-8);
+                EXPECT_NEAR(pt.getY(), llh[1] * degrees, 1.0e-8);
+                EXPECT_NEAR(pt.getZ(), hgt, 1.0e-6);
+            }
+        }
+    }
+}
+
+
+TEST_P(PerimeterTest, Bursts) {
+
+    LookSide side = std::get<0>(GetParam());
+    int azlooks = std::get<1>(GetParam());
+    int rglooks = std::get<2>(GetParam());
+
+    const double degrees = 180.0 / M_PI;
+    Setup_orbit(0.0, 0.1 / degrees, 10);
+    Setup_grid(azlooks, rglooks, side);
+
+    std::unique_ptr<isce3::core::ProjectionBase> proj(
+            isce3::core::createProj(4326));
+
+    // Split the grid into overlapping bursts
+    const int nbursts = 5;
+    const int burst_length = grid.length() / 3;
+    std::vector<isce3::product::RadarGridParameters> bursts;
+    for (int i = 0; i < nbursts; ++i) {
+        const int offset = i * (grid.length() - burst_length) / (nbursts - 1);
+        bursts.push_back(grid.offsetAndResize(offset, 0, burst_length,
+                                              grid.width()));
+    }
+
+    // Heights solved together (warm-started) match heights solved separately
+    const std::vector<double> hgts = {0.0, 1500.0, -300.0, 8000.0};
+    const auto zerodop = isce3::core::LUT2d<double>();
+    const double htol = 1e-8;
+    const auto boxes = isce3::geometry::getGeoBoundingBox(
+            bursts, orbit, proj.get(), zerodop, hgts, 0.0, 11, htol);
+    ASSERT_EQ(boxes.size(), nbursts);
+
+    for (int i = 0; i < nbursts; ++i) {
+        isce3::geometry::BoundingBox expected;
+        for (auto hgt : hgts) {
+            expected.Merge(isce3::geometry::getGeoBoundingBox(
+                    bursts[i], orbit, proj.get(), zerodop, {hgt}, 0.0, 11,
+                    htol));
+        }
+        EXPECT_NEAR(boxes[i].MinX, expected.MinX, 1.0e-9);
+        EXPECT_NEAR(boxes[i].MaxX, expected.MaxX, 1.0e-9);
+        EXPECT_NEAR(boxes[i].MinY, expected.MinY, 1.0e-9);
+        EXPECT_NEAR(boxes[i].MaxY, expected.MaxY, 1.0e-9);
+    }
+
+    const auto search_boxes = isce3::geometry::getGeoBoundingBoxHeightSearch(
+            bursts, orbit, proj.get(), zerodop, -500.0, 9000.0);
+    ASSERT_EQ(search_boxes.size(), nbursts);
+    for (int i = 0; i < nbursts; ++i) {
+        const auto expected = isce3::geometry::getGeoBoundingBoxHeightSearch(
+                bursts[i], orbit, proj.get(), zerodop, -500.0, 9000.0);
+        EXPECT_DOUBLE_EQ(search_boxes[i].MinX, expected.MinX);
+        EXPECT_DOUBLE_EQ(search_boxes[i].MaxX, expected.MaxX);
+        EXPECT_DOUBLE_EQ(search_boxes[i].MinY, expected.MinY);
+        EXPECT_DOUBLE_EQ(search_boxes[i].MaxY, expected.MaxY);
+    }
+}
+
+
 INSTANTIATE_TEST_SUITE_P(PerimeterTests, PerimeterTest,
                         testing::Values(
                             std::make_tuple(LookSide::Right,1,1),
@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -18,9 +19,11 @@
 
 // isce3::core
 #include <isce3/core/Constants.h>
+#include <isce3/core/Basis.h>
 #include <isce3/core/DateTime.h>
 #include <isce3/core/Ellipsoid.h>
 #include <isce3/core/Orbit.h>
+#include <isce3/core/Pixel.h>
 #include <isce3/core/Serialization.h>
 #include <isce3/core/TimeDelta.h>
 
@@ -29,6 +32,7 @@
 
 // isce3::geometry
 #include <isce3/geometry/DEMInterpolator.h>
+#include <isce3/geometry/detail/Rdr2Geo.h>
 #include <isce3/geometry/geo2rdr_roots.h>
 #include <isce3/geometry/geometry.h>
 
@@ -124,6 +128,148 @@ TEST_F(GeometryTest, RdrToGeoWithOrbit)
     }
 }
 
+TEST_F(GeometryTest, RdrToGeoMixedPrecision)
+{
+
+    // Load test data
+    std::vector<std::string> aztimes;
+    std::vector<double> ranges, heights, ref_data, ref_zerodop;
+    loadTestData(aztimes, ranges, heights, ref_data, ref_zerodop);
+
+    const double degrees = 180.0 / M_PI;
+    const isce3::geometry::detail::Rdr2GeoParams params {1.0e-8, 25, 15};
+    for (size_t i = 0; i < aztimes.size(); ++i) {
+
+        isce3::core::DateTime azDate(aztimes[i]);
+        const double azTime =
+                (azDate - orbit.referenceEpoch()).getTotalSeconds();
+
+        // Build the pixel and basis the way Topo does
+        isce3::core::Vec3 pos, vel;
+        orbit.interpolate(&pos, &vel, azTime);
+        const isce3::core::Basis tcn(pos, vel);
+        const double dopfact = 0.5 * swath.processedWavelength() *
+                               doppler.eval(azTime, ranges[i]) / vel.norm() *
+                               ranges[i];
+        const isce3::core::Pixel pixel(ranges[i], dopfact, 0);
+
+        isce3::geometry::DEMInterpolator dem(heights[i]);
+
+        // Float first stage followed by double refinement
+        isce3::core::Vec3 targetLLH;
+        bool fallback = true;
+        auto err = isce3::geometry::detail::rdr2geo_mixed(&targetLLH, pixel,
+                tcn, pos, vel, dem, ellipsoid, lookSide, heights[i], params,
+                1.0, &fallback);
+
+        // Same answer as the double precision solver
+        ASSERT_EQ(err, isce3::error::ErrorCode::Success);
+        EXPECT_FALSE(fallback);
+        ASSERT_NEAR(degrees * targetLLH[0], ref_data[3 * i], 1.0e-8);
+        ASSERT_NEAR(degrees * targetLLH[1], ref_data[3 * i + 1], 1.0e-8);
+        ASSERT_NEAR(targetLLH[2], ref_data[3 * i + 2], 1.0e-8);
+    }
+}
+
+// Planar terrain sloping in longitude and latitude. The first fail_calls
+// lookups return NaN, which makes the single precision stage of rdr2geo_mixed
+// fail and forces the double precision fallback.
+struct SlopedDEM {
+    double lon0, lat0, h0, dhdlon, dhdlat;
+    mutable int fail_calls = 0;
+
+    double interpolateLonLat(double lon, double lat) const
+    {
+        if (fail_calls > 0) {
+            --fail_calls;
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return h0 + dhdlon * (lon - lon0) + dhdlat * (lat - lat0);
+    }
+};
+
+TEST_F(GeometryTest, RdrToGeoMixedPrecisionSloped)
+{
+    std::vector<std::string> aztimes;
+    std::vector<double> ranges, heights, ref_data, ref_zerodop;
+    loadTestData(aztimes, ranges, heights, ref_data, ref_zerodop);
+
+    const double radians = M_PI / 180.0;
+    const isce3::geometry::detail::Rdr2GeoParams params {1.0e-8, 25, 15};
+    for (size_t i = 0; i < aztimes.size(); ++i) {
+
+        isce3::core::DateTime azDate(aztimes[i]);
+        const double azTime =
+                (azDate - orbit.referenceEpoch()).getTotalSeconds();
+
+        isce3::core::Vec3 pos, vel;
+        orbit.interpolate(&pos, &vel, azTime);
+        const isce3::core::Basis tcn(pos, vel);
+        const double dopfact = 0.5 * swath.processedWavelength() *
+                               doppler.eval(azTime, ranges[i]) / vel.norm() *
+                               ranges[i];
+        const isce3::core::Pixel pixel(ranges[i], dopfact, 0);
+
+        // ~10% slopes near the reference solution
+        const double lon0 = ref_data[3 * i] * radians;
+        const double lat0 = ref_data[3 * i + 1] * radians;
+        SlopedDEM dem {lon0, lat0, heights[i] + 300.0, 6.0e5, -4.0e5};
+
+        isce3::core::Vec3 llh_ref;
+        auto err = isce3::geometry::detail::rdr2geo(&llh_ref, pixel, tcn, pos,
+                vel, dem, ellipsoid, lookSide, 0., params);
+        ASSERT_EQ(err, isce3::error::ErrorCode::Success);
+
+        // single precision stage followed by double precision refinement,
+        // for the default float threshold, one below the single precision
+        // resolution and a coarser one
+        for (double float_threshold :
+                {std::numeric_limits<double>::quiet_NaN(), 1.0e-4, 1.0}) {
+            isce3::core::Vec3 llh;
+            bool fallback = true;
+            err = isce3::geometry::detail::rdr2geo_mixed(&llh, pixel, tcn,
+                    pos, vel, dem, ellipsoid, lookSide, 0., params,
+                    float_threshold, &fallback);
+            ASSERT_EQ(err, isce3::error::ErrorCode::Success);
+            EXPECT_FALSE(fallback);
+            EXPECT_NEAR(llh[0], llh_ref[0], 1.0e-12);
+            EXPECT_NEAR(llh[1], llh_ref[1], 1.0e-12);
+            EXPECT_NEAR(llh[2], llh_ref[2], 1.0e-6);
+            EXPECT_NEAR(llh[2], dem.interpolateLonLat(llh[0], llh[1]),
+                        1.0e-6);
+        }
+
+        // a convergence threshold coarser than single precision resolution
+        // needs no double precision refinement
+        {
+            const isce3::geometry::detail::Rdr2GeoParams coarse {1.0, 25, 15};
+            isce3::core::Vec3 llh;
+            bool fallback = true;
+            err = isce3::geometry::detail::rdr2geo_mixed(&llh, pixel, tcn,
+                    pos, vel, dem, ellipsoid, lookSide, 0., coarse,
+                    std::numeric_limits<double>::quiet_NaN(), &fallback);
+            ASSERT_EQ(err, isce3::error::ErrorCode::Success);
+            EXPECT_FALSE(fallback);
+            const isce3::core::Vec3 xyz = ellipsoid.lonLatToXyz(llh);
+            EXPECT_LT(std::abs((xyz - pos).norm() - ranges[i]), 1.0);
+            EXPECT_NEAR(llh[2], dem.interpolateLonLat(llh[0], llh[1]), 1.0);
+        }
+
+        // failed single precision stage falls back to rdr2geo from h0
+        dem.fail_calls = 1;
+        isce3::core::Vec3 llh;
+        bool fallback = false;
+        err = isce3::geometry::detail::rdr2geo_mixed(&llh, pixel, tcn, pos,
+                vel, dem, ellipsoid, lookSide, 0., params,
+                std::numeric_limits<double>::quiet_NaN(), &fallback);
+        ASSERT_EQ(err, isce3::error::ErrorCode::Success);
+        EXPECT_TRUE(fallback);
+        EXPECT_DOUBLE_EQ(llh[0], llh_ref[0]);
+        EXPECT_DOUBLE_EQ(llh[1], llh_ref[1]);
+        EXPECT_DOUBLE_EQ(llh[2], llh_ref[2]);
+    }
+}
+
 TEST_F(GeometryTest, GeoToRdr)
 {
 
@@ -99,6 +99,68 @@ TEST(TopoTest, CheckResults) {
     }
 }
 
+TEST(TopoTest, RunTopoMixedPrecision) {
+
+    // Same configuration as RunTopo with mixed precision rdr2geo
+    std::string h5file(TESTDATA_DIR "envisat.h5");
+    isce3::io::IH5File file(h5file);
+    isce3::product::RadarGridProduct product(file);
+    isce3::geometry::Topo topo(product, 'A', true);
+    topo.threshold(0.05);
+    topo.numiter(25);
+    topo.extraiter(10);
+    topo.demMethod(isce3::core::dataInterpMethod::BIQUINTIC_METHOD);
+    topo.epsgOut(4326);
+    topo.mixedPrecision(true);
+    ASSERT_TRUE(topo.mixedPrecision());
+
+    // Output only the coordinate layers
+    const size_t width = topo.radarGridParameters().width();
+    const size_t length = topo.radarGridParameters().length();
+    isce3::io::Raster xRaster("mixed_x.rdr", width, length, 1, GDT_Float64,
+                              "ENVI");
+    isce3::io::Raster yRaster("mixed_y.rdr", width, length, 1, GDT_Float64,
+                              "ENVI");
+    isce3::io::Raster zRaster("mixed_z.rdr", width, length, 1, GDT_Float64,
+                              "ENVI");
+
+    isce3::io::Raster demRaster(TESTDATA_DIR "srtm_cropped.tif");
+    topo.topo(demRaster, &xRaster, &yRaster, &zRaster);
+}
+
+TEST(TopoTest, CheckMixedPrecision) {
+
+    // Compare against the double precision layers from RunTopo, which are
+    // converged to the same slant range threshold
+    const std::vector<std::string> layers{"x", "y", "z"};
+    const std::vector<double> tols{1.0e-6, 1.0e-6, 0.05};
+    for (size_t k = 0; k < layers.size(); ++k) {
+        std::cout << "comparing layer: " << layers[k] << std::endl;
+        isce3::io::Raster testRaster("mixed_" + layers[k] + ".rdr");
+        isce3::io::Raster refRaster(layers[k] + ".rdr");
+        ASSERT_EQ(testRaster.width(), refRaster.width());
+        ASSERT_EQ(testRaster.length(), refRaster.length());
+
+        std::valarray<double> test(testRaster.width()),
+                ref(refRaster.width());
+        double error = 0.0;
+        size_t count = 0;
+        for (size_t i = 0; i < testRaster.length(); ++i) {
+            testRaster.getLine(test, i);
+            refRaster.getLine(ref, i);
+            for (size_t j = 0; j < testRaster.width(); ++j) {
+                // Skip outliers, as in CheckResults
+                const double currentError = std::abs(test[j] - ref[j]);
+                if (currentError > 5.0) continue;
+                error += currentError;
+                ++count;
+            }
+        }
+        ASSERT_GT(count, 0);
+        EXPECT_LT(error / count, tols[k]);
+    }
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -272,6 +272,19 @@ TEST_F(RasterTest, pushBack) {
   v.push_back(lon);
 }
 
+// Rasters of the same file share their data even through different handles
+TEST_F(RasterTest, sharesDataset) {
+  isce3::io::Raster inc = isce3::io::Raster( incFilename );
+  isce3::io::Raster incUpdate = isce3::io::Raster( "./" + incFilename, GA_Update );
+  isce3::io::Raster msk = isce3::io::Raster( mskFilename );
+  isce3::io::Raster incCopy( inc );
+
+  ASSERT_NE( inc.dataset(), incUpdate.dataset() );
+  ASSERT_TRUE( inc.sharesDataset( incCopy ) );
+  ASSERT_TRUE( inc.sharesDataset( incUpdate ) );
+  ASSERT_FALSE( inc.sharesDataset( msk ) );
+}
+
 
 // Main
 int main( int argc, char * argv[] ) {
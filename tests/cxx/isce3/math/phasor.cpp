@@ -0,0 +1,120 @@
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <isce3/math/Phasor.h>
+
+// reference values computed in extended precision
+static long double refSin(double x) { return std::sin((long double) x); }
+static long double refCos(double x) { return std::cos((long double) x); }
+
+TEST(PhasorTest, SinCos)
+{
+    // phases spanning the range of SAR phases, e.g. 4 pi R / wavelength
+    std::mt19937 gen(1234);
+    std::vector<double> x;
+    for (double scale : {1.0, 100.0, 1e5, 1e8, isce3::math::SINCOS_MAX_PHASE}) {
+        std::uniform_real_distribution<double> dist(-scale, scale);
+        for (int i = 0; i < 10000; ++i)
+            x.push_back(dist(gen));
+    }
+    // quadrant boundaries and special values
+    for (int k = -8; k <= 8; ++k) {
+        x.push_back(k * M_PI_4);
+        x.push_back(std::nextafter(k * M_PI_4, 0.0));
+    }
+    x.push_back(0.0);
+    x.push_back(-0.0);
+    x.push_back(1e300);
+    x.push_back(std::numeric_limits<double>::infinity());
+    x.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    const size_t n = x.size();
+    std::vector<double> s(n), c(n);
+    isce3::math::sincos(x.data(), s.data(), c.data(), n);
+
+    double maxErr = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        if (!std::isfinite(x[i])) {
+            EXPECT_TRUE(std::isnan(s[i]));
+            EXPECT_TRUE(std::isnan(c[i]));
+            continue;
+        }
+        maxErr = std::max(maxErr, (double) std::abs(s[i] - refSin(x[i])));
+        maxErr = std::max(maxErr, (double) std::abs(c[i] - refCos(x[i])));
+    }
+    EXPECT_LT(maxErr, 2.5e-16);
+
+    // in place, and symmetric in the sign of the phase
+    std::vector<double> y = x, minus(n), sm(n);
+    for (size_t i = 0; i < n; ++i)
+        minus[i] = -x[i];
+    isce3::math::sincos(y.data(), y.data(), c.data(), n);
+    isce3::math::sincos(minus.data(), sm.data(), c.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        if (std::isfinite(x[i])) {
+            EXPECT_EQ(y[i], s[i]);
+            EXPECT_EQ(sm[i], -s[i]);
+        }
+    }
+}
+
+TEST(PhasorTest, UnitPhasorsAndRotate)
+{
+    const size_t n = 1000;
+    std::vector<double> phase(n);
+    for (size_t i = 0; i < n; ++i)
+        phase[i] = 4.0 * M_PI * (850e3 + 2.3 * i) / 0.24;
+
+    std::vector<std::complex<float>> phasors(n);
+    isce3::math::unitPhasors(phase.data(), phasors.data(), n);
+
+    std::vector<std::complex<float>> data(n, {3.0f, -4.0f});
+    isce3::math::rotate(data.data(), phase.data(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        const std::complex<float> expected(std::cos(phase[i]),
+                                           std::sin(phase[i]));
+        EXPECT_NEAR(std::abs(phasors[i] - expected), 0.0, 1e-7);
+        EXPECT_NEAR(std::abs(data[i] - std::complex<float>(3.0f, -4.0f) *
+                                               expected),
+                    0.0, 1e-6);
+    }
+}
+
+TEST(PhasorTest, LinearPhasors)
+{
+    const double phase0 = 1234.5, dphase = -0.731;
+    const size_t n = 10000;
+    std::vector<std::complex<double>> out(n);
+    isce3::math::linearPhasors(phase0, dphase, out.data(), n);
+
+    double maxErr = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const long double phase = phase0 + (long double) i * dphase;
+        const std::complex<double> expected(std::cos(phase), std::sin(phase));
+        maxErr = std::max(maxErr, std::abs(out[i] - expected));
+    }
+    // the phases of the anchors are rounded to double precision
+    const double phaseErr = std::numeric_limits<double>::epsilon() *
+                            std::abs(phase0 + n * dphase);
+    EXPECT_LT(maxErr,
+              9e-16 * isce3::math::LINEAR_PHASOR_ANCHOR_INTERVAL + phaseErr);
+
+    // anchoring every sample evaluates every phasor directly
+    std::vector<std::complex<float>> direct(n);
+    isce3::math::linearPhasors(phase0, dphase, direct.data(), n, 1);
+    for (size_t i = 0; i < n; ++i)
+        EXPECT_NEAR(std::abs(direct[i] - std::complex<float>(out[i])), 0.0,
+                    1e-7);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
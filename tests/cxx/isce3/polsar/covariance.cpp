@@ -0,0 +1,175 @@
+#include <array>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <isce3/core/Constants.h>
+#include <isce3/except/Error.h>
+#include <isce3/polsar/covariance.h>
+
+using isce3::polsar::PolMatrixType;
+
+struct PolarimetricMatrixTest : public ::testing::Test {
+
+    using T = std::complex<float>;
+
+    void SetUp() override
+    {
+        const std::vector<std::string> names {"hh", "hv", "vh", "vv"};
+        channel_rasters.reserve(4);
+        for (int c = 0; c < 4; ++c) {
+            isce3::core::Matrix<T> array(length, width);
+            for (int i = 0; i < length; ++i)
+                for (int j = 0; j < width; ++j)
+                    array(i, j) = T(std::cos(0.3 * i + c * j), (c + 1) * i - j);
+            channel_rasters.emplace_back("covariance_" + names[c] + ".bin",
+                    width, length, 1, GDT_CFloat32, "ENVI");
+            channel_rasters.back().setBlock(
+                    array.data(), 0, 0, width, length, 1);
+            channels.push_back(array);
+        }
+    }
+
+    // Row-major 3x3 matrix averaged over the window of looks of output
+    // pixel (i, j)
+    std::array<std::complex<double>, 9> expectedMatrix(
+            PolMatrixType matrix_type, int i, int j) const
+    {
+        const double sqrt2 = std::sqrt(2.0);
+        std::array<std::complex<double>, 9> matrix {};
+        for (int ii = i * nlooks_azimuth; ii < (i + 1) * nlooks_azimuth; ++ii) {
+            for (int jj = j * nlooks_range; jj < (j + 1) * nlooks_range; ++jj) {
+                const std::complex<double> hh = channels[0](ii, jj);
+                const std::complex<double> hv =
+                        0.5 * (std::complex<double>(channels[1](ii, jj)) +
+                                std::complex<double>(channels[2](ii, jj)));
+                const std::complex<double> vv = channels[3](ii, jj);
+                std::complex<double> k[3];
+                if (matrix_type == PolMatrixType::Covariance) {
+                    k[0] = hh;
+                    k[1] = sqrt2 * hv;
+                    k[2] = vv;
+                } else {
+                    k[0] = (hh + vv) / sqrt2;
+                    k[1] = (hh - vv) / sqrt2;
+                    k[2] = sqrt2 * hv;
+                }
+                for (int m = 0; m < 3; ++m)
+                    for (int n = 0; n < 3; ++n)
+                        matrix[3 * m + n] += k[m] * std::conj(k[n]);
+            }
+        }
+        for (auto& element : matrix)
+            element /= nlooks_range * nlooks_azimuth;
+        return matrix;
+    }
+
+    // Form the matrix and compare its diagonal and off-diagonal rasters
+    // with the expected matrix
+    void checkMatrix(PolMatrixType matrix_type, bool overlap_io,
+            long long max_block_size = isce3::core::DEFAULT_MAX_BLOCK_SIZE)
+    {
+        isce3::io::Raster diag_raster("covariance_diag.bin", width_looked,
+                length_looked, 3, GDT_Float32, "ENVI");
+        isce3::io::Raster off_diag_raster("covariance_off_diag.bin",
+                width_looked, length_looked, 3, GDT_CFloat32, "ENVI");
+
+        isce3::polsar::polarimetricMatrix(channel_rasters[0],
+                channel_rasters[1], channel_rasters[2], channel_rasters[3],
+                &diag_raster, &off_diag_raster, matrix_type, nlooks_range,
+                nlooks_azimuth, isce3::core::MemoryModeBlocksY::MultipleBlocksY,
+                overlap_io, 0, max_block_size);
+
+        isce3::core::Matrix<float> diag(length_looked, width_looked);
+        isce3::core::Matrix<T> off_diag(length_looked, width_looked);
+        const int diag_index[3] = {0, 4, 8};
+        const int off_diag_index[3] = {1, 2, 5};
+        for (int b = 0; b < 3; ++b) {
+            diag_raster.getBlock(
+                    diag.data(), 0, 0, width_looked, length_looked, b + 1);
+            off_diag_raster.getBlock(off_diag.data(), 0, 0, width_looked,
+                    length_looked, b + 1);
+            for (int i = 0; i < length_looked; ++i) {
+                for (int j = 0; j < width_looked; ++j) {
+                    const auto expected = expectedMatrix(matrix_type, i, j);
+                    const auto m11 = expected[diag_index[b]];
+                    const auto m12 = expected[off_diag_index[b]];
+                    EXPECT_NEAR(diag(i, j), m11.real(),
+                            1e-6 * (1 + std::abs(m11)))
+                            << "band " << b + 1 << " at " << i << ", " << j;
+                    EXPECT_NEAR(std::abs(std::complex<double>(off_diag(i, j)) -
+                                        m12),
+                            0, 1e-6 * (1 + std::abs(m12)))
+                            << "band " << b + 1 << " at " << i << ", " << j;
+                }
+            }
+        }
+    }
+
+    // the last input lines and column are dropped
+    const int width = 17, length = 41, nlooks_range = 3, nlooks_azimuth = 4;
+    const int width_looked = width / nlooks_range;
+    const int length_looked = length / nlooks_azimuth;
+
+    std::vector<isce3::core::Matrix<T>> channels;
+    std::vector<isce3::io::Raster> channel_rasters;
+};
+
+TEST_F(PolarimetricMatrixTest, Covariance)
+{
+    for (bool overlap_io : {false, true})
+        checkMatrix(PolMatrixType::Covariance, overlap_io);
+}
+
+TEST_F(PolarimetricMatrixTest, Coherency)
+{
+    for (bool overlap_io : {false, true})
+        checkMatrix(PolMatrixType::Coherency, overlap_io);
+}
+
+// Blocks of three output lines (of 4 channels x nlooks_azimuth input lines
+// per pipeline slot) and a shorter last block
+TEST_F(PolarimetricMatrixTest, MultipleBlocks)
+{
+    const long long line_size = 4 * nlooks_azimuth * width * sizeof(T);
+    checkMatrix(PolMatrixType::Covariance, false, 3 * line_size);
+    checkMatrix(PolMatrixType::Covariance, true, 3 * 3 * line_size);
+    // blocks of one output line
+    checkMatrix(PolMatrixType::Coherency, true, 1);
+}
+
+TEST_F(PolarimetricMatrixTest, InvalidArguments)
+{
+    isce3::io::Raster diag_raster("covariance_invalid_diag.bin", width_looked,
+            length_looked, 3, GDT_Float32, "ENVI");
+    isce3::io::Raster real_off_diag_raster("covariance_invalid_off_diag.bin",
+            width_looked, length_looked, 3, GDT_Float32, "ENVI");
+
+    // no looks
+    EXPECT_THROW(isce3::polsar::polarimetricMatrix(channel_rasters[0],
+                         channel_rasters[1], channel_rasters[2],
+                         channel_rasters[3], &diag_raster, nullptr,
+                         PolMatrixType::Covariance, 0, nlooks_azimuth),
+            isce3::except::InvalidArgument);
+    // output dimensions without looks
+    EXPECT_THROW(isce3::polsar::polarimetricMatrix(channel_rasters[0],
+                         channel_rasters[1], channel_rasters[2],
+                         channel_rasters[3], &diag_raster, nullptr),
+            isce3::except::InvalidArgument);
+    // real off-diagonal elements
+    EXPECT_THROW(isce3::polsar::polarimetricMatrix(channel_rasters[0],
+                         channel_rasters[1], channel_rasters[2],
+                         channel_rasters[3], &diag_raster,
+                         &real_off_diag_raster, PolMatrixType::Covariance,
+                         nlooks_range, nlooks_azimuth),
+            isce3::except::InvalidArgument);
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
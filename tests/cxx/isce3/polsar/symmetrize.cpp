@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -69,6 +73,108 @@ TEST(PolsarSymmetrizeTest, symmetrize)
     }
 }
 
+TEST(PolsarSymmetrizeTest, fusedProducts)
+{
+    using T = std::complex<float>;
+
+    const int width = 13, length = 50, band = 1;
+
+    const std::vector<std::string> channel_names {"hh", "hv", "vh", "vv"};
+    std::vector<isce3::core::Matrix<T>> channels;
+    std::vector<isce3::io::Raster> channel_rasters;
+    channel_rasters.reserve(4);
+    for (int c = 0; c < 4; ++c) {
+        isce3::core::Matrix<T> array(length, width);
+        for (int i = 0; i < length; ++i) {
+            for (int j = 0; j < width; ++j) {
+                array(i, j) = T(i + c * j, (c + 1) * i - j);
+            }
+        }
+        channel_rasters.emplace_back("symmetrize_fused_" + channel_names[c] +
+                                             "_raster.bin",
+                width, length, 1, GDT_CFloat32, "ENVI");
+        channel_rasters.back().setBlock(
+                array.data(), 0, 0, width, length, band);
+        channels.push_back(array);
+    }
+
+    isce3::io::Raster output_raster("symmetrize_fused_output_raster.bin",
+            width, length, 1, GDT_CFloat32, "ENVI");
+    isce3::io::Raster span_raster("symmetrize_fused_span_raster.bin", width,
+            length, 1, GDT_Float32, "ENVI");
+    isce3::io::Raster pauli_raster("symmetrize_fused_pauli_raster.bin",
+            width, length, 3, GDT_CFloat32, "ENVI");
+    isce3::io::Raster covariance_raster(
+            "symmetrize_fused_covariance_raster.bin", width, length, 6,
+            GDT_CFloat32, "ENVI");
+
+    isce3::polsar::FusedPolProducts products;
+    products.span = &span_raster;
+    products.pauli = &pauli_raster;
+    products.covariance = &covariance_raster;
+
+    for (bool overlap_io : {false, true}) {
+
+        isce3::polsar::symmetrizeCrossPolChannels(channel_rasters[0],
+                channel_rasters[1], channel_rasters[2], channel_rasters[3],
+                &output_raster, products,
+                isce3::core::MemoryModeBlocksY::MultipleBlocksY, overlap_io);
+
+        isce3::core::Matrix<T> output_array(length, width);
+        isce3::core::Matrix<float> span_array(length, width);
+        std::vector<isce3::core::Matrix<T>> pauli(
+                3, isce3::core::Matrix<T>(length, width));
+        std::vector<isce3::core::Matrix<T>> covariance(
+                6, isce3::core::Matrix<T>(length, width));
+        output_raster.getBlock(
+                output_array.data(), 0, 0, width, length, band);
+        span_raster.getBlock(span_array.data(), 0, 0, width, length, band);
+        for (int b = 0; b < 3; ++b) {
+            pauli_raster.getBlock(
+                    pauli[b].data(), 0, 0, width, length, b + 1);
+        }
+        for (int b = 0; b < 6; ++b) {
+            covariance_raster.getBlock(
+                    covariance[b].data(), 0, 0, width, length, b + 1);
+        }
+
+        double max_error = 0;
+        auto check = [&](std::complex<double> value,
+                             std::complex<double> expected) {
+            max_error = std::max(max_error,
+                    std::abs(value - expected) / (1 + std::abs(expected)));
+        };
+
+        for (int i = 0; i < length; ++i) {
+            for (int j = 0; j < width; ++j) {
+                const std::complex<double> hh = channels[0](i, j);
+                const std::complex<double> vv = channels[3](i, j);
+                const std::complex<double> hv =
+                        0.5 * (std::complex<double>(channels[1](i, j)) +
+                                std::complex<double>(channels[2](i, j)));
+                const double sqrt2 = std::sqrt(2.0);
+
+                check(output_array(i, j), hv);
+                check(span_array(i, j),
+                        std::norm(hh) + 2 * std::norm(hv) + std::norm(vv));
+                check(pauli[0](i, j), (hh + vv) / sqrt2);
+                check(pauli[1](i, j), (hh - vv) / sqrt2);
+                check(pauli[2](i, j), sqrt2 * hv);
+                check(covariance[0](i, j), std::norm(hh));
+                check(covariance[1](i, j), sqrt2 * hh * std::conj(hv));
+                check(covariance[2](i, j), hh * std::conj(vv));
+                check(covariance[3](i, j), 2 * std::norm(hv));
+                check(covariance[4](i, j), sqrt2 * hv * std::conj(vv));
+                check(covariance[5](i, j), std::norm(vv));
+            }
+        }
+
+        std::cout << "PolSAR fused products max. relative error: "
+                  << max_error << std::endl;
+        EXPECT_LT(max_error, 1e-6);
+    }
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
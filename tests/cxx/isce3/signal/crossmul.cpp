@@ -12,6 +12,8 @@
 #include "isce3/signal/Signal.h"
 #include "isce3/io/Raster.h"
 #include "isce3/signal/Crossmul.h"
+#include "isce3/signal/Filter.h"
+#include "isce3/signal/Looks.h"
 #include <isce3/io/IH5.h>
 #include <isce3/product/RadarGridProduct.h>
 #include <isce3/product/Serialization.h>
@@ -164,6 +166,265 @@ TEST(Crossmul, RunCrossmulMLook)
       ASSERT_LT(max_err, 1.0e-6);
 }
 
+TEST(Crossmul, OverlapIO)
+{
+    // This test checks that overlapping the raster I/O with the processing
+    // of the blocks does not change the multilooked interferogram and
+    // coherence of an oversampled crossmul.
+
+    isce3::io::Raster referenceSlc(TESTDATA_DIR "warped_envisat.slc.vrt");
+
+    const int rngLooks = 3;
+    const int azLooks = 13;
+    const int width = referenceSlc.width() / rngLooks;
+    const int length = referenceSlc.length() / azLooks;
+
+    std::valarray<std::complex<float>> igram[2];
+    std::valarray<float> coh[2];
+    for (int i = 0; i < 2; ++i) {
+        std::string vsimem_igram = "/vsimem/" + getTempString("crossmul_igram");
+        std::string vsimem_coh = "/vsimem/" + getTempString("crossmul_coh");
+        isce3::io::Raster interferogram(vsimem_igram, width, length, 1,
+                                        GDT_CFloat32, "ENVI");
+        isce3::io::Raster coherence(vsimem_coh, width, length, 1, GDT_Float32,
+                                    "ENVI");
+
+        isce3::signal::Crossmul crsmul;
+        crsmul.rangeLooks(rngLooks);
+        crsmul.azimuthLooks(azLooks);
+        crsmul.oversampleFactor(2);
+        // several blocks, the last one partial
+        crsmul.linesPerBlock(4 * azLooks + 1);
+        crsmul.overlapIO(i == 0);
+
+        crsmul.crossmul(referenceSlc, referenceSlc, interferogram, coherence);
+
+        igram[i].resize(width * length);
+        coh[i].resize(width * length);
+        interferogram.getBlock(igram[i], 0, 0, width, length);
+        coherence.getBlock(coh[i], 0, 0, width, length);
+    }
+
+    for (size_t i = 0; i < igram[0].size(); ++i) {
+        ASSERT_EQ(igram[0][i], igram[1][i]);
+        ASSERT_EQ(coh[0][i], coh[1][i]);
+    }
+
+    // interferogram of the SLC with itself
+    double max_err = 0.0;
+    for (size_t i = 0; i < igram[0].size(); ++i)
+        max_err = std::max(max_err, std::abs(double(std::arg(igram[0][i]))));
+    ASSERT_LT(max_err, 1.0e-6);
+}
+
+// Synthetic SLC with a quadratic phase and a varying amplitude
+std::valarray<std::complex<float>> syntheticSlc(size_t length, size_t width,
+        double phase_rate)
+{
+    std::valarray<std::complex<float>> slc(length * width);
+    for (size_t i = 0; i < length; ++i) {
+        for (size_t j = 0; j < width; ++j) {
+            const double phase = phase_rate * (0.01 * i * i + 0.3 * j) +
+                                 0.002 * i * j;
+            slc[i * width + j] = std::polar(
+                    1.0 + 0.5 * std::cos(0.7 * i + 0.2 * j), phase);
+        }
+    }
+    return slc;
+}
+
+// Multilooked interferogram and coherence of an oversampled crossmul formed
+// as before the block pipeline: each SLC is upsampled as a whole with
+// Signal::upsample, the upsampled interferogram is looked down to the
+// original sampling and multilooked with Looks, and the coherence is formed
+// from the multilooked powers of the upsampled SLCs.
+void referenceCrossmul(std::valarray<std::complex<float>>& refSlc,
+        std::valarray<std::complex<float>>& secSlc, size_t length,
+        size_t width, size_t oversample, size_t rngLooks, size_t azLooks,
+        std::valarray<std::complex<float>>& ifgLooked,
+        std::valarray<float>& cohLooked)
+{
+    using SC = std::complex<float>;
+
+    size_t fft_size;
+    isce3::signal::Signal<float>().nextPowerOfTwo(width, fft_size);
+    const size_t ovsSize = oversample * fft_size;
+
+    // zero-padded SLCs, spectra and upsampled SLCs. The plans are made
+    // before the data is copied.
+    std::valarray<SC> ref(length * fft_size), sec(length * fft_size);
+    std::valarray<SC> refSpectrum(length * fft_size);
+    std::valarray<SC> secSpectrum(length * fft_size);
+    std::valarray<SC> refSpectrumUpsampled(length * ovsSize);
+    std::valarray<SC> secSpectrumUpsampled(length * ovsSize);
+    std::valarray<SC> refUpsampled(length * ovsSize);
+    std::valarray<SC> secUpsampled(length * ovsSize);
+    isce3::signal::Signal<float> refSignal, secSignal;
+    refSignal.forwardRangeFFT(ref, refSpectrum, fft_size, length);
+    refSignal.inverseRangeFFT(refSpectrumUpsampled, refUpsampled, ovsSize,
+            length);
+    secSignal.forwardRangeFFT(sec, secSpectrum, fft_size, length);
+    secSignal.inverseRangeFFT(secSpectrumUpsampled, secUpsampled, ovsSize,
+            length);
+    for (size_t i = 0; i < length; ++i) {
+        ref[std::slice(i * fft_size, width, 1)] =
+                refSlc[std::slice(i * width, width, 1)];
+        sec[std::slice(i * fft_size, width, 1)] =
+                secSlc[std::slice(i * width, width, 1)];
+    }
+
+    // linear phase of the sub-pixel shift of the look-down
+    std::valarray<double> frequencies(ovsSize);
+    isce3::signal::fftfreq(1.0 / oversample, frequencies);
+    const double shift = (1.0 - 1.0 / oversample) / 2.0;
+    std::valarray<SC> shiftImpact(length * ovsSize);
+    for (size_t i = 0; i < length; ++i) {
+        for (size_t j = 0; j < ovsSize; ++j) {
+            shiftImpact[i * ovsSize + j] =
+                    std::polar(1.0, -2.0 * M_PI * shift * frequencies[j]);
+        }
+    }
+
+    refSignal.upsample(ref, refUpsampled, length, fft_size, oversample,
+            shiftImpact);
+    secSignal.upsample(sec, secUpsampled, length, fft_size, oversample,
+            shiftImpact);
+
+    std::valarray<SC> ifg(length * width);
+    for (size_t i = 0; i < length; ++i) {
+        for (size_t j = 0; j < width; ++j) {
+            SC sum = 0;
+            for (size_t k = 0; k < oversample; ++k) {
+                const size_t index = i * ovsSize + j * oversample + k;
+                sum += refUpsampled[index] * std::conj(secUpsampled[index]);
+            }
+            ifg[i * width + j] = sum / float(oversample);
+        }
+    }
+
+    isce3::signal::Looks<float> looks;
+    looks.nrows(length);
+    looks.ncols(width);
+    looks.rowsLooks(azLooks);
+    looks.colsLooks(rngLooks);
+    looks.nrowsLooked(length / azLooks);
+    looks.ncolsLooked(width / rngLooks);
+    looks.multilook(ifg, ifgLooked);
+
+    std::valarray<float> refPower, secPower;
+    looks.ncols(ovsSize);
+    looks.colsLooks(oversample * rngLooks);
+    looks.multilook(refUpsampled, refPower, 2);
+    looks.multilook(secUpsampled, secPower, 2);
+
+    cohLooked.resize(ifgLooked.size());
+    for (size_t i = 0; i < ifgLooked.size(); ++i)
+        cohLooked[i] = std::abs(ifgLooked[i]) /
+                       std::sqrt(refPower[i] * secPower[i]);
+}
+
+TEST(Crossmul, OversampledMultilookedReference)
+{
+    // This test checks the oversampled and multilooked interferogram and
+    // coherence streamed through the block pipeline against the formation
+    // of the whole image used before it.
+
+    const size_t length = 53, width = 50;
+    const size_t oversample = 2, rngLooks = 3, azLooks = 4;
+    const size_t lengthLooked = length / azLooks;
+    const size_t widthLooked = width / rngLooks;
+
+    auto refSlc = syntheticSlc(length, width, 1.0);
+    auto secSlc = syntheticSlc(length, width, 0.8);
+    isce3::io::Raster refRaster("crossmul_ref_synthetic.slc", width, length,
+                                1, GDT_CFloat32, "ENVI");
+    isce3::io::Raster secRaster("crossmul_sec_synthetic.slc", width, length,
+                                1, GDT_CFloat32, "ENVI");
+    refRaster.setBlock(refSlc, 0, 0, width, length);
+    secRaster.setBlock(secSlc, 0, 0, width, length);
+
+    std::valarray<std::complex<float>> refIfg;
+    std::valarray<float> refCoh;
+    referenceCrossmul(refSlc, secSlc, length, width, oversample, rngLooks,
+            azLooks, refIfg, refCoh);
+
+    for (const bool overlap : {false, true}) {
+        std::string vsimem_igram = "/vsimem/" + getTempString("crossmul_igram");
+        std::string vsimem_coh = "/vsimem/" + getTempString("crossmul_coh");
+        isce3::io::Raster interferogram(vsimem_igram, widthLooked,
+                lengthLooked, 1, GDT_CFloat32, "ENVI");
+        isce3::io::Raster coherence(vsimem_coh, widthLooked, lengthLooked, 1,
+                GDT_Float32, "ENVI");
+
+        isce3::signal::Crossmul crsmul;
+        crsmul.rangeLooks(rngLooks);
+        crsmul.azimuthLooks(azLooks);
+        crsmul.oversampleFactor(oversample);
+        // several blocks, the last one partial
+        crsmul.linesPerBlock(3 * azLooks);
+        crsmul.overlapIO(overlap);
+
+        crsmul.crossmul(refRaster, secRaster, interferogram, coherence);
+
+        std::valarray<std::complex<float>> ifg(lengthLooked * widthLooked);
+        std::valarray<float> coh(lengthLooked * widthLooked);
+        interferogram.getBlock(ifg, 0, 0, widthLooked, lengthLooked);
+        coherence.getBlock(coh, 0, 0, widthLooked, lengthLooked);
+
+        for (size_t i = 0; i < ifg.size(); ++i) {
+            ASSERT_LT(std::abs(ifg[i] - refIfg[i]),
+                    1.0e-4 * (1.0 + std::abs(refIfg[i])))
+                    << "pixel " << i << ", overlap " << overlap;
+            ASSERT_NEAR(coh[i], refCoh[i], 1.0e-4)
+                    << "pixel " << i << ", overlap " << overlap;
+        }
+    }
+}
+
+TEST(Crossmul, OutputSharingInputDataset)
+{
+    // This test writes the full-resolution interferogram over the reference
+    // SLC, through a raster opened separately on the same file. The
+    // overlap of the I/O must then be disabled so that no block is
+    // overwritten before it is read.
+
+    const size_t length = 37, width = 20;
+    auto refSlc = syntheticSlc(length, width, 1.0);
+    auto secSlc = syntheticSlc(length, width, 0.8);
+
+    isce3::io::Raster secRaster("crossmul_shared_sec.slc", width, length, 1,
+                                GDT_CFloat32, "ENVI");
+    secRaster.setBlock(secSlc, 0, 0, width, length);
+    {
+        isce3::io::Raster refRaster("crossmul_shared_ref.slc", width, length,
+                                    1, GDT_CFloat32, "ENVI");
+        refRaster.setBlock(refSlc, 0, 0, width, length);
+    }
+
+    std::string vsimem_coh = "/vsimem/" + getTempString("crossmul_coh");
+    isce3::io::Raster coherence(vsimem_coh, width, length, 1, GDT_Float32,
+                                "ENVI");
+
+    isce3::io::Raster refRaster("crossmul_shared_ref.slc");
+    isce3::io::Raster interferogram("crossmul_shared_ref.slc", GA_Update);
+    ASSERT_TRUE(interferogram.sharesDataset(refRaster));
+
+    isce3::signal::Crossmul crsmul;
+    crsmul.rangeLooks(1);
+    crsmul.azimuthLooks(1);
+    crsmul.linesPerBlock(5);
+    crsmul.overlapIO(true);
+    crsmul.crossmul(refRaster, secRaster, interferogram, coherence);
+
+    std::valarray<std::complex<float>> ifg(length * width);
+    interferogram.getBlock(ifg, 0, 0, width, length);
+    for (size_t i = 0; i < ifg.size(); ++i) {
+        const std::complex<float> expected = refSlc[i] * std::conj(secSlc[i]);
+        ASSERT_LT(std::abs(ifg[i] - expected),
+                1.0e-5 * (1.0 + std::abs(expected)))
+                << "pixel " << i;
+    }
+}
 
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
@@ -131,6 +131,46 @@ test_adjoint_nfft(size_t m, size_t nf, size_t fft_size)
     compare_output(nfft, xf_ref, xf);
 }
 
+// Compare batch interface with precomputed weights to one-at-a-time version.
+void
+test_batch_nfft(size_t m, size_t nf, size_t fft_size, size_t howmany)
+{
+    const size_t nt = 200;
+    std::valarray<double> times(nt);
+    std::valarray<std::complex<double>> xf(nf * howmany), xt(nt * howmany),
+        xf_adj(nf * howmany), xt_ref(nt), xf_ref(nf);
+
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, nf-1.0);
+    for (size_t i=0; i<nt; ++i) {
+        times[i] = uniform(rng);
+    }
+    for (size_t i=0; i<nf*howmany; ++i) {
+        xf[i] = normal(rng) + 1i * normal(rng);
+    }
+
+    isce3::signal::NFFT<double> nfft(m, nf, fft_size);
+    nfft.set_times(times);
+    ASSERT_EQ(nfft.size_times(), nt);
+    nfft.execute_batch(howmany, &xf[0], nf, &xt[0], nt);
+    // Use the outputs as input to the adjoint batch.
+    nfft.execute_adjoint_batch(howmany, &xt[0], nt, &xf_adj[0], nf);
+
+    for (size_t l=0; l<howmany; ++l) {
+        std::valarray<std::complex<double>> spec = xf[std::slice(l*nf, nf, 1)];
+        nfft.execute(spec, times, xt_ref);
+        std::valarray<std::complex<double>> sig = xt[std::slice(l*nt, nt, 1)];
+        nfft.execute_adjoint(sig, times, xf_ref);
+        for (size_t i=0; i<nt; ++i) {
+            EXPECT_NEAR(std::abs(xt[l*nt + i] - xt_ref[i]), 0.0, 1e-12);
+        }
+        for (size_t k=0; k<nf; ++k) {
+            EXPECT_NEAR(std::abs(xf_adj[l*nf + k] - xf_ref[k]), 0.0, 1e-9);
+        }
+    }
+}
+
 TEST(NFFT, ShortEven) { test_nfft(1,   8,   32); }
 TEST(NFFT, LongEven)  { test_nfft(4, 256, 1024); }
 TEST(NFFT, LongOdd)   { test_nfft(4, 256,  625); }
@@ -145,6 +185,21 @@ TEST(AdjointNFFT, MedEven)   { test_adjoint_nfft(2, 256, 1024); }
 TEST(AdjointNFFT, LongEven)  { test_adjoint_nfft(4, 256, 1024); }
 TEST(AdjointNFFT, LongOdd)   { test_adjoint_nfft(4, 256,  625); }
 
+TEST(BatchNFFT, Single)   { test_batch_nfft(4, 256, 1024,  1); }
+TEST(BatchNFFT, Many)     { test_batch_nfft(2,  64,  256, 37); }
+TEST(BatchNFFT, Odd)      { test_batch_nfft(4, 256,  625,  3); }
+TEST(BatchNFFT, Empty)
+{
+    isce3::signal::NFFT<double> nfft(2, 64, 256);
+    std::valarray<double> times {1.0, 2.5, 3.0};
+    nfft.set_times(times);
+    std::valarray<std::complex<double>> xf(64), xt(3);
+    ASSERT_THROW(nfft.execute_batch(0, &xf[0], 64, &xt[0], 3),
+                 isce3::except::InvalidArgument);
+    ASSERT_THROW(nfft.execute_adjoint_batch(0, &xt[0], 3, &xf[0], 64),
+                 isce3::except::InvalidArgument);
+}
+
 TEST(Kernel, Singularity)
 {
     size_t m = 1;
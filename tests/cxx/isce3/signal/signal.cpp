@@ -4,6 +4,7 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 #include <cmath>
 #include <valarray>
 #include <complex>
@@ -760,6 +761,106 @@ TEST(Signal, realDataFFT)
     ASSERT_LT(max_err_az, 1.0e-12);
 }
 
+TEST(Signal, TransposedAzimuthFFT)
+{
+    // compare the transposed azimuth FFTs with the strided ones, for a
+    // block whose sides are not multiples of the transpose tiles
+    int width = 45;
+    int length = 70;
+
+    std::valarray<std::complex<double>> data(width*length);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = std::complex<double>(std::cos(0.37*i), std::sin(0.11*i*i));
+    }
+
+    std::valarray<std::complex<double>> refSpectrum(width*length);
+    std::valarray<std::complex<double>> refInverse(width*length);
+    std::valarray<std::complex<double>> spectrum(width*length);
+    std::valarray<std::complex<double>> invertData(width*length);
+
+    isce3::signal::Signal<double> ref;
+    ref.azimuthFFTMode(isce3::signal::AzimuthFFTMode::Strided);
+    ref.forwardAzimuthFFT(data, refSpectrum, width, length);
+    ref.inverseAzimuthFFT(refSpectrum, refInverse, width, length);
+    ref.forward(data, refSpectrum);
+    ref.inverse(refSpectrum, refInverse);
+
+    isce3::signal::Signal<double> sig;
+    ASSERT_EQ(sig.azimuthFFTMode(), isce3::signal::AzimuthFFTMode::Auto);
+    sig.azimuthFFTMode(isce3::signal::AzimuthFFTMode::Transposed);
+    sig.forwardAzimuthFFT(data, spectrum, width, length);
+    sig.inverseAzimuthFFT(spectrum, invertData, width, length);
+    sig.forward(data, spectrum);
+    sig.inverse(spectrum, invertData);
+
+    double max_err_fwd = 0.0;
+    double max_err_inv = 0.0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        max_err_fwd = std::max(max_err_fwd,
+                               std::abs(spectrum[i] - refSpectrum[i]));
+        max_err_inv = std::max(max_err_inv,
+                               std::abs(invertData[i] - refInverse[i]));
+    }
+    ASSERT_LT(max_err_fwd, 1.0e-9);
+    ASSERT_LT(max_err_inv, 1.0e-9);
+
+    // in place, as the filters apply them
+    std::valarray<std::complex<double>> inPlace = data;
+    sig.forward(inPlace, inPlace);
+    sig.inverse(inPlace, inPlace);
+    double max_err_az = 0.0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        max_err_az = std::max(max_err_az,
+                              std::abs(inPlace[i] / double(length) - data[i]));
+    }
+    ASSERT_LT(max_err_az, 1.0e-12);
+}
+
+TEST(Signal, AutoAzimuthFFTMode)
+{
+    using isce3::signal::AzimuthFFTMode;
+
+    // Auto transposes blocks of at least 256 rows of at least 1024 bytes
+    isce3::signal::Signal<double> sig;
+    ASSERT_FALSE(sig.transposedAzimuthFFT(45, 300));
+    ASSERT_FALSE(sig.transposedAzimuthFFT(63, 1000));
+    ASSERT_FALSE(sig.transposedAzimuthFFT(1000, 255));
+    ASSERT_TRUE(sig.transposedAzimuthFFT(64, 256));
+
+    isce3::signal::Signal<float> sigf;
+    ASSERT_FALSE(sigf.transposedAzimuthFFT(64, 256));
+    ASSERT_TRUE(sigf.transposedAzimuthFFT(128, 256));
+
+    // the explicit modes ignore the block shape
+    sig.azimuthFFTMode(AzimuthFFTMode::Strided);
+    ASSERT_FALSE(sig.transposedAzimuthFFT(4096, 4096));
+    sig.azimuthFFTMode(AzimuthFFTMode::Transposed);
+    ASSERT_TRUE(sig.transposedAzimuthFFT(1, 1));
+
+    // a wide block picked by Auto matches the strided transform
+    const int width = 300;
+    const int length = 256;
+    std::valarray<std::complex<double>> data(width*length);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = std::complex<double>(std::cos(0.37*i), std::sin(0.11*i));
+    }
+    std::valarray<std::complex<double>> refSpectrum(width*length);
+    std::valarray<std::complex<double>> spectrum(width*length);
+
+    sig.azimuthFFTMode(AzimuthFFTMode::Strided);
+    sig.forwardAzimuthFFT(data, refSpectrum, width, length);
+    sig.forward(data, refSpectrum);
+
+    sig.azimuthFFTMode(AzimuthFFTMode::Auto);
+    sig.forwardAzimuthFFT(data, spectrum, width, length);
+    sig.forward(data, spectrum);
+
+    double max_err = 0.0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        max_err = std::max(max_err, std::abs(spectrum[i] - refSpectrum[i]));
+    }
+    ASSERT_LT(max_err, 1.0e-9);
+}
 
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
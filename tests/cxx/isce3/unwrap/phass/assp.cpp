@@ -0,0 +1,81 @@
+#include <cmath> // std::remainder, M_PI
+#include <cstdint> // uint32_t
+#include <fstream> // std::ifstream
+#include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_NEAR, testing::InitGoogleTest, RUN_ALL_TESTS
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include "isce3/unwrap/phass/PhassUnwrapper.h" // phass_unwrap
+
+// Deterministic scene: a phase ramp plus pseudo-random noise, strong enough in
+// the lower half to create over a thousand residues, with low correlation
+// strips splitting the scene into several regions.
+static void makeScene(int nrows, int ncols, std::vector<float>& phase,
+                      std::vector<float>& corr)
+{
+    phase.assign(nrows * ncols, 0.f);
+    corr.assign(nrows * ncols, 0.9f);
+    uint32_t state = 12345u;
+    auto lcg = [&]() {
+        state = 1664525u * state + 1013904223u;
+        return state;
+    };
+    for (int line = 0; line < nrows; ++line) {
+        for (int pixel = 0; pixel < ncols; ++pixel) {
+            const double noise = (lcg() / 4294967296.0 - 0.5) *
+                                 (line > nrows / 2 ? 5.0 : 1.5);
+            const double x = 0.35 * line + 0.15 * pixel + noise;
+            phase[line * ncols + pixel] =
+                    static_cast<float>(std::remainder(x, 2.0 * M_PI));
+            const bool strip = (pixel >= 55 && pixel < 60 && line < 100) ||
+                               (line >= 100 && line < 104 && pixel >= 20);
+            if (strip) {
+                corr[line * ncols + pixel] = 0.05f;
+            }
+        }
+    }
+}
+
+template<typename T>
+static std::vector<T> readFixture(const std::string& name, size_t size)
+{
+    std::vector<T> data(size);
+    std::ifstream file(TESTDATA_DIR "phass/" + name, std::ios::binary);
+    file.read(reinterpret_cast<char*>(data.data()), size * sizeof(T));
+    EXPECT_TRUE(file.good()) << name;
+    return data;
+}
+
+// The bucket queue solver must reproduce the output of the previous
+// per-distance std::queue solver, saved in the fixtures.
+TEST(ASSP, MatchesPreviousSolver)
+{
+    const int nrows = 150, ncols = 120;
+    std::vector<float> phase, corr;
+    makeScene(nrows, ncols, phase, corr);
+
+    std::vector<int> regions(nrows * ncols);
+    std::vector<float*> phaseLines(nrows), corrLines(nrows);
+    std::vector<int*> regionLines(nrows);
+    for (int i = 0; i < nrows; ++i) {
+        phaseLines[i] = &phase[i * ncols];
+        corrLines[i] = &corr[i * ncols];
+        regionLines[i] = &regions[i * ncols];
+    }
+    phass_unwrap(nrows, ncols, phaseLines.data(), corrLines.data(), nullptr,
+                 regionLines.data(), 0.2, 0.7, 50);
+
+    const auto refPhase = readFixture<float>("assp_unw.bin", nrows * ncols);
+    const auto refRegions = readFixture<int>("assp_regions.bin",
+                                             nrows * ncols);
+    for (int i = 0; i < nrows * ncols; ++i) {
+        ASSERT_EQ(regions[i], refRegions[i]) << "pixel " << i;
+        ASSERT_NEAR(phase[i], refPhase[i], 1e-4) << "pixel " << i;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2,10 +2,12 @@
 #include <complex> // std::complex, std::arg
 #include <cstdint> // uint8_t
 #include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_TRUE, testing::InitGoogleTest, RUN_ALL_TE  STS
+#include <map> // std::map
 #include <valarray> // std::valarray, std::abs
 
 #include "isce3/unwrap/phass/Phass.h" // isce3::unwrap::phass::Phass
 #include "isce3/io/Raster.h" // isce3::io::Raster
+#include "isce3/except/Error.h" // isce3::except::InvalidArgument
 
 void runPhass();
 
@@ -23,6 +25,15 @@ TEST(Phass, GetSetters)
     phassObj.minPixelsPerRegion(100);
     ASSERT_EQ(phassObj.minPixelsPerRegion(), 100);
 
+    phassObj.tileLength(512);
+    ASSERT_EQ(phassObj.tileLength(), 512);
+
+    phassObj.tileWidth(256);
+    ASSERT_EQ(phassObj.tileWidth(), 256);
+
+    phassObj.tileOverlap(64);
+    ASSERT_EQ(phassObj.tileOverlap(), 64);
+
 }
 
 
@@ -89,6 +100,95 @@ TEST(Phass, CheckConnCompLabels)
 }
 
 
+TEST(Phass, Tiled)
+{
+    constexpr size_t l = 1100;
+    constexpr size_t w = 256;
+
+    // Inputs and untiled outputs from the prior test.
+    isce3::io::Raster wrappedPhaseRaster("./intf");
+    isce3::io::Raster corrRaster("./corr");
+    isce3::io::Raster refUnwRaster("./unw");
+    isce3::io::Raster refLabelsRaster("./labels");
+    std::valarray<float> refunw(l*w);
+    refUnwRaster.getBlock(refunw, 0, 0, w, l);
+    std::valarray<int> refccl(l*w);
+    refLabelsRaster.getBlock(refccl, 0, 0, w, l);
+
+    // Tiles splitting both arms of the "U" and its base across seams.
+    isce3::io::Raster unwRaster("./unw_tiled", w, l, 1, GDT_Float32, "ENVI");
+    isce3::io::Raster labelsRaster("./labels_tiled", w, l, 1, GDT_Int32,
+                                   "ENVI");
+    isce3::unwrap::phass::Phass phassObj;
+    phassObj.tileLength(300);
+    phassObj.tileWidth(128);
+    phassObj.tileOverlap(64);
+    phassObj.unwrap(wrappedPhaseRaster, corrRaster, unwRaster, labelsRaster);
+
+    // Same connected components as the untiled solution, up to their
+    // numbering: the labels must map one to one, with 0 left unlabeled.
+    std::valarray<int> ccl(l*w);
+    labelsRaster.getBlock(ccl, 0, 0, w, l);
+    std::map<int, int> toTiled, toRef;
+    for (size_t i = 0; i < l*w; ++i)
+    {
+        ASSERT_EQ(ccl[i] == 0, refccl[i] == 0);
+        const auto a = toTiled.emplace(refccl[i], ccl[i]).first;
+        const auto b = toRef.emplace(ccl[i], refccl[i]).first;
+        ASSERT_EQ(a->second, ccl[i]);
+        ASSERT_EQ(b->second, refccl[i]);
+    }
+    ASSERT_EQ(toTiled.size(), 3u);
+
+    // Same unwrapped phase up to a constant within each component.
+    std::valarray<float> unw(l*w);
+    unwRaster.getBlock(unw, 0, 0, w, l);
+    for (int label = 1; label <= 2; ++label)
+    {
+        bool first = true;
+        float offset = 0.f;
+        for (size_t i = 0; i < l*w; ++i)
+        {
+            if (refccl[i] != label) { continue; }
+            if (first) { offset = unw[i] - refunw[i]; first = false; }
+            ASSERT_NEAR(unw[i] - refunw[i], offset, 1e-3);
+        }
+        ASSERT_FALSE(first);
+    }
+}
+
+TEST(Phass, TileOverlapTooLarge)
+{
+    isce3::io::Raster wrappedPhaseRaster("./intf");
+    isce3::io::Raster corrRaster("./corr");
+    isce3::io::Raster unwRaster("./unw_tiled");
+    isce3::io::Raster labelsRaster("./labels_tiled");
+
+    isce3::unwrap::phass::Phass phassObj;
+    phassObj.tileLength(64);
+    phassObj.tileOverlap(64);
+    ASSERT_THROW(phassObj.unwrap(wrappedPhaseRaster, corrRaster, unwRaster,
+                                 labelsRaster),
+                 isce3::except::InvalidArgument);
+}
+
+TEST(Phass, TileOverlapZero)
+{
+    isce3::io::Raster wrappedPhaseRaster("./intf");
+    isce3::io::Raster corrRaster("./corr");
+    isce3::io::Raster unwRaster("./unw_tiled");
+    isce3::io::Raster labelsRaster("./labels_tiled");
+
+    // Tiles without shared pixels cannot be merged.
+    isce3::unwrap::phass::Phass phassObj;
+    ASSERT_EQ(phassObj.tileOverlap(), 64);
+    phassObj.tileLength(300);
+    phassObj.tileOverlap(0);
+    ASSERT_THROW(phassObj.unwrap(wrappedPhaseRaster, corrRaster, unwRaster,
+                                 labelsRaster),
+                 isce3::except::InvalidArgument);
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,75 @@
+#include <cstdint> // uint32_t
+#include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_TRUE, testing::InitGoogleTest, RUN_ALL_TESTS
+#include <map> // std::map
+#include <queue> // std::queue
+#include <random> // std::mt19937
+
+#include "isce3/unwrap/phass/PixelQueue.h" // PixelQueue, BucketQueue, LineOfIndex
+
+TEST(PixelQueue, Fifo)
+{
+    PixelQueue queue(4);
+    ASSERT_TRUE(queue.empty());
+
+    for (uint32_t i = 0; i < 10; ++i) { queue.push(i); }
+    for (uint32_t i = 0; i < 5; ++i) { ASSERT_EQ(queue.pop(), i); }
+    ASSERT_EQ(queue.pushed().size(), 10);
+
+    queue.clear();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_TRUE(queue.pushed().empty());
+}
+
+TEST(BucketQueue, MatchesQueuePerDistance)
+{
+    // Distances spread over more than the ring so that it has to grow, and
+    // popped from the smallest one as in the shortest path search.
+    BucketQueue buckets(4);
+    std::map<size_t, std::queue<uint32_t>> reference;
+    std::mt19937 gen(0);
+
+    uint32_t index = 0;
+    size_t minDist = 0;
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (gen() % 3 != 0)
+        {
+            const size_t dist = minDist + gen() % 300;
+            buckets.push(dist, index);
+            reference[dist].push(index);
+            ++index;
+        }
+        else if (!reference.empty())
+        {
+            minDist = reference.begin()->first;
+            ASSERT_FALSE(buckets.empty(minDist));
+            ASSERT_EQ(buckets.pop(minDist), reference[minDist].front());
+            reference[minDist].pop();
+            if (reference[minDist].empty())
+            {
+                reference.erase(minDist);
+                ASSERT_TRUE(buckets.empty(minDist));
+            }
+        }
+        ASSERT_EQ(buckets.empty(), reference.empty());
+    }
+}
+
+TEST(LineOfIndex, MatchesDivision)
+{
+    for (uint32_t width : {1u, 2u, 3u, 7u, 1000u, 65537u, 4294967295u})
+    {
+        const LineOfIndex lineOf(width);
+        for (uint32_t index : {0u, 1u, width - 1, width, 2 * width - 1,
+                               123456789u, 4294967294u, 4294967295u})
+        {
+            ASSERT_EQ(lineOf(index), index / width);
+        }
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
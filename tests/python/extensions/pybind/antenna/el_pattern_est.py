@@ -286,3 +286,29 @@ fitted 1-way echo power pattern and antenna el cut")
         npt.assert_array_less(lka_rad, inc_rad,
                               err_msg='All incidence angles must be greater \
 than look angles for "pow_pat_2w"')
+
+    def test_methods_multi_channel(self):
+        el_pat_est = ElPatternEst(self.sr_start, self.orbit_obj,
+                                  dem_interp=self.dem_obj)
+        # two channels, the second one with a different gain
+        echo_mats = np.stack([self.echo, 2 * self.echo])
+
+        for method in (el_pat_est.power_pattern_1way,
+                       el_pat_est.power_pattern_2way):
+            pat_ref, slrg_ref, lka_ref, inc_ref, _ = method(
+                self.echo, self.sr_spacing, self.chp_rate, self.chp_dur,
+                self.az_tm_mid)
+            pat_list = method(echo_mats, self.sr_spacing, self.chp_rate,
+                              self.chp_dur, self.az_tm_mid)
+            npt.assert_equal(len(pat_list), 2,
+                             err_msg='Wrong number of channels')
+            # peak-normalized patterns do not depend on the channel gain
+            for pat, slrg, lka, inc, _ in pat_list:
+                npt.assert_allclose(pat, pat_ref, atol=1e-6,
+                                    err_msg='Wrong multi-channel pattern')
+                npt.assert_equal(slrg.size, slrg_ref.size,
+                                 err_msg='Wrong multi-channel slant range')
+                npt.assert_allclose(lka, lka_ref,
+                                    err_msg='Wrong multi-channel look angle')
+                npt.assert_allclose(inc, inc_ref,
+                                    err_msg='Wrong multi-channel inc angle')
@@ -132,6 +132,56 @@ class TestGeometryFunc:
         npt.assert_equal(convergence, True,
                          err_msg="Wrong convergence flag!")
 
+    def test_ant2rgdop_grid(self):
+        el_vec = np.deg2rad(self.el_deg + np.linspace(-2, 2, 9))
+        az_vec = np.deg2rad([-0.5, 0.0, 0.5])
+        pos_list = [self.sc_pos_ecef, self.sc_pos_ecef + [100., -50., 20.]]
+        vel_list = [self.sc_vel_ecef, self.sc_vel_ecef]
+        quat_list = [self.q_ant2ecef, self.q_ant2ecef]
+        slantrange, doppler, convergence = ant.ant2rgdop(
+            el_vec, az_vec, pos_list, vel_list, quat_list, self.wl,
+            self.dem_interp)
+
+        npt.assert_equal(slantrange.shape, (6, el_vec.size),
+                         err_msg="Wrong shape of slantrange!")
+        npt.assert_equal(convergence, True,
+                         err_msg="Wrong convergence flag!")
+
+        for itime, (pos, vel, quat) in enumerate(
+                zip(pos_list, vel_list, quat_list)):
+            for iaz, az in enumerate(az_vec):
+                sr_ref, dop_ref, _ = ant.ant2rgdop(
+                    el_vec, az, pos, vel, quat, self.wl, self.dem_interp)
+                row = itime * az_vec.size + iaz
+                npt.assert_allclose(slantrange[row], sr_ref, atol=0.5,
+                                    err_msg="Wrong slantrange!")
+                npt.assert_allclose(doppler[row], dop_ref, atol=self.atol,
+                                    err_msg="Wrong doppler!")
+
+    def test_ant2geo_grid(self):
+        el_vec = np.deg2rad(self.el_deg + np.linspace(-2, 2, 9))
+        az_vec = np.deg2rad([-0.5, 0.0, 0.5])
+        pos_list = [self.sc_pos_ecef, self.sc_pos_ecef + [100., -50., 20.]]
+        quat_list = [self.q_ant2ecef, self.q_ant2ecef]
+        lon, lat, hgt, convergence = ant.ant2geo(
+            el_vec, az_vec, pos_list, quat_list, self.dem_interp)
+
+        npt.assert_equal(convergence, True,
+                         err_msg="Wrong convergence flag!")
+
+        for itime, (pos, quat) in enumerate(zip(pos_list, quat_list)):
+            for iaz, az in enumerate(az_vec):
+                llh_list, _ = ant.ant2geo(
+                    el_vec, az, pos, quat, self.dem_interp)
+                llh_ref = np.asarray(llh_list)
+                row = itime * az_vec.size + iaz
+                npt.assert_allclose(lon[row], llh_ref[:, 0], atol=1e-7,
+                                    err_msg="Wrong longitude!")
+                npt.assert_allclose(lat[row], llh_ref[:, 1], atol=1e-7,
+                                    err_msg="Wrong latitude!")
+                npt.assert_allclose(hgt[row], llh_ref[:, 2], atol=0.5,
+                                    err_msg="Wrong height!")
+
 
 def test_range_az_to_xyz():
     # Configuration for flying north at (lat, lon) = (0, 0):
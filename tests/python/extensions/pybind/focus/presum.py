@@ -71,3 +71,41 @@ def test_unique_ids():
     desired = np.unique(ids)
     out = isce3.focus.get_unique_ids(ids)
     npt.assert_array_equal(out, desired)
+
+
+def test_presum_pulse():
+    # Variable PRI pulse times and a mask with a few gap patterns.
+    n, nr = 40, 1001
+    t = np.cumsum(1.0 + 0.1 * (np.arange(n) % 8)) / 1910.
+    tout = t[n // 2] + 0.3 / 1910.
+    acor = isce3.core.AzimuthKernel(4.0 / 1910.)
+    offset, weights = isce3.focus.get_presum_weights(acor, t, tout)
+    nw = len(weights)
+    mask = np.ones((nr, nw), dtype=bool)
+    mask[100:300, 1] = False
+    mask[250:400, nw - 1] = False
+    mask[700:, 0] = False
+    ids = isce3.focus.compute_ids_from_mask(mask)
+
+    rng = np.random.default_rng(12345)
+    N = lambda: rng.normal(size=(nw, nr))
+    raw = (N() + 1j * N()).astype("c8")
+    fd = np.linspace(800, 900, nr)
+
+    # Weights of each unique pattern computed in Python.
+    lut = dict()
+    for uid in np.unique(ids):
+        valid = (uid & (1 << np.arange(nw))).astype(bool)
+        joff, jwgt = isce3.focus.get_presum_weights(
+            acor, t[offset:offset+nw][valid], tout)
+        full = np.zeros(nw)
+        full[np.flatnonzero(valid)[joff:joff+len(jwgt)]] = jwgt
+        lut[uid] = full
+    w = isce3.focus.fill_weights(ids, lut)
+    desired = np.zeros(nr, dtype="c8")
+    isce3.focus.apply_presum_weights(desired, t[offset:offset+nw] - tout, fd,
+                                     w, raw)
+
+    out = np.zeros(nr, dtype="c8")
+    isce3.focus.presum_pulse(out, acor, t, tout, offset, ids, raw, fd)
+    npt.assert_allclose(out, desired, rtol=1e-5, atol=1e-5)
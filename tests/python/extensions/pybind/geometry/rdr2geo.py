@@ -210,3 +210,36 @@ def test_validate(unit_test_params):
             assert mean_err < tol, f"band {i_band} of {test_path} mean err fail"
 
         del test_ds
+
+
+def test_mixed_precision(unit_test_params):
+    """
+    check mixed precision topo against the double precision layers
+    """
+    slc = unit_test_params.slc
+    rdr2geo_obj = isce3.geometry.Rdr2Geo(
+        unit_test_params.radargrid, slc.getOrbit(), isce3.core.Ellipsoid(),
+        slc.getDopplerCentroid()
+    )
+    assert not rdr2geo_obj.mixed_precision
+    rdr2geo_obj.mixed_precision = True
+    assert rdr2geo_obj.mixed_precision
+
+    # run with coordinate layers only
+    length, width = unit_test_params.radargrid.shape
+    rasters = [
+        isce3.io.Raster(f"mixed_{name}.rdr", width, length, 1,
+                        gdal.GDT_Float64, "ENVI")
+        for name in "xyz"
+    ]
+    rdr2geo_obj.topo(unit_test_params.dem_raster, *rasters)
+    del rasters
+
+    # compare against the double precision layers of test_run, which are
+    # converged to the same slant range threshold
+    for name, tol in zip("xyz", [1.0e-6, 1.0e-6, 0.05]):
+        test_arr = gdal.Open(f"mixed_{name}.rdr").ReadAsArray()
+        ref_arr = gdal.Open(f"{name}.rdr").ReadAsArray()
+        err = np.abs(test_arr - ref_arr)
+        err = np.ma.masked_array(err, mask=err > 5.0)
+        assert np.mean(err) < tol, f"mixed precision {name} mean err fail"
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+import os
+import numpy as np
+from osgeo import gdal
+import isce3.ext.isce3 as isce3
+
+
+def _create_raster(outpath, array):
+    '''
+    create and return ISCE3 raster obj. containing given array
+    '''
+    driver = gdal.GetDriverByName("ENVI")
+    dir_name = os.path.dirname(outpath)
+    if not os.path.isdir(dir_name):
+        os.makedirs(dir_name)
+    length, width = array.shape
+    dset = driver.Create(outpath, width, length, 1, gdal.GDT_CFloat32)
+    if dset is None:
+        error_message = 'ERROR creating test file: ' + outpath
+        raise RuntimeError(error_message)
+    dset.GetRasterBand(1).WriteArray(array)
+    dset = None
+    return isce3.io.Raster(outpath)
+
+
+def _multilook(array, nlooks_azimuth, nlooks_range):
+    length = array.shape[0] // nlooks_azimuth
+    width = array.shape[1] // nlooks_range
+    array = array[:length * nlooks_azimuth, :width * nlooks_range]
+    return array.reshape(length, nlooks_azimuth, width,
+                         nlooks_range).mean(axis=(1, 3))
+
+
+def test_run():
+    '''
+    compare the C3 and T3 matrices with a numpy implementation
+    '''
+    width = 23
+    length = 31
+    nlooks_range = 4
+    nlooks_azimuth = 3
+    width_looked = width // nlooks_range
+    length_looked = length // nlooks_azimuth
+    error_threshold = 1e-5
+
+    rng = np.random.default_rng(0)
+    arrays = {}
+    rasters = {}
+    for pol in ['hh', 'hv', 'vh', 'vv']:
+        arrays[pol] = (rng.normal(size=(length, width)) +
+                       1j * rng.normal(size=(length, width))).astype(
+                           np.complex64)
+        rasters[pol] = _create_raster(f'polsar/covariance_{pol}.bin',
+                                      arrays[pol])
+
+    hh = arrays['hh'].astype(np.complex128)
+    vv = arrays['vv'].astype(np.complex128)
+    hv = (arrays['hv'].astype(np.complex128) + arrays['vh']) / 2
+
+    vectors = {
+        isce3.polsar.PolMatrixType.Covariance: [hh, np.sqrt(2) * hv, vv],
+        isce3.polsar.PolMatrixType.Coherency: [(hh + vv) / np.sqrt(2),
+                                               (hh - vv) / np.sqrt(2),
+                                               np.sqrt(2) * hv]}
+
+    diag_file = 'polsar/covariance_diag.bin'
+    off_diag_file = 'polsar/covariance_off_diag.bin'
+
+    for matrix_type, k in vectors.items():
+        diag_raster = isce3.io.Raster(diag_file, width_looked, length_looked,
+                                      3, gdal.GDT_Float32, "ENVI")
+        off_diag_raster = isce3.io.Raster(off_diag_file, width_looked,
+                                          length_looked, 3,
+                                          gdal.GDT_CFloat32, "ENVI")
+
+        isce3.polsar.polarimetric_matrix(
+            rasters['hh'], rasters['hv'], rasters['vh'], rasters['vv'],
+            diag_raster=diag_raster, off_diag_raster=off_diag_raster,
+            matrix_type=matrix_type, nlooks_range=nlooks_range,
+            nlooks_azimuth=nlooks_azimuth)
+        del diag_raster, off_diag_raster
+
+        diag_ds = gdal.Open(diag_file, gdal.GA_ReadOnly)
+        off_diag_ds = gdal.Open(off_diag_file, gdal.GA_ReadOnly)
+        pairs = [(diag_ds, 1, 0, 0), (diag_ds, 2, 1, 1), (diag_ds, 3, 2, 2),
+                 (off_diag_ds, 1, 0, 1), (off_diag_ds, 2, 0, 2),
+                 (off_diag_ds, 3, 1, 2)]
+        for ds, band, m, n in pairs:
+            value = ds.GetRasterBand(band).ReadAsArray()
+            expected = _multilook(k[m] * np.conj(k[n]), nlooks_azimuth,
+                                  nlooks_range)
+            max_error = np.max(np.abs(value - expected) /
+                               (1 + np.abs(expected)))
+            assert max_error < error_threshold
+
+
+if __name__ == "__main__":
+    test_run()
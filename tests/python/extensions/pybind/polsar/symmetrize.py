@@ -84,5 +84,76 @@ def test_run():
         assert(symmetrization_max_error  < symmetrization_error_threshold )
 
 
+def test_fused_products():
+    '''
+    run the single-pass symmetrization with polarimetric products
+    '''
+    width = 13
+    length = 50
+    dtype = gdal.GDT_CFloat32
+    error_threshold = 1e-5
+
+    # create input arrays and rasters
+    rng = np.random.default_rng(0)
+    arrays = {}
+    rasters = {}
+    for pol in ['hh', 'hv', 'vh', 'vv']:
+        arrays[pol] = (rng.normal(size=(length, width)) +
+                       1j * rng.normal(size=(length, width))).astype(
+                           np.complex64)
+        rasters[pol] = _create_raster(f'polsar/fused_{pol}.bin',
+                                      arrays[pol], width, length, 1, dtype,
+                                      "ENVI")
+
+    output_file = "polsar/fused_output.bin"
+    span_file = "polsar/fused_span.bin"
+    pauli_file = "polsar/fused_pauli.bin"
+    cov_file = "polsar/fused_covariance.bin"
+
+    # expected products
+    hh = arrays['hh'].astype(np.complex128)
+    vv = arrays['vv'].astype(np.complex128)
+    hv = (arrays['hv'].astype(np.complex128) + arrays['vh']) / 2
+    k = [hh, np.sqrt(2) * hv, vv]
+    expected_cov = [k[i] * np.conj(k[j]) for i in range(3)
+                    for j in range(i, 3)]
+    expected_pauli = [(hh + vv) / np.sqrt(2), (hh - vv) / np.sqrt(2),
+                      np.sqrt(2) * hv]
+    expected_span = np.abs(hh)**2 + 2 * np.abs(hv)**2 + np.abs(vv)**2
+
+    for overlap_io in [False, True]:
+        output_raster = isce3.io.Raster(output_file, width, length, 1,
+                                        dtype, "ENVI")
+        span_raster = isce3.io.Raster(span_file, width, length, 1,
+                                      gdal.GDT_Float32, "ENVI")
+        pauli_raster = isce3.io.Raster(pauli_file, width, length, 3,
+                                       dtype, "ENVI")
+        cov_raster = isce3.io.Raster(cov_file, width, length, 6, dtype,
+                                     "ENVI")
+
+        isce3.polsar.symmetrize_cross_pol_channels(
+            rasters['hh'], rasters['hv'], rasters['vh'], rasters['vv'],
+            output_raster=output_raster, span_raster=span_raster,
+            pauli_raster=pauli_raster, covariance_raster=cov_raster,
+            memory_mode=isce3.core.MemoryModeBlocksY.MultipleBlocksY,
+            overlap_io=overlap_io)
+        del output_raster, span_raster, pauli_raster, cov_raster
+
+        def read_bands(path):
+            ds = gdal.Open(path, gdal.GA_ReadOnly)
+            return [ds.GetRasterBand(b + 1).ReadAsArray()
+                    for b in range(ds.RasterCount)]
+
+        pairs = list(zip(read_bands(output_file), [hv]))
+        pairs += list(zip(read_bands(span_file), [expected_span]))
+        pairs += list(zip(read_bands(pauli_file), expected_pauli))
+        pairs += list(zip(read_bands(cov_file), expected_cov))
+        for value, expected in pairs:
+            max_error = np.max(np.abs(value - expected) /
+                               (1 + np.abs(expected)))
+            assert max_error < error_threshold
+
+
 if __name__ == "__main__":
     test_run()
+    test_fused_products()
@@ -0,0 +1,27 @@
+import numpy as np
+import numpy.testing as npt
+import isce3.ext.isce3 as isce3
+
+
+def test_nfft_batch():
+    m, nf, fft_size = 4, 64, 256
+    howmany, nt = 5, 100
+    rng = np.random.default_rng(1234)
+    times = np.sort(rng.uniform(0.0, nf - 1.0, nt))
+    spectra = rng.normal(size=(howmany, nf)) + 1j * rng.normal(size=(howmany, nf))
+    signals = rng.normal(size=(howmany, nt)) + 1j * rng.normal(size=(howmany, nt))
+
+    nfft = isce3.signal.NFFT(m, nf, fft_size)
+    nfft.set_times(times)
+    assert nfft.size_times == nt
+    assert nfft.size_spectrum == nf
+
+    # Equivalent DFT matrix.
+    f = np.fft.fftfreq(nf)
+    dft = np.exp(2j * np.pi * times[:, None] * f[None, :])
+
+    out = nfft.execute_batch(spectra)
+    npt.assert_allclose(out, spectra @ dft.T / nf, atol=1e-6)
+
+    adj = nfft.execute_adjoint_batch(signals)
+    npt.assert_allclose(adj, signals @ dft.conj(), atol=1e-5)
@@ -62,6 +62,15 @@ def test_getter_setter():
     phass.min_pixels_region = 100
     npt.assert_equal(phass.min_pixels_region, 100)
 
+    phass.tile_length = 512
+    npt.assert_equal(phass.tile_length, 512)
+
+    phass.tile_width = 256
+    npt.assert_equal(phass.tile_width, 256)
+
+    phass.tile_overlap = 64
+    npt.assert_equal(phass.tile_overlap, 64)
+
 
 def test_run_phass():
     # Create interferogram and coherence
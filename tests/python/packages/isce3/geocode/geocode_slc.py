@@ -771,3 +771,64 @@ def test_subswath_masking(unit_test_params):
             # percentile
             assert(np.all(in_subswath_mask_bounds),
                    f"{test_case.output_path} with not all NaN")
+
+
+def test_geocode_slc_bursts(unit_test_params):
+    '''
+    geocode_slc_bursts must match geocode_slc run once per burst, both with
+    separate outputs per burst and with bursts mosaicked into one output
+    '''
+    out_shape = (unit_test_params.geogrid.length,
+                 unit_test_params.geogrid.width)
+    common_kwargs = dict(dem_raster=unit_test_params.dem_raster,
+                         geogrid=unit_test_params.geogrid,
+                         orbit=unit_test_params.orbit,
+                         ellipsoid=isce3.core.Ellipsoid(),
+                         threshold_geo2rdr=1.0e-9,
+                         num_iter_geo2rdr=25,
+                         flatten=False)
+
+    # one burst per test SLC, each with the full radar grid
+    rdr_data = {}
+    for axis in 'xy':
+        ds = gdal.Open(os.path.join(iscetest.data, f"geocodeslc/{axis}.slc"),
+                       gdal.GA_ReadOnly)
+        rdr_data[axis] = ds.GetRasterBand(1).ReadAsArray()
+
+    # reference: one geocode_slc call per burst
+    ref_data = {}
+    for axis in 'xy':
+        ref_data[axis] = np.zeros(out_shape, dtype=np.complex64)
+        isce3.geocode.geocode_slc(
+            geo_data_blocks=ref_data[axis],
+            rdr_data_blocks=rdr_data[axis],
+            radargrid=unit_test_params.radargrid,
+            native_doppler=unit_test_params.native_doppler,
+            image_grid_doppler=unit_test_params.img_doppler,
+            **common_kwargs)
+        assert np.any(np.isfinite(ref_data[axis]))
+
+    # separate outputs per burst
+    geo_data = {axis: np.zeros(out_shape, dtype=np.complex64)
+                for axis in 'xy'}
+    mask_data = {axis: np.zeros(out_shape, dtype=np.ubyte) for axis in 'xy'}
+    bursts = [dict(geo_data_blocks=geo_data[axis],
+                   rdr_data_blocks=rdr_data[axis],
+                   mask_block=mask_data[axis],
+                   radargrid=unit_test_params.radargrid,
+                   native_doppler=unit_test_params.native_doppler,
+                   image_grid_doppler=unit_test_params.img_doppler)
+              for axis in 'xy']
+    isce3.geocode.geocode_slc_bursts(bursts, **common_kwargs)
+    for axis in 'xy':
+        np.testing.assert_allclose(geo_data[axis], ref_data[axis],
+                                   rtol=1e-6, equal_nan=True)
+
+    # both bursts mosaicked into one output: the later burst wins
+    mosaic = np.zeros(out_shape, dtype=np.complex64)
+    for burst in bursts:
+        burst['geo_data_blocks'] = mosaic
+        del burst['mask_block']
+    isce3.geocode.geocode_slc_bursts(bursts, **common_kwargs)
+    np.testing.assert_allclose(mosaic, ref_data['y'], rtol=1e-6,
+                               equal_nan=True)